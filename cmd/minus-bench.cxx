@@ -0,0 +1,250 @@
+//
+// \brief Microbenchmarks of the tracker kernels on the default Chicago data
+//
+// Each benchmark times alternative implementations of one kernel on the same
+// inputs and reports their timings and largest disagreement, so that a
+// specialized kernel can be checked against its reference.
+//
+// lsolve: the dense Eigen-based 14x14 solve kept for reference, the unrolled
+// N-generic LU used by default for any formulation, and the structured
+// solve used by the Chicago tracker, on [Hx|Ht] blocks from all start paths.
+//
+// track_mixed: tracking all paths in float with refinement and retracking in
+// double, against tracking all of them in double. Reports timings, the number
+// of REGULAR paths, whether the ground-truth solution is found, and how many
+// REGULAR endpoints disagree.
+//
+// predictor: RK4 with the heuristic step control against the Cash-Karp
+// embedded pair with PI step control and the Hermite multistep predictor, in
+// total steps, REGULAR paths and time.
+// scripts/synthdata/synthdata-bench-predictors does the same on the synthdata
+// configurations.
+//
+// prune_nonreal: steps saved by track_settings::prune_nonreal_ at a few
+// thresholds, against the real REGULAR endpoints (those that pass
+// minus_array::get_real) lost.
+//
+// retrack_failed: the paths that failed in double retracked with 4x the step
+// budget, in double and in double_double, as done by solve() when no valid
+// solution is found. Here all of them are retracked in double_double, while
+// solve() stops at track_settings::wide_retrack_max_paths_.
+//
+// \author Ricardo Fabbri
+//
+#include <cstdio>
+#include <chrono>
+#include <minus/minus.hxx>
+#include <minus/chicago14a.hxx>
+#include <minus/chicago14a-io.h>
+#include <minus/chicago-default.h>
+
+using namespace MiNuS;
+using namespace std::chrono;
+typedef double F;
+static constexpr unsigned nve = M::nve, nsols = M::nsols;
+static constexpr unsigned nblock = nve*(nve+1);
+static constexpr unsigned nrepeat = 200;
+
+// [Hx|Ht] at each start solution, t = 1/2
+static C<F> blocks[nsols][nblock] alignas(64);
+static C<F> sols[3][nsols][nve] alignas(64);
+
+template <typename Solve>
+static double
+time_lsolve(Solve solve, C<F> (*x)[nve])
+{
+  alignas(64) C<F> m[nblock];
+  auto t1 = high_resolution_clock::now();
+  for (unsigned r = 0; r < nrepeat; ++r)
+    for (unsigned s = 0; s < nsols; ++s) {
+      memcpy(m, blocks[s], sizeof(m));
+      solve(m, x[s]);
+    }
+  auto t2 = high_resolution_clock::now();
+  return duration_cast<nanoseconds>(t2-t1).count() / double(nrepeat*nsols);
+}
+
+static F
+max_diff(C<F> (*x)[nve], C<F> (*y)[nve])
+{
+  F d = 0;
+  for (unsigned s = 0; s < nsols; ++s)
+    for (unsigned i = 0; i < nve; ++i)
+      d = std::max(d, std::abs(x[s][i] - y[s][i]) / std::max(F(1), std::abs(x[s][i])));
+  return d;
+}
+
+static void
+bench_lsolve()
+{
+  alignas(64) C<F> memo[M::f::nconstants], xt[nve+1];
+  M::evaluate_constants(data::params_, memo);
+  for (unsigned s = 0; s < nsols; ++s) {
+    memcpy(xt, data::start_sols_ + s*nve, nve*sizeof(C<F>));
+    xt[nve] = 0.5;
+    eval<chicago, F>::Hxt(xt, data::params_, memo, blocks[s]);
+  }
+
+  const double dense = time_lsolve([](C<F> *m, C<F> *x) {
+      Map<Matrix<C<F>, nve, nve+1>, Aligned> mm(m);
+      lsolve<chicago, F>(mm, x);
+    }, sols[0]);
+  const double unrolled = time_lsolve([](C<F> *m, C<F> *x) {
+      lsolve_n<nve, F>(m, x);
+    }, sols[1]);
+  const double structured = time_lsolve([](C<F> *m, C<F> *x) {
+      lsolver<chicago, F>::solve(m, x);
+    }, sols[2]);
+
+  printf("lsolve %ux%u, %u blocks x %u\n", nve, nve, nsols, nrepeat);
+  printf("  dense (reference) %8.1f ns\n", dense);
+  printf("  unrolled<%u>      %8.1f ns   max rel. diff %g\n", nve, unrolled, max_diff(sols[0], sols[1]));
+  printf("  structured        %8.1f ns   max rel. diff %g\n", structured, max_diff(sols[0], sols[2]));
+}
+
+static M::solution raw[2][nsols];
+
+static double
+time_track(void (*track)(const C<F> *memo, M::solution *raw), M::solution *out)
+{
+  alignas(64) C<F> memo[M::f::nconstants];
+  M::evaluate_constants(data::params_, memo);
+  double best = 1e30;
+  for (unsigned r = 0; r < 3; ++r) {
+    for (unsigned s = 0; s < nsols; ++s) out[s] = M::solution();
+    auto t1 = high_resolution_clock::now();
+    track(memo, out);
+    auto t2 = high_resolution_clock::now();
+    best = std::min(best, (double) duration_cast<milliseconds>(t2-t1).count());
+  }
+  return best;
+}
+
+static void
+bench_track_mixed()
+{
+  const double d = time_track([](const C<F> *memo, M::solution *out) {
+      M::track_memoized(M::DEFAULT, data::start_sols_, data::params_, memo, out, 0, nsols);
+    }, raw[0]);
+  const double m = time_track([](const C<F> *memo, M::solution *out) {
+      M::track_mixed<float>(minus_core<chicago, float>::DEFAULT, M::DEFAULT,
+          data::start_sols_, data::params_, memo, out, 0, nsols);
+    }, raw[1]);
+
+  unsigned regular[2] = {0, 0}, disagree = 0;
+  for (unsigned s = 0; s < nsols; ++s) {
+    regular[0] += raw[0][s].status == M::REGULAR;
+    regular[1] += raw[1][s].status == M::REGULAR;
+    if (raw[0][s].status == M::REGULAR && raw[1][s].status == M::REGULAR) {
+      F dmax = 0;
+      for (unsigned i = 0; i < nve; ++i)
+        dmax = std::max(dmax, std::abs(raw[0][s].x[i] - raw[1][s].x[i]));
+      disagree += dmax > 1e-6;
+    }
+  }
+  io::RC_to_QT_format(data::cameras_gt_, data::cameras_gt_quat_);
+  unsigned gt[2];
+  const bool found[2] = {
+    io::probe_all_solutions(raw[0], data::cameras_gt_quat_, &gt[0]),
+    io::probe_all_solutions(raw[1], data::cameras_gt_quat_, &gt[1]) };
+  printf("track %u paths, best of 3\n", nsols);
+  printf("  double       %6.0f ms   regular %u   ground truth %s\n", d, regular[0],
+      found[0] ? "found" : "missed");
+  printf("  float+double %6.0f ms   regular %u   ground truth %s   endpoints differing %u\n", m, regular[1],
+      found[1] ? "found" : "missed", disagree);
+}
+
+static void
+bench_predictor()
+{
+  alignas(64) C<F> memo[M::f::nconstants];
+  M::evaluate_constants(data::params_, memo);
+  static M::solution out[nsols];
+  printf("predictor, track %u paths\n", nsols);
+  const char *names[4] = {"rk4", "cash_karp", "hermite", "taylor"};
+  for (unsigned p = M::RK4; p <= M::TAYLOR; ++p) {
+    M::track_settings s;
+    s.predictor_ = (M::predictor) p;
+    for (unsigned i = 0; i < nsols; ++i) out[i] = M::solution();
+    auto t1 = high_resolution_clock::now();
+    M::track_memoized(s, data::start_sols_, data::params_, memo, out, 0, nsols);
+    auto t2 = high_resolution_clock::now();
+    unsigned long steps = 0; unsigned regular = 0;
+    for (unsigned i = 0; i < nsols; ++i) {
+      steps += out[i].num_steps;
+      regular += out[i].status == M::REGULAR;
+    }
+    printf("  %-10s %6ld ms   steps %6lu   regular %u\n", names[p],
+        (long) duration_cast<milliseconds>(t2-t1).count(), steps, regular);
+  }
+}
+
+static void
+bench_prune_nonreal()
+{
+  alignas(64) C<F> memo[M::f::nconstants];
+  M::evaluate_constants(data::params_, memo);
+  static M::solution out[nsols];
+  bool real0[nsols];
+  unsigned long steps0 = 0;
+  unsigned nreal0 = 0;
+  printf("prune_nonreal, track %u paths\n", nsols);
+  for (F thr : {F(0), F(10), F(2), F(1), F(.5), F(.1)}) {
+    M::track_settings s;
+    s.prune_nonreal_ = thr;
+    for (unsigned i = 0; i < nsols; ++i) out[i] = M::solution();
+    auto t1 = high_resolution_clock::now();
+    M::track_memoized(s, data::start_sols_, data::params_, memo, out, 0, nsols);
+    auto t2 = high_resolution_clock::now();
+    unsigned long steps = 0; unsigned pruned = 0, lost = 0;
+    for (unsigned i = 0; i < nsols; ++i) {
+      F rs[nve];
+      const bool real = out[i].status == M::REGULAR && minus_array<nve,F>::get_real(out[i].x, rs);
+      if (!thr) { real0[i] = real; nreal0 += real; }
+      steps += out[i].num_steps;
+      pruned += out[i].status == M::NONREAL_PRUNED;
+      lost += real0[i] && !real;
+    }
+    if (!thr) steps0 = steps;
+    printf("  %-5g %6ld ms   steps %6lu (%4.1f%% saved)   pruned %3u   real lost %u of %u\n", double(thr),
+        (long) duration_cast<milliseconds>(t2-t1).count(), steps, 100.*(1 - double(steps)/steps0),
+        pruned, lost, nreal0);
+  }
+}
+
+template <typename FH>
+static void
+report_retrack(const char *name)
+{
+  static M::solution out[nsols];
+  memcpy(out, raw[0], sizeof(out));
+  typename minus_core<chicago, FH>::track_settings s;
+  s.max_num_steps_ *= 4;
+  auto t1 = high_resolution_clock::now();
+  const unsigned n = M::retrack_failed<FH>(s, data::start_sols_, data::params_, out, 0, nsols);
+  auto t2 = high_resolution_clock::now();
+  unsigned recovered = 0;
+  for (unsigned i = 0; i < nsols; ++i)
+    recovered += raw[0][i].status != M::REGULAR && out[i].status == M::REGULAR;
+  printf("  %-13s %6ld ms   %u of %u recovered\n", name,
+      (long) duration_cast<milliseconds>(t2-t1).count(), recovered, n);
+}
+
+static void
+bench_retrack_failed()
+{
+  printf("retrack_failed, 4x steps, of the paths failed in double above\n");
+  report_retrack<F>("double");
+  report_retrack<double_double>("double_double");
+}
+
+int
+main()
+{
+  bench_lsolve();
+  bench_track_mixed();
+  bench_predictor();
+  bench_prune_nonreal();
+  bench_retrack_failed();
+  return 0;
+}
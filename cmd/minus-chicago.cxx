@@ -59,6 +59,13 @@ print_usage()
                "  minus -h       # (or --help) : print this help message\n"
                // "  minus -r       # (or --real)  :  outputs only real solutions\n"
                "  minus -AB      # (or --two_problems) : continue between 2 given problems\n"
+               "  minus --predictor rk4|cash_karp|hermite|taylor  # path tracker predictor, default rk4\n"
+               "  minus --predictor_tolerance tol  # local error tolerance of cash_karp\n"
+               "  minus --detour_budget n  # retrack up to n failed paths on random detours, default 0\n"
+               "  minus --early_infinity  # classify paths at infinity by their growth in the end zone\n"
+               "  minus --prune_nonreal thr  # abandon paths headed to |imag| > thr in the end zone, default 0 (off).\n"
+               "                             # Can drop real solutions, the true one included: with -g it may\n"
+               "                             # then report that the solutions dont match m2\n"
             <<
   R"(-i | --image_data usage:
  
@@ -156,7 +163,7 @@ const char *output_ = "stdout";
 M::track_settings settings_;
 
 void
-print_num_steps(M::solution solutions[M::nsols])
+print_num_steps(M::solution solutions[M::nsols], unsigned discarded_steps=0)
 {
   LOG("solution id x num steps:");
   unsigned sum=0;
@@ -164,7 +171,9 @@ print_num_steps(M::solution solutions[M::nsols])
     LOG(s << " " << solutions[s].num_steps);
     sum += solutions[s].num_steps;
   }
-  LOG("total number of steps: " << sum);
+  if (discarded_steps) // by retrack_detour(), not in the per-solution counts above
+    LOG("number of steps of discarded tracks: " << discarded_steps);
+  LOG("total number of steps: " << sum + discarded_steps);
 }
 
 // Output solutions in ASCII matlab format
@@ -373,6 +382,15 @@ print_settings(const M::track_settings &settings)
   std::cerr << names[7] << " = " << settings.max_num_steps_ << std::endl;
   std::cerr << names[8] << " = " << settings.num_successes_before_increase_ << std::endl;
   std::cerr << names[9] << " = " << settings.max_corr_steps_ << std::endl;
+  std::cerr << "chord_corrector_ = " << settings.chord_corrector_ << std::endl;
+  std::cerr << "endgame_ = " << settings.endgame_ << std::endl;
+  std::cerr << "endgame_max_samples_ = " << int(settings.endgame_max_samples_) << std::endl;
+  const char *predictors[4] = {"rk4", "cash_karp", "hermite", "taylor"};
+  std::cerr << "predictor_ = " << predictors[settings.predictor_] << std::endl;
+  std::cerr << "predictor_tolerance_ = " << settings.predictor_tolerance_ << std::endl;
+  std::cerr << "detour_budget_ = " << settings.detour_budget_ << std::endl;
+  std::cerr << "early_infinity_ = " << settings.early_infinity_ << std::endl;
+  std::cerr << "prune_nonreal_ = " << settings.prune_nonreal_ << std::endl;
   std::cerr << "---------------------------------------------------------------\n";
   #endif 
 }
@@ -384,7 +402,7 @@ process_args(int argc, char **argv)
   --argc; ++argv;
   // switches that can show up only in 1st position
   
-  enum {INITIAL_ARGS, AFTER_INITIAL_ARGS, IMAGE_DATA, MAX_CORR_STEPS, EPSILON} argstate = INITIAL_ARGS;
+  enum {INITIAL_ARGS, AFTER_INITIAL_ARGS, IMAGE_DATA, MAX_CORR_STEPS, EPSILON, PREDICTOR, PREDICTOR_TOLERANCE, DETOUR_BUDGET, PRUNE_NONREAL} argstate = INITIAL_ARGS;
   bool incomplete = false;
   std::string arg;
   if (argc) {
@@ -449,6 +467,49 @@ process_args(int argc, char **argv)
         continue;
       }
 
+      if (argstate == PREDICTOR) {
+        if (arg == "rk4")
+          settings_.predictor_ = M::RK4;
+        else if (arg == "cash_karp")
+          settings_.predictor_ = M::CASH_KARP;
+        else if (arg == "hermite")
+          settings_.predictor_ = M::HERMITE;
+        else if (arg == "taylor")
+          settings_.predictor_ = M::TAYLOR;
+        else {
+          std::cerr << "minus: \033[1;91m error\e[m\n - unknown predictor " << arg << std::endl;
+          print_usage();
+        }
+        --argc; ++argv;
+        argstate = AFTER_INITIAL_ARGS;
+        incomplete = false;
+        continue;
+      }
+      
+      if (argstate == PREDICTOR_TOLERANCE) {
+        settings_.predictor_tolerance_ = std::stod(arg);
+        --argc; ++argv;
+        argstate = AFTER_INITIAL_ARGS;
+        incomplete = false;
+        continue;
+      }
+
+      if (argstate == DETOUR_BUDGET) {
+        settings_.detour_budget_ = std::stoi(arg);
+        --argc; ++argv;
+        argstate = AFTER_INITIAL_ARGS;
+        incomplete = false;
+        continue;
+      }
+
+      if (argstate == PRUNE_NONREAL) {
+        settings_.prune_nonreal_ = std::stod(arg);
+        --argc; ++argv;
+        argstate = AFTER_INITIAL_ARGS;
+        incomplete = false;
+        continue;
+      }
+
       // argstate == AFTER_INITIAL_ARGS ----------------------------------------
       if (arg == "--max_corr_steps") {
         --argc; ++argv;
@@ -462,6 +523,35 @@ process_args(int argc, char **argv)
         incomplete = true;
         continue;
       }
+      if (arg == "--predictor") {
+        --argc; ++argv;
+        argstate = PREDICTOR;
+        incomplete = true;
+        continue;
+      }
+      if (arg == "--predictor_tolerance") {
+        --argc; ++argv;
+        argstate = PREDICTOR_TOLERANCE;
+        incomplete = true;
+        continue;
+      }
+      if (arg == "--detour_budget") {
+        --argc; ++argv;
+        argstate = DETOUR_BUDGET;
+        incomplete = true;
+        continue;
+      }
+      if (arg == "--early_infinity") {
+        --argc; ++argv;
+        settings_.early_infinity_ = true;
+        continue;
+      }
+      if (arg == "--prune_nonreal") {
+        --argc; ++argv;
+        argstate = PRUNE_NONREAL;
+        incomplete = true;
+        continue;
+      }
       std::cerr << "minus: \033[1;91m error\e[m\n - unrecognized argument " << arg << std::endl;;
       print_usage();
     }
@@ -525,20 +615,23 @@ main(int argc, char **argv)
       std::cerr << "LOG \033[0;33mStarting path tracker from random initial solution to given problem\e[m\n" << std::endl;
     #endif 
     std::thread t[4];
+    unsigned discarded_steps = 0;
     high_resolution_clock::time_point t1 = high_resolution_clock::now();
     //  unsigned retval = 
     //  ptrack(&MINUS_DEFAULT, start_sols_, params_, solutions);
     {
-      t[0] = std::thread(M::track, settings_, data::start_sols_, data::params_, solutions, 0, 78);
-      t[1] = std::thread(M::track, settings_, data::start_sols_, data::params_, solutions, 78, 78*2);
-      t[2] = std::thread(M::track, settings_, data::start_sols_, data::params_, solutions, 78*2, 78*3);
-      t[3] = std::thread(M::track, settings_, data::start_sols_, data::params_, solutions, 78*3, 78*4);
+      M::path_scheduler sched(0, M::nsols);
+      alignas(64) complex memo[M::f::nconstants];
+      M::evaluate_constants(data::params_, memo);
+      for (auto &thr : t)
+        thr = std::thread(M::track_scheduled, settings_, data::start_sols_, data::params_, memo, solutions, &sched);
       t[0].join(); t[1].join(); t[2].join(); t[3].join();
+      M::retrack_detour(settings_, data::start_sols_, data::params_, solutions, 0, M::nsols, &discarded_steps);
     }
     high_resolution_clock::time_point t2 = high_resolution_clock::now();
     auto duration = duration_cast<milliseconds>(t2 - t1).count();
     #ifdef M_VERBOSE
-    print_num_steps(solutions);
+    print_num_steps(solutions, discarded_steps);
     std::cerr << "LOG \033[1;32mTime of solver: " << duration << "ms\e[m" << std::endl;
     #endif
   }
@@ -594,21 +687,24 @@ main(int argc, char **argv)
     std::cerr << "LOG \033[0;33mStarting path tracker from A to B\e[m\n" << std::endl;
     #endif 
     std::thread t[4];
+    unsigned discarded_steps = 0;
     high_resolution_clock::time_point t1 = high_resolution_clock::now();
 
     //  unsigned retval = 
     //  ptrack(&MINUS_DEFAULT, start_sols_, params_, solutions);
     {
-      t[0] = std::thread(M::track, settings_, sols_A, data::params_, solutions, 0, 78);
-      t[1] = std::thread(M::track, settings_, sols_A, data::params_, solutions, 78, 78*2);
-      t[2] = std::thread(M::track, settings_, sols_A, data::params_, solutions, 78*2, 78*3);
-      t[3] = std::thread(M::track, settings_, sols_A, data::params_, solutions, 78*3, 78*4);
+      M::path_scheduler sched(0, M::nsols);
+      alignas(64) complex memo[M::f::nconstants];
+      M::evaluate_constants(data::params_, memo);
+      for (auto &thr : t)
+        thr = std::thread(M::track_scheduled, settings_, sols_A, data::params_, memo, solutions, &sched);
       t[0].join(); t[1].join(); t[2].join(); t[3].join();
+      M::retrack_detour(settings_, sols_A, data::params_, solutions, 0, M::nsols, &discarded_steps);
     }
     high_resolution_clock::time_point t2 = high_resolution_clock::now();
     auto duration = duration_cast<milliseconds>(t2 - t1).count();
     #ifdef M_VERBOSE
-    print_num_steps(solutions);
+    print_num_steps(solutions, discarded_steps);
     std::cerr << "LOG \033[1;32mTime of solver A -> B: " << duration << "ms\e[m" << std::endl;
     #endif
   }
@@ -0,0 +1,204 @@
+//
+// \brief Trains an order in which to track the Chicago start paths
+//
+// Generates random synthetic problems: three cameras around a unit box looking
+// at its center, and three random points in the box with random 3D tangent
+// directions, projected to normalized image coordinates. Each problem is
+// solved with all start paths, and the path that reaches the ground-truth
+// cameras (see probe_all_solutions) is counted. Start paths are then ordered
+// by decreasing count, ties broken by how often the path ends at a real
+// REGULAR solution, then by index.
+//
+// Which target solution a start path reaches depends on the gammas of the
+// homotopy, which point_tangents2params draws at random on every call. The
+// trainer draws them from minus_util<F>::rnd seeded with gamma_seed before
+// each problem, and an order is only meaningful for problems gammified the
+// same way.
+//
+// Prints the order on stdout, as an array to pass to M::path_scheduler. On
+// stderr, evaluates it on held-out problems (every 4th, the order being trained
+// on the others): the mean position of the ground-truth path when tracking in the
+// trained order and in index order, and how often it is among the first n.
+//
+// Usage: minus-train-order [num_problems [seed [gamma_seed]]]   (default 400 1 1)
+//
+// \author Ricardo Fabbri
+//
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <minus/minus.hxx>
+#include <minus/chicago14a.hxx>
+#include <minus/chicago14a-io.h>
+#include <minus/chicago-default.h>
+
+using namespace MiNuS;
+typedef double F;
+typedef minus_3d<F> vec;
+static constexpr unsigned nsols = M::nsols;
+static constexpr unsigned nviews = io::pp::nviews, npoints = io::pp::npoints;
+
+static std::mt19937 rng;
+
+static void
+rand_unit(F v[3])
+{
+  std::normal_distribution<F> g;
+  do { v[0] = g(rng); v[1] = g(rng); v[2] = g(rng); } while (std::sqrt(vec::dot(v, v)) < 1e-3);
+  const F n = std::sqrt(vec::dot(v, v));
+  v[0] /= n; v[1] /= n; v[2] /= n;
+}
+
+// A random problem: cameras in the rotation-center format of cameras_gt_, and
+// the points and tangents they see, in normalized image coordinates.
+// false if some view of it is too degenerate to solve.
+static bool
+rand_problem(F cams[nviews][4][3], F p[nviews][npoints][io::ncoords2d], F tgt[nviews][npoints][io::ncoords2d])
+{
+  std::uniform_real_distribution<F> u(-1, 1), d(4, 6);
+  F X[npoints][3], T[npoints][3];
+  for (unsigned k = 0; k < npoints; ++k) {
+    X[k][0] = u(rng); X[k][1] = u(rng); X[k][2] = u(rng);
+    rand_unit(T[k]);
+  }
+  for (unsigned v = 0; v < nviews; ++v) {
+    F *const C = cams[v][3], (*R)[3] = cams[v], up[3];
+    rand_unit(C);
+    const F r = d(rng);
+    C[0] *= r; C[1] *= r; C[2] *= r;
+    // rows of R: camera axes in world coordinates, z towards the box
+    R[2][0] = -C[0]/r + .1*u(rng); R[2][1] = -C[1]/r + .1*u(rng); R[2][2] = -C[2]/r + .1*u(rng);
+    const F nz = std::sqrt(vec::dot(R[2], R[2]));
+    R[2][0] /= nz; R[2][1] /= nz; R[2][2] /= nz;
+    rand_unit(up);
+    vec::cross(up, R[2], R[0]);
+    const F nx = std::sqrt(vec::dot(R[0], R[0]));
+    if (nx < 1e-3) return false;
+    R[0][0] /= nx; R[0][1] /= nx; R[0][2] /= nx;
+    vec::cross(R[2], R[0], R[1]);
+    for (unsigned k = 0; k < npoints; ++k) {
+      F Xc[3] = {0, 0, 0}, Tc[3] = {0, 0, 0};
+      for (unsigned i = 0; i < 3; ++i)
+        for (unsigned j = 0; j < 3; ++j) {
+          Xc[i] += R[i][j]*(X[k][j] - C[j]);
+          Tc[i] += R[i][j]*T[k][j];
+        }
+      if (Xc[2] < .5) return false;
+      p[v][k][0] = Xc[0]/Xc[2]; p[v][k][1] = Xc[1]/Xc[2];
+      // derivative of the projection along the tangent
+      F t0 = Tc[0]*Xc[2] - Xc[0]*Tc[2], t1 = Tc[1]*Xc[2] - Xc[1]*Tc[2];
+      const F nt = std::hypot(t0, t1);
+      if (nt < 1e-6) return false;
+      tgt[v][k][0] = t0/nt; tgt[v][k][1] = t1/nt;
+    }
+  }
+  return true;
+}
+
+struct sample {
+  unsigned gt;            // start path that reached the ground truth
+  bool real[nsols];       // start paths that ended at a real REGULAR solution
+};
+
+// trained order from the samples s with (i % 4 == skip) left out
+static void
+train(const std::vector<sample> &s, unsigned skip, unsigned short order[nsols])
+{
+  unsigned long hits[nsols] = {0}, real[nsols] = {0};
+  for (unsigned i = 0; i < s.size(); ++i) {
+    if (i % 4 == skip) continue;
+    ++hits[s[i].gt];
+    for (unsigned k = 0; k < nsols; ++k) real[k] += s[i].real[k];
+  }
+  for (unsigned k = 0; k < nsols; ++k) order[k] = k;
+  std::stable_sort(order, order + nsols, [&](unsigned short a, unsigned short b) {
+    return hits[a] != hits[b] ? hits[a] > hits[b] : real[a] > real[b]; });
+}
+
+int
+main(int argc, char **argv)
+{
+  const unsigned nproblems = argc > 1 ? atoi(argv[1]) : 400;
+  rng.seed(argc > 2 ? atoi(argv[2]) : 1);
+  const unsigned gamma_seed = argc > 3 ? atoi(argv[3]) : 1;
+  const unsigned nthreads = std::max(1u, std::thread::hardware_concurrency());
+
+  std::vector<sample> samples;
+  unsigned degenerate = 0, missed = 0;
+  static M::solution solutions[nsols];
+  while (samples.size() < nproblems) {
+    F cams[nviews][4][3], p[nviews][npoints][io::ncoords2d], tgt[nviews][npoints][io::ncoords2d];
+    alignas(64) C<F> params[2*M::f::nparams], memo[M::f::nconstants];
+    minus_util<F>::rnd.seed(gamma_seed);
+    memcpy(params, data::params_start_target_, M::f::nparams*sizeof(C<F>));
+    if (!rand_problem(cams, p, tgt) || !io::point_tangents2params(p, tgt, 0, 1, params)) {
+      ++degenerate;
+      continue;
+    }
+    M::evaluate_constants(params, memo);
+    for (auto &s : solutions) s = M::solution();
+    M::path_scheduler sched(0, nsols);
+    std::vector<std::thread> t;
+    for (unsigned i = 0; i + 1 < nthreads; ++i)
+      t.emplace_back(M::track_scheduled, M::DEFAULT, data::start_sols_, params, memo, solutions, &sched);
+    M::track_scheduled(M::DEFAULT, data::start_sols_, params, memo, solutions, &sched);
+    for (auto &thr : t) thr.join();
+
+    F gt[M::nve];
+    io14::RC_to_QT_format(cams, gt);
+    sample s;
+    if (!io::probe_all_solutions(solutions, gt, &s.gt)) {
+      ++missed;
+      continue;
+    }
+    for (unsigned k = 0; k < nsols; ++k) {
+      F rs[M::nve];
+      s.real[k] = solutions[k].status == M::REGULAR && minus_array<M::nve,F>::get_real(solutions[k].x, rs);
+    }
+    samples.push_back(s);
+    if (samples.size() % 50 == 0)
+      fprintf(stderr, "%zu problems\n", samples.size());
+  }
+  fprintf(stderr, "%u problems, %u degenerate ones redrawn, %u where no path reached the ground truth\n",
+      nproblems, degenerate, missed);
+
+  // held-out evaluation
+  static constexpr unsigned firsts[] = {16, 32, 64, 156};
+  double pos[2] = {0, 0};
+  unsigned within[2][4] = {{0}}, ntest = 0;
+  for (unsigned skip = 0; skip < 4; ++skip) {
+    unsigned short order[nsols], rank[nsols];
+    train(samples, skip, order);
+    for (unsigned k = 0; k < nsols; ++k) rank[order[k]] = k;
+    for (unsigned i = skip; i < samples.size(); i += 4, ++ntest) {
+      const unsigned r[2] = {rank[samples[i].gt], samples[i].gt};
+      for (unsigned o = 0; o < 2; ++o) {
+        pos[o] += r[o] + 1;
+        for (unsigned f = 0; f < 4; ++f) within[o][f] += r[o] < firsts[f];
+      }
+    }
+  }
+  const char *names[2] = {"trained order", "index order"};
+  for (unsigned o = 0; o < 2; ++o) {
+    fprintf(stderr, "%-13s: ground truth at mean position %.1f;", names[o], pos[o]/ntest);
+    for (unsigned f = 0; f < 4; ++f)
+      fprintf(stderr, " %.0f%% in first %u", 100.*within[o][f]/ntest, firsts[f]);
+    fprintf(stderr, "\n");
+  }
+
+  unsigned short order[nsols];
+  unsigned long most = 0;
+  train(samples, 4, order);
+  for (const sample &s : samples) most += s.gt == order[0];
+  fprintf(stderr, "most frequent path reached the ground truth in %.1f%% of the problems\n", 100.*most/samples.size());
+  printf("// Start paths by decreasing frequency of reaching the ground truth on %u\n", nproblems);
+  printf("// synthetic problems, by minus-train-order %u %s %u.\n", nproblems, argc > 2 ? argv[2] : "1", gamma_seed);
+  printf("static const unsigned short start_sols_order[%u] = {", nsols);
+  for (unsigned k = 0; k < nsols; ++k)
+    printf("%s%u%s", k % 16 ? " " : "\n  ", order[k], k + 1 < nsols ? "," : "\n");
+  printf("};\n");
+  return 0;
+}
@@ -8,2982 +8,2868 @@
 template <typename F>
 inline __attribute__((always_inline)) void 
 eval<chicago14a, F>::
-HxH(const C<F>* __restrict ux /*x and t*/, const C<F> * __restrict uparams, C<F>* __restrict uy /*HxH*/) 
+HxH(const C<F> * __restrict ux /*x, t*/, const C<F> * __restrict uparams, C<F> * __restrict uy /*HxH*/) 
+{
+  alignas(64) C<F> memo[formulation_parameters<chicago14a>::nconstants];
+  constants(uparams, memo);
+  HxH(ux, uparams, memo, uy);
+}
+
+// Same as above, reading the parameter-only values from memo, as computed
+// by constants(params, memo) once per solve.
+template <typename F>
+inline __attribute__((always_inline)) void 
+eval<chicago14a, F>::
+HxH(const C<F> * __restrict ux /*x, t*/, const C<F> * __restrict uparams, const C<F> * __restrict umemo, C<F> * __restrict uy /*HxH*/) 
 {
   const C<F> *params = reinterpret_cast<C<F> *> (__builtin_assume_aligned(uparams,64));
+  const C<F> *memo = reinterpret_cast<C<F> *> (__builtin_assume_aligned(umemo,64));
   const C<F> *x = reinterpret_cast<C<F> *> (__builtin_assume_aligned(ux,64));
   C<F> *y = reinterpret_cast<C<F> *> (__builtin_assume_aligned(uy,64));
+  __builtin_prefetch(x);
+  HxH_slp<C<F>>(x, *((F *)ux + 28), params, memo, y);
+}
+
+// -H(x,t) alone into y[0:14], for the chord corrector. The same
+// straight-line program as HxH, writing through a view that drops the Hx
+// columns, so that the gates only they need are dead code.
+template <typename F>
+inline __attribute__((always_inline)) void 
+eval<chicago14a, F>::
+H(const C<F> * __restrict ux /*x, t*/, const C<F> * __restrict uparams, const C<F> * __restrict umemo, C<F> * __restrict uy /*-H*/) 
+{
+  const C<F> *params = reinterpret_cast<C<F> *> (__builtin_assume_aligned(uparams,64));
+  const C<F> *memo = reinterpret_cast<C<F> *> (__builtin_assume_aligned(umemo,64));
+  const C<F> *x = reinterpret_cast<C<F> *> (__builtin_assume_aligned(ux,64));
+  C<F> *y = reinterpret_cast<C<F> *> (__builtin_assume_aligned(uy,64));
+  HxH_slp<C<F>>(x, *((F *)ux + 28), params, memo, tail_array<196, C<F> *>(y));
+}
+
+// -H(x(s), t + s) into y[0:14], where the x[i] are jets in s, so that y
+// holds the Taylor coefficients of -H along x(s) to order K. The same
+// straight-line program on jets, t + s being the jet {t, 1}.
+template <typename F> template <unsigned K>
+inline __attribute__((always_inline)) void 
+eval<chicago14a, F>::
+H(const jet<C<F>,K> * __restrict x, F t, const C<F> * __restrict uparams, const C<F> * __restrict umemo, jet<C<F>,K> * __restrict y /*-H*/) 
+{
+  const C<F> *params = reinterpret_cast<C<F> *> (__builtin_assume_aligned(uparams,64));
+  const C<F> *memo = reinterpret_cast<C<F> *> (__builtin_assume_aligned(umemo,64));
+  jet<C<F>,K> ts(t);
+  ts.c[1] = 1;
+  HxH_slp<jet<C<F>,K>>(x, ts, params, memo, tail_array<196, jet<C<F>,K> *>(y));
+}
 
-  const C<F> &X0 = x[0];    // q0
-  const C<F> &X1 = x[1];    // q1
-  const C<F> &X2 = x[2];    // q2
-  const C<F> &X3 = x[3];    // q3
-  const C<F> &X4 = x[4];    // q0
-  const C<F> &X5 = x[5];    // q1
-  const C<F> &X6 = x[6];    // q2
-  const C<F> &X7 = x[7];    // q3
-  const C<F> &X8 = x[8];    // transl
-  const C<F> &X9 = x[9];    // transl
-  const C<F> &X10 = x[10];  // transl
-  const C<F> &X11 = x[11];  // transl
-  const C<F> &X12 = x[12];  // transl
-  const C<F> &X13 = x[13];  // transl
-  const F &t = *((F *)ux + 28);
+// The straight-line program of HxH, generic on the scalar type T. x, params,
+// memo and y only need operator[], so the same code runs on std::complex
+// arrays, on jets and through tail_array.
+//
+// Gates depending only on params were hoisted into constants(): the
+// homotopy parameters (1-t)*p0 + t*p1 are evaluated as p0 + t*memo, with
+// memo = p1 - p0, and d/dt of them is memo itself.
+template <typename F> template <typename T, typename XV, typename TV, typename PV, typename MV, typename YV>
+inline __attribute__((always_inline)) void 
+eval<chicago14a, F>::
+HxH_slp(XV x, TV t, PV params, MV memo, YV y)
+{
+  const T &X0 = x[0];    // q0
+  const T &X1 = x[1];    // q1
+  const T &X2 = x[2];    // q2
+  const T &X3 = x[3];    // q3
+  const T &X4 = x[4];    // q0
+  const T &X5 = x[5];    // q1
+  const T &X6 = x[6];    // q2
+  const T &X7 = x[7];    // q3
+  const T &X8 = x[8];    // transl
+  const T &X9 = x[9];    // transl
+  const T &X10 = x[10];  // transl
+  const T &X11 = x[11];  // transl
+  const T &X12 = x[12];  // transl
+  const T &X13 = x[13];  // transl
   
-  const C<F> &X15 =  params[0];
-  const C<F> &X16 =  params[1];
-  const C<F> &X17 =  params[2];
-  const C<F> &X18 =  params[3];
-  const C<F> &X19 =  params[4];
-  const C<F> &X20 =  params[5];
-  const C<F> &X21 =  params[6];
-  const C<F> &X22 =  params[7];
-  const C<F> &X23 =  params[8];
-  const C<F> &X24 =  params[9];
-  const C<F> &X25 =  params[10];
-  const C<F> &X26 =  params[11];
-  const C<F> &X27 =  params[12];
-  const C<F> &X28 =  params[13];
-  const C<F> &X29 =  params[14];
-  const C<F> &X30 =  params[15];
-  const C<F> &X31 =  params[16];
-  const C<F> &X32 =  params[17];
-  const C<F> &X33 =  params[18];
-  const C<F> &X34 =  params[19];
-  const C<F> &X35 =  params[20];
-  const C<F> &X36 =  params[21];
-  const C<F> &X37 =  params[22];
-  const C<F> &X38 =  params[23];
-  const C<F> &X39 =  params[24];
-  const C<F> &X40 =  params[25];
-  const C<F> &X41 =  params[26];
-  const C<F> &X42 =  params[27];
-  const C<F> &X43 =  params[28];
-  const C<F> &X44 =  params[29];
-  const C<F> &X45 =  params[30];
-  const C<F> &X46 =  params[31];
-  const C<F> &X47 =  params[32];
-  const C<F> &X48 =  params[33];
-  const C<F> &X49 =  params[34];
-  const C<F> &X50 =  params[35];
-  const C<F> &X51 =  params[36];
-  const C<F> &X52 =  params[37];
-  const C<F> &X53 =  params[38];
-  const C<F> &X54 =  params[39];
-  const C<F> &X55 =  params[40];
-  const C<F> &X56 =  params[41];
-  const C<F> &X57 =  params[42];
-  const C<F> &X58 =  params[43];
-  const C<F> &X59 =  params[44];
-  const C<F> &X60 =  params[45];
-  const C<F> &X61 =  params[46];
-  const C<F> &X62 =  params[47];
-  const C<F> &X63 =  params[48];
-  const C<F> &X64 =  params[49];
-  const C<F> &X65 =  params[50];
-  const C<F> &X66 =  params[51];
-  const C<F> &X67 =  params[52];
-  const C<F> &X68 =  params[53];
-  const C<F> &X69 =  params[54];
-  const C<F> &X70 =  params[55];
-  const C<F> &X71 =  params[56];
-  const C<F> &X72 =  params[57];
-  const C<F> &X73 =  params[58];
-  const C<F> &X74 =  params[59];
-  const C<F> &X75 =  params[60];
-  const C<F> &X76 =  params[61];
-  const C<F> &X77 =  params[62];
-  const C<F> &X78 =  params[63];
-  const C<F> &X79 =  params[64];
-  const C<F> &X80 =  params[65];
-  const C<F> &X81 =  params[66];
-  const C<F> &X82 =  params[67];
-  const C<F> &X83 =  params[68];
-  const C<F> &X84 =  params[69];
-  const C<F> &X85 =  params[70];
-  const C<F> &X86 =  params[71];
-  const C<F> &X87 =  params[72];
-  const C<F> &X88 =  params[73];
-  const C<F> &X89 =  params[74];
-  const C<F> &X90 =  params[75];
-  const C<F> &X91 =  params[76];
-  const C<F> &X92 =  params[77];
-  const C<F> &X93 =  params[78];
-  const C<F> &X94 =  params[79];
-  const C<F> &X95 =  params[80];
-  const C<F> &X96 =  params[81];
-  const C<F> &X97 =  params[82];
-  const C<F> &X98 =  params[83];
-  const C<F> &X99 =  params[84];
-  const C<F> &X100 = params[85];
-  const C<F> &X101 = params[86];
-  const C<F> &X102 = params[87];
-  const C<F> &X103 = params[88];
-  const C<F> &X104 = params[89];
-  const C<F> &X105 = params[90];
-  const C<F> &X106 = params[91];
-  const C<F> &X107 = params[92];
-  const C<F> &X108 = params[93];
-  const C<F> &X109 = params[94];
-  const C<F> &X110 = params[95];
-  const C<F> &X111 = params[96];
-  const C<F> &X112 = params[97];
-  const C<F> &X113 = params[98];
-  const C<F> &X114 = params[99];
-  const C<F> &X115 = params[100];
-  const C<F> &X116 = params[101];
-  const C<F> &X117 = params[102];
-  const C<F> &X118 = params[103];
-  const C<F> &X119 = params[104];
-  const C<F> &X120 = params[105];
-  const C<F> &X121 = params[106];
-  const C<F> &X122 = params[107];
-  const C<F> &X123 = params[108];
-  const C<F> &X124 = params[109];
-  const C<F> &X125 = params[110];
-  const C<F> &X126 = params[111];
+  const T &X15 =  params[0];
+  const T &X16 =  params[1];
+  const T &X17 =  params[2];
+  const T &X18 =  params[3];
+  const T &X19 =  params[4];
+  const T &X20 =  params[5];
+  const T &X21 =  params[6];
+  const T &X22 =  params[7];
+  const T &X23 =  params[8];
+  const T &X24 =  params[9];
+  const T &X25 =  params[10];
+  const T &X26 =  params[11];
+  const T &X27 =  params[12];
+  const T &X28 =  params[13];
+  const T &X29 =  params[14];
+  const T &X30 =  params[15];
+  const T &X31 =  params[16];
+  const T &X32 =  params[17];
+  const T &X33 =  params[18];
+  const T &X34 =  params[19];
+  const T &X35 =  params[20];
+  const T &X36 =  params[21];
+  const T &X37 =  params[22];
+  const T &X38 =  params[23];
+  const T &X39 =  params[24];
+  const T &X40 =  params[25];
+  const T &X41 =  params[26];
+  const T &X42 =  params[27];
+  const T &X43 =  params[28];
+  const T &X44 =  params[29];
+  const T &X45 =  params[30];
+  const T &X46 =  params[31];
+  const T &X47 =  params[32];
+  const T &X48 =  params[33];
+  const T &X49 =  params[34];
+  const T &X50 =  params[35];
+  const T &X51 =  params[36];
+  const T &X52 =  params[37];
+  const T &X53 =  params[38];
+  const T &X54 =  params[39];
+  const T &X55 =  params[40];
+  const T &X56 =  params[41];
+  const T &X57 =  params[42];
+  const T &X58 =  params[43];
+  const T &X59 =  params[44];
+  const T &X60 =  params[45];
+  const T &X61 =  params[46];
+  const T &X62 =  params[47];
+  const T &X63 =  params[48];
+  const T &X64 =  params[49];
+  const T &X65 =  params[50];
+  const T &X66 =  params[51];
+  const T &X67 =  params[52];
+  const T &X68 =  params[53];
+  const T &X69 =  params[54];
+  const T &X70 =  params[55];
   
-  static constexpr F C0 = 1.;
   static constexpr F C1 = -1.;
   static constexpr F C2 = 2.;
 //  static constexpr F C3 = 0.;
-  const C<F> G0  = C1 * t;
-  const C<F> G1  = C0 + G0;
-  const C<F> G2  = G1 * X15;
-  const C<F> G3  = t * X71;
-  const C<F> G4  = G2 + G3;
-  const C<F> G5  = G1 * X21;
-  const C<F> G6  = t * X77;
-  const C<F> G7  = G5 + G6;
-  const C<F> G8  = X4 * X4;
-  const C<F> G9  = X5 * X5;
-  const C<F> G10 = G8 + G9;
-  const C<F> G11 = X6 * X6;
-  const C<F> G12 = G10 + G11;
-  const C<F> G13 = X7 * X7;
-  const C<F> G14 = G12 + G13;
-  const C<F> G15 = G14 * X11;
-  const C<F> G16 = G7 * G15;
-  const C<F> G17 = G1 * X22;
-  const C<F> G18 = t * X78;
-  const C<F> G19 = G17 + G18;
-  const C<F> G20 = G14 * X12;
-  const C<F> G21 = G19 * G20;
-  const C<F> G22 = G1 * X23;
-  const C<F> G23 = t * X79;
-  const C<F> G24 = G22 + G23;
-  const C<F> G25 = G14 * X13;
-  const C<F> G26 = G24 * G25;
-  const C<F> G27 = G16 + G21 + G26;
-  const C<F> G28 = G1 * X18;
-  const C<F> G29 = t * X74;
-  const C<F> G30 = G28 + G29;
-  const C<F> G31 = C2 * X2;
-  const C<F> G32 = G30 * G31;
-  const C<F> G33 = G1 * X19;
-  const C<F> G34 = t * X75;
-  const C<F> G35 = G33 + G34;
-  const C<F> G36 = C1 * X1;
-  const C<F> G37 = C2 * G36;
-  const C<F> G38 = G35 * G37;
-  const C<F> G39 = G1 * X20;
-  const C<F> G40 = t * X76;
-  const C<F> G41 = G39 + G40;
-  const C<F> G42 = X0 + X0;
-  const C<F> G43 = G41 * G42;
-  const C<F> G44 = G32 + G38 + G43;
-  const C<F> G45 = G27 * G44;
-  const C<F> G46 = X5 * X7;
-  const C<F> G47 = X4 * X6;
-  const C<F> G48 = G46 + G47;
-  const C<F> G49 = C2 * G48;
-  const C<F> G50 = G7 * G49;
-  const C<F> G51 = X6 * X7;
-  const C<F> G52 = X4 * X5;
-  const C<F> G53 = C1 * G52;
-  const C<F> G54 = G51 + G53;
-  const C<F> G55 = C2 * G54;
-  const C<F> G56 = G19 * G55;
-  const C<F> G57 = G8 + G13;
-  const C<F> G58 = G9 + G11;
-  const C<F> G59 = C1 * G58;
-  const C<F> G60 = G57 + G59;
-  const C<F> G61 = G24 * G60;
-  const C<F> G62 = G50 + G56 + G61;
-  const C<F> G63 = X8 * G42;
-  const C<F> G64 = G30 * G63;
-  const C<F> G65 = X9 * G42;
-  const C<F> G66 = G35 * G65;
-  const C<F> G67 = X10 * G42;
-  const C<F> G68 = G41 * G67;
-  const C<F> G69 = G64 + G66 + G68;
-  const C<F> G70 = G62 * G69;
-  const C<F> G71 = C1 * G70;
-  const C<F> G72 = G45 + G71;
-  const C<F> G73 = G4 * G72;
-  const C<F> G74 = G1 * X17;
-  const C<F> G75 = t * X73;
-  const C<F> G76 = G74 + G75;
-  const C<F> G77 = G30 * G42;
-  const C<F> G78 = C2 * X3;
-  const C<F> G79 = G35 * G78;
-  const C<F> G80 = C1 * X2;
-  const C<F> G81 = C2 * G80;
-  const C<F> G82 = G41 * G81;
-  const C<F> G83 = G77 + G79 + G82;
-  const C<F> G84 = G27 * G83;
-  const C<F> G85 = G11 + G13;
-  const C<F> G86 = C1 * G85;
-  const C<F> G87 = G10 + G86;
-  const C<F> G88 = G7 * G87;
-  const C<F> G89 = X5 * X6;
-  const C<F> G90 = X4 * X7;
-  const C<F> G91 = G89 + G90;
-  const C<F> G92 = C2 * G91;
-  const C<F> G93 = G19 * G92;
-  const C<F> G94 = C1 * G47;
-  const C<F> G95 = G46 + G94;
-  const C<F> G96 = C2 * G95;
-  const C<F> G97 = G24 * G96;
-  const C<F> G98 = G88 + G93 + G97;
-  const C<F> G99 = G98 * G69;
-  const C<F> G100 = C1 * G99;
-  const C<F> G101 = G84 + G100;
-  const C<F> G102 = G76 * G101;
-  const C<F> G103 = C1 * G102;
-  const C<F> G104 = G73 + G103;
-  const C<F> G105 = G1 * X16;
-  const C<F> G106 = t * X72;
-  const C<F> G107 = G105 + G106;
-  const C<F> G108 = G107 * G72;
-  const C<F> G109 = C1 * X3;
-  const C<F> G110 = C2 * G109;
-  const C<F> G111 = G30 * G110;
-  const C<F> G112 = G35 * G42;
-  const C<F> G113 = C2 * X1;
-  const C<F> G114 = G41 * G113;
-  const C<F> G115 = G111 + G112 + G114;
-  const C<F> G116 = G27 * G115;
-  const C<F> G117 = C1 * G90;
-  const C<F> G118 = G89 + G117;
-  const C<F> G119 = C2 * G118;
-  const C<F> G120 = G7 * G119;
-  const C<F> G121 = G8 + G11;
-  const C<F> G122 = G9 + G13;
-  const C<F> G123 = C1 * G122;
-  const C<F> G124 = G121 + G123;
-  const C<F> G125 = G19 * G124;
-  const C<F> G126 = G51 + G52;
-  const C<F> G127 = C2 * G126;
-  const C<F> G128 = G24 * G127;
-  const C<F> G129 = G120 + G125 + G128;
-  const C<F> G130 = G129 * G69;
-  const C<F> G131 = C1 * G130;
-  const C<F> G132 = G116 + G131;
-  const C<F> G133 = G76 * G132;
-  const C<F> G134 = C1 * G133;
-  const C<F> G135 = G108 + G134;
-  const C<F> G136 = G1 * X24;
-  const C<F> G137 = t * X80;
-  const C<F> G138 = G136 + G137;
-  const C<F> G139 = G1 * X30;
-  const C<F> G140 = t * X86;
-  const C<F> G141 = G139 + G140;
-  const C<F> G142 = G141 * G15;
-  const C<F> G143 = G1 * X31;
-  const C<F> G144 = t * X87;
-  const C<F> G145 = G143 + G144;
-  const C<F> G146 = G145 * G20;
-  const C<F> G147 = G1 * X32;
-  const C<F> G148 = t * X88;
-  const C<F> G149 = G147 + G148;
-  const C<F> G150 = G149 * G25;
-  const C<F> G151 = G142 + G146 + G150;
-  const C<F> G152 = G1 * X27;
-  const C<F> G153 = t * X83;
-  const C<F> G154 = G152 + G153;
-  const C<F> G155 = G154 * G31;
-  const C<F> G156 = G1 * X28;
-  const C<F> G157 = t * X84;
-  const C<F> G158 = G156 + G157;
-  const C<F> G159 = G158 * G37;
-  const C<F> G160 = G1 * X29;
-  const C<F> G161 = t * X85;
-  const C<F> G162 = G160 + G161;
-  const C<F> G163 = G162 * G42;
-  const C<F> G164 = G155 + G159 + G163;
-  const C<F> G165 = G151 * G164;
-  const C<F> G166 = G141 * G49;
-  const C<F> G167 = G145 * G55;
-  const C<F> G168 = G149 * G60;
-  const C<F> G169 = G166 + G167 + G168;
-  const C<F> G170 = G154 * G63;
-  const C<F> G171 = G158 * G65;
-  const C<F> G172 = G162 * G67;
-  const C<F> G173 = G170 + G171 + G172;
-  const C<F> G174 = G169 * G173;
-  const C<F> G175 = C1 * G174;
-  const C<F> G176 = G165 + G175;
-  const C<F> G177 = G138 * G176;
-  const C<F> G178 = G1 * X26;
-  const C<F> G179 = t * X82;
-  const C<F> G180 = G178 + G179;
-  const C<F> G181 = G154 * G42;
-  const C<F> G182 = G158 * G78;
-  const C<F> G183 = G162 * G81;
-  const C<F> G184 = G181 + G182 + G183;
-  const C<F> G185 = G151 * G184;
-  const C<F> G186 = G141 * G87;
-  const C<F> G187 = G145 * G92;
-  const C<F> G188 = G149 * G96;
-  const C<F> G189 = G186 + G187 + G188;
-  const C<F> G190 = G189 * G173;
-  const C<F> G191 = C1 * G190;
-  const C<F> G192 = G185 + G191;
-  const C<F> G193 = G180 * G192;
-  const C<F> G194 = C1 * G193;
-  const C<F> G195 = G177 + G194;
-  const C<F> G196 = G1 * X25;
-  const C<F> G197 = t * X81;
-  const C<F> G198 = G196 + G197;
-  const C<F> G199 = G198 * G176;
-  const C<F> G200 = G154 * G110;
-  const C<F> G201 = G158 * G42;
-  const C<F> G202 = G162 * G113;
-  const C<F> G203 = G200 + G201 + G202;
-  const C<F> G204 = G151 * G203;
-  const C<F> G205 = G141 * G119;
-  const C<F> G206 = G145 * G124;
-  const C<F> G207 = G149 * G127;
-  const C<F> G208 = G205 + G206 + G207;
-  const C<F> G209 = G208 * G173;
-  const C<F> G210 = C1 * G209;
-  const C<F> G211 = G204 + G210;
-  const C<F> G212 = G180 * G211;
-  const C<F> G213 = C1 * G212;
-  const C<F> G214 = G199 + G213;
-  const C<F> G215 = G1 * X33;
-  const C<F> G216 = t * X89;
-  const C<F> G217 = G215 + G216;
-  const C<F> G218 = G1 * X39;
-  const C<F> G219 = t * X95;
-  const C<F> G220 = G218 + G219;
-  const C<F> G221 = G220 * G15;
-  const C<F> G222 = G1 * X40;
-  const C<F> G223 = t * X96;
-  const C<F> G224 = G222 + G223;
-  const C<F> G225 = G224 * G20;
-  const C<F> G226 = G1 * X41;
-  const C<F> G227 = t * X97;
-  const C<F> G228 = G226 + G227;
-  const C<F> G229 = G228 * G25;
-  const C<F> G230 = G221 + G225 + G229;
-  const C<F> G231 = G1 * X36;
-  const C<F> G232 = t * X92;
-  const C<F> G233 = G231 + G232;
-  const C<F> G234 = G233 * G31;
-  const C<F> G235 = G1 * X37;
-  const C<F> G236 = t * X93;
-  const C<F> G237 = G235 + G236;
-  const C<F> G238 = G237 * G37;
-  const C<F> G239 = G1 * X38;
-  const C<F> G240 = t * X94;
-  const C<F> G241 = G239 + G240;
-  const C<F> G242 = G241 * G42;
-  const C<F> G243 = G234 + G238 + G242;
-  const C<F> G244 = G230 * G243;
-  const C<F> G245 = G220 * G49;
-  const C<F> G246 = G224 * G55;
-  const C<F> G247 = G228 * G60;
-  const C<F> G248 = G245 + G246 + G247;
-  const C<F> G249 = G233 * G63;
-  const C<F> G250 = G237 * G65;
-  const C<F> G251 = G241 * G67;
-  const C<F> G252 = G249 + G250 + G251;
-  const C<F> G253 = G248 * G252;
-  const C<F> G254 = C1 * G253;
-  const C<F> G255 = G244 + G254;
-  const C<F> G256 = G217 * G255;
-  const C<F> G257 = G1 * X35;
-  const C<F> G258 = t * X91;
-  const C<F> G259 = G257 + G258;
-  const C<F> G260 = G233 * G42;
-  const C<F> G261 = G237 * G78;
-  const C<F> G262 = G241 * G81;
-  const C<F> G263 = G260 + G261 + G262;
-  const C<F> G264 = G230 * G263;
-  const C<F> G265 = G220 * G87;
-  const C<F> G266 = G224 * G92;
-  const C<F> G267 = G228 * G96;
-  const C<F> G268 = G265 + G266 + G267;
-  const C<F> G269 = G268 * G252;
-  const C<F> G270 = C1 * G269;
-  const C<F> G271 = G264 + G270;
-  const C<F> G272 = G259 * G271;
-  const C<F> G273 = C1 * G272;
-  const C<F> G274 = G256 + G273;
-  const C<F> G275 = G1 * X34;
-  const C<F> G276 = t * X90;
-  const C<F> G277 = G275 + G276;
-  const C<F> G278 = G277 * G255;
-  const C<F> G279 = G233 * G110;
-  const C<F> G280 = G237 * G42;
-  const C<F> G281 = G241 * G113;
-  const C<F> G282 = G279 + G280 + G281;
-  const C<F> G283 = G230 * G282;
-  const C<F> G284 = G220 * G119;
-  const C<F> G285 = G224 * G124;
-  const C<F> G286 = G228 * G127;
-  const C<F> G287 = G284 + G285 + G286;
-  const C<F> G288 = G287 * G252;
-  const C<F> G289 = C1 * G288;
-  const C<F> G290 = G283 + G289;
-  const C<F> G291 = G259 * G290;
-  const C<F> G292 = C1 * G291;
-  const C<F> G293 = G278 + G292;
-  const C<F> G294 = G1 * X42;
-  const C<F> G295 = t * X98;
-  const C<F> G296 = G294 + G295;
-  const C<F> G297 = G296 * G4;
-  const C<F> G298 = G1 * X43;
-  const C<F> G299 = t * X99;
-  const C<F> G300 = G298 + G299;
-  const C<F> G301 = G300 * G138;
-  const C<F> G302 = G297 + G301;
-  const C<F> G303 = G1 * X46;
-  const C<F> G304 = t * X102;
-  const C<F> G305 = G303 + G304;
-  const C<F> G306 = G305 * G7;
-  const C<F> G307 = G1 * X47;
-  const C<F> G308 = t * X103;
-  const C<F> G309 = G307 + G308;
-  const C<F> G310 = G309 * G141;
-  const C<F> G311 = G306 + G310;
-  const C<F> G312 = G311 * G15;
-  const C<F> G313 = G305 * G19;
-  const C<F> G314 = G309 * G145;
-  const C<F> G315 = G313 + G314;
-  const C<F> G316 = G315 * G20;
-  const C<F> G317 = G305 * G24;
-  const C<F> G318 = G309 * G149;
-  const C<F> G319 = G317 + G318;
-  const C<F> G320 = G319 * G25;
-  const C<F> G321 = G312 + G316 + G320;
-  const C<F> G322 = G1 * X44;
-  const C<F> G323 = t * X100;
-  const C<F> G324 = G322 + G323;
-  const C<F> G325 = G324 * G30;
-  const C<F> G326 = G1 * X45;
-  const C<F> G327 = t * X101;
-  const C<F> G328 = G326 + G327;
-  const C<F> G329 = G328 * G154;
-  const C<F> G330 = G325 + G329;
-  const C<F> G331 = G330 * G31;
-  const C<F> G332 = G324 * G35;
-  const C<F> G333 = G328 * G158;
-  const C<F> G334 = G332 + G333;
-  const C<F> G335 = G334 * G37;
-  const C<F> G336 = G324 * G41;
-  const C<F> G337 = G328 * G162;
-  const C<F> G338 = G336 + G337;
-  const C<F> G339 = G338 * G42;
-  const C<F> G340 = G331 + G335 + G339;
-  const C<F> G341 = G321 * G340;
-  const C<F> G342 = G311 * G49;
-  const C<F> G343 = G315 * G55;
-  const C<F> G344 = G319 * G60;
-  const C<F> G345 = G342 + G343 + G344;
-  const C<F> G346 = G330 * G63;
-  const C<F> G347 = G334 * G65;
-  const C<F> G348 = G338 * G67;
-  const C<F> G349 = G346 + G347 + G348;
-  const C<F> G350 = G345 * G349;
-  const C<F> G351 = C1 * G350;
-  const C<F> G352 = G341 + G351;
-  const C<F> G353 = G302 * G352;
-  const C<F> G354 = G296 * G76;
-  const C<F> G355 = G300 * G180;
-  const C<F> G356 = G354 + G355;
-  const C<F> G357 = G330 * G42;
-  const C<F> G358 = G334 * G78;
-  const C<F> G359 = G338 * G81;
-  const C<F> G360 = G357 + G358 + G359;
-  const C<F> G361 = G321 * G360;
-  const C<F> G362 = G311 * G87;
-  const C<F> G363 = G315 * G92;
-  const C<F> G364 = G319 * G96;
-  const C<F> G365 = G362 + G363 + G364;
-  const C<F> G366 = G365 * G349;
-  const C<F> G367 = C1 * G366;
-  const C<F> G368 = G361 + G367;
-  const C<F> G369 = G356 * G368;
-  const C<F> G370 = C1 * G369;
-  const C<F> G371 = G353 + G370;
-  const C<F> G372 = G296 * G107;
-  const C<F> G373 = G300 * G198;
-  const C<F> G374 = G372 + G373;
-  const C<F> G375 = G374 * G352;
-  const C<F> G376 = G330 * G110;
-  const C<F> G377 = G334 * G42;
-  const C<F> G378 = G338 * G113;
-  const C<F> G379 = G376 + G377 + G378;
-  const C<F> G380 = G321 * G379;
-  const C<F> G381 = G311 * G119;
-  const C<F> G382 = G315 * G124;
-  const C<F> G383 = G319 * G127;
-  const C<F> G384 = G381 + G382 + G383;
-  const C<F> G385 = G384 * G349;
-  const C<F> G386 = C1 * G385;
-  const C<F> G387 = G380 + G386;
-  const C<F> G388 = G356 * G387;
-  const C<F> G389 = C1 * G388;
-  const C<F> G390 = G375 + G389;
-  const C<F> G391 = G1 * X48;
-  const C<F> G392 = t * X104;
-  const C<F> G393 = G391 + G392;
-  const C<F> G394 = G393 * G4;
-  const C<F> G395 = G1 * X49;
-  const C<F> G396 = t * X105;
-  const C<F> G397 = G395 + G396;
-  const C<F> G398 = G397 * G217;
-  const C<F> G399 = G394 + G398;
-  const C<F> G400 = G1 * X52;
-  const C<F> G401 = t * X108;
-  const C<F> G402 = G400 + G401;
-  const C<F> G403 = G402 * G7;
-  const C<F> G404 = G1 * X53;
-  const C<F> G405 = t * X109;
-  const C<F> G406 = G404 + G405;
-  const C<F> G407 = G406 * G220;
-  const C<F> G408 = G403 + G407;
-  const C<F> G409 = G408 * G15;
-  const C<F> G410 = G402 * G19;
-  const C<F> G411 = G406 * G224;
-  const C<F> G412 = G410 + G411;
-  const C<F> G413 = G412 * G20;
-  const C<F> G414 = G402 * G24;
-  const C<F> G415 = G406 * G228;
-  const C<F> G416 = G414 + G415;
-  const C<F> G417 = G416 * G25;
-  const C<F> G418 = G409 + G413 + G417;
-  const C<F> G419 = G1 * X50;
-  const C<F> G420 = t * X106;
-  const C<F> G421 = G419 + G420;
-  const C<F> G422 = G421 * G30;
-  const C<F> G423 = G1 * X51;
-  const C<F> G424 = t * X107;
-  const C<F> G425 = G423 + G424;
-  const C<F> G426 = G425 * G233;
-  const C<F> G427 = G422 + G426;
-  const C<F> G428 = G427 * G31;
-  const C<F> G429 = G421 * G35;
-  const C<F> G430 = G425 * G237;
-  const C<F> G431 = G429 + G430;
-  const C<F> G432 = G431 * G37;
-  const C<F> G433 = G421 * G41;
-  const C<F> G434 = G425 * G241;
-  const C<F> G435 = G433 + G434;
-  const C<F> G436 = G435 * G42;
-  const C<F> G437 = G428 + G432 + G436;
-  const C<F> G438 = G418 * G437;
-  const C<F> G439 = G408 * G49;
-  const C<F> G440 = G412 * G55;
-  const C<F> G441 = G416 * G60;
-  const C<F> G442 = G439 + G440 + G441;
-  const C<F> G443 = G427 * G63;
-  const C<F> G444 = G431 * G65;
-  const C<F> G445 = G435 * G67;
-  const C<F> G446 = G443 + G444 + G445;
-  const C<F> G447 = G442 * G446;
-  const C<F> G448 = C1 * G447;
-  const C<F> G449 = G438 + G448;
-  const C<F> G450 = G399 * G449;
-  const C<F> G451 = G393 * G76;
-  const C<F> G452 = G397 * G259;
-  const C<F> G453 = G451 + G452;
-  const C<F> G454 = G427 * G42;
-  const C<F> G455 = G431 * G78;
-  const C<F> G456 = G435 * G81;
-  const C<F> G457 = G454 + G455 + G456;
-  const C<F> G458 = G418 * G457;
-  const C<F> G459 = G408 * G87;
-  const C<F> G460 = G412 * G92;
-  const C<F> G461 = G416 * G96;
-  const C<F> G462 = G459 + G460 + G461;
-  const C<F> G463 = G462 * G446;
-  const C<F> G464 = C1 * G463;
-  const C<F> G465 = G458 + G464;
-  const C<F> G466 = G453 * G465;
-  const C<F> G467 = C1 * G466;
-  const C<F> G468 = G450 + G467;
-  const C<F> G469 = G393 * G107;
-  const C<F> G470 = G397 * G277;
-  const C<F> G471 = G469 + G470;
-  const C<F> G472 = G471 * G449;
-  const C<F> G473 = G427 * G110;
-  const C<F> G474 = G431 * G42;
-  const C<F> G475 = G435 * G113;
-  const C<F> G476 = G473 + G474 + G475;
-  const C<F> G477 = G418 * G476;
-  const C<F> G478 = G408 * G119;
-  const C<F> G479 = G412 * G124;
-  const C<F> G480 = G416 * G127;
-  const C<F> G481 = G478 + G479 + G480;
-  const C<F> G482 = G481 * G446;
-  const C<F> G483 = C1 * G482;
-  const C<F> G484 = G477 + G483;
-  const C<F> G485 = G453 * G484;
-  const C<F> G486 = C1 * G485;
-  const C<F> G487 = G472 + G486;
-  const C<F> G488 = G151 * G243;
-  const C<F> G489 = G169 * G252;
-  const C<F> G490 = C1 * G489;
-  const C<F> G491 = G488 + G490;
-  const C<F> G492 = G277 * G491;
-  const C<F> G493 = G151 * G282;
-  const C<F> G494 = G208 * G252;
-  const C<F> G495 = C1 * G494;
-  const C<F> G496 = G493 + G495;
-  const C<F> G497 = G259 * G496;
-  const C<F> G498 = C1 * G497;
-  const C<F> G499 = G492 + G498;
-  const C<F> G500 = G138 * G499;
-  const C<F> G501 = G217 * G491;
-  const C<F> G502 = G151 * G263;
-  const C<F> G503 = G189 * G252;
-  const C<F> G504 = C1 * G503;
-  const C<F> G505 = G502 + G504;
-  const C<F> G506 = G259 * G505;
-  const C<F> G507 = C1 * G506;
-  const C<F> G508 = G501 + G507;
-  const C<F> G509 = G198 * G508;
-  const C<F> G510 = C1 * G509;
-  const C<F> G511 = G500 + G510;
-  const C<F> G512 = G217 * G496;
-  const C<F> G513 = G277 * G505;
-  const C<F> G514 = C1 * G513;
-  const C<F> G515 = G512 + G514;
-  const C<F> G516 = G180 * G515;
-  const C<F> G517 = G511 + G516;
-  const C<F> G518 = G1 * X61;
-  const C<F> G519 = t * X117;
-  const C<F> G520 = G518 + G519;
-  const C<F> G521 = G30 * G78;
-  const C<F> G522 = C1 * X0;
-  const C<F> G523 = C2 * G522;
-  const C<F> G524 = G35 * G523;
-  const C<F> G525 = X1 + X1;
-  const C<F> G526 = C1 * G525;
-  const C<F> G527 = G41 * G526;
-  const C<F> G528 = G521 + G524 + G527;
-  const C<F> G529 = G27 * G528;
-  const C<F> G530 = X8 * G525;
-  const C<F> G531 = G30 * G530;
-  const C<F> G532 = X9 * G525;
-  const C<F> G533 = G35 * G532;
-  const C<F> G534 = X10 * G525;
-  const C<F> G535 = G41 * G534;
-  const C<F> G536 = G531 + G533 + G535;
-  const C<F> G537 = G62 * G536;
-  const C<F> G538 = C1 * G537;
-  const C<F> G539 = G529 + G538;
-  const C<F> G540 = G4 * G539;
-  const C<F> G541 = G30 * G525;
-  const C<F> G542 = G35 * G31;
-  const C<F> G543 = G41 * G78;
-  const C<F> G544 = G541 + G542 + G543;
-  const C<F> G545 = G27 * G544;
-  const C<F> G546 = G98 * G536;
-  const C<F> G547 = C1 * G546;
-  const C<F> G548 = G545 + G547;
-  const C<F> G549 = G76 * G548;
-  const C<F> G550 = C1 * G549;
-  const C<F> G551 = G540 + G550;
-  const C<F> G552 = G107 * G539;
-  const C<F> G553 = G35 * G526;
-  const C<F> G554 = C2 * X0;
-  const C<F> G555 = G41 * G554;
-  const C<F> G556 = G32 + G553 + G555;
-  const C<F> G557 = G27 * G556;
-  const C<F> G558 = G129 * G536;
-  const C<F> G559 = C1 * G558;
-  const C<F> G560 = G557 + G559;
-  const C<F> G561 = G76 * G560;
-  const C<F> G562 = C1 * G561;
-  const C<F> G563 = G552 + G562;
-  const C<F> G564 = G154 * G78;
-  const C<F> G565 = G158 * G523;
-  const C<F> G566 = G162 * G526;
-  const C<F> G567 = G564 + G565 + G566;
-  const C<F> G568 = G151 * G567;
-  const C<F> G569 = G154 * G530;
-  const C<F> G570 = G158 * G532;
-  const C<F> G571 = G162 * G534;
-  const C<F> G572 = G569 + G570 + G571;
-  const C<F> G573 = G169 * G572;
-  const C<F> G574 = C1 * G573;
-  const C<F> G575 = G568 + G574;
-  const C<F> G576 = G138 * G575;
-  const C<F> G577 = G154 * G525;
-  const C<F> G578 = G158 * G31;
-  const C<F> G579 = G162 * G78;
-  const C<F> G580 = G577 + G578 + G579;
-  const C<F> G581 = G151 * G580;
-  const C<F> G582 = G189 * G572;
-  const C<F> G583 = C1 * G582;
-  const C<F> G584 = G581 + G583;
-  const C<F> G585 = G180 * G584;
-  const C<F> G586 = C1 * G585;
-  const C<F> G587 = G576 + G586;
-  const C<F> G588 = G198 * G575;
-  const C<F> G589 = G158 * G526;
-  const C<F> G590 = G162 * G554;
-  const C<F> G591 = G155 + G589 + G590;
-  const C<F> G592 = G151 * G591;
-  const C<F> G593 = G208 * G572;
-  const C<F> G594 = C1 * G593;
-  const C<F> G595 = G592 + G594;
-  const C<F> G596 = G180 * G595;
-  const C<F> G597 = C1 * G596;
-  const C<F> G598 = G588 + G597;
-  const C<F> G599 = G233 * G78;
-  const C<F> G600 = G237 * G523;
-  const C<F> G601 = G241 * G526;
-  const C<F> G602 = G599 + G600 + G601;
-  const C<F> G603 = G230 * G602;
-  const C<F> G604 = G233 * G530;
-  const C<F> G605 = G237 * G532;
-  const C<F> G606 = G241 * G534;
-  const C<F> G607 = G604 + G605 + G606;
-  const C<F> G608 = G248 * G607;
-  const C<F> G609 = C1 * G608;
-  const C<F> G610 = G603 + G609;
-  const C<F> G611 = G217 * G610;
-  const C<F> G612 = G233 * G525;
-  const C<F> G613 = G237 * G31;
-  const C<F> G614 = G241 * G78;
-  const C<F> G615 = G612 + G613 + G614;
-  const C<F> G616 = G230 * G615;
-  const C<F> G617 = G268 * G607;
-  const C<F> G618 = C1 * G617;
-  const C<F> G619 = G616 + G618;
-  const C<F> G620 = G259 * G619;
-  const C<F> G621 = C1 * G620;
-  const C<F> G622 = G611 + G621;
-  const C<F> G623 = G277 * G610;
-  const C<F> G624 = G237 * G526;
-  const C<F> G625 = G241 * G554;
-  const C<F> G626 = G234 + G624 + G625;
-  const C<F> G627 = G230 * G626;
-  const C<F> G628 = G287 * G607;
-  const C<F> G629 = C1 * G628;
-  const C<F> G630 = G627 + G629;
-  const C<F> G631 = G259 * G630;
-  const C<F> G632 = C1 * G631;
-  const C<F> G633 = G623 + G632;
-  const C<F> G634 = G330 * G78;
-  const C<F> G635 = G334 * G523;
-  const C<F> G636 = G338 * G526;
-  const C<F> G637 = G634 + G635 + G636;
-  const C<F> G638 = G321 * G637;
-  const C<F> G639 = G330 * G530;
-  const C<F> G640 = G334 * G532;
-  const C<F> G641 = G338 * G534;
-  const C<F> G642 = G639 + G640 + G641;
-  const C<F> G643 = G345 * G642;
-  const C<F> G644 = C1 * G643;
-  const C<F> G645 = G638 + G644;
-  const C<F> G646 = G302 * G645;
-  const C<F> G647 = G330 * G525;
-  const C<F> G648 = G334 * G31;
-  const C<F> G649 = G338 * G78;
-  const C<F> G650 = G647 + G648 + G649;
-  const C<F> G651 = G321 * G650;
-  const C<F> G652 = G365 * G642;
-  const C<F> G653 = C1 * G652;
-  const C<F> G654 = G651 + G653;
-  const C<F> G655 = G356 * G654;
-  const C<F> G656 = C1 * G655;
-  const C<F> G657 = G646 + G656;
-  const C<F> G658 = G374 * G645;
-  const C<F> G659 = G334 * G526;
-  const C<F> G660 = G338 * G554;
-  const C<F> G661 = G331 + G659 + G660;
-  const C<F> G662 = G321 * G661;
-  const C<F> G663 = G384 * G642;
-  const C<F> G664 = C1 * G663;
-  const C<F> G665 = G662 + G664;
-  const C<F> G666 = G356 * G665;
-  const C<F> G667 = C1 * G666;
-  const C<F> G668 = G658 + G667;
-  const C<F> G669 = G427 * G78;
-  const C<F> G670 = G431 * G523;
-  const C<F> G671 = G435 * G526;
-  const C<F> G672 = G669 + G670 + G671;
-  const C<F> G673 = G418 * G672;
-  const C<F> G674 = G427 * G530;
-  const C<F> G675 = G431 * G532;
-  const C<F> G676 = G435 * G534;
-  const C<F> G677 = G674 + G675 + G676;
-  const C<F> G678 = G442 * G677;
-  const C<F> G679 = C1 * G678;
-  const C<F> G680 = G673 + G679;
-  const C<F> G681 = G399 * G680;
-  const C<F> G682 = G427 * G525;
-  const C<F> G683 = G431 * G31;
-  const C<F> G684 = G435 * G78;
-  const C<F> G685 = G682 + G683 + G684;
-  const C<F> G686 = G418 * G685;
-  const C<F> G687 = G462 * G677;
-  const C<F> G688 = C1 * G687;
-  const C<F> G689 = G686 + G688;
-  const C<F> G690 = G453 * G689;
-  const C<F> G691 = C1 * G690;
-  const C<F> G692 = G681 + G691;
-  const C<F> G693 = G471 * G680;
-  const C<F> G694 = G431 * G526;
-  const C<F> G695 = G435 * G554;
-  const C<F> G696 = G428 + G694 + G695;
-  const C<F> G697 = G418 * G696;
-  const C<F> G698 = G481 * G677;
-  const C<F> G699 = C1 * G698;
-  const C<F> G700 = G697 + G699;
-  const C<F> G701 = G453 * G700;
-  const C<F> G702 = C1 * G701;
-  const C<F> G703 = G693 + G702;
-  const C<F> G704 = G151 * G602;
-  const C<F> G705 = G169 * G607;
-  const C<F> G706 = C1 * G705;
-  const C<F> G707 = G704 + G706;
-  const C<F> G708 = G277 * G707;
-  const C<F> G709 = G151 * G626;
-  const C<F> G710 = G208 * G607;
-  const C<F> G711 = C1 * G710;
-  const C<F> G712 = G709 + G711;
-  const C<F> G713 = G259 * G712;
-  const C<F> G714 = C1 * G713;
-  const C<F> G715 = G708 + G714;
-  const C<F> G716 = G138 * G715;
-  const C<F> G717 = G217 * G707;
-  const C<F> G718 = G151 * G615;
-  const C<F> G719 = G189 * G607;
-  const C<F> G720 = C1 * G719;
-  const C<F> G721 = G718 + G720;
-  const C<F> G722 = G259 * G721;
-  const C<F> G723 = C1 * G722;
-  const C<F> G724 = G717 + G723;
-  const C<F> G725 = G198 * G724;
-  const C<F> G726 = C1 * G725;
-  const C<F> G727 = G716 + G726;
-  const C<F> G728 = G217 * G712;
-  const C<F> G729 = G277 * G721;
-  const C<F> G730 = C1 * G729;
-  const C<F> G731 = G728 + G730;
-  const C<F> G732 = G180 * G731;
-  const C<F> G733 = G727 + G732;
-  const C<F> G734 = G1 * X62;
-  const C<F> G735 = t * X118;
-  const C<F> G736 = G734 + G735;
-  const C<F> G737 = G30 * G554;
-  const C<F> G738 = X2 + X2;
-  const C<F> G739 = C1 * G738;
-  const C<F> G740 = G41 * G739;
-  const C<F> G741 = G737 + G79 + G740;
-  const C<F> G742 = G27 * G741;
-  const C<F> G743 = X8 * G738;
-  const C<F> G744 = G30 * G743;
-  const C<F> G745 = X9 * G738;
-  const C<F> G746 = G35 * G745;
-  const C<F> G747 = X10 * G738;
-  const C<F> G748 = G41 * G747;
-  const C<F> G749 = G744 + G746 + G748;
-  const C<F> G750 = G62 * G749;
-  const C<F> G751 = C1 * G750;
-  const C<F> G752 = G742 + G751;
-  const C<F> G753 = G4 * G752;
-  const C<F> G754 = G30 * G739;
-  const C<F> G755 = G35 * G113;
-  const C<F> G756 = G41 * G523;
-  const C<F> G757 = G754 + G755 + G756;
-  const C<F> G758 = G27 * G757;
-  const C<F> G759 = G98 * G749;
-  const C<F> G760 = C1 * G759;
-  const C<F> G761 = G758 + G760;
-  const C<F> G762 = G76 * G761;
-  const C<F> G763 = C1 * G762;
-  const C<F> G764 = G753 + G763;
-  const C<F> G765 = G107 * G752;
-  const C<F> G766 = G30 * G113;
-  const C<F> G767 = G35 * G738;
-  const C<F> G768 = G766 + G767 + G543;
-  const C<F> G769 = G27 * G768;
-  const C<F> G770 = G129 * G749;
-  const C<F> G771 = C1 * G770;
-  const C<F> G772 = G769 + G771;
-  const C<F> G773 = G76 * G772;
-  const C<F> G774 = C1 * G773;
-  const C<F> G775 = G765 + G774;
-  const C<F> G776 = G154 * G554;
-  const C<F> G777 = G162 * G739;
-  const C<F> G778 = G776 + G182 + G777;
-  const C<F> G779 = G151 * G778;
-  const C<F> G780 = G154 * G743;
-  const C<F> G781 = G158 * G745;
-  const C<F> G782 = G162 * G747;
-  const C<F> G783 = G780 + G781 + G782;
-  const C<F> G784 = G169 * G783;
-  const C<F> G785 = C1 * G784;
-  const C<F> G786 = G779 + G785;
-  const C<F> G787 = G138 * G786;
-  const C<F> G788 = G154 * G739;
-  const C<F> G789 = G158 * G113;
-  const C<F> G790 = G162 * G523;
-  const C<F> G791 = G788 + G789 + G790;
-  const C<F> G792 = G151 * G791;
-  const C<F> G793 = G189 * G783;
-  const C<F> G794 = C1 * G793;
-  const C<F> G795 = G792 + G794;
-  const C<F> G796 = G180 * G795;
-  const C<F> G797 = C1 * G796;
-  const C<F> G798 = G787 + G797;
-  const C<F> G799 = G198 * G786;
-  const C<F> G800 = G154 * G113;
-  const C<F> G801 = G158 * G738;
-  const C<F> G802 = G800 + G801 + G579;
-  const C<F> G803 = G151 * G802;
-  const C<F> G804 = G208 * G783;
-  const C<F> G805 = C1 * G804;
-  const C<F> G806 = G803 + G805;
-  const C<F> G807 = G180 * G806;
-  const C<F> G808 = C1 * G807;
-  const C<F> G809 = G799 + G808;
-  const C<F> G810 = G233 * G554;
-  const C<F> G811 = G241 * G739;
-  const C<F> G812 = G810 + G261 + G811;
-  const C<F> G813 = G230 * G812;
-  const C<F> G814 = G233 * G743;
-  const C<F> G815 = G237 * G745;
-  const C<F> G816 = G241 * G747;
-  const C<F> G817 = G814 + G815 + G816;
-  const C<F> G818 = G248 * G817;
-  const C<F> G819 = C1 * G818;
-  const C<F> G820 = G813 + G819;
-  const C<F> G821 = G217 * G820;
-  const C<F> G822 = G233 * G739;
-  const C<F> G823 = G237 * G113;
-  const C<F> G824 = G241 * G523;
-  const C<F> G825 = G822 + G823 + G824;
-  const C<F> G826 = G230 * G825;
-  const C<F> G827 = G268 * G817;
-  const C<F> G828 = C1 * G827;
-  const C<F> G829 = G826 + G828;
-  const C<F> G830 = G259 * G829;
-  const C<F> G831 = C1 * G830;
-  const C<F> G832 = G821 + G831;
-  const C<F> G833 = G277 * G820;
-  const C<F> G834 = G233 * G113;
-  const C<F> G835 = G237 * G738;
-  const C<F> G836 = G834 + G835 + G614;
-  const C<F> G837 = G230 * G836;
-  const C<F> G838 = G287 * G817;
-  const C<F> G839 = C1 * G838;
-  const C<F> G840 = G837 + G839;
-  const C<F> G841 = G259 * G840;
-  const C<F> G842 = C1 * G841;
-  const C<F> G843 = G833 + G842;
-  const C<F> G844 = G330 * G554;
-  const C<F> G845 = G338 * G739;
-  const C<F> G846 = G844 + G358 + G845;
-  const C<F> G847 = G321 * G846;
-  const C<F> G848 = G330 * G743;
-  const C<F> G849 = G334 * G745;
-  const C<F> G850 = G338 * G747;
-  const C<F> G851 = G848 + G849 + G850;
-  const C<F> G852 = G345 * G851;
-  const C<F> G853 = C1 * G852;
-  const C<F> G854 = G847 + G853;
-  const C<F> G855 = G302 * G854;
-  const C<F> G856 = G330 * G739;
-  const C<F> G857 = G334 * G113;
-  const C<F> G858 = G338 * G523;
-  const C<F> G859 = G856 + G857 + G858;
-  const C<F> G860 = G321 * G859;
-  const C<F> G861 = G365 * G851;
-  const C<F> G862 = C1 * G861;
-  const C<F> G863 = G860 + G862;
-  const C<F> G864 = G356 * G863;
-  const C<F> G865 = C1 * G864;
-  const C<F> G866 = G855 + G865;
-  const C<F> G867 = G374 * G854;
-  const C<F> G868 = G330 * G113;
-  const C<F> G869 = G334 * G738;
-  const C<F> G870 = G868 + G869 + G649;
-  const C<F> G871 = G321 * G870;
-  const C<F> G872 = G384 * G851;
-  const C<F> G873 = C1 * G872;
-  const C<F> G874 = G871 + G873;
-  const C<F> G875 = G356 * G874;
-  const C<F> G876 = C1 * G875;
-  const C<F> G877 = G867 + G876;
-  const C<F> G878 = G427 * G554;
-  const C<F> G879 = G435 * G739;
-  const C<F> G880 = G878 + G455 + G879;
-  const C<F> G881 = G418 * G880;
-  const C<F> G882 = G427 * G743;
-  const C<F> G883 = G431 * G745;
-  const C<F> G884 = G435 * G747;
-  const C<F> G885 = G882 + G883 + G884;
-  const C<F> G886 = G442 * G885;
-  const C<F> G887 = C1 * G886;
-  const C<F> G888 = G881 + G887;
-  const C<F> G889 = G399 * G888;
-  const C<F> G890 = G427 * G739;
-  const C<F> G891 = G431 * G113;
-  const C<F> G892 = G435 * G523;
-  const C<F> G893 = G890 + G891 + G892;
-  const C<F> G894 = G418 * G893;
-  const C<F> G895 = G462 * G885;
-  const C<F> G896 = C1 * G895;
-  const C<F> G897 = G894 + G896;
-  const C<F> G898 = G453 * G897;
-  const C<F> G899 = C1 * G898;
-  const C<F> G900 = G889 + G899;
-  const C<F> G901 = G471 * G888;
-  const C<F> G902 = G427 * G113;
-  const C<F> G903 = G431 * G738;
-  const C<F> G904 = G902 + G903 + G684;
-  const C<F> G905 = G418 * G904;
-  const C<F> G906 = G481 * G885;
-  const C<F> G907 = C1 * G906;
-  const C<F> G908 = G905 + G907;
-  const C<F> G909 = G453 * G908;
-  const C<F> G910 = C1 * G909;
-  const C<F> G911 = G901 + G910;
-  const C<F> G912 = G151 * G812;
-  const C<F> G913 = G169 * G817;
-  const C<F> G914 = C1 * G913;
-  const C<F> G915 = G912 + G914;
-  const C<F> G916 = G277 * G915;
-  const C<F> G917 = G151 * G836;
-  const C<F> G918 = G208 * G817;
-  const C<F> G919 = C1 * G918;
-  const C<F> G920 = G917 + G919;
-  const C<F> G921 = G259 * G920;
-  const C<F> G922 = C1 * G921;
-  const C<F> G923 = G916 + G922;
-  const C<F> G924 = G138 * G923;
-  const C<F> G925 = G217 * G915;
-  const C<F> G926 = G151 * G825;
-  const C<F> G927 = G189 * G817;
-  const C<F> G928 = C1 * G927;
-  const C<F> G929 = G926 + G928;
-  const C<F> G930 = G259 * G929;
-  const C<F> G931 = C1 * G930;
-  const C<F> G932 = G925 + G931;
-  const C<F> G933 = G198 * G932;
-  const C<F> G934 = C1 * G933;
-  const C<F> G935 = G924 + G934;
-  const C<F> G936 = G217 * G920;
-  const C<F> G937 = G277 * G929;
-  const C<F> G938 = C1 * G937;
-  const C<F> G939 = G936 + G938;
-  const C<F> G940 = G180 * G939;
-  const C<F> G941 = G935 + G940;
-  const C<F> G942 = G1 * X63;
-  const C<F> G943 = t * X119;
-  const C<F> G944 = G942 + G943;
-  const C<F> G945 = X3 + X3;
-  const C<F> G946 = G41 * G945;
-  const C<F> G947 = G766 + G542 + G946;
-  const C<F> G948 = G27 * G947;
-  const C<F> G949 = X8 * G945;
-  const C<F> G950 = G30 * G949;
-  const C<F> G951 = X9 * G945;
-  const C<F> G952 = G35 * G951;
-  const C<F> G953 = X10 * G945;
-  const C<F> G954 = G41 * G953;
-  const C<F> G955 = G950 + G952 + G954;
-  const C<F> G956 = G62 * G955;
-  const C<F> G957 = C1 * G956;
-  const C<F> G958 = G948 + G957;
-  const C<F> G959 = G4 * G958;
-  const C<F> G960 = C1 * G945;
-  const C<F> G961 = G30 * G960;
-  const C<F> G962 = G35 * G554;
-  const C<F> G963 = G961 + G962 + G114;
-  const C<F> G964 = G27 * G963;
-  const C<F> G965 = G98 * G955;
-  const C<F> G966 = C1 * G965;
-  const C<F> G967 = G964 + G966;
-  const C<F> G968 = G76 * G967;
-  const C<F> G969 = C1 * G968;
-  const C<F> G970 = G959 + G969;
-  const C<F> G971 = G107 * G958;
-  const C<F> G972 = G30 * G523;
-  const C<F> G973 = G35 * G960;
-  const C<F> G974 = G41 * G31;
-  const C<F> G975 = G972 + G973 + G974;
-  const C<F> G976 = G27 * G975;
-  const C<F> G977 = G129 * G955;
-  const C<F> G978 = C1 * G977;
-  const C<F> G979 = G976 + G978;
-  const C<F> G980 = G76 * G979;
-  const C<F> G981 = C1 * G980;
-  const C<F> G982 = G971 + G981;
-  const C<F> G983 = G162 * G945;
-  const C<F> G984 = G800 + G578 + G983;
-  const C<F> G985 = G151 * G984;
-  const C<F> G986 = G154 * G949;
-  const C<F> G987 = G158 * G951;
-  const C<F> G988 = G162 * G953;
-  const C<F> G989 = G986 + G987 + G988;
-  const C<F> G990 = G169 * G989;
-  const C<F> G991 = C1 * G990;
-  const C<F> G992 = G985 + G991;
-  const C<F> G993 = G138 * G992;
-  const C<F> G994 = G154 * G960;
-  const C<F> G995 = G158 * G554;
-  const C<F> G996 = G994 + G995 + G202;
-  const C<F> G997 = G151 * G996;
-  const C<F> G998 = G189 * G989;
-  const C<F> G999 = C1 * G998;
-  const C<F> G1000 = G997 + G999;
-  const C<F> G1001 = G180 * G1000;
-  const C<F> G1002 = C1 * G1001;
-  const C<F> G1003 = G993 + G1002;
-  const C<F> G1004 = G198 * G992;
-  const C<F> G1005 = G154 * G523;
-  const C<F> G1006 = G158 * G960;
-  const C<F> G1007 = G162 * G31;
-  const C<F> G1008 = G1005 + G1006 + G1007;
-  const C<F> G1009 = G151 * G1008;
-  const C<F> G1010 = G208 * G989;
-  const C<F> G1011 = C1 * G1010;
-  const C<F> G1012 = G1009 + G1011;
-  const C<F> G1013 = G180 * G1012;
-  const C<F> G1014 = C1 * G1013;
-  const C<F> G1015 = G1004 + G1014;
-  const C<F> G1016 = G241 * G945;
-  const C<F> G1017 = G834 + G613 + G1016;
-  const C<F> G1018 = G230 * G1017;
-  const C<F> G1019 = G233 * G949;
-  const C<F> G1020 = G237 * G951;
-  const C<F> G1021 = G241 * G953;
-  const C<F> G1022 = G1019 + G1020 + G1021;
-  const C<F> G1023 = G248 * G1022;
-  const C<F> G1024 = C1 * G1023;
-  const C<F> G1025 = G1018 + G1024;
-  const C<F> G1026 = G217 * G1025;
-  const C<F> G1027 = G233 * G960;
-  const C<F> G1028 = G237 * G554;
-  const C<F> G1029 = G1027 + G1028 + G281;
-  const C<F> G1030 = G230 * G1029;
-  const C<F> G1031 = G268 * G1022;
-  const C<F> G1032 = C1 * G1031;
-  const C<F> G1033 = G1030 + G1032;
-  const C<F> G1034 = G259 * G1033;
-  const C<F> G1035 = C1 * G1034;
-  const C<F> G1036 = G1026 + G1035;
-  const C<F> G1037 = G277 * G1025;
-  const C<F> G1038 = G233 * G523;
-  const C<F> G1039 = G237 * G960;
-  const C<F> G1040 = G241 * G31;
-  const C<F> G1041 = G1038 + G1039 + G1040;
-  const C<F> G1042 = G230 * G1041;
-  const C<F> G1043 = G287 * G1022;
-  const C<F> G1044 = C1 * G1043;
-  const C<F> G1045 = G1042 + G1044;
-  const C<F> G1046 = G259 * G1045;
-  const C<F> G1047 = C1 * G1046;
-  const C<F> G1048 = G1037 + G1047;
-  const C<F> G1049 = G338 * G945;
-  const C<F> G1050 = G868 + G648 + G1049;
-  const C<F> G1051 = G321 * G1050;
-  const C<F> G1052 = G330 * G949;
-  const C<F> G1053 = G334 * G951;
-  const C<F> G1054 = G338 * G953;
-  const C<F> G1055 = G1052 + G1053 + G1054;
-  const C<F> G1056 = G345 * G1055;
-  const C<F> G1057 = C1 * G1056;
-  const C<F> G1058 = G1051 + G1057;
-  const C<F> G1059 = G302 * G1058;
-  const C<F> G1060 = G330 * G960;
-  const C<F> G1061 = G334 * G554;
-  const C<F> G1062 = G1060 + G1061 + G378;
-  const C<F> G1063 = G321 * G1062;
-  const C<F> G1064 = G365 * G1055;
-  const C<F> G1065 = C1 * G1064;
-  const C<F> G1066 = G1063 + G1065;
-  const C<F> G1067 = G356 * G1066;
-  const C<F> G1068 = C1 * G1067;
-  const C<F> G1069 = G1059 + G1068;
-  const C<F> G1070 = G374 * G1058;
-  const C<F> G1071 = G330 * G523;
-  const C<F> G1072 = G334 * G960;
-  const C<F> G1073 = G338 * G31;
-  const C<F> G1074 = G1071 + G1072 + G1073;
-  const C<F> G1075 = G321 * G1074;
-  const C<F> G1076 = G384 * G1055;
-  const C<F> G1077 = C1 * G1076;
-  const C<F> G1078 = G1075 + G1077;
-  const C<F> G1079 = G356 * G1078;
-  const C<F> G1080 = C1 * G1079;
-  const C<F> G1081 = G1070 + G1080;
-  const C<F> G1082 = G435 * G945;
-  const C<F> G1083 = G902 + G683 + G1082;
-  const C<F> G1084 = G418 * G1083;
-  const C<F> G1085 = G427 * G949;
-  const C<F> G1086 = G431 * G951;
-  const C<F> G1087 = G435 * G953;
-  const C<F> G1088 = G1085 + G1086 + G1087;
-  const C<F> G1089 = G442 * G1088;
-  const C<F> G1090 = C1 * G1089;
-  const C<F> G1091 = G1084 + G1090;
-  const C<F> G1092 = G399 * G1091;
-  const C<F> G1093 = G427 * G960;
-  const C<F> G1094 = G431 * G554;
-  const C<F> G1095 = G1093 + G1094 + G475;
-  const C<F> G1096 = G418 * G1095;
-  const C<F> G1097 = G462 * G1088;
-  const C<F> G1098 = C1 * G1097;
-  const C<F> G1099 = G1096 + G1098;
-  const C<F> G1100 = G453 * G1099;
-  const C<F> G1101 = C1 * G1100;
-  const C<F> G1102 = G1092 + G1101;
-  const C<F> G1103 = G471 * G1091;
-  const C<F> G1104 = G427 * G523;
-  const C<F> G1105 = G431 * G960;
-  const C<F> G1106 = G435 * G31;
-  const C<F> G1107 = G1104 + G1105 + G1106;
-  const C<F> G1108 = G418 * G1107;
-  const C<F> G1109 = G481 * G1088;
-  const C<F> G1110 = C1 * G1109;
-  const C<F> G1111 = G1108 + G1110;
-  const C<F> G1112 = G453 * G1111;
-  const C<F> G1113 = C1 * G1112;
-  const C<F> G1114 = G1103 + G1113;
-  const C<F> G1115 = G151 * G1017;
-  const C<F> G1116 = G169 * G1022;
-  const C<F> G1117 = C1 * G1116;
-  const C<F> G1118 = G1115 + G1117;
-  const C<F> G1119 = G277 * G1118;
-  const C<F> G1120 = G151 * G1041;
-  const C<F> G1121 = G208 * G1022;
-  const C<F> G1122 = C1 * G1121;
-  const C<F> G1123 = G1120 + G1122;
-  const C<F> G1124 = G259 * G1123;
-  const C<F> G1125 = C1 * G1124;
-  const C<F> G1126 = G1119 + G1125;
-  const C<F> G1127 = G138 * G1126;
-  const C<F> G1128 = G217 * G1118;
-  const C<F> G1129 = G151 * G1029;
-  const C<F> G1130 = G189 * G1022;
-  const C<F> G1131 = C1 * G1130;
-  const C<F> G1132 = G1129 + G1131;
-  const C<F> G1133 = G259 * G1132;
-  const C<F> G1134 = C1 * G1133;
-  const C<F> G1135 = G1128 + G1134;
-  const C<F> G1136 = G198 * G1135;
-  const C<F> G1137 = C1 * G1136;
-  const C<F> G1138 = G1127 + G1137;
-  const C<F> G1139 = G217 * G1123;
-  const C<F> G1140 = G277 * G1132;
-  const C<F> G1141 = C1 * G1140;
-  const C<F> G1142 = G1139 + G1141;
-  const C<F> G1143 = G180 * G1142;
-  const C<F> G1144 = G1138 + G1143;
-  const C<F> G1145 = G1 * X64;
-  const C<F> G1146 = t * X120;
-  const C<F> G1147 = G1145 + G1146;
-  const C<F> G1148 = X1 * X3;
-  const C<F> G1149 = X0 * X2;
-  const C<F> G1150 = G1148 + G1149;
-  const C<F> G1151 = C2 * G1150;
-  const C<F> G1152 = G30 * G1151;
-  const C<F> G1153 = X2 * X3;
-  const C<F> G1154 = X0 * X1;
-  const C<F> G1155 = C1 * G1154;
-  const C<F> G1156 = G1153 + G1155;
-  const C<F> G1157 = C2 * G1156;
-  const C<F> G1158 = G35 * G1157;
-  const C<F> G1159 = X0 * X0;
-  const C<F> G1160 = X3 * X3;
-  const C<F> G1161 = G1159 + G1160;
-  const C<F> G1162 = X1 * X1;
-  const C<F> G1163 = X2 * X2;
-  const C<F> G1164 = G1162 + G1163;
-  const C<F> G1165 = C1 * G1164;
-  const C<F> G1166 = G1161 + G1165;
-  const C<F> G1167 = G41 * G1166;
-  const C<F> G1168 = G1152 + G1158 + G1167;
-  const C<F> G1169 = X4 + X4;
-  const C<F> G1170 = X11 * G1169;
-  const C<F> G1171 = G7 * G1170;
-  const C<F> G1172 = X12 * G1169;
-  const C<F> G1173 = G19 * G1172;
-  const C<F> G1174 = X13 * G1169;
-  const C<F> G1175 = G24 * G1174;
-  const C<F> G1176 = G1171 + G1173 + G1175;
-  const C<F> G1177 = G1168 * G1176;
-  const C<F> G1178 = G1159 + G1162;
-  const C<F> G1179 = G1178 + G1163;
-  const C<F> G1180 = G1179 + G1160;
-  const C<F> G1181 = G1180 * X8;
-  const C<F> G1182 = G30 * G1181;
-  const C<F> G1183 = G1180 * X9;
-  const C<F> G1184 = G35 * G1183;
-  const C<F> G1185 = G1180 * X10;
-  const C<F> G1186 = G41 * G1185;
-  const C<F> G1187 = G1182 + G1184 + G1186;
-  const C<F> G1188 = C2 * X6;
-  const C<F> G1189 = G7 * G1188;
-  const C<F> G1190 = C1 * X5;
-  const C<F> G1191 = C2 * G1190;
-  const C<F> G1192 = G19 * G1191;
-  const C<F> G1193 = G24 * G1169;
-  const C<F> G1194 = G1189 + G1192 + G1193;
-  const C<F> G1195 = G1187 * G1194;
-  const C<F> G1196 = C1 * G1195;
-  const C<F> G1197 = G1177 + G1196;
-  const C<F> G1198 = G4 * G1197;
-  const C<F> G1199 = G1163 + G1160;
-  const C<F> G1200 = C1 * G1199;
-  const C<F> G1201 = G1178 + G1200;
-  const C<F> G1202 = G30 * G1201;
-  const C<F> G1203 = X1 * X2;
-  const C<F> G1204 = X0 * X3;
-  const C<F> G1205 = G1203 + G1204;
-  const C<F> G1206 = C2 * G1205;
-  const C<F> G1207 = G35 * G1206;
-  const C<F> G1208 = C1 * G1149;
-  const C<F> G1209 = G1148 + G1208;
-  const C<F> G1210 = C2 * G1209;
-  const C<F> G1211 = G41 * G1210;
-  const C<F> G1212 = G1202 + G1207 + G1211;
-  const C<F> G1213 = G1212 * G1176;
-  const C<F> G1214 = G7 * G1169;
-  const C<F> G1215 = C2 * X7;
-  const C<F> G1216 = G19 * G1215;
-  const C<F> G1217 = C1 * X6;
-  const C<F> G1218 = C2 * G1217;
-  const C<F> G1219 = G24 * G1218;
-  const C<F> G1220 = G1214 + G1216 + G1219;
-  const C<F> G1221 = G1187 * G1220;
-  const C<F> G1222 = C1 * G1221;
-  const C<F> G1223 = G1213 + G1222;
-  const C<F> G1224 = G76 * G1223;
-  const C<F> G1225 = C1 * G1224;
-  const C<F> G1226 = G1198 + G1225;
-  const C<F> G1227 = G107 * G1197;
-  const C<F> G1228 = C1 * G1204;
-  const C<F> G1229 = G1203 + G1228;
-  const C<F> G1230 = C2 * G1229;
-  const C<F> G1231 = G30 * G1230;
-  const C<F> G1232 = G1159 + G1163;
-  const C<F> G1233 = G1162 + G1160;
-  const C<F> G1234 = C1 * G1233;
-  const C<F> G1235 = G1232 + G1234;
-  const C<F> G1236 = G35 * G1235;
-  const C<F> G1237 = G1153 + G1154;
-  const C<F> G1238 = C2 * G1237;
-  const C<F> G1239 = G41 * G1238;
-  const C<F> G1240 = G1231 + G1236 + G1239;
-  const C<F> G1241 = G1240 * G1176;
-  const C<F> G1242 = C1 * X7;
-  const C<F> G1243 = C2 * G1242;
-  const C<F> G1244 = G7 * G1243;
-  const C<F> G1245 = G19 * G1169;
-  const C<F> G1246 = C2 * X5;
-  const C<F> G1247 = G24 * G1246;
-  const C<F> G1248 = G1244 + G1245 + G1247;
-  const C<F> G1249 = G1187 * G1248;
-  const C<F> G1250 = C1 * G1249;
-  const C<F> G1251 = G1241 + G1250;
-  const C<F> G1252 = G76 * G1251;
-  const C<F> G1253 = C1 * G1252;
-  const C<F> G1254 = G1227 + G1253;
-  const C<F> G1255 = G154 * G1151;
-  const C<F> G1256 = G158 * G1157;
-  const C<F> G1257 = G162 * G1166;
-  const C<F> G1258 = G1255 + G1256 + G1257;
-  const C<F> G1259 = G141 * G1170;
-  const C<F> G1260 = G145 * G1172;
-  const C<F> G1261 = G149 * G1174;
-  const C<F> G1262 = G1259 + G1260 + G1261;
-  const C<F> G1263 = G1258 * G1262;
-  const C<F> G1264 = G154 * G1181;
-  const C<F> G1265 = G158 * G1183;
-  const C<F> G1266 = G162 * G1185;
-  const C<F> G1267 = G1264 + G1265 + G1266;
-  const C<F> G1268 = G141 * G1188;
-  const C<F> G1269 = G145 * G1191;
-  const C<F> G1270 = G149 * G1169;
-  const C<F> G1271 = G1268 + G1269 + G1270;
-  const C<F> G1272 = G1267 * G1271;
-  const C<F> G1273 = C1 * G1272;
-  const C<F> G1274 = G1263 + G1273;
-  const C<F> G1275 = G138 * G1274;
-  const C<F> G1276 = G154 * G1201;
-  const C<F> G1277 = G158 * G1206;
-  const C<F> G1278 = G162 * G1210;
-  const C<F> G1279 = G1276 + G1277 + G1278;
-  const C<F> G1280 = G1279 * G1262;
-  const C<F> G1281 = G141 * G1169;
-  const C<F> G1282 = G145 * G1215;
-  const C<F> G1283 = G149 * G1218;
-  const C<F> G1284 = G1281 + G1282 + G1283;
-  const C<F> G1285 = G1267 * G1284;
-  const C<F> G1286 = C1 * G1285;
-  const C<F> G1287 = G1280 + G1286;
-  const C<F> G1288 = G180 * G1287;
-  const C<F> G1289 = C1 * G1288;
-  const C<F> G1290 = G1275 + G1289;
-  const C<F> G1291 = G198 * G1274;
-  const C<F> G1292 = G154 * G1230;
-  const C<F> G1293 = G158 * G1235;
-  const C<F> G1294 = G162 * G1238;
-  const C<F> G1295 = G1292 + G1293 + G1294;
-  const C<F> G1296 = G1295 * G1262;
-  const C<F> G1297 = G141 * G1243;
-  const C<F> G1298 = G145 * G1169;
-  const C<F> G1299 = G149 * G1246;
-  const C<F> G1300 = G1297 + G1298 + G1299;
-  const C<F> G1301 = G1267 * G1300;
-  const C<F> G1302 = C1 * G1301;
-  const C<F> G1303 = G1296 + G1302;
-  const C<F> G1304 = G180 * G1303;
-  const C<F> G1305 = C1 * G1304;
-  const C<F> G1306 = G1291 + G1305;
-  const C<F> G1307 = G233 * G1151;
-  const C<F> G1308 = G237 * G1157;
-  const C<F> G1309 = G241 * G1166;
-  const C<F> G1310 = G1307 + G1308 + G1309;
-  const C<F> G1311 = G220 * G1170;
-  const C<F> G1312 = G224 * G1172;
-  const C<F> G1313 = G228 * G1174;
-  const C<F> G1314 = G1311 + G1312 + G1313;
-  const C<F> G1315 = G1310 * G1314;
-  const C<F> G1316 = G233 * G1181;
-  const C<F> G1317 = G237 * G1183;
-  const C<F> G1318 = G241 * G1185;
-  const C<F> G1319 = G1316 + G1317 + G1318;
-  const C<F> G1320 = G220 * G1188;
-  const C<F> G1321 = G224 * G1191;
-  const C<F> G1322 = G228 * G1169;
-  const C<F> G1323 = G1320 + G1321 + G1322;
-  const C<F> G1324 = G1319 * G1323;
-  const C<F> G1325 = C1 * G1324;
-  const C<F> G1326 = G1315 + G1325;
-  const C<F> G1327 = G217 * G1326;
-  const C<F> G1328 = G233 * G1201;
-  const C<F> G1329 = G237 * G1206;
-  const C<F> G1330 = G241 * G1210;
-  const C<F> G1331 = G1328 + G1329 + G1330;
-  const C<F> G1332 = G1331 * G1314;
-  const C<F> G1333 = G220 * G1169;
-  const C<F> G1334 = G224 * G1215;
-  const C<F> G1335 = G228 * G1218;
-  const C<F> G1336 = G1333 + G1334 + G1335;
-  const C<F> G1337 = G1319 * G1336;
-  const C<F> G1338 = C1 * G1337;
-  const C<F> G1339 = G1332 + G1338;
-  const C<F> G1340 = G259 * G1339;
-  const C<F> G1341 = C1 * G1340;
-  const C<F> G1342 = G1327 + G1341;
-  const C<F> G1343 = G277 * G1326;
-  const C<F> G1344 = G233 * G1230;
-  const C<F> G1345 = G237 * G1235;
-  const C<F> G1346 = G241 * G1238;
-  const C<F> G1347 = G1344 + G1345 + G1346;
-  const C<F> G1348 = G1347 * G1314;
-  const C<F> G1349 = G220 * G1243;
-  const C<F> G1350 = G224 * G1169;
-  const C<F> G1351 = G228 * G1246;
-  const C<F> G1352 = G1349 + G1350 + G1351;
-  const C<F> G1353 = G1319 * G1352;
-  const C<F> G1354 = C1 * G1353;
-  const C<F> G1355 = G1348 + G1354;
-  const C<F> G1356 = G259 * G1355;
-  const C<F> G1357 = C1 * G1356;
-  const C<F> G1358 = G1343 + G1357;
-  const C<F> G1359 = G330 * G1151;
-  const C<F> G1360 = G334 * G1157;
-  const C<F> G1361 = G338 * G1166;
-  const C<F> G1362 = G1359 + G1360 + G1361;
-  const C<F> G1363 = G311 * G1170;
-  const C<F> G1364 = G315 * G1172;
-  const C<F> G1365 = G319 * G1174;
-  const C<F> G1366 = G1363 + G1364 + G1365;
-  const C<F> G1367 = G1362 * G1366;
-  const C<F> G1368 = G330 * G1181;
-  const C<F> G1369 = G334 * G1183;
-  const C<F> G1370 = G338 * G1185;
-  const C<F> G1371 = G1368 + G1369 + G1370;
-  const C<F> G1372 = G311 * G1188;
-  const C<F> G1373 = G315 * G1191;
-  const C<F> G1374 = G319 * G1169;
-  const C<F> G1375 = G1372 + G1373 + G1374;
-  const C<F> G1376 = G1371 * G1375;
-  const C<F> G1377 = C1 * G1376;
-  const C<F> G1378 = G1367 + G1377;
-  const C<F> G1379 = G302 * G1378;
-  const C<F> G1380 = G330 * G1201;
-  const C<F> G1381 = G334 * G1206;
-  const C<F> G1382 = G338 * G1210;
-  const C<F> G1383 = G1380 + G1381 + G1382;
-  const C<F> G1384 = G1383 * G1366;
-  const C<F> G1385 = G311 * G1169;
-  const C<F> G1386 = G315 * G1215;
-  const C<F> G1387 = G319 * G1218;
-  const C<F> G1388 = G1385 + G1386 + G1387;
-  const C<F> G1389 = G1371 * G1388;
-  const C<F> G1390 = C1 * G1389;
-  const C<F> G1391 = G1384 + G1390;
-  const C<F> G1392 = G356 * G1391;
-  const C<F> G1393 = C1 * G1392;
-  const C<F> G1394 = G1379 + G1393;
-  const C<F> G1395 = G374 * G1378;
-  const C<F> G1396 = G330 * G1230;
-  const C<F> G1397 = G334 * G1235;
-  const C<F> G1398 = G338 * G1238;
-  const C<F> G1399 = G1396 + G1397 + G1398;
-  const C<F> G1400 = G1399 * G1366;
-  const C<F> G1401 = G311 * G1243;
-  const C<F> G1402 = G315 * G1169;
-  const C<F> G1403 = G319 * G1246;
-  const C<F> G1404 = G1401 + G1402 + G1403;
-  const C<F> G1405 = G1371 * G1404;
-  const C<F> G1406 = C1 * G1405;
-  const C<F> G1407 = G1400 + G1406;
-  const C<F> G1408 = G356 * G1407;
-  const C<F> G1409 = C1 * G1408;
-  const C<F> G1410 = G1395 + G1409;
-  const C<F> G1411 = G427 * G1151;
-  const C<F> G1412 = G431 * G1157;
-  const C<F> G1413 = G435 * G1166;
-  const C<F> G1414 = G1411 + G1412 + G1413;
-  const C<F> G1415 = G408 * G1170;
-  const C<F> G1416 = G412 * G1172;
-  const C<F> G1417 = G416 * G1174;
-  const C<F> G1418 = G1415 + G1416 + G1417;
-  const C<F> G1419 = G1414 * G1418;
-  const C<F> G1420 = G427 * G1181;
-  const C<F> G1421 = G431 * G1183;
-  const C<F> G1422 = G435 * G1185;
-  const C<F> G1423 = G1420 + G1421 + G1422;
-  const C<F> G1424 = G408 * G1188;
-  const C<F> G1425 = G412 * G1191;
-  const C<F> G1426 = G416 * G1169;
-  const C<F> G1427 = G1424 + G1425 + G1426;
-  const C<F> G1428 = G1423 * G1427;
-  const C<F> G1429 = C1 * G1428;
-  const C<F> G1430 = G1419 + G1429;
-  const C<F> G1431 = G399 * G1430;
-  const C<F> G1432 = G427 * G1201;
-  const C<F> G1433 = G431 * G1206;
-  const C<F> G1434 = G435 * G1210;
-  const C<F> G1435 = G1432 + G1433 + G1434;
-  const C<F> G1436 = G1435 * G1418;
-  const C<F> G1437 = G408 * G1169;
-  const C<F> G1438 = G412 * G1215;
-  const C<F> G1439 = G416 * G1218;
-  const C<F> G1440 = G1437 + G1438 + G1439;
-  const C<F> G1441 = G1423 * G1440;
-  const C<F> G1442 = C1 * G1441;
-  const C<F> G1443 = G1436 + G1442;
-  const C<F> G1444 = G453 * G1443;
-  const C<F> G1445 = C1 * G1444;
-  const C<F> G1446 = G1431 + G1445;
-  const C<F> G1447 = G471 * G1430;
-  const C<F> G1448 = G427 * G1230;
-  const C<F> G1449 = G431 * G1235;
-  const C<F> G1450 = G435 * G1238;
-  const C<F> G1451 = G1448 + G1449 + G1450;
-  const C<F> G1452 = G1451 * G1418;
-  const C<F> G1453 = G408 * G1243;
-  const C<F> G1454 = G412 * G1169;
-  const C<F> G1455 = G416 * G1246;
-  const C<F> G1456 = G1453 + G1454 + G1455;
-  const C<F> G1457 = G1423 * G1456;
-  const C<F> G1458 = C1 * G1457;
-  const C<F> G1459 = G1452 + G1458;
-  const C<F> G1460 = G453 * G1459;
-  const C<F> G1461 = C1 * G1460;
-  const C<F> G1462 = G1447 + G1461;
-  const C<F> G1463 = G1310 * G1262;
-  const C<F> G1464 = G1319 * G1271;
-  const C<F> G1465 = C1 * G1464;
-  const C<F> G1466 = G1463 + G1465;
-  const C<F> G1467 = G277 * G1466;
-  const C<F> G1468 = G1347 * G1262;
-  const C<F> G1469 = G1319 * G1300;
-  const C<F> G1470 = C1 * G1469;
-  const C<F> G1471 = G1468 + G1470;
-  const C<F> G1472 = G259 * G1471;
-  const C<F> G1473 = C1 * G1472;
-  const C<F> G1474 = G1467 + G1473;
-  const C<F> G1475 = G138 * G1474;
-  const C<F> G1476 = G217 * G1466;
-  const C<F> G1477 = G1331 * G1262;
-  const C<F> G1478 = G1319 * G1284;
-  const C<F> G1479 = C1 * G1478;
-  const C<F> G1480 = G1477 + G1479;
-  const C<F> G1481 = G259 * G1480;
-  const C<F> G1482 = C1 * G1481;
-  const C<F> G1483 = G1476 + G1482;
-  const C<F> G1484 = G198 * G1483;
-  const C<F> G1485 = C1 * G1484;
-  const C<F> G1486 = G1475 + G1485;
-  const C<F> G1487 = G217 * G1471;
-  const C<F> G1488 = G277 * G1480;
-  const C<F> G1489 = C1 * G1488;
-  const C<F> G1490 = G1487 + G1489;
-  const C<F> G1491 = G180 * G1490;
-  const C<F> G1492 = G1486 + G1491;
-  const C<F> G1493 = G1 * X66;
-  const C<F> G1494 = t * X122;
-  const C<F> G1495 = G1493 + G1494;
-  const C<F> G1496 = X5 + X5;
-  const C<F> G1497 = X11 * G1496;
-  const C<F> G1498 = G7 * G1497;
-  const C<F> G1499 = X12 * G1496;
-  const C<F> G1500 = G19 * G1499;
-  const C<F> G1501 = X13 * G1496;
-  const C<F> G1502 = G24 * G1501;
-  const C<F> G1503 = G1498 + G1500 + G1502;
-  const C<F> G1504 = G1168 * G1503;
-  const C<F> G1505 = G7 * G1215;
-  const C<F> G1506 = C1 * X4;
-  const C<F> G1507 = C2 * G1506;
-  const C<F> G1508 = G19 * G1507;
-  const C<F> G1509 = C1 * G1496;
-  const C<F> G1510 = G24 * G1509;
-  const C<F> G1511 = G1505 + G1508 + G1510;
-  const C<F> G1512 = G1187 * G1511;
-  const C<F> G1513 = C1 * G1512;
-  const C<F> G1514 = G1504 + G1513;
-  const C<F> G1515 = G4 * G1514;
-  const C<F> G1516 = G1212 * G1503;
-  const C<F> G1517 = G7 * G1496;
-  const C<F> G1518 = G19 * G1188;
-  const C<F> G1519 = G24 * G1215;
-  const C<F> G1520 = G1517 + G1518 + G1519;
-  const C<F> G1521 = G1187 * G1520;
-  const C<F> G1522 = C1 * G1521;
-  const C<F> G1523 = G1516 + G1522;
-  const C<F> G1524 = G76 * G1523;
-  const C<F> G1525 = C1 * G1524;
-  const C<F> G1526 = G1515 + G1525;
-  const C<F> G1527 = G107 * G1514;
-  const C<F> G1528 = G1240 * G1503;
-  const C<F> G1529 = G19 * G1509;
-  const C<F> G1530 = C2 * X4;
-  const C<F> G1531 = G24 * G1530;
-  const C<F> G1532 = G1189 + G1529 + G1531;
-  const C<F> G1533 = G1187 * G1532;
-  const C<F> G1534 = C1 * G1533;
-  const C<F> G1535 = G1528 + G1534;
-  const C<F> G1536 = G76 * G1535;
-  const C<F> G1537 = C1 * G1536;
-  const C<F> G1538 = G1527 + G1537;
-  const C<F> G1539 = G141 * G1497;
-  const C<F> G1540 = G145 * G1499;
-  const C<F> G1541 = G149 * G1501;
-  const C<F> G1542 = G1539 + G1540 + G1541;
-  const C<F> G1543 = G1258 * G1542;
-  const C<F> G1544 = G141 * G1215;
-  const C<F> G1545 = G145 * G1507;
-  const C<F> G1546 = G149 * G1509;
-  const C<F> G1547 = G1544 + G1545 + G1546;
-  const C<F> G1548 = G1267 * G1547;
-  const C<F> G1549 = C1 * G1548;
-  const C<F> G1550 = G1543 + G1549;
-  const C<F> G1551 = G138 * G1550;
-  const C<F> G1552 = G1279 * G1542;
-  const C<F> G1553 = G141 * G1496;
-  const C<F> G1554 = G145 * G1188;
-  const C<F> G1555 = G149 * G1215;
-  const C<F> G1556 = G1553 + G1554 + G1555;
-  const C<F> G1557 = G1267 * G1556;
-  const C<F> G1558 = C1 * G1557;
-  const C<F> G1559 = G1552 + G1558;
-  const C<F> G1560 = G180 * G1559;
-  const C<F> G1561 = C1 * G1560;
-  const C<F> G1562 = G1551 + G1561;
-  const C<F> G1563 = G198 * G1550;
-  const C<F> G1564 = G1295 * G1542;
-  const C<F> G1565 = G145 * G1509;
-  const C<F> G1566 = G149 * G1530;
-  const C<F> G1567 = G1268 + G1565 + G1566;
-  const C<F> G1568 = G1267 * G1567;
-  const C<F> G1569 = C1 * G1568;
-  const C<F> G1570 = G1564 + G1569;
-  const C<F> G1571 = G180 * G1570;
-  const C<F> G1572 = C1 * G1571;
-  const C<F> G1573 = G1563 + G1572;
-  const C<F> G1574 = G220 * G1497;
-  const C<F> G1575 = G224 * G1499;
-  const C<F> G1576 = G228 * G1501;
-  const C<F> G1577 = G1574 + G1575 + G1576;
-  const C<F> G1578 = G1310 * G1577;
-  const C<F> G1579 = G220 * G1215;
-  const C<F> G1580 = G224 * G1507;
-  const C<F> G1581 = G228 * G1509;
-  const C<F> G1582 = G1579 + G1580 + G1581;
-  const C<F> G1583 = G1319 * G1582;
-  const C<F> G1584 = C1 * G1583;
-  const C<F> G1585 = G1578 + G1584;
-  const C<F> G1586 = G217 * G1585;
-  const C<F> G1587 = G1331 * G1577;
-  const C<F> G1588 = G220 * G1496;
-  const C<F> G1589 = G224 * G1188;
-  const C<F> G1590 = G228 * G1215;
-  const C<F> G1591 = G1588 + G1589 + G1590;
-  const C<F> G1592 = G1319 * G1591;
-  const C<F> G1593 = C1 * G1592;
-  const C<F> G1594 = G1587 + G1593;
-  const C<F> G1595 = G259 * G1594;
-  const C<F> G1596 = C1 * G1595;
-  const C<F> G1597 = G1586 + G1596;
-  const C<F> G1598 = G277 * G1585;
-  const C<F> G1599 = G1347 * G1577;
-  const C<F> G1600 = G224 * G1509;
-  const C<F> G1601 = G228 * G1530;
-  const C<F> G1602 = G1320 + G1600 + G1601;
-  const C<F> G1603 = G1319 * G1602;
-  const C<F> G1604 = C1 * G1603;
-  const C<F> G1605 = G1599 + G1604;
-  const C<F> G1606 = G259 * G1605;
-  const C<F> G1607 = C1 * G1606;
-  const C<F> G1608 = G1598 + G1607;
-  const C<F> G1609 = G311 * G1497;
-  const C<F> G1610 = G315 * G1499;
-  const C<F> G1611 = G319 * G1501;
-  const C<F> G1612 = G1609 + G1610 + G1611;
-  const C<F> G1613 = G1362 * G1612;
-  const C<F> G1614 = G311 * G1215;
-  const C<F> G1615 = G315 * G1507;
-  const C<F> G1616 = G319 * G1509;
-  const C<F> G1617 = G1614 + G1615 + G1616;
-  const C<F> G1618 = G1371 * G1617;
-  const C<F> G1619 = C1 * G1618;
-  const C<F> G1620 = G1613 + G1619;
-  const C<F> G1621 = G302 * G1620;
-  const C<F> G1622 = G1383 * G1612;
-  const C<F> G1623 = G311 * G1496;
-  const C<F> G1624 = G315 * G1188;
-  const C<F> G1625 = G319 * G1215;
-  const C<F> G1626 = G1623 + G1624 + G1625;
-  const C<F> G1627 = G1371 * G1626;
-  const C<F> G1628 = C1 * G1627;
-  const C<F> G1629 = G1622 + G1628;
-  const C<F> G1630 = G356 * G1629;
-  const C<F> G1631 = C1 * G1630;
-  const C<F> G1632 = G1621 + G1631;
-  const C<F> G1633 = G374 * G1620;
-  const C<F> G1634 = G1399 * G1612;
-  const C<F> G1635 = G315 * G1509;
-  const C<F> G1636 = G319 * G1530;
-  const C<F> G1637 = G1372 + G1635 + G1636;
-  const C<F> G1638 = G1371 * G1637;
-  const C<F> G1639 = C1 * G1638;
-  const C<F> G1640 = G1634 + G1639;
-  const C<F> G1641 = G356 * G1640;
-  const C<F> G1642 = C1 * G1641;
-  const C<F> G1643 = G1633 + G1642;
-  const C<F> G1644 = G408 * G1497;
-  const C<F> G1645 = G412 * G1499;
-  const C<F> G1646 = G416 * G1501;
-  const C<F> G1647 = G1644 + G1645 + G1646;
-  const C<F> G1648 = G1414 * G1647;
-  const C<F> G1649 = G408 * G1215;
-  const C<F> G1650 = G412 * G1507;
-  const C<F> G1651 = G416 * G1509;
-  const C<F> G1652 = G1649 + G1650 + G1651;
-  const C<F> G1653 = G1423 * G1652;
-  const C<F> G1654 = C1 * G1653;
-  const C<F> G1655 = G1648 + G1654;
-  const C<F> G1656 = G399 * G1655;
-  const C<F> G1657 = G1435 * G1647;
-  const C<F> G1658 = G408 * G1496;
-  const C<F> G1659 = G412 * G1188;
-  const C<F> G1660 = G416 * G1215;
-  const C<F> G1661 = G1658 + G1659 + G1660;
-  const C<F> G1662 = G1423 * G1661;
-  const C<F> G1663 = C1 * G1662;
-  const C<F> G1664 = G1657 + G1663;
-  const C<F> G1665 = G453 * G1664;
-  const C<F> G1666 = C1 * G1665;
-  const C<F> G1667 = G1656 + G1666;
-  const C<F> G1668 = G471 * G1655;
-  const C<F> G1669 = G1451 * G1647;
-  const C<F> G1670 = G412 * G1509;
-  const C<F> G1671 = G416 * G1530;
-  const C<F> G1672 = G1424 + G1670 + G1671;
-  const C<F> G1673 = G1423 * G1672;
-  const C<F> G1674 = C1 * G1673;
-  const C<F> G1675 = G1669 + G1674;
-  const C<F> G1676 = G453 * G1675;
-  const C<F> G1677 = C1 * G1676;
-  const C<F> G1678 = G1668 + G1677;
-  const C<F> G1679 = G1310 * G1542;
-  const C<F> G1680 = G1319 * G1547;
-  const C<F> G1681 = C1 * G1680;
-  const C<F> G1682 = G1679 + G1681;
-  const C<F> G1683 = G277 * G1682;
-  const C<F> G1684 = G1347 * G1542;
-  const C<F> G1685 = G1319 * G1567;
-  const C<F> G1686 = C1 * G1685;
-  const C<F> G1687 = G1684 + G1686;
-  const C<F> G1688 = G259 * G1687;
-  const C<F> G1689 = C1 * G1688;
-  const C<F> G1690 = G1683 + G1689;
-  const C<F> G1691 = G138 * G1690;
-  const C<F> G1692 = G217 * G1682;
-  const C<F> G1693 = G1331 * G1542;
-  const C<F> G1694 = G1319 * G1556;
-  const C<F> G1695 = C1 * G1694;
-  const C<F> G1696 = G1693 + G1695;
-  const C<F> G1697 = G259 * G1696;
-  const C<F> G1698 = C1 * G1697;
-  const C<F> G1699 = G1692 + G1698;
-  const C<F> G1700 = G198 * G1699;
-  const C<F> G1701 = C1 * G1700;
-  const C<F> G1702 = G1691 + G1701;
-  const C<F> G1703 = G217 * G1687;
-  const C<F> G1704 = G277 * G1696;
-  const C<F> G1705 = C1 * G1704;
-  const C<F> G1706 = G1703 + G1705;
-  const C<F> G1707 = G180 * G1706;
-  const C<F> G1708 = G1702 + G1707;
-  const C<F> G1709 = G1 * X67;
-  const C<F> G1710 = t * X123;
-  const C<F> G1711 = G1709 + G1710;
-  const C<F> G1712 = X6 + X6;
-  const C<F> G1713 = X11 * G1712;
-  const C<F> G1714 = G7 * G1713;
-  const C<F> G1715 = X12 * G1712;
-  const C<F> G1716 = G19 * G1715;
-  const C<F> G1717 = X13 * G1712;
-  const C<F> G1718 = G24 * G1717;
-  const C<F> G1719 = G1714 + G1716 + G1718;
-  const C<F> G1720 = G1168 * G1719;
-  const C<F> G1721 = G7 * G1530;
-  const C<F> G1722 = C1 * G1712;
-  const C<F> G1723 = G24 * G1722;
-  const C<F> G1724 = G1721 + G1216 + G1723;
-  const C<F> G1725 = G1187 * G1724;
-  const C<F> G1726 = C1 * G1725;
-  const C<F> G1727 = G1720 + G1726;
-  const C<F> G1728 = G4 * G1727;
-  const C<F> G1729 = G1212 * G1719;
-  const C<F> G1730 = G7 * G1722;
-  const C<F> G1731 = G19 * G1246;
-  const C<F> G1732 = G24 * G1507;
-  const C<F> G1733 = G1730 + G1731 + G1732;
-  const C<F> G1734 = G1187 * G1733;
-  const C<F> G1735 = C1 * G1734;
-  const C<F> G1736 = G1729 + G1735;
-  const C<F> G1737 = G76 * G1736;
-  const C<F> G1738 = C1 * G1737;
-  const C<F> G1739 = G1728 + G1738;
-  const C<F> G1740 = G107 * G1727;
-  const C<F> G1741 = G1240 * G1719;
-  const C<F> G1742 = G7 * G1246;
-  const C<F> G1743 = G19 * G1712;
-  const C<F> G1744 = G1742 + G1743 + G1519;
-  const C<F> G1745 = G1187 * G1744;
-  const C<F> G1746 = C1 * G1745;
-  const C<F> G1747 = G1741 + G1746;
-  const C<F> G1748 = G76 * G1747;
-  const C<F> G1749 = C1 * G1748;
-  const C<F> G1750 = G1740 + G1749;
-  const C<F> G1751 = G141 * G1713;
-  const C<F> G1752 = G145 * G1715;
-  const C<F> G1753 = G149 * G1717;
-  const C<F> G1754 = G1751 + G1752 + G1753;
-  const C<F> G1755 = G1258 * G1754;
-  const C<F> G1756 = G141 * G1530;
-  const C<F> G1757 = G149 * G1722;
-  const C<F> G1758 = G1756 + G1282 + G1757;
-  const C<F> G1759 = G1267 * G1758;
-  const C<F> G1760 = C1 * G1759;
-  const C<F> G1761 = G1755 + G1760;
-  const C<F> G1762 = G138 * G1761;
-  const C<F> G1763 = G1279 * G1754;
-  const C<F> G1764 = G141 * G1722;
-  const C<F> G1765 = G145 * G1246;
-  const C<F> G1766 = G149 * G1507;
-  const C<F> G1767 = G1764 + G1765 + G1766;
-  const C<F> G1768 = G1267 * G1767;
-  const C<F> G1769 = C1 * G1768;
-  const C<F> G1770 = G1763 + G1769;
-  const C<F> G1771 = G180 * G1770;
-  const C<F> G1772 = C1 * G1771;
-  const C<F> G1773 = G1762 + G1772;
-  const C<F> G1774 = G198 * G1761;
-  const C<F> G1775 = G1295 * G1754;
-  const C<F> G1776 = G141 * G1246;
-  const C<F> G1777 = G145 * G1712;
-  const C<F> G1778 = G1776 + G1777 + G1555;
-  const C<F> G1779 = G1267 * G1778;
-  const C<F> G1780 = C1 * G1779;
-  const C<F> G1781 = G1775 + G1780;
-  const C<F> G1782 = G180 * G1781;
-  const C<F> G1783 = C1 * G1782;
-  const C<F> G1784 = G1774 + G1783;
-  const C<F> G1785 = G220 * G1713;
-  const C<F> G1786 = G224 * G1715;
-  const C<F> G1787 = G228 * G1717;
-  const C<F> G1788 = G1785 + G1786 + G1787;
-  const C<F> G1789 = G1310 * G1788;
-  const C<F> G1790 = G220 * G1530;
-  const C<F> G1791 = G228 * G1722;
-  const C<F> G1792 = G1790 + G1334 + G1791;
-  const C<F> G1793 = G1319 * G1792;
-  const C<F> G1794 = C1 * G1793;
-  const C<F> G1795 = G1789 + G1794;
-  const C<F> G1796 = G217 * G1795;
-  const C<F> G1797 = G1331 * G1788;
-  const C<F> G1798 = G220 * G1722;
-  const C<F> G1799 = G224 * G1246;
-  const C<F> G1800 = G228 * G1507;
-  const C<F> G1801 = G1798 + G1799 + G1800;
-  const C<F> G1802 = G1319 * G1801;
-  const C<F> G1803 = C1 * G1802;
-  const C<F> G1804 = G1797 + G1803;
-  const C<F> G1805 = G259 * G1804;
-  const C<F> G1806 = C1 * G1805;
-  const C<F> G1807 = G1796 + G1806;
-  const C<F> G1808 = G277 * G1795;
-  const C<F> G1809 = G1347 * G1788;
-  const C<F> G1810 = G220 * G1246;
-  const C<F> G1811 = G224 * G1712;
-  const C<F> G1812 = G1810 + G1811 + G1590;
-  const C<F> G1813 = G1319 * G1812;
-  const C<F> G1814 = C1 * G1813;
-  const C<F> G1815 = G1809 + G1814;
-  const C<F> G1816 = G259 * G1815;
-  const C<F> G1817 = C1 * G1816;
-  const C<F> G1818 = G1808 + G1817;
-  const C<F> G1819 = G311 * G1713;
-  const C<F> G1820 = G315 * G1715;
-  const C<F> G1821 = G319 * G1717;
-  const C<F> G1822 = G1819 + G1820 + G1821;
-  const C<F> G1823 = G1362 * G1822;
-  const C<F> G1824 = G311 * G1530;
-  const C<F> G1825 = G319 * G1722;
-  const C<F> G1826 = G1824 + G1386 + G1825;
-  const C<F> G1827 = G1371 * G1826;
-  const C<F> G1828 = C1 * G1827;
-  const C<F> G1829 = G1823 + G1828;
-  const C<F> G1830 = G302 * G1829;
-  const C<F> G1831 = G1383 * G1822;
-  const C<F> G1832 = G311 * G1722;
-  const C<F> G1833 = G315 * G1246;
-  const C<F> G1834 = G319 * G1507;
-  const C<F> G1835 = G1832 + G1833 + G1834;
-  const C<F> G1836 = G1371 * G1835;
-  const C<F> G1837 = C1 * G1836;
-  const C<F> G1838 = G1831 + G1837;
-  const C<F> G1839 = G356 * G1838;
-  const C<F> G1840 = C1 * G1839;
-  const C<F> G1841 = G1830 + G1840;
-  const C<F> G1842 = G374 * G1829;
-  const C<F> G1843 = G1399 * G1822;
-  const C<F> G1844 = G311 * G1246;
-  const C<F> G1845 = G315 * G1712;
-  const C<F> G1846 = G1844 + G1845 + G1625;
-  const C<F> G1847 = G1371 * G1846;
-  const C<F> G1848 = C1 * G1847;
-  const C<F> G1849 = G1843 + G1848;
-  const C<F> G1850 = G356 * G1849;
-  const C<F> G1851 = C1 * G1850;
-  const C<F> G1852 = G1842 + G1851;
-  const C<F> G1853 = G408 * G1713;
-  const C<F> G1854 = G412 * G1715;
-  const C<F> G1855 = G416 * G1717;
-  const C<F> G1856 = G1853 + G1854 + G1855;
-  const C<F> G1857 = G1414 * G1856;
-  const C<F> G1858 = G408 * G1530;
-  const C<F> G1859 = G416 * G1722;
-  const C<F> G1860 = G1858 + G1438 + G1859;
-  const C<F> G1861 = G1423 * G1860;
-  const C<F> G1862 = C1 * G1861;
-  const C<F> G1863 = G1857 + G1862;
-  const C<F> G1864 = G399 * G1863;
-  const C<F> G1865 = G1435 * G1856;
-  const C<F> G1866 = G408 * G1722;
-  const C<F> G1867 = G412 * G1246;
-  const C<F> G1868 = G416 * G1507;
-  const C<F> G1869 = G1866 + G1867 + G1868;
-  const C<F> G1870 = G1423 * G1869;
-  const C<F> G1871 = C1 * G1870;
-  const C<F> G1872 = G1865 + G1871;
-  const C<F> G1873 = G453 * G1872;
-  const C<F> G1874 = C1 * G1873;
-  const C<F> G1875 = G1864 + G1874;
-  const C<F> G1876 = G471 * G1863;
-  const C<F> G1877 = G1451 * G1856;
-  const C<F> G1878 = G408 * G1246;
-  const C<F> G1879 = G412 * G1712;
-  const C<F> G1880 = G1878 + G1879 + G1660;
-  const C<F> G1881 = G1423 * G1880;
-  const C<F> G1882 = C1 * G1881;
-  const C<F> G1883 = G1877 + G1882;
-  const C<F> G1884 = G453 * G1883;
-  const C<F> G1885 = C1 * G1884;
-  const C<F> G1886 = G1876 + G1885;
-  const C<F> G1887 = G1310 * G1754;
-  const C<F> G1888 = G1319 * G1758;
-  const C<F> G1889 = C1 * G1888;
-  const C<F> G1890 = G1887 + G1889;
-  const C<F> G1891 = G277 * G1890;
-  const C<F> G1892 = G1347 * G1754;
-  const C<F> G1893 = G1319 * G1778;
-  const C<F> G1894 = C1 * G1893;
-  const C<F> G1895 = G1892 + G1894;
-  const C<F> G1896 = G259 * G1895;
-  const C<F> G1897 = C1 * G1896;
-  const C<F> G1898 = G1891 + G1897;
-  const C<F> G1899 = G138 * G1898;
-  const C<F> G1900 = G217 * G1890;
-  const C<F> G1901 = G1331 * G1754;
-  const C<F> G1902 = G1319 * G1767;
-  const C<F> G1903 = C1 * G1902;
-  const C<F> G1904 = G1901 + G1903;
-  const C<F> G1905 = G259 * G1904;
-  const C<F> G1906 = C1 * G1905;
-  const C<F> G1907 = G1900 + G1906;
-  const C<F> G1908 = G198 * G1907;
-  const C<F> G1909 = C1 * G1908;
-  const C<F> G1910 = G1899 + G1909;
-  const C<F> G1911 = G217 * G1895;
-  const C<F> G1912 = G277 * G1904;
-  const C<F> G1913 = C1 * G1912;
-  const C<F> G1914 = G1911 + G1913;
-  const C<F> G1915 = G180 * G1914;
-  const C<F> G1916 = G1910 + G1915;
-  const C<F> G1917 = G1 * X68;
-  const C<F> G1918 = t * X124;
-  const C<F> G1919 = G1917 + G1918;
-  const C<F> G1920 = X7 + X7;
-  const C<F> G1921 = X11 * G1920;
-  const C<F> G1922 = G7 * G1921;
-  const C<F> G1923 = X12 * G1920;
-  const C<F> G1924 = G19 * G1923;
-  const C<F> G1925 = X13 * G1920;
-  const C<F> G1926 = G24 * G1925;
-  const C<F> G1927 = G1922 + G1924 + G1926;
-  const C<F> G1928 = G1168 * G1927;
-  const C<F> G1929 = G24 * G1920;
-  const C<F> G1930 = G1742 + G1518 + G1929;
-  const C<F> G1931 = G1187 * G1930;
-  const C<F> G1932 = C1 * G1931;
-  const C<F> G1933 = G1928 + G1932;
-  const C<F> G1934 = G4 * G1933;
-  const C<F> G1935 = G1212 * G1927;
-  const C<F> G1936 = C1 * G1920;
-  const C<F> G1937 = G7 * G1936;
-  const C<F> G1938 = G19 * G1530;
-  const C<F> G1939 = G1937 + G1938 + G1247;
-  const C<F> G1940 = G1187 * G1939;
-  const C<F> G1941 = C1 * G1940;
-  const C<F> G1942 = G1935 + G1941;
-  const C<F> G1943 = G76 * G1942;
-  const C<F> G1944 = C1 * G1943;
-  const C<F> G1945 = G1934 + G1944;
-  const C<F> G1946 = G107 * G1933;
-  const C<F> G1947 = G1240 * G1927;
-  const C<F> G1948 = G7 * G1507;
-  const C<F> G1949 = G19 * G1936;
-  const C<F> G1950 = G24 * G1188;
-  const C<F> G1951 = G1948 + G1949 + G1950;
-  const C<F> G1952 = G1187 * G1951;
-  const C<F> G1953 = C1 * G1952;
-  const C<F> G1954 = G1947 + G1953;
-  const C<F> G1955 = G76 * G1954;
-  const C<F> G1956 = C1 * G1955;
-  const C<F> G1957 = G1946 + G1956;
-  const C<F> G1958 = G141 * G1921;
-  const C<F> G1959 = G145 * G1923;
-  const C<F> G1960 = G149 * G1925;
-  const C<F> G1961 = G1958 + G1959 + G1960;
-  const C<F> G1962 = G1258 * G1961;
-  const C<F> G1963 = G149 * G1920;
-  const C<F> G1964 = G1776 + G1554 + G1963;
-  const C<F> G1965 = G1267 * G1964;
-  const C<F> G1966 = C1 * G1965;
-  const C<F> G1967 = G1962 + G1966;
-  const C<F> G1968 = G138 * G1967;
-  const C<F> G1969 = G1279 * G1961;
-  const C<F> G1970 = G141 * G1936;
-  const C<F> G1971 = G145 * G1530;
-  const C<F> G1972 = G1970 + G1971 + G1299;
-  const C<F> G1973 = G1267 * G1972;
-  const C<F> G1974 = C1 * G1973;
-  const C<F> G1975 = G1969 + G1974;
-  const C<F> G1976 = G180 * G1975;
-  const C<F> G1977 = C1 * G1976;
-  const C<F> G1978 = G1968 + G1977;
-  const C<F> G1979 = G198 * G1967;
-  const C<F> G1980 = G1295 * G1961;
-  const C<F> G1981 = G141 * G1507;
-  const C<F> G1982 = G145 * G1936;
-  const C<F> G1983 = G149 * G1188;
-  const C<F> G1984 = G1981 + G1982 + G1983;
-  const C<F> G1985 = G1267 * G1984;
-  const C<F> G1986 = C1 * G1985;
-  const C<F> G1987 = G1980 + G1986;
-  const C<F> G1988 = G180 * G1987;
-  const C<F> G1989 = C1 * G1988;
-  const C<F> G1990 = G1979 + G1989;
-  const C<F> G1991 = G220 * G1921;
-  const C<F> G1992 = G224 * G1923;
-  const C<F> G1993 = G228 * G1925;
-  const C<F> G1994 = G1991 + G1992 + G1993;
-  const C<F> G1995 = G1310 * G1994;
-  const C<F> G1996 = G228 * G1920;
-  const C<F> G1997 = G1810 + G1589 + G1996;
-  const C<F> G1998 = G1319 * G1997;
-  const C<F> G1999 = C1 * G1998;
-  const C<F> G2000 = G1995 + G1999;
-  const C<F> G2001 = G217 * G2000;
-  const C<F> G2002 = G1331 * G1994;
-  const C<F> G2003 = G220 * G1936;
-  const C<F> G2004 = G224 * G1530;
-  const C<F> G2005 = G2003 + G2004 + G1351;
-  const C<F> G2006 = G1319 * G2005;
-  const C<F> G2007 = C1 * G2006;
-  const C<F> G2008 = G2002 + G2007;
-  const C<F> G2009 = G259 * G2008;
-  const C<F> G2010 = C1 * G2009;
-  const C<F> G2011 = G2001 + G2010;
-  const C<F> G2012 = G277 * G2000;
-  const C<F> G2013 = G1347 * G1994;
-  const C<F> G2014 = G220 * G1507;
-  const C<F> G2015 = G224 * G1936;
-  const C<F> G2016 = G228 * G1188;
-  const C<F> G2017 = G2014 + G2015 + G2016;
-  const C<F> G2018 = G1319 * G2017;
-  const C<F> G2019 = C1 * G2018;
-  const C<F> G2020 = G2013 + G2019;
-  const C<F> G2021 = G259 * G2020;
-  const C<F> G2022 = C1 * G2021;
-  const C<F> G2023 = G2012 + G2022;
-  const C<F> G2024 = G311 * G1921;
-  const C<F> G2025 = G315 * G1923;
-  const C<F> G2026 = G319 * G1925;
-  const C<F> G2027 = G2024 + G2025 + G2026;
-  const C<F> G2028 = G1362 * G2027;
-  const C<F> G2029 = G319 * G1920;
-  const C<F> G2030 = G1844 + G1624 + G2029;
-  const C<F> G2031 = G1371 * G2030;
-  const C<F> G2032 = C1 * G2031;
-  const C<F> G2033 = G2028 + G2032;
-  const C<F> G2034 = G302 * G2033;
-  const C<F> G2035 = G1383 * G2027;
-  const C<F> G2036 = G311 * G1936;
-  const C<F> G2037 = G315 * G1530;
-  const C<F> G2038 = G2036 + G2037 + G1403;
-  const C<F> G2039 = G1371 * G2038;
-  const C<F> G2040 = C1 * G2039;
-  const C<F> G2041 = G2035 + G2040;
-  const C<F> G2042 = G356 * G2041;
-  const C<F> G2043 = C1 * G2042;
-  const C<F> G2044 = G2034 + G2043;
-  const C<F> G2045 = G374 * G2033;
-  const C<F> G2046 = G1399 * G2027;
-  const C<F> G2047 = G311 * G1507;
-  const C<F> G2048 = G315 * G1936;
-  const C<F> G2049 = G319 * G1188;
-  const C<F> G2050 = G2047 + G2048 + G2049;
-  const C<F> G2051 = G1371 * G2050;
-  const C<F> G2052 = C1 * G2051;
-  const C<F> G2053 = G2046 + G2052;
-  const C<F> G2054 = G356 * G2053;
-  const C<F> G2055 = C1 * G2054;
-  const C<F> G2056 = G2045 + G2055;
-  const C<F> G2057 = G408 * G1921;
-  const C<F> G2058 = G412 * G1923;
-  const C<F> G2059 = G416 * G1925;
-  const C<F> G2060 = G2057 + G2058 + G2059;
-  const C<F> G2061 = G1414 * G2060;
-  const C<F> G2062 = G416 * G1920;
-  const C<F> G2063 = G1878 + G1659 + G2062;
-  const C<F> G2064 = G1423 * G2063;
-  const C<F> G2065 = C1 * G2064;
-  const C<F> G2066 = G2061 + G2065;
-  const C<F> G2067 = G399 * G2066;
-  const C<F> G2068 = G1435 * G2060;
-  const C<F> G2069 = G408 * G1936;
-  const C<F> G2070 = G412 * G1530;
-  const C<F> G2071 = G2069 + G2070 + G1455;
-  const C<F> G2072 = G1423 * G2071;
-  const C<F> G2073 = C1 * G2072;
-  const C<F> G2074 = G2068 + G2073;
-  const C<F> G2075 = G453 * G2074;
-  const C<F> G2076 = C1 * G2075;
-  const C<F> G2077 = G2067 + G2076;
-  const C<F> G2078 = G471 * G2066;
-  const C<F> G2079 = G1451 * G2060;
-  const C<F> G2080 = G408 * G1507;
-  const C<F> G2081 = G412 * G1936;
-  const C<F> G2082 = G416 * G1188;
-  const C<F> G2083 = G2080 + G2081 + G2082;
-  const C<F> G2084 = G1423 * G2083;
-  const C<F> G2085 = C1 * G2084;
-  const C<F> G2086 = G2079 + G2085;
-  const C<F> G2087 = G453 * G2086;
-  const C<F> G2088 = C1 * G2087;
-  const C<F> G2089 = G2078 + G2088;
-  const C<F> G2090 = G1310 * G1961;
-  const C<F> G2091 = G1319 * G1964;
-  const C<F> G2092 = C1 * G2091;
-  const C<F> G2093 = G2090 + G2092;
-  const C<F> G2094 = G277 * G2093;
-  const C<F> G2095 = G1347 * G1961;
-  const C<F> G2096 = G1319 * G1984;
-  const C<F> G2097 = C1 * G2096;
-  const C<F> G2098 = G2095 + G2097;
-  const C<F> G2099 = G259 * G2098;
-  const C<F> G2100 = C1 * G2099;
-  const C<F> G2101 = G2094 + G2100;
-  const C<F> G2102 = G138 * G2101;
-  const C<F> G2103 = G217 * G2093;
-  const C<F> G2104 = G1331 * G1961;
-  const C<F> G2105 = G1319 * G1972;
-  const C<F> G2106 = C1 * G2105;
-  const C<F> G2107 = G2104 + G2106;
-  const C<F> G2108 = G259 * G2107;
-  const C<F> G2109 = C1 * G2108;
-  const C<F> G2110 = G2103 + G2109;
-  const C<F> G2111 = G198 * G2110;
-  const C<F> G2112 = C1 * G2111;
-  const C<F> G2113 = G2102 + G2112;
-  const C<F> G2114 = G217 * G2098;
-  const C<F> G2115 = G277 * G2107;
-  const C<F> G2116 = C1 * G2115;
-  const C<F> G2117 = G2114 + G2116;
-  const C<F> G2118 = G180 * G2117;
-  const C<F> G2119 = G2113 + G2118;
-  const C<F> G2120 = G1 * X69;
-  const C<F> G2121 = t * X125;
-  const C<F> G2122 = G2120 + G2121;
-  const C<F> G2123 = G30 * G1180;
-  const C<F> G2124 = G62 * G2123;
-  const C<F> G2125 = C1 * G2124;
-  const C<F> G2126 = G4 * G2125;
-  const C<F> G2127 = G98 * G2123;
-  const C<F> G2128 = C1 * G2127;
-  const C<F> G2129 = G76 * G2128;
-  const C<F> G2130 = C1 * G2129;
-  const C<F> G2131 = G2126 + G2130;
-  const C<F> G2132 = G107 * G2125;
-  const C<F> G2133 = G129 * G2123;
-  const C<F> G2134 = C1 * G2133;
-  const C<F> G2135 = G76 * G2134;
-  const C<F> G2136 = C1 * G2135;
-  const C<F> G2137 = G2132 + G2136;
-  const C<F> G2138 = G154 * G1180;
-  const C<F> G2139 = G169 * G2138;
-  const C<F> G2140 = C1 * G2139;
-  const C<F> G2141 = G138 * G2140;
-  const C<F> G2142 = G189 * G2138;
-  const C<F> G2143 = C1 * G2142;
-  const C<F> G2144 = G180 * G2143;
-  const C<F> G2145 = C1 * G2144;
-  const C<F> G2146 = G2141 + G2145;
-  const C<F> G2147 = G198 * G2140;
-  const C<F> G2148 = G208 * G2138;
-  const C<F> G2149 = C1 * G2148;
-  const C<F> G2150 = G180 * G2149;
-  const C<F> G2151 = C1 * G2150;
-  const C<F> G2152 = G2147 + G2151;
-  const C<F> G2153 = G233 * G1180;
-  const C<F> G2154 = G248 * G2153;
-  const C<F> G2155 = C1 * G2154;
-  const C<F> G2156 = G217 * G2155;
-  const C<F> G2157 = G268 * G2153;
-  const C<F> G2158 = C1 * G2157;
-  const C<F> G2159 = G259 * G2158;
-  const C<F> G2160 = C1 * G2159;
-  const C<F> G2161 = G2156 + G2160;
-  const C<F> G2162 = G277 * G2155;
-  const C<F> G2163 = G287 * G2153;
-  const C<F> G2164 = C1 * G2163;
-  const C<F> G2165 = G259 * G2164;
-  const C<F> G2166 = C1 * G2165;
-  const C<F> G2167 = G2162 + G2166;
-  const C<F> G2168 = G330 * G1180;
-  const C<F> G2169 = G345 * G2168;
-  const C<F> G2170 = C1 * G2169;
-  const C<F> G2171 = G302 * G2170;
-  const C<F> G2172 = G365 * G2168;
-  const C<F> G2173 = C1 * G2172;
-  const C<F> G2174 = G356 * G2173;
-  const C<F> G2175 = C1 * G2174;
-  const C<F> G2176 = G2171 + G2175;
-  const C<F> G2177 = G374 * G2170;
-  const C<F> G2178 = G384 * G2168;
-  const C<F> G2179 = C1 * G2178;
-  const C<F> G2180 = G356 * G2179;
-  const C<F> G2181 = C1 * G2180;
-  const C<F> G2182 = G2177 + G2181;
-  const C<F> G2183 = G427 * G1180;
-  const C<F> G2184 = G442 * G2183;
-  const C<F> G2185 = C1 * G2184;
-  const C<F> G2186 = G399 * G2185;
-  const C<F> G2187 = G462 * G2183;
-  const C<F> G2188 = C1 * G2187;
-  const C<F> G2189 = G453 * G2188;
-  const C<F> G2190 = C1 * G2189;
-  const C<F> G2191 = G2186 + G2190;
-  const C<F> G2192 = G471 * G2185;
-  const C<F> G2193 = G481 * G2183;
-  const C<F> G2194 = C1 * G2193;
-  const C<F> G2195 = G453 * G2194;
-  const C<F> G2196 = C1 * G2195;
-  const C<F> G2197 = G2192 + G2196;
-  const C<F> G2198 = G169 * G2153;
-  const C<F> G2199 = C1 * G2198;
-  const C<F> G2200 = G277 * G2199;
-  const C<F> G2201 = G208 * G2153;
-  const C<F> G2202 = C1 * G2201;
-  const C<F> G2203 = G259 * G2202;
-  const C<F> G2204 = C1 * G2203;
-  const C<F> G2205 = G2200 + G2204;
-  const C<F> G2206 = G138 * G2205;
-  const C<F> G2207 = G217 * G2199;
-  const C<F> G2208 = G189 * G2153;
-  const C<F> G2209 = C1 * G2208;
-  const C<F> G2210 = G259 * G2209;
-  const C<F> G2211 = C1 * G2210;
-  const C<F> G2212 = G2207 + G2211;
-  const C<F> G2213 = G198 * G2212;
-  const C<F> G2214 = C1 * G2213;
-  const C<F> G2215 = G2206 + G2214;
-  const C<F> G2216 = G217 * G2202;
-  const C<F> G2217 = G277 * G2209;
-  const C<F> G2218 = C1 * G2217;
-  const C<F> G2219 = G2216 + G2218;
-  const C<F> G2220 = G180 * G2219;
-  const C<F> G2221 = G2215 + G2220;
-  const C<F> G2222 = G1 * X54;
-  const C<F> G2223 = t * X110;
-  const C<F> G2224 = G2222 + G2223;
-  const C<F> G2225 = G35 * G1180;
-  const C<F> G2226 = G62 * G2225;
-  const C<F> G2227 = C1 * G2226;
-  const C<F> G2228 = G4 * G2227;
-  const C<F> G2229 = G98 * G2225;
-  const C<F> G2230 = C1 * G2229;
-  const C<F> G2231 = G76 * G2230;
-  const C<F> G2232 = C1 * G2231;
-  const C<F> G2233 = G2228 + G2232;
-  const C<F> G2234 = G107 * G2227;
-  const C<F> G2235 = G129 * G2225;
-  const C<F> G2236 = C1 * G2235;
-  const C<F> G2237 = G76 * G2236;
-  const C<F> G2238 = C1 * G2237;
-  const C<F> G2239 = G2234 + G2238;
-  const C<F> G2240 = G158 * G1180;
-  const C<F> G2241 = G169 * G2240;
-  const C<F> G2242 = C1 * G2241;
-  const C<F> G2243 = G138 * G2242;
-  const C<F> G2244 = G189 * G2240;
-  const C<F> G2245 = C1 * G2244;
-  const C<F> G2246 = G180 * G2245;
-  const C<F> G2247 = C1 * G2246;
-  const C<F> G2248 = G2243 + G2247;
-  const C<F> G2249 = G198 * G2242;
-  const C<F> G2250 = G208 * G2240;
-  const C<F> G2251 = C1 * G2250;
-  const C<F> G2252 = G180 * G2251;
-  const C<F> G2253 = C1 * G2252;
-  const C<F> G2254 = G2249 + G2253;
-  const C<F> G2255 = G237 * G1180;
-  const C<F> G2256 = G248 * G2255;
-  const C<F> G2257 = C1 * G2256;
-  const C<F> G2258 = G217 * G2257;
-  const C<F> G2259 = G268 * G2255;
-  const C<F> G2260 = C1 * G2259;
-  const C<F> G2261 = G259 * G2260;
-  const C<F> G2262 = C1 * G2261;
-  const C<F> G2263 = G2258 + G2262;
-  const C<F> G2264 = G277 * G2257;
-  const C<F> G2265 = G287 * G2255;
-  const C<F> G2266 = C1 * G2265;
-  const C<F> G2267 = G259 * G2266;
-  const C<F> G2268 = C1 * G2267;
-  const C<F> G2269 = G2264 + G2268;
-  const C<F> G2270 = G334 * G1180;
-  const C<F> G2271 = G345 * G2270;
-  const C<F> G2272 = C1 * G2271;
-  const C<F> G2273 = G302 * G2272;
-  const C<F> G2274 = G365 * G2270;
-  const C<F> G2275 = C1 * G2274;
-  const C<F> G2276 = G356 * G2275;
-  const C<F> G2277 = C1 * G2276;
-  const C<F> G2278 = G2273 + G2277;
-  const C<F> G2279 = G374 * G2272;
-  const C<F> G2280 = G384 * G2270;
-  const C<F> G2281 = C1 * G2280;
-  const C<F> G2282 = G356 * G2281;
-  const C<F> G2283 = C1 * G2282;
-  const C<F> G2284 = G2279 + G2283;
-  const C<F> G2285 = G431 * G1180;
-  const C<F> G2286 = G442 * G2285;
-  const C<F> G2287 = C1 * G2286;
-  const C<F> G2288 = G399 * G2287;
-  const C<F> G2289 = G462 * G2285;
-  const C<F> G2290 = C1 * G2289;
-  const C<F> G2291 = G453 * G2290;
-  const C<F> G2292 = C1 * G2291;
-  const C<F> G2293 = G2288 + G2292;
-  const C<F> G2294 = G471 * G2287;
-  const C<F> G2295 = G481 * G2285;
-  const C<F> G2296 = C1 * G2295;
-  const C<F> G2297 = G453 * G2296;
-  const C<F> G2298 = C1 * G2297;
-  const C<F> G2299 = G2294 + G2298;
-  const C<F> G2300 = G169 * G2255;
-  const C<F> G2301 = C1 * G2300;
-  const C<F> G2302 = G277 * G2301;
-  const C<F> G2303 = G208 * G2255;
-  const C<F> G2304 = C1 * G2303;
-  const C<F> G2305 = G259 * G2304;
-  const C<F> G2306 = C1 * G2305;
-  const C<F> G2307 = G2302 + G2306;
-  const C<F> G2308 = G138 * G2307;
-  const C<F> G2309 = G217 * G2301;
-  const C<F> G2310 = G189 * G2255;
-  const C<F> G2311 = C1 * G2310;
-  const C<F> G2312 = G259 * G2311;
-  const C<F> G2313 = C1 * G2312;
-  const C<F> G2314 = G2309 + G2313;
-  const C<F> G2315 = G198 * G2314;
-  const C<F> G2316 = C1 * G2315;
-  const C<F> G2317 = G2308 + G2316;
-  const C<F> G2318 = G217 * G2304;
-  const C<F> G2319 = G277 * G2311;
-  const C<F> G2320 = C1 * G2319;
-  const C<F> G2321 = G2318 + G2320;
-  const C<F> G2322 = G180 * G2321;
-  const C<F> G2323 = G2317 + G2322;
-  const C<F> G2324 = G1 * X55;
-  const C<F> G2325 = t * X111;
-  const C<F> G2326 = G2324 + G2325;
-  const C<F> G2327 = G41 * G1180;
-  const C<F> G2328 = G62 * G2327;
-  const C<F> G2329 = C1 * G2328;
-  const C<F> G2330 = G4 * G2329;
-  const C<F> G2331 = G98 * G2327;
-  const C<F> G2332 = C1 * G2331;
-  const C<F> G2333 = G76 * G2332;
-  const C<F> G2334 = C1 * G2333;
-  const C<F> G2335 = G2330 + G2334;
-  const C<F> G2336 = G107 * G2329;
-  const C<F> G2337 = G129 * G2327;
-  const C<F> G2338 = C1 * G2337;
-  const C<F> G2339 = G76 * G2338;
-  const C<F> G2340 = C1 * G2339;
-  const C<F> G2341 = G2336 + G2340;
-  const C<F> G2342 = G162 * G1180;
-  const C<F> G2343 = G169 * G2342;
-  const C<F> G2344 = C1 * G2343;
-  const C<F> G2345 = G138 * G2344;
-  const C<F> G2346 = G189 * G2342;
-  const C<F> G2347 = C1 * G2346;
-  const C<F> G2348 = G180 * G2347;
-  const C<F> G2349 = C1 * G2348;
-  const C<F> G2350 = G2345 + G2349;
-  const C<F> G2351 = G198 * G2344;
-  const C<F> G2352 = G208 * G2342;
-  const C<F> G2353 = C1 * G2352;
-  const C<F> G2354 = G180 * G2353;
-  const C<F> G2355 = C1 * G2354;
-  const C<F> G2356 = G2351 + G2355;
-  const C<F> G2357 = G241 * G1180;
-  const C<F> G2358 = G248 * G2357;
-  const C<F> G2359 = C1 * G2358;
-  const C<F> G2360 = G217 * G2359;
-  const C<F> G2361 = G268 * G2357;
-  const C<F> G2362 = C1 * G2361;
-  const C<F> G2363 = G259 * G2362;
-  const C<F> G2364 = C1 * G2363;
-  const C<F> G2365 = G2360 + G2364;
-  const C<F> G2366 = G277 * G2359;
-  const C<F> G2367 = G287 * G2357;
-  const C<F> G2368 = C1 * G2367;
-  const C<F> G2369 = G259 * G2368;
-  const C<F> G2370 = C1 * G2369;
-  const C<F> G2371 = G2366 + G2370;
-  const C<F> G2372 = G338 * G1180;
-  const C<F> G2373 = G345 * G2372;
-  const C<F> G2374 = C1 * G2373;
-  const C<F> G2375 = G302 * G2374;
-  const C<F> G2376 = G365 * G2372;
-  const C<F> G2377 = C1 * G2376;
-  const C<F> G2378 = G356 * G2377;
-  const C<F> G2379 = C1 * G2378;
-  const C<F> G2380 = G2375 + G2379;
-  const C<F> G2381 = G374 * G2374;
-  const C<F> G2382 = G384 * G2372;
-  const C<F> G2383 = C1 * G2382;
-  const C<F> G2384 = G356 * G2383;
-  const C<F> G2385 = C1 * G2384;
-  const C<F> G2386 = G2381 + G2385;
-  const C<F> G2387 = G435 * G1180;
-  const C<F> G2388 = G442 * G2387;
-  const C<F> G2389 = C1 * G2388;
-  const C<F> G2390 = G399 * G2389;
-  const C<F> G2391 = G462 * G2387;
-  const C<F> G2392 = C1 * G2391;
-  const C<F> G2393 = G453 * G2392;
-  const C<F> G2394 = C1 * G2393;
-  const C<F> G2395 = G2390 + G2394;
-  const C<F> G2396 = G471 * G2389;
-  const C<F> G2397 = G481 * G2387;
-  const C<F> G2398 = C1 * G2397;
-  const C<F> G2399 = G453 * G2398;
-  const C<F> G2400 = C1 * G2399;
-  const C<F> G2401 = G2396 + G2400;
-  const C<F> G2402 = G169 * G2357;
-  const C<F> G2403 = C1 * G2402;
-  const C<F> G2404 = G277 * G2403;
-  const C<F> G2405 = G208 * G2357;
-  const C<F> G2406 = C1 * G2405;
-  const C<F> G2407 = G259 * G2406;
-  const C<F> G2408 = C1 * G2407;
-  const C<F> G2409 = G2404 + G2408;
-  const C<F> G2410 = G138 * G2409;
-  const C<F> G2411 = G217 * G2403;
-  const C<F> G2412 = G189 * G2357;
-  const C<F> G2413 = C1 * G2412;
-  const C<F> G2414 = G259 * G2413;
-  const C<F> G2415 = C1 * G2414;
-  const C<F> G2416 = G2411 + G2415;
-  const C<F> G2417 = G198 * G2416;
-  const C<F> G2418 = C1 * G2417;
-  const C<F> G2419 = G2410 + G2418;
-  const C<F> G2420 = G217 * G2406;
-  const C<F> G2421 = G277 * G2413;
-  const C<F> G2422 = C1 * G2421;
-  const C<F> G2423 = G2420 + G2422;
-  const C<F> G2424 = G180 * G2423;
-  const C<F> G2425 = G2419 + G2424;
-  const C<F> G2426 = G1 * X56;
-  const C<F> G2427 = t * X112;
-  const C<F> G2428 = G2426 + G2427;
-  const C<F> G2429 = G7 * G14;
-  const C<F> G2430 = G1168 * G2429;
-  const C<F> G2431 = G4 * G2430;
-  const C<F> G2432 = G1212 * G2429;
-  const C<F> G2433 = G76 * G2432;
-  const C<F> G2434 = C1 * G2433;
-  const C<F> G2435 = G2431 + G2434;
-  const C<F> G2436 = G107 * G2430;
-  const C<F> G2437 = G1240 * G2429;
-  const C<F> G2438 = G76 * G2437;
-  const C<F> G2439 = C1 * G2438;
-  const C<F> G2440 = G2436 + G2439;
-  const C<F> G2441 = G141 * G14;
-  const C<F> G2442 = G1258 * G2441;
-  const C<F> G2443 = G138 * G2442;
-  const C<F> G2444 = G1279 * G2441;
-  const C<F> G2445 = G180 * G2444;
-  const C<F> G2446 = C1 * G2445;
-  const C<F> G2447 = G2443 + G2446;
-  const C<F> G2448 = G198 * G2442;
-  const C<F> G2449 = G1295 * G2441;
-  const C<F> G2450 = G180 * G2449;
-  const C<F> G2451 = C1 * G2450;
-  const C<F> G2452 = G2448 + G2451;
-  const C<F> G2453 = G220 * G14;
-  const C<F> G2454 = G1310 * G2453;
-  const C<F> G2455 = G217 * G2454;
-  const C<F> G2456 = G1331 * G2453;
-  const C<F> G2457 = G259 * G2456;
-  const C<F> G2458 = C1 * G2457;
-  const C<F> G2459 = G2455 + G2458;
-  const C<F> G2460 = G277 * G2454;
-  const C<F> G2461 = G1347 * G2453;
-  const C<F> G2462 = G259 * G2461;
-  const C<F> G2463 = C1 * G2462;
-  const C<F> G2464 = G2460 + G2463;
-  const C<F> G2465 = G311 * G14;
-  const C<F> G2466 = G1362 * G2465;
-  const C<F> G2467 = G302 * G2466;
-  const C<F> G2468 = G1383 * G2465;
-  const C<F> G2469 = G356 * G2468;
-  const C<F> G2470 = C1 * G2469;
-  const C<F> G2471 = G2467 + G2470;
-  const C<F> G2472 = G374 * G2466;
-  const C<F> G2473 = G1399 * G2465;
-  const C<F> G2474 = G356 * G2473;
-  const C<F> G2475 = C1 * G2474;
-  const C<F> G2476 = G2472 + G2475;
-  const C<F> G2477 = G408 * G14;
-  const C<F> G2478 = G1414 * G2477;
-  const C<F> G2479 = G399 * G2478;
-  const C<F> G2480 = G1435 * G2477;
-  const C<F> G2481 = G453 * G2480;
-  const C<F> G2482 = C1 * G2481;
-  const C<F> G2483 = G2479 + G2482;
-  const C<F> G2484 = G471 * G2478;
-  const C<F> G2485 = G1451 * G2477;
-  const C<F> G2486 = G453 * G2485;
-  const C<F> G2487 = C1 * G2486;
-  const C<F> G2488 = G2484 + G2487;
-  const C<F> G2489 = G1310 * G2441;
-  const C<F> G2490 = G277 * G2489;
-  const C<F> G2491 = G1347 * G2441;
-  const C<F> G2492 = G259 * G2491;
-  const C<F> G2493 = C1 * G2492;
-  const C<F> G2494 = G2490 + G2493;
-  const C<F> G2495 = G138 * G2494;
-  const C<F> G2496 = G217 * G2489;
-  const C<F> G2497 = G1331 * G2441;
-  const C<F> G2498 = G259 * G2497;
-  const C<F> G2499 = C1 * G2498;
-  const C<F> G2500 = G2496 + G2499;
-  const C<F> G2501 = G198 * G2500;
-  const C<F> G2502 = C1 * G2501;
-  const C<F> G2503 = G2495 + G2502;
-  const C<F> G2504 = G217 * G2491;
-  const C<F> G2505 = G277 * G2497;
-  const C<F> G2506 = C1 * G2505;
-  const C<F> G2507 = G2504 + G2506;
-  const C<F> G2508 = G180 * G2507;
-  const C<F> G2509 = G2503 + G2508;
-  const C<F> G2510 = G1 * X57;
-  const C<F> G2511 = t * X113;
-  const C<F> G2512 = G2510 + G2511;
-  const C<F> G2513 = G19 * G14;
-  const C<F> G2514 = G1168 * G2513;
-  const C<F> G2515 = G4 * G2514;
-  const C<F> G2516 = G1212 * G2513;
-  const C<F> G2517 = G76 * G2516;
-  const C<F> G2518 = C1 * G2517;
-  const C<F> G2519 = G2515 + G2518;
-  const C<F> G2520 = G107 * G2514;
-  const C<F> G2521 = G1240 * G2513;
-  const C<F> G2522 = G76 * G2521;
-  const C<F> G2523 = C1 * G2522;
-  const C<F> G2524 = G2520 + G2523;
-  const C<F> G2525 = G145 * G14;
-  const C<F> G2526 = G1258 * G2525;
-  const C<F> G2527 = G138 * G2526;
-  const C<F> G2528 = G1279 * G2525;
-  const C<F> G2529 = G180 * G2528;
-  const C<F> G2530 = C1 * G2529;
-  const C<F> G2531 = G2527 + G2530;
-  const C<F> G2532 = G198 * G2526;
-  const C<F> G2533 = G1295 * G2525;
-  const C<F> G2534 = G180 * G2533;
-  const C<F> G2535 = C1 * G2534;
-  const C<F> G2536 = G2532 + G2535;
-  const C<F> G2537 = G224 * G14;
-  const C<F> G2538 = G1310 * G2537;
-  const C<F> G2539 = G217 * G2538;
-  const C<F> G2540 = G1331 * G2537;
-  const C<F> G2541 = G259 * G2540;
-  const C<F> G2542 = C1 * G2541;
-  const C<F> G2543 = G2539 + G2542;
-  const C<F> G2544 = G277 * G2538;
-  const C<F> G2545 = G1347 * G2537;
-  const C<F> G2546 = G259 * G2545;
-  const C<F> G2547 = C1 * G2546;
-  const C<F> G2548 = G2544 + G2547;
-  const C<F> G2549 = G315 * G14;
-  const C<F> G2550 = G1362 * G2549;
-  const C<F> G2551 = G302 * G2550;
-  const C<F> G2552 = G1383 * G2549;
-  const C<F> G2553 = G356 * G2552;
-  const C<F> G2554 = C1 * G2553;
-  const C<F> G2555 = G2551 + G2554;
-  const C<F> G2556 = G374 * G2550;
-  const C<F> G2557 = G1399 * G2549;
-  const C<F> G2558 = G356 * G2557;
-  const C<F> G2559 = C1 * G2558;
-  const C<F> G2560 = G2556 + G2559;
-  const C<F> G2561 = G412 * G14;
-  const C<F> G2562 = G1414 * G2561;
-  const C<F> G2563 = G399 * G2562;
-  const C<F> G2564 = G1435 * G2561;
-  const C<F> G2565 = G453 * G2564;
-  const C<F> G2566 = C1 * G2565;
-  const C<F> G2567 = G2563 + G2566;
-  const C<F> G2568 = G471 * G2562;
-  const C<F> G2569 = G1451 * G2561;
-  const C<F> G2570 = G453 * G2569;
-  const C<F> G2571 = C1 * G2570;
-  const C<F> G2572 = G2568 + G2571;
-  const C<F> G2573 = G1310 * G2525;
-  const C<F> G2574 = G277 * G2573;
-  const C<F> G2575 = G1347 * G2525;
-  const C<F> G2576 = G259 * G2575;
-  const C<F> G2577 = C1 * G2576;
-  const C<F> G2578 = G2574 + G2577;
-  const C<F> G2579 = G138 * G2578;
-  const C<F> G2580 = G217 * G2573;
-  const C<F> G2581 = G1331 * G2525;
-  const C<F> G2582 = G259 * G2581;
-  const C<F> G2583 = C1 * G2582;
-  const C<F> G2584 = G2580 + G2583;
-  const C<F> G2585 = G198 * G2584;
-  const C<F> G2586 = C1 * G2585;
-  const C<F> G2587 = G2579 + G2586;
-  const C<F> G2588 = G217 * G2575;
-  const C<F> G2589 = G277 * G2581;
-  const C<F> G2590 = C1 * G2589;
-  const C<F> G2591 = G2588 + G2590;
-  const C<F> G2592 = G180 * G2591;
-  const C<F> G2593 = G2587 + G2592;
-  const C<F> G2594 = G1 * X58;
-  const C<F> G2595 = t * X114;
-  const C<F> G2596 = G2594 + G2595;
-  const C<F> G2597 = G24 * G14;
-  const C<F> G2598 = G1168 * G2597;
-  const C<F> G2599 = G4 * G2598;
-  const C<F> G2600 = G1212 * G2597;
-  const C<F> G2601 = G76 * G2600;
-  const C<F> G2602 = C1 * G2601;
-  const C<F> G2603 = G2599 + G2602;
-  const C<F> G2604 = G107 * G2598;
-  const C<F> G2605 = G1240 * G2597;
-  const C<F> G2606 = G76 * G2605;
-  const C<F> G2607 = C1 * G2606;
-  const C<F> G2608 = G2604 + G2607;
-  const C<F> G2609 = G149 * G14;
-  const C<F> G2610 = G1258 * G2609;
-  const C<F> G2611 = G138 * G2610;
-  const C<F> G2612 = G1279 * G2609;
-  const C<F> G2613 = G180 * G2612;
-  const C<F> G2614 = C1 * G2613;
-  const C<F> G2615 = G2611 + G2614;
-  const C<F> G2616 = G198 * G2610;
-  const C<F> G2617 = G1295 * G2609;
-  const C<F> G2618 = G180 * G2617;
-  const C<F> G2619 = C1 * G2618;
-  const C<F> G2620 = G2616 + G2619;
-  const C<F> G2621 = G228 * G14;
-  const C<F> G2622 = G1310 * G2621;
-  const C<F> G2623 = G217 * G2622;
-  const C<F> G2624 = G1331 * G2621;
-  const C<F> G2625 = G259 * G2624;
-  const C<F> G2626 = C1 * G2625;
-  const C<F> G2627 = G2623 + G2626;
-  const C<F> G2628 = G277 * G2622;
-  const C<F> G2629 = G1347 * G2621;
-  const C<F> G2630 = G259 * G2629;
-  const C<F> G2631 = C1 * G2630;
-  const C<F> G2632 = G2628 + G2631;
-  const C<F> G2633 = G319 * G14;
-  const C<F> G2634 = G1362 * G2633;
-  const C<F> G2635 = G302 * G2634;
-  const C<F> G2636 = G1383 * G2633;
-  const C<F> G2637 = G356 * G2636;
-  const C<F> G2638 = C1 * G2637;
-  const C<F> G2639 = G2635 + G2638;
-  const C<F> G2640 = G374 * G2634;
-  const C<F> G2641 = G1399 * G2633;
-  const C<F> G2642 = G356 * G2641;
-  const C<F> G2643 = C1 * G2642;
-  const C<F> G2644 = G2640 + G2643;
-  const C<F> G2645 = G416 * G14;
-  const C<F> G2646 = G1414 * G2645;
-  const C<F> G2647 = G399 * G2646;
-  const C<F> G2648 = G1435 * G2645;
-  const C<F> G2649 = G453 * G2648;
-  const C<F> G2650 = C1 * G2649;
-  const C<F> G2651 = G2647 + G2650;
-  const C<F> G2652 = G471 * G2646;
-  const C<F> G2653 = G1451 * G2645;
-  const C<F> G2654 = G453 * G2653;
-  const C<F> G2655 = C1 * G2654;
-  const C<F> G2656 = G2652 + G2655;
-  const C<F> G2657 = G1310 * G2609;
-  const C<F> G2658 = G277 * G2657;
-  const C<F> G2659 = G1347 * G2609;
-  const C<F> G2660 = G259 * G2659;
-  const C<F> G2661 = C1 * G2660;
-  const C<F> G2662 = G2658 + G2661;
-  const C<F> G2663 = G138 * G2662;
-  const C<F> G2664 = G217 * G2657;
-  const C<F> G2665 = G1331 * G2609;
-  const C<F> G2666 = G259 * G2665;
-  const C<F> G2667 = C1 * G2666;
-  const C<F> G2668 = G2664 + G2667;
-  const C<F> G2669 = G198 * G2668;
-  const C<F> G2670 = C1 * G2669;
-  const C<F> G2671 = G2663 + G2670;
-  const C<F> G2672 = G217 * G2659;
-  const C<F> G2673 = G277 * G2665;
-  const C<F> G2674 = C1 * G2673;
-  const C<F> G2675 = G2672 + G2674;
-  const C<F> G2676 = G180 * G2675;
-  const C<F> G2677 = G2671 + G2676;
-  const C<F> G2678 = G1 * X59;
-  const C<F> G2679 = t * X115;
-  const C<F> G2680 = G2678 + G2679;
-  const C<F> G2681 = G1168 * G27;
-  const C<F> G2682 = G62 * G1187;
-  const C<F> G2683 = C1 * G2682;
-  const C<F> G2684 = G2681 + G2683;
-  const C<F> G2685 = G4 * G2684;
-  const C<F> G2686 = G1212 * G27;
-  const C<F> G2687 = G98 * G1187;
-  const C<F> G2688 = C1 * G2687;
-  const C<F> G2689 = G2686 + G2688;
-  const C<F> G2690 = G76 * G2689;
-  const C<F> G2691 = C1 * G2690;
-  const C<F> G2692 = G2685 + G2691;
-  const C<F> G2693 = G107 * G2684;
-  const C<F> G2694 = G1240 * G27;
-  const C<F> G2695 = G129 * G1187;
-  const C<F> G2696 = C1 * G2695;
-  const C<F> G2697 = G2694 + G2696;
-  const C<F> G2698 = G76 * G2697;
-  const C<F> G2699 = C1 * G2698;
-  const C<F> G2700 = G2693 + G2699;
-  const C<F> G2701 = G1258 * G151;
-  const C<F> G2702 = G169 * G1267;
-  const C<F> G2703 = C1 * G2702;
-  const C<F> G2704 = G2701 + G2703;
-  const C<F> G2705 = G138 * G2704;
-  const C<F> G2706 = G1279 * G151;
-  const C<F> G2707 = G189 * G1267;
-  const C<F> G2708 = C1 * G2707;
-  const C<F> G2709 = G2706 + G2708;
-  const C<F> G2710 = G180 * G2709;
-  const C<F> G2711 = C1 * G2710;
-  const C<F> G2712 = G2705 + G2711;
-  const C<F> G2713 = G198 * G2704;
-  const C<F> G2714 = G1295 * G151;
-  const C<F> G2715 = G208 * G1267;
-  const C<F> G2716 = C1 * G2715;
-  const C<F> G2717 = G2714 + G2716;
-  const C<F> G2718 = G180 * G2717;
-  const C<F> G2719 = C1 * G2718;
-  const C<F> G2720 = G2713 + G2719;
-  const C<F> G2721 = G1310 * G230;
-  const C<F> G2722 = G248 * G1319;
-  const C<F> G2723 = C1 * G2722;
-  const C<F> G2724 = G2721 + G2723;
-  const C<F> G2725 = G217 * G2724;
-  const C<F> G2726 = G1331 * G230;
-  const C<F> G2727 = G268 * G1319;
-  const C<F> G2728 = C1 * G2727;
-  const C<F> G2729 = G2726 + G2728;
-  const C<F> G2730 = G259 * G2729;
-  const C<F> G2731 = C1 * G2730;
-  const C<F> G2732 = G2725 + G2731;
-  const C<F> G2733 = G277 * G2724;
-  const C<F> G2734 = G1347 * G230;
-  const C<F> G2735 = G287 * G1319;
-  const C<F> G2736 = C1 * G2735;
-  const C<F> G2737 = G2734 + G2736;
-  const C<F> G2738 = G259 * G2737;
-  const C<F> G2739 = C1 * G2738;
-  const C<F> G2740 = G2733 + G2739;
-  const C<F> G2741 = G1362 * G321;
-  const C<F> G2742 = G345 * G1371;
-  const C<F> G2743 = C1 * G2742;
-  const C<F> G2744 = G2741 + G2743;
-  const C<F> G2745 = G302 * G2744;
-  const C<F> G2746 = G1383 * G321;
-  const C<F> G2747 = G365 * G1371;
-  const C<F> G2748 = C1 * G2747;
-  const C<F> G2749 = G2746 + G2748;
-  const C<F> G2750 = G356 * G2749;
-  const C<F> G2751 = C1 * G2750;
-  const C<F> G2752 = G2745 + G2751;
-  const C<F> G2753 = G374 * G2744;
-  const C<F> G2754 = G1399 * G321;
-  const C<F> G2755 = G384 * G1371;
-  const C<F> G2756 = C1 * G2755;
-  const C<F> G2757 = G2754 + G2756;
-  const C<F> G2758 = G356 * G2757;
-  const C<F> G2759 = C1 * G2758;
-  const C<F> G2760 = G2753 + G2759;
-  const C<F> G2761 = G1414 * G418;
-  const C<F> G2762 = G442 * G1423;
-  const C<F> G2763 = C1 * G2762;
-  const C<F> G2764 = G2761 + G2763;
-  const C<F> G2765 = G399 * G2764;
-  const C<F> G2766 = G1435 * G418;
-  const C<F> G2767 = G462 * G1423;
-  const C<F> G2768 = C1 * G2767;
-  const C<F> G2769 = G2766 + G2768;
-  const C<F> G2770 = G453 * G2769;
-  const C<F> G2771 = C1 * G2770;
-  const C<F> G2772 = G2765 + G2771;
-  const C<F> G2773 = G471 * G2764;
-  const C<F> G2774 = G1451 * G418;
-  const C<F> G2775 = G481 * G1423;
-  const C<F> G2776 = C1 * G2775;
-  const C<F> G2777 = G2774 + G2776;
-  const C<F> G2778 = G453 * G2777;
-  const C<F> G2779 = C1 * G2778;
-  const C<F> G2780 = G2773 + G2779;
-  const C<F> G2781 = G1310 * G151;
-  const C<F> G2782 = G169 * G1319;
-  const C<F> G2783 = C1 * G2782;
-  const C<F> G2784 = G2781 + G2783;
-  const C<F> G2785 = G277 * G2784;
-  const C<F> G2786 = G1347 * G151;
-  const C<F> G2787 = G208 * G1319;
-  const C<F> G2788 = C1 * G2787;
-  const C<F> G2789 = G2786 + G2788;
-  const C<F> G2790 = G259 * G2789;
-  const C<F> G2791 = C1 * G2790;
-  const C<F> G2792 = G2785 + G2791;
-  const C<F> G2793 = G138 * G2792;
-  const C<F> G2794 = G217 * G2784;
-  const C<F> G2795 = G1331 * G151;
-  const C<F> G2796 = G189 * G1319;
-  const C<F> G2797 = C1 * G2796;
-  const C<F> G2798 = G2795 + G2797;
-  const C<F> G2799 = G259 * G2798;
-  const C<F> G2800 = C1 * G2799;
-  const C<F> G2801 = G2794 + G2800;
-  const C<F> G2802 = G198 * G2801;
-  const C<F> G2803 = C1 * G2802;
-  const C<F> G2804 = G2793 + G2803;
-  const C<F> G2805 = G217 * G2789;
-  const C<F> G2806 = G277 * G2798;
-  const C<F> G2807 = C1 * G2806;
-  const C<F> G2808 = G2805 + G2807;
-  const C<F> G2809 = G180 * G2808;
-  const C<F> G2810 = G2804 + G2809;
-  const C<F> G2811 = G2224 * X8;
-  const C<F> G2812 = G2326 * X9;
-  const C<F> G2813 = G2428 * X10;
-  const C<F> G2814 = G2512 * X11;
-  const C<F> G2815 = G2596 * X12;
-  const C<F> G2816 = G2680 * X13;
-  const C<F> G2817 = G1 * X60;
-  const C<F> G2818 = t * X116;
-  const C<F> G2819 = G2817 + G2818;
-  const C<F> G2820 = G2811 + G2812 + G2813 + G2814 + G2815 + G2816 + G2819;
-  const C<F> G2821 = G520 * X0;
-  const C<F> G2822 = G736 * X1;
-  const C<F> G2823 = G944 * X2;
-  const C<F> G2824 = G1147 * X3;
-  const C<F> G2825 = G1 * X65;
-  const C<F> G2826 = t * X121;
-  const C<F> G2827 = G2825 + G2826;
-  const C<F> G2828 = G2821 + G2822 + G2823 + G2824 + G2827;
-  const C<F> G2829 = G1495 * X4;
-  const C<F> G2830 = G1711 * X5;
-  const C<F> G2831 = G1919 * X6;
-  const C<F> G2832 = G2122 * X7;
-  const C<F> G2833 = G1 * X70;
-  const C<F> G2834 = t * X126;
-  const C<F> G2835 = G2833 + G2834;
-  const C<F> G2836 = G2829 + G2830 + G2831 + G2832 + G2835;
+  const T G4  = X15 + t * memo[0];
+  const T G7  = X21 + t * memo[6];
+  const T G8  = X4 * X4;
+  const T G9  = X5 * X5;
+  const T G10 = G8 + G9;
+  const T G11 = X6 * X6;
+  const T G12 = G10 + G11;
+  const T G13 = X7 * X7;
+  const T G14 = G12 + G13;
+  const T G15 = G14 * X11;
+  const T G16 = G7 * G15;
+  const T G19 = X22 + t * memo[7];
+  const T G20 = G14 * X12;
+  const T G21 = G19 * G20;
+  const T G24 = X23 + t * memo[8];
+  const T G25 = G14 * X13;
+  const T G26 = G24 * G25;
+  const T G27 = G16 + G21 + G26;
+  const T G30 = X18 + t * memo[3];
+  const T G31 = C2 * X2;
+  const T G32 = G30 * G31;
+  const T G35 = X19 + t * memo[4];
+  const T G36 = C1 * X1;
+  const T G37 = C2 * G36;
+  const T G38 = G35 * G37;
+  const T G41 = X20 + t * memo[5];
+  const T G42 = X0 + X0;
+  const T G43 = G41 * G42;
+  const T G44 = G32 + G38 + G43;
+  const T G45 = G27 * G44;
+  const T G46 = X5 * X7;
+  const T G47 = X4 * X6;
+  const T G48 = G46 + G47;
+  const T G49 = C2 * G48;
+  const T G50 = G7 * G49;
+  const T G51 = X6 * X7;
+  const T G52 = X4 * X5;
+  const T G53 = C1 * G52;
+  const T G54 = G51 + G53;
+  const T G55 = C2 * G54;
+  const T G56 = G19 * G55;
+  const T G57 = G8 + G13;
+  const T G58 = G9 + G11;
+  const T G59 = C1 * G58;
+  const T G60 = G57 + G59;
+  const T G61 = G24 * G60;
+  const T G62 = G50 + G56 + G61;
+  const T G63 = X8 * G42;
+  const T G64 = G30 * G63;
+  const T G65 = X9 * G42;
+  const T G66 = G35 * G65;
+  const T G67 = X10 * G42;
+  const T G68 = G41 * G67;
+  const T G69 = G64 + G66 + G68;
+  const T G70 = G62 * G69;
+  const T G71 = C1 * G70;
+  const T G72 = G45 + G71;
+  const T G73 = G4 * G72;
+  const T G76 = X17 + t * memo[2];
+  const T G77 = G30 * G42;
+  const T G78 = C2 * X3;
+  const T G79 = G35 * G78;
+  const T G80 = C1 * X2;
+  const T G81 = C2 * G80;
+  const T G82 = G41 * G81;
+  const T G83 = G77 + G79 + G82;
+  const T G84 = G27 * G83;
+  const T G85 = G11 + G13;
+  const T G86 = C1 * G85;
+  const T G87 = G10 + G86;
+  const T G88 = G7 * G87;
+  const T G89 = X5 * X6;
+  const T G90 = X4 * X7;
+  const T G91 = G89 + G90;
+  const T G92 = C2 * G91;
+  const T G93 = G19 * G92;
+  const T G94 = C1 * G47;
+  const T G95 = G46 + G94;
+  const T G96 = C2 * G95;
+  const T G97 = G24 * G96;
+  const T G98 = G88 + G93 + G97;
+  const T G99 = G98 * G69;
+  const T G100 = C1 * G99;
+  const T G101 = G84 + G100;
+  const T G102 = G76 * G101;
+  const T G103 = C1 * G102;
+  const T G104 = G73 + G103;
+  const T G107 = X16 + t * memo[1];
+  const T G108 = G107 * G72;
+  const T G109 = C1 * X3;
+  const T G110 = C2 * G109;
+  const T G111 = G30 * G110;
+  const T G112 = G35 * G42;
+  const T G113 = C2 * X1;
+  const T G114 = G41 * G113;
+  const T G115 = G111 + G112 + G114;
+  const T G116 = G27 * G115;
+  const T G117 = C1 * G90;
+  const T G118 = G89 + G117;
+  const T G119 = C2 * G118;
+  const T G120 = G7 * G119;
+  const T G121 = G8 + G11;
+  const T G122 = G9 + G13;
+  const T G123 = C1 * G122;
+  const T G124 = G121 + G123;
+  const T G125 = G19 * G124;
+  const T G126 = G51 + G52;
+  const T G127 = C2 * G126;
+  const T G128 = G24 * G127;
+  const T G129 = G120 + G125 + G128;
+  const T G130 = G129 * G69;
+  const T G131 = C1 * G130;
+  const T G132 = G116 + G131;
+  const T G133 = G76 * G132;
+  const T G134 = C1 * G133;
+  const T G135 = G108 + G134;
+  const T G138 = X24 + t * memo[9];
+  const T G141 = X30 + t * memo[15];
+  const T G142 = G141 * G15;
+  const T G145 = X31 + t * memo[16];
+  const T G146 = G145 * G20;
+  const T G149 = X32 + t * memo[17];
+  const T G150 = G149 * G25;
+  const T G151 = G142 + G146 + G150;
+  const T G154 = X27 + t * memo[12];
+  const T G155 = G154 * G31;
+  const T G158 = X28 + t * memo[13];
+  const T G159 = G158 * G37;
+  const T G162 = X29 + t * memo[14];
+  const T G163 = G162 * G42;
+  const T G164 = G155 + G159 + G163;
+  const T G165 = G151 * G164;
+  const T G166 = G141 * G49;
+  const T G167 = G145 * G55;
+  const T G168 = G149 * G60;
+  const T G169 = G166 + G167 + G168;
+  const T G170 = G154 * G63;
+  const T G171 = G158 * G65;
+  const T G172 = G162 * G67;
+  const T G173 = G170 + G171 + G172;
+  const T G174 = G169 * G173;
+  const T G175 = C1 * G174;
+  const T G176 = G165 + G175;
+  const T G177 = G138 * G176;
+  const T G180 = X26 + t * memo[11];
+  const T G181 = G154 * G42;
+  const T G182 = G158 * G78;
+  const T G183 = G162 * G81;
+  const T G184 = G181 + G182 + G183;
+  const T G185 = G151 * G184;
+  const T G186 = G141 * G87;
+  const T G187 = G145 * G92;
+  const T G188 = G149 * G96;
+  const T G189 = G186 + G187 + G188;
+  const T G190 = G189 * G173;
+  const T G191 = C1 * G190;
+  const T G192 = G185 + G191;
+  const T G193 = G180 * G192;
+  const T G194 = C1 * G193;
+  const T G195 = G177 + G194;
+  const T G198 = X25 + t * memo[10];
+  const T G199 = G198 * G176;
+  const T G200 = G154 * G110;
+  const T G201 = G158 * G42;
+  const T G202 = G162 * G113;
+  const T G203 = G200 + G201 + G202;
+  const T G204 = G151 * G203;
+  const T G205 = G141 * G119;
+  const T G206 = G145 * G124;
+  const T G207 = G149 * G127;
+  const T G208 = G205 + G206 + G207;
+  const T G209 = G208 * G173;
+  const T G210 = C1 * G209;
+  const T G211 = G204 + G210;
+  const T G212 = G180 * G211;
+  const T G213 = C1 * G212;
+  const T G214 = G199 + G213;
+  const T G217 = X33 + t * memo[18];
+  const T G220 = X39 + t * memo[24];
+  const T G221 = G220 * G15;
+  const T G224 = X40 + t * memo[25];
+  const T G225 = G224 * G20;
+  const T G228 = X41 + t * memo[26];
+  const T G229 = G228 * G25;
+  const T G230 = G221 + G225 + G229;
+  const T G233 = X36 + t * memo[21];
+  const T G234 = G233 * G31;
+  const T G237 = X37 + t * memo[22];
+  const T G238 = G237 * G37;
+  const T G241 = X38 + t * memo[23];
+  const T G242 = G241 * G42;
+  const T G243 = G234 + G238 + G242;
+  const T G244 = G230 * G243;
+  const T G245 = G220 * G49;
+  const T G246 = G224 * G55;
+  const T G247 = G228 * G60;
+  const T G248 = G245 + G246 + G247;
+  const T G249 = G233 * G63;
+  const T G250 = G237 * G65;
+  const T G251 = G241 * G67;
+  const T G252 = G249 + G250 + G251;
+  const T G253 = G248 * G252;
+  const T G254 = C1 * G253;
+  const T G255 = G244 + G254;
+  const T G256 = G217 * G255;
+  const T G259 = X35 + t * memo[20];
+  const T G260 = G233 * G42;
+  const T G261 = G237 * G78;
+  const T G262 = G241 * G81;
+  const T G263 = G260 + G261 + G262;
+  const T G264 = G230 * G263;
+  const T G265 = G220 * G87;
+  const T G266 = G224 * G92;
+  const T G267 = G228 * G96;
+  const T G268 = G265 + G266 + G267;
+  const T G269 = G268 * G252;
+  const T G270 = C1 * G269;
+  const T G271 = G264 + G270;
+  const T G272 = G259 * G271;
+  const T G273 = C1 * G272;
+  const T G274 = G256 + G273;
+  const T G277 = X34 + t * memo[19];
+  const T G278 = G277 * G255;
+  const T G279 = G233 * G110;
+  const T G280 = G237 * G42;
+  const T G281 = G241 * G113;
+  const T G282 = G279 + G280 + G281;
+  const T G283 = G230 * G282;
+  const T G284 = G220 * G119;
+  const T G285 = G224 * G124;
+  const T G286 = G228 * G127;
+  const T G287 = G284 + G285 + G286;
+  const T G288 = G287 * G252;
+  const T G289 = C1 * G288;
+  const T G290 = G283 + G289;
+  const T G291 = G259 * G290;
+  const T G292 = C1 * G291;
+  const T G293 = G278 + G292;
+  const T G296 = X42 + t * memo[27];
+  const T G297 = G296 * G4;
+  const T G300 = X43 + t * memo[28];
+  const T G301 = G300 * G138;
+  const T G302 = G297 + G301;
+  const T G305 = X46 + t * memo[31];
+  const T G306 = G305 * G7;
+  const T G309 = X47 + t * memo[32];
+  const T G310 = G309 * G141;
+  const T G311 = G306 + G310;
+  const T G312 = G311 * G15;
+  const T G313 = G305 * G19;
+  const T G314 = G309 * G145;
+  const T G315 = G313 + G314;
+  const T G316 = G315 * G20;
+  const T G317 = G305 * G24;
+  const T G318 = G309 * G149;
+  const T G319 = G317 + G318;
+  const T G320 = G319 * G25;
+  const T G321 = G312 + G316 + G320;
+  const T G324 = X44 + t * memo[29];
+  const T G325 = G324 * G30;
+  const T G328 = X45 + t * memo[30];
+  const T G329 = G328 * G154;
+  const T G330 = G325 + G329;
+  const T G331 = G330 * G31;
+  const T G332 = G324 * G35;
+  const T G333 = G328 * G158;
+  const T G334 = G332 + G333;
+  const T G335 = G334 * G37;
+  const T G336 = G324 * G41;
+  const T G337 = G328 * G162;
+  const T G338 = G336 + G337;
+  const T G339 = G338 * G42;
+  const T G340 = G331 + G335 + G339;
+  const T G341 = G321 * G340;
+  const T G342 = G311 * G49;
+  const T G343 = G315 * G55;
+  const T G344 = G319 * G60;
+  const T G345 = G342 + G343 + G344;
+  const T G346 = G330 * G63;
+  const T G347 = G334 * G65;
+  const T G348 = G338 * G67;
+  const T G349 = G346 + G347 + G348;
+  const T G350 = G345 * G349;
+  const T G351 = C1 * G350;
+  const T G352 = G341 + G351;
+  const T G353 = G302 * G352;
+  const T G354 = G296 * G76;
+  const T G355 = G300 * G180;
+  const T G356 = G354 + G355;
+  const T G357 = G330 * G42;
+  const T G358 = G334 * G78;
+  const T G359 = G338 * G81;
+  const T G360 = G357 + G358 + G359;
+  const T G361 = G321 * G360;
+  const T G362 = G311 * G87;
+  const T G363 = G315 * G92;
+  const T G364 = G319 * G96;
+  const T G365 = G362 + G363 + G364;
+  const T G366 = G365 * G349;
+  const T G367 = C1 * G366;
+  const T G368 = G361 + G367;
+  const T G369 = G356 * G368;
+  const T G370 = C1 * G369;
+  const T G371 = G353 + G370;
+  const T G372 = G296 * G107;
+  const T G373 = G300 * G198;
+  const T G374 = G372 + G373;
+  const T G375 = G374 * G352;
+  const T G376 = G330 * G110;
+  const T G377 = G334 * G42;
+  const T G378 = G338 * G113;
+  const T G379 = G376 + G377 + G378;
+  const T G380 = G321 * G379;
+  const T G381 = G311 * G119;
+  const T G382 = G315 * G124;
+  const T G383 = G319 * G127;
+  const T G384 = G381 + G382 + G383;
+  const T G385 = G384 * G349;
+  const T G386 = C1 * G385;
+  const T G387 = G380 + G386;
+  const T G388 = G356 * G387;
+  const T G389 = C1 * G388;
+  const T G390 = G375 + G389;
+  const T G393 = X48 + t * memo[33];
+  const T G394 = G393 * G4;
+  const T G397 = X49 + t * memo[34];
+  const T G398 = G397 * G217;
+  const T G399 = G394 + G398;
+  const T G402 = X52 + t * memo[37];
+  const T G403 = G402 * G7;
+  const T G406 = X53 + t * memo[38];
+  const T G407 = G406 * G220;
+  const T G408 = G403 + G407;
+  const T G409 = G408 * G15;
+  const T G410 = G402 * G19;
+  const T G411 = G406 * G224;
+  const T G412 = G410 + G411;
+  const T G413 = G412 * G20;
+  const T G414 = G402 * G24;
+  const T G415 = G406 * G228;
+  const T G416 = G414 + G415;
+  const T G417 = G416 * G25;
+  const T G418 = G409 + G413 + G417;
+  const T G421 = X50 + t * memo[35];
+  const T G422 = G421 * G30;
+  const T G425 = X51 + t * memo[36];
+  const T G426 = G425 * G233;
+  const T G427 = G422 + G426;
+  const T G428 = G427 * G31;
+  const T G429 = G421 * G35;
+  const T G430 = G425 * G237;
+  const T G431 = G429 + G430;
+  const T G432 = G431 * G37;
+  const T G433 = G421 * G41;
+  const T G434 = G425 * G241;
+  const T G435 = G433 + G434;
+  const T G436 = G435 * G42;
+  const T G437 = G428 + G432 + G436;
+  const T G438 = G418 * G437;
+  const T G439 = G408 * G49;
+  const T G440 = G412 * G55;
+  const T G441 = G416 * G60;
+  const T G442 = G439 + G440 + G441;
+  const T G443 = G427 * G63;
+  const T G444 = G431 * G65;
+  const T G445 = G435 * G67;
+  const T G446 = G443 + G444 + G445;
+  const T G447 = G442 * G446;
+  const T G448 = C1 * G447;
+  const T G449 = G438 + G448;
+  const T G450 = G399 * G449;
+  const T G451 = G393 * G76;
+  const T G452 = G397 * G259;
+  const T G453 = G451 + G452;
+  const T G454 = G427 * G42;
+  const T G455 = G431 * G78;
+  const T G456 = G435 * G81;
+  const T G457 = G454 + G455 + G456;
+  const T G458 = G418 * G457;
+  const T G459 = G408 * G87;
+  const T G460 = G412 * G92;
+  const T G461 = G416 * G96;
+  const T G462 = G459 + G460 + G461;
+  const T G463 = G462 * G446;
+  const T G464 = C1 * G463;
+  const T G465 = G458 + G464;
+  const T G466 = G453 * G465;
+  const T G467 = C1 * G466;
+  const T G468 = G450 + G467;
+  const T G469 = G393 * G107;
+  const T G470 = G397 * G277;
+  const T G471 = G469 + G470;
+  const T G472 = G471 * G449;
+  const T G473 = G427 * G110;
+  const T G474 = G431 * G42;
+  const T G475 = G435 * G113;
+  const T G476 = G473 + G474 + G475;
+  const T G477 = G418 * G476;
+  const T G478 = G408 * G119;
+  const T G479 = G412 * G124;
+  const T G480 = G416 * G127;
+  const T G481 = G478 + G479 + G480;
+  const T G482 = G481 * G446;
+  const T G483 = C1 * G482;
+  const T G484 = G477 + G483;
+  const T G485 = G453 * G484;
+  const T G486 = C1 * G485;
+  const T G487 = G472 + G486;
+  const T G488 = G151 * G243;
+  const T G489 = G169 * G252;
+  const T G490 = C1 * G489;
+  const T G491 = G488 + G490;
+  const T G492 = G277 * G491;
+  const T G493 = G151 * G282;
+  const T G494 = G208 * G252;
+  const T G495 = C1 * G494;
+  const T G496 = G493 + G495;
+  const T G497 = G259 * G496;
+  const T G498 = C1 * G497;
+  const T G499 = G492 + G498;
+  const T G500 = G138 * G499;
+  const T G501 = G217 * G491;
+  const T G502 = G151 * G263;
+  const T G503 = G189 * G252;
+  const T G504 = C1 * G503;
+  const T G505 = G502 + G504;
+  const T G506 = G259 * G505;
+  const T G507 = C1 * G506;
+  const T G508 = G501 + G507;
+  const T G509 = G198 * G508;
+  const T G510 = C1 * G509;
+  const T G511 = G500 + G510;
+  const T G512 = G217 * G496;
+  const T G513 = G277 * G505;
+  const T G514 = C1 * G513;
+  const T G515 = G512 + G514;
+  const T G516 = G180 * G515;
+  const T G517 = G511 + G516;
+  const T G520 = X61 + t * memo[46];
+  const T G521 = G30 * G78;
+  const T G522 = C1 * X0;
+  const T G523 = C2 * G522;
+  const T G524 = G35 * G523;
+  const T G525 = X1 + X1;
+  const T G526 = C1 * G525;
+  const T G527 = G41 * G526;
+  const T G528 = G521 + G524 + G527;
+  const T G529 = G27 * G528;
+  const T G530 = X8 * G525;
+  const T G531 = G30 * G530;
+  const T G532 = X9 * G525;
+  const T G533 = G35 * G532;
+  const T G534 = X10 * G525;
+  const T G535 = G41 * G534;
+  const T G536 = G531 + G533 + G535;
+  const T G537 = G62 * G536;
+  const T G538 = C1 * G537;
+  const T G539 = G529 + G538;
+  const T G540 = G4 * G539;
+  const T G541 = G30 * G525;
+  const T G542 = G35 * G31;
+  const T G543 = G41 * G78;
+  const T G544 = G541 + G542 + G543;
+  const T G545 = G27 * G544;
+  const T G546 = G98 * G536;
+  const T G547 = C1 * G546;
+  const T G548 = G545 + G547;
+  const T G549 = G76 * G548;
+  const T G550 = C1 * G549;
+  const T G551 = G540 + G550;
+  const T G552 = G107 * G539;
+  const T G553 = G35 * G526;
+  const T G554 = C2 * X0;
+  const T G555 = G41 * G554;
+  const T G556 = G32 + G553 + G555;
+  const T G557 = G27 * G556;
+  const T G558 = G129 * G536;
+  const T G559 = C1 * G558;
+  const T G560 = G557 + G559;
+  const T G561 = G76 * G560;
+  const T G562 = C1 * G561;
+  const T G563 = G552 + G562;
+  const T G564 = G154 * G78;
+  const T G565 = G158 * G523;
+  const T G566 = G162 * G526;
+  const T G567 = G564 + G565 + G566;
+  const T G568 = G151 * G567;
+  const T G569 = G154 * G530;
+  const T G570 = G158 * G532;
+  const T G571 = G162 * G534;
+  const T G572 = G569 + G570 + G571;
+  const T G573 = G169 * G572;
+  const T G574 = C1 * G573;
+  const T G575 = G568 + G574;
+  const T G576 = G138 * G575;
+  const T G577 = G154 * G525;
+  const T G578 = G158 * G31;
+  const T G579 = G162 * G78;
+  const T G580 = G577 + G578 + G579;
+  const T G581 = G151 * G580;
+  const T G582 = G189 * G572;
+  const T G583 = C1 * G582;
+  const T G584 = G581 + G583;
+  const T G585 = G180 * G584;
+  const T G586 = C1 * G585;
+  const T G587 = G576 + G586;
+  const T G588 = G198 * G575;
+  const T G589 = G158 * G526;
+  const T G590 = G162 * G554;
+  const T G591 = G155 + G589 + G590;
+  const T G592 = G151 * G591;
+  const T G593 = G208 * G572;
+  const T G594 = C1 * G593;
+  const T G595 = G592 + G594;
+  const T G596 = G180 * G595;
+  const T G597 = C1 * G596;
+  const T G598 = G588 + G597;
+  const T G599 = G233 * G78;
+  const T G600 = G237 * G523;
+  const T G601 = G241 * G526;
+  const T G602 = G599 + G600 + G601;
+  const T G603 = G230 * G602;
+  const T G604 = G233 * G530;
+  const T G605 = G237 * G532;
+  const T G606 = G241 * G534;
+  const T G607 = G604 + G605 + G606;
+  const T G608 = G248 * G607;
+  const T G609 = C1 * G608;
+  const T G610 = G603 + G609;
+  const T G611 = G217 * G610;
+  const T G612 = G233 * G525;
+  const T G613 = G237 * G31;
+  const T G614 = G241 * G78;
+  const T G615 = G612 + G613 + G614;
+  const T G616 = G230 * G615;
+  const T G617 = G268 * G607;
+  const T G618 = C1 * G617;
+  const T G619 = G616 + G618;
+  const T G620 = G259 * G619;
+  const T G621 = C1 * G620;
+  const T G622 = G611 + G621;
+  const T G623 = G277 * G610;
+  const T G624 = G237 * G526;
+  const T G625 = G241 * G554;
+  const T G626 = G234 + G624 + G625;
+  const T G627 = G230 * G626;
+  const T G628 = G287 * G607;
+  const T G629 = C1 * G628;
+  const T G630 = G627 + G629;
+  const T G631 = G259 * G630;
+  const T G632 = C1 * G631;
+  const T G633 = G623 + G632;
+  const T G634 = G330 * G78;
+  const T G635 = G334 * G523;
+  const T G636 = G338 * G526;
+  const T G637 = G634 + G635 + G636;
+  const T G638 = G321 * G637;
+  const T G639 = G330 * G530;
+  const T G640 = G334 * G532;
+  const T G641 = G338 * G534;
+  const T G642 = G639 + G640 + G641;
+  const T G643 = G345 * G642;
+  const T G644 = C1 * G643;
+  const T G645 = G638 + G644;
+  const T G646 = G302 * G645;
+  const T G647 = G330 * G525;
+  const T G648 = G334 * G31;
+  const T G649 = G338 * G78;
+  const T G650 = G647 + G648 + G649;
+  const T G651 = G321 * G650;
+  const T G652 = G365 * G642;
+  const T G653 = C1 * G652;
+  const T G654 = G651 + G653;
+  const T G655 = G356 * G654;
+  const T G656 = C1 * G655;
+  const T G657 = G646 + G656;
+  const T G658 = G374 * G645;
+  const T G659 = G334 * G526;
+  const T G660 = G338 * G554;
+  const T G661 = G331 + G659 + G660;
+  const T G662 = G321 * G661;
+  const T G663 = G384 * G642;
+  const T G664 = C1 * G663;
+  const T G665 = G662 + G664;
+  const T G666 = G356 * G665;
+  const T G667 = C1 * G666;
+  const T G668 = G658 + G667;
+  const T G669 = G427 * G78;
+  const T G670 = G431 * G523;
+  const T G671 = G435 * G526;
+  const T G672 = G669 + G670 + G671;
+  const T G673 = G418 * G672;
+  const T G674 = G427 * G530;
+  const T G675 = G431 * G532;
+  const T G676 = G435 * G534;
+  const T G677 = G674 + G675 + G676;
+  const T G678 = G442 * G677;
+  const T G679 = C1 * G678;
+  const T G680 = G673 + G679;
+  const T G681 = G399 * G680;
+  const T G682 = G427 * G525;
+  const T G683 = G431 * G31;
+  const T G684 = G435 * G78;
+  const T G685 = G682 + G683 + G684;
+  const T G686 = G418 * G685;
+  const T G687 = G462 * G677;
+  const T G688 = C1 * G687;
+  const T G689 = G686 + G688;
+  const T G690 = G453 * G689;
+  const T G691 = C1 * G690;
+  const T G692 = G681 + G691;
+  const T G693 = G471 * G680;
+  const T G694 = G431 * G526;
+  const T G695 = G435 * G554;
+  const T G696 = G428 + G694 + G695;
+  const T G697 = G418 * G696;
+  const T G698 = G481 * G677;
+  const T G699 = C1 * G698;
+  const T G700 = G697 + G699;
+  const T G701 = G453 * G700;
+  const T G702 = C1 * G701;
+  const T G703 = G693 + G702;
+  const T G704 = G151 * G602;
+  const T G705 = G169 * G607;
+  const T G706 = C1 * G705;
+  const T G707 = G704 + G706;
+  const T G708 = G277 * G707;
+  const T G709 = G151 * G626;
+  const T G710 = G208 * G607;
+  const T G711 = C1 * G710;
+  const T G712 = G709 + G711;
+  const T G713 = G259 * G712;
+  const T G714 = C1 * G713;
+  const T G715 = G708 + G714;
+  const T G716 = G138 * G715;
+  const T G717 = G217 * G707;
+  const T G718 = G151 * G615;
+  const T G719 = G189 * G607;
+  const T G720 = C1 * G719;
+  const T G721 = G718 + G720;
+  const T G722 = G259 * G721;
+  const T G723 = C1 * G722;
+  const T G724 = G717 + G723;
+  const T G725 = G198 * G724;
+  const T G726 = C1 * G725;
+  const T G727 = G716 + G726;
+  const T G728 = G217 * G712;
+  const T G729 = G277 * G721;
+  const T G730 = C1 * G729;
+  const T G731 = G728 + G730;
+  const T G732 = G180 * G731;
+  const T G733 = G727 + G732;
+  const T G736 = X62 + t * memo[47];
+  const T G737 = G30 * G554;
+  const T G738 = X2 + X2;
+  const T G739 = C1 * G738;
+  const T G740 = G41 * G739;
+  const T G741 = G737 + G79 + G740;
+  const T G742 = G27 * G741;
+  const T G743 = X8 * G738;
+  const T G744 = G30 * G743;
+  const T G745 = X9 * G738;
+  const T G746 = G35 * G745;
+  const T G747 = X10 * G738;
+  const T G748 = G41 * G747;
+  const T G749 = G744 + G746 + G748;
+  const T G750 = G62 * G749;
+  const T G751 = C1 * G750;
+  const T G752 = G742 + G751;
+  const T G753 = G4 * G752;
+  const T G754 = G30 * G739;
+  const T G755 = G35 * G113;
+  const T G756 = G41 * G523;
+  const T G757 = G754 + G755 + G756;
+  const T G758 = G27 * G757;
+  const T G759 = G98 * G749;
+  const T G760 = C1 * G759;
+  const T G761 = G758 + G760;
+  const T G762 = G76 * G761;
+  const T G763 = C1 * G762;
+  const T G764 = G753 + G763;
+  const T G765 = G107 * G752;
+  const T G766 = G30 * G113;
+  const T G767 = G35 * G738;
+  const T G768 = G766 + G767 + G543;
+  const T G769 = G27 * G768;
+  const T G770 = G129 * G749;
+  const T G771 = C1 * G770;
+  const T G772 = G769 + G771;
+  const T G773 = G76 * G772;
+  const T G774 = C1 * G773;
+  const T G775 = G765 + G774;
+  const T G776 = G154 * G554;
+  const T G777 = G162 * G739;
+  const T G778 = G776 + G182 + G777;
+  const T G779 = G151 * G778;
+  const T G780 = G154 * G743;
+  const T G781 = G158 * G745;
+  const T G782 = G162 * G747;
+  const T G783 = G780 + G781 + G782;
+  const T G784 = G169 * G783;
+  const T G785 = C1 * G784;
+  const T G786 = G779 + G785;
+  const T G787 = G138 * G786;
+  const T G788 = G154 * G739;
+  const T G789 = G158 * G113;
+  const T G790 = G162 * G523;
+  const T G791 = G788 + G789 + G790;
+  const T G792 = G151 * G791;
+  const T G793 = G189 * G783;
+  const T G794 = C1 * G793;
+  const T G795 = G792 + G794;
+  const T G796 = G180 * G795;
+  const T G797 = C1 * G796;
+  const T G798 = G787 + G797;
+  const T G799 = G198 * G786;
+  const T G800 = G154 * G113;
+  const T G801 = G158 * G738;
+  const T G802 = G800 + G801 + G579;
+  const T G803 = G151 * G802;
+  const T G804 = G208 * G783;
+  const T G805 = C1 * G804;
+  const T G806 = G803 + G805;
+  const T G807 = G180 * G806;
+  const T G808 = C1 * G807;
+  const T G809 = G799 + G808;
+  const T G810 = G233 * G554;
+  const T G811 = G241 * G739;
+  const T G812 = G810 + G261 + G811;
+  const T G813 = G230 * G812;
+  const T G814 = G233 * G743;
+  const T G815 = G237 * G745;
+  const T G816 = G241 * G747;
+  const T G817 = G814 + G815 + G816;
+  const T G818 = G248 * G817;
+  const T G819 = C1 * G818;
+  const T G820 = G813 + G819;
+  const T G821 = G217 * G820;
+  const T G822 = G233 * G739;
+  const T G823 = G237 * G113;
+  const T G824 = G241 * G523;
+  const T G825 = G822 + G823 + G824;
+  const T G826 = G230 * G825;
+  const T G827 = G268 * G817;
+  const T G828 = C1 * G827;
+  const T G829 = G826 + G828;
+  const T G830 = G259 * G829;
+  const T G831 = C1 * G830;
+  const T G832 = G821 + G831;
+  const T G833 = G277 * G820;
+  const T G834 = G233 * G113;
+  const T G835 = G237 * G738;
+  const T G836 = G834 + G835 + G614;
+  const T G837 = G230 * G836;
+  const T G838 = G287 * G817;
+  const T G839 = C1 * G838;
+  const T G840 = G837 + G839;
+  const T G841 = G259 * G840;
+  const T G842 = C1 * G841;
+  const T G843 = G833 + G842;
+  const T G844 = G330 * G554;
+  const T G845 = G338 * G739;
+  const T G846 = G844 + G358 + G845;
+  const T G847 = G321 * G846;
+  const T G848 = G330 * G743;
+  const T G849 = G334 * G745;
+  const T G850 = G338 * G747;
+  const T G851 = G848 + G849 + G850;
+  const T G852 = G345 * G851;
+  const T G853 = C1 * G852;
+  const T G854 = G847 + G853;
+  const T G855 = G302 * G854;
+  const T G856 = G330 * G739;
+  const T G857 = G334 * G113;
+  const T G858 = G338 * G523;
+  const T G859 = G856 + G857 + G858;
+  const T G860 = G321 * G859;
+  const T G861 = G365 * G851;
+  const T G862 = C1 * G861;
+  const T G863 = G860 + G862;
+  const T G864 = G356 * G863;
+  const T G865 = C1 * G864;
+  const T G866 = G855 + G865;
+  const T G867 = G374 * G854;
+  const T G868 = G330 * G113;
+  const T G869 = G334 * G738;
+  const T G870 = G868 + G869 + G649;
+  const T G871 = G321 * G870;
+  const T G872 = G384 * G851;
+  const T G873 = C1 * G872;
+  const T G874 = G871 + G873;
+  const T G875 = G356 * G874;
+  const T G876 = C1 * G875;
+  const T G877 = G867 + G876;
+  const T G878 = G427 * G554;
+  const T G879 = G435 * G739;
+  const T G880 = G878 + G455 + G879;
+  const T G881 = G418 * G880;
+  const T G882 = G427 * G743;
+  const T G883 = G431 * G745;
+  const T G884 = G435 * G747;
+  const T G885 = G882 + G883 + G884;
+  const T G886 = G442 * G885;
+  const T G887 = C1 * G886;
+  const T G888 = G881 + G887;
+  const T G889 = G399 * G888;
+  const T G890 = G427 * G739;
+  const T G891 = G431 * G113;
+  const T G892 = G435 * G523;
+  const T G893 = G890 + G891 + G892;
+  const T G894 = G418 * G893;
+  const T G895 = G462 * G885;
+  const T G896 = C1 * G895;
+  const T G897 = G894 + G896;
+  const T G898 = G453 * G897;
+  const T G899 = C1 * G898;
+  const T G900 = G889 + G899;
+  const T G901 = G471 * G888;
+  const T G902 = G427 * G113;
+  const T G903 = G431 * G738;
+  const T G904 = G902 + G903 + G684;
+  const T G905 = G418 * G904;
+  const T G906 = G481 * G885;
+  const T G907 = C1 * G906;
+  const T G908 = G905 + G907;
+  const T G909 = G453 * G908;
+  const T G910 = C1 * G909;
+  const T G911 = G901 + G910;
+  const T G912 = G151 * G812;
+  const T G913 = G169 * G817;
+  const T G914 = C1 * G913;
+  const T G915 = G912 + G914;
+  const T G916 = G277 * G915;
+  const T G917 = G151 * G836;
+  const T G918 = G208 * G817;
+  const T G919 = C1 * G918;
+  const T G920 = G917 + G919;
+  const T G921 = G259 * G920;
+  const T G922 = C1 * G921;
+  const T G923 = G916 + G922;
+  const T G924 = G138 * G923;
+  const T G925 = G217 * G915;
+  const T G926 = G151 * G825;
+  const T G927 = G189 * G817;
+  const T G928 = C1 * G927;
+  const T G929 = G926 + G928;
+  const T G930 = G259 * G929;
+  const T G931 = C1 * G930;
+  const T G932 = G925 + G931;
+  const T G933 = G198 * G932;
+  const T G934 = C1 * G933;
+  const T G935 = G924 + G934;
+  const T G936 = G217 * G920;
+  const T G937 = G277 * G929;
+  const T G938 = C1 * G937;
+  const T G939 = G936 + G938;
+  const T G940 = G180 * G939;
+  const T G941 = G935 + G940;
+  const T G944 = X63 + t * memo[48];
+  const T G945 = X3 + X3;
+  const T G946 = G41 * G945;
+  const T G947 = G766 + G542 + G946;
+  const T G948 = G27 * G947;
+  const T G949 = X8 * G945;
+  const T G950 = G30 * G949;
+  const T G951 = X9 * G945;
+  const T G952 = G35 * G951;
+  const T G953 = X10 * G945;
+  const T G954 = G41 * G953;
+  const T G955 = G950 + G952 + G954;
+  const T G956 = G62 * G955;
+  const T G957 = C1 * G956;
+  const T G958 = G948 + G957;
+  const T G959 = G4 * G958;
+  const T G960 = C1 * G945;
+  const T G961 = G30 * G960;
+  const T G962 = G35 * G554;
+  const T G963 = G961 + G962 + G114;
+  const T G964 = G27 * G963;
+  const T G965 = G98 * G955;
+  const T G966 = C1 * G965;
+  const T G967 = G964 + G966;
+  const T G968 = G76 * G967;
+  const T G969 = C1 * G968;
+  const T G970 = G959 + G969;
+  const T G971 = G107 * G958;
+  const T G972 = G30 * G523;
+  const T G973 = G35 * G960;
+  const T G974 = G41 * G31;
+  const T G975 = G972 + G973 + G974;
+  const T G976 = G27 * G975;
+  const T G977 = G129 * G955;
+  const T G978 = C1 * G977;
+  const T G979 = G976 + G978;
+  const T G980 = G76 * G979;
+  const T G981 = C1 * G980;
+  const T G982 = G971 + G981;
+  const T G983 = G162 * G945;
+  const T G984 = G800 + G578 + G983;
+  const T G985 = G151 * G984;
+  const T G986 = G154 * G949;
+  const T G987 = G158 * G951;
+  const T G988 = G162 * G953;
+  const T G989 = G986 + G987 + G988;
+  const T G990 = G169 * G989;
+  const T G991 = C1 * G990;
+  const T G992 = G985 + G991;
+  const T G993 = G138 * G992;
+  const T G994 = G154 * G960;
+  const T G995 = G158 * G554;
+  const T G996 = G994 + G995 + G202;
+  const T G997 = G151 * G996;
+  const T G998 = G189 * G989;
+  const T G999 = C1 * G998;
+  const T G1000 = G997 + G999;
+  const T G1001 = G180 * G1000;
+  const T G1002 = C1 * G1001;
+  const T G1003 = G993 + G1002;
+  const T G1004 = G198 * G992;
+  const T G1005 = G154 * G523;
+  const T G1006 = G158 * G960;
+  const T G1007 = G162 * G31;
+  const T G1008 = G1005 + G1006 + G1007;
+  const T G1009 = G151 * G1008;
+  const T G1010 = G208 * G989;
+  const T G1011 = C1 * G1010;
+  const T G1012 = G1009 + G1011;
+  const T G1013 = G180 * G1012;
+  const T G1014 = C1 * G1013;
+  const T G1015 = G1004 + G1014;
+  const T G1016 = G241 * G945;
+  const T G1017 = G834 + G613 + G1016;
+  const T G1018 = G230 * G1017;
+  const T G1019 = G233 * G949;
+  const T G1020 = G237 * G951;
+  const T G1021 = G241 * G953;
+  const T G1022 = G1019 + G1020 + G1021;
+  const T G1023 = G248 * G1022;
+  const T G1024 = C1 * G1023;
+  const T G1025 = G1018 + G1024;
+  const T G1026 = G217 * G1025;
+  const T G1027 = G233 * G960;
+  const T G1028 = G237 * G554;
+  const T G1029 = G1027 + G1028 + G281;
+  const T G1030 = G230 * G1029;
+  const T G1031 = G268 * G1022;
+  const T G1032 = C1 * G1031;
+  const T G1033 = G1030 + G1032;
+  const T G1034 = G259 * G1033;
+  const T G1035 = C1 * G1034;
+  const T G1036 = G1026 + G1035;
+  const T G1037 = G277 * G1025;
+  const T G1038 = G233 * G523;
+  const T G1039 = G237 * G960;
+  const T G1040 = G241 * G31;
+  const T G1041 = G1038 + G1039 + G1040;
+  const T G1042 = G230 * G1041;
+  const T G1043 = G287 * G1022;
+  const T G1044 = C1 * G1043;
+  const T G1045 = G1042 + G1044;
+  const T G1046 = G259 * G1045;
+  const T G1047 = C1 * G1046;
+  const T G1048 = G1037 + G1047;
+  const T G1049 = G338 * G945;
+  const T G1050 = G868 + G648 + G1049;
+  const T G1051 = G321 * G1050;
+  const T G1052 = G330 * G949;
+  const T G1053 = G334 * G951;
+  const T G1054 = G338 * G953;
+  const T G1055 = G1052 + G1053 + G1054;
+  const T G1056 = G345 * G1055;
+  const T G1057 = C1 * G1056;
+  const T G1058 = G1051 + G1057;
+  const T G1059 = G302 * G1058;
+  const T G1060 = G330 * G960;
+  const T G1061 = G334 * G554;
+  const T G1062 = G1060 + G1061 + G378;
+  const T G1063 = G321 * G1062;
+  const T G1064 = G365 * G1055;
+  const T G1065 = C1 * G1064;
+  const T G1066 = G1063 + G1065;
+  const T G1067 = G356 * G1066;
+  const T G1068 = C1 * G1067;
+  const T G1069 = G1059 + G1068;
+  const T G1070 = G374 * G1058;
+  const T G1071 = G330 * G523;
+  const T G1072 = G334 * G960;
+  const T G1073 = G338 * G31;
+  const T G1074 = G1071 + G1072 + G1073;
+  const T G1075 = G321 * G1074;
+  const T G1076 = G384 * G1055;
+  const T G1077 = C1 * G1076;
+  const T G1078 = G1075 + G1077;
+  const T G1079 = G356 * G1078;
+  const T G1080 = C1 * G1079;
+  const T G1081 = G1070 + G1080;
+  const T G1082 = G435 * G945;
+  const T G1083 = G902 + G683 + G1082;
+  const T G1084 = G418 * G1083;
+  const T G1085 = G427 * G949;
+  const T G1086 = G431 * G951;
+  const T G1087 = G435 * G953;
+  const T G1088 = G1085 + G1086 + G1087;
+  const T G1089 = G442 * G1088;
+  const T G1090 = C1 * G1089;
+  const T G1091 = G1084 + G1090;
+  const T G1092 = G399 * G1091;
+  const T G1093 = G427 * G960;
+  const T G1094 = G431 * G554;
+  const T G1095 = G1093 + G1094 + G475;
+  const T G1096 = G418 * G1095;
+  const T G1097 = G462 * G1088;
+  const T G1098 = C1 * G1097;
+  const T G1099 = G1096 + G1098;
+  const T G1100 = G453 * G1099;
+  const T G1101 = C1 * G1100;
+  const T G1102 = G1092 + G1101;
+  const T G1103 = G471 * G1091;
+  const T G1104 = G427 * G523;
+  const T G1105 = G431 * G960;
+  const T G1106 = G435 * G31;
+  const T G1107 = G1104 + G1105 + G1106;
+  const T G1108 = G418 * G1107;
+  const T G1109 = G481 * G1088;
+  const T G1110 = C1 * G1109;
+  const T G1111 = G1108 + G1110;
+  const T G1112 = G453 * G1111;
+  const T G1113 = C1 * G1112;
+  const T G1114 = G1103 + G1113;
+  const T G1115 = G151 * G1017;
+  const T G1116 = G169 * G1022;
+  const T G1117 = C1 * G1116;
+  const T G1118 = G1115 + G1117;
+  const T G1119 = G277 * G1118;
+  const T G1120 = G151 * G1041;
+  const T G1121 = G208 * G1022;
+  const T G1122 = C1 * G1121;
+  const T G1123 = G1120 + G1122;
+  const T G1124 = G259 * G1123;
+  const T G1125 = C1 * G1124;
+  const T G1126 = G1119 + G1125;
+  const T G1127 = G138 * G1126;
+  const T G1128 = G217 * G1118;
+  const T G1129 = G151 * G1029;
+  const T G1130 = G189 * G1022;
+  const T G1131 = C1 * G1130;
+  const T G1132 = G1129 + G1131;
+  const T G1133 = G259 * G1132;
+  const T G1134 = C1 * G1133;
+  const T G1135 = G1128 + G1134;
+  const T G1136 = G198 * G1135;
+  const T G1137 = C1 * G1136;
+  const T G1138 = G1127 + G1137;
+  const T G1139 = G217 * G1123;
+  const T G1140 = G277 * G1132;
+  const T G1141 = C1 * G1140;
+  const T G1142 = G1139 + G1141;
+  const T G1143 = G180 * G1142;
+  const T G1144 = G1138 + G1143;
+  const T G1147 = X64 + t * memo[49];
+  const T G1148 = X1 * X3;
+  const T G1149 = X0 * X2;
+  const T G1150 = G1148 + G1149;
+  const T G1151 = C2 * G1150;
+  const T G1152 = G30 * G1151;
+  const T G1153 = X2 * X3;
+  const T G1154 = X0 * X1;
+  const T G1155 = C1 * G1154;
+  const T G1156 = G1153 + G1155;
+  const T G1157 = C2 * G1156;
+  const T G1158 = G35 * G1157;
+  const T G1159 = X0 * X0;
+  const T G1160 = X3 * X3;
+  const T G1161 = G1159 + G1160;
+  const T G1162 = X1 * X1;
+  const T G1163 = X2 * X2;
+  const T G1164 = G1162 + G1163;
+  const T G1165 = C1 * G1164;
+  const T G1166 = G1161 + G1165;
+  const T G1167 = G41 * G1166;
+  const T G1168 = G1152 + G1158 + G1167;
+  const T G1169 = X4 + X4;
+  const T G1170 = X11 * G1169;
+  const T G1171 = G7 * G1170;
+  const T G1172 = X12 * G1169;
+  const T G1173 = G19 * G1172;
+  const T G1174 = X13 * G1169;
+  const T G1175 = G24 * G1174;
+  const T G1176 = G1171 + G1173 + G1175;
+  const T G1177 = G1168 * G1176;
+  const T G1178 = G1159 + G1162;
+  const T G1179 = G1178 + G1163;
+  const T G1180 = G1179 + G1160;
+  const T G1181 = G1180 * X8;
+  const T G1182 = G30 * G1181;
+  const T G1183 = G1180 * X9;
+  const T G1184 = G35 * G1183;
+  const T G1185 = G1180 * X10;
+  const T G1186 = G41 * G1185;
+  const T G1187 = G1182 + G1184 + G1186;
+  const T G1188 = C2 * X6;
+  const T G1189 = G7 * G1188;
+  const T G1190 = C1 * X5;
+  const T G1191 = C2 * G1190;
+  const T G1192 = G19 * G1191;
+  const T G1193 = G24 * G1169;
+  const T G1194 = G1189 + G1192 + G1193;
+  const T G1195 = G1187 * G1194;
+  const T G1196 = C1 * G1195;
+  const T G1197 = G1177 + G1196;
+  const T G1198 = G4 * G1197;
+  const T G1199 = G1163 + G1160;
+  const T G1200 = C1 * G1199;
+  const T G1201 = G1178 + G1200;
+  const T G1202 = G30 * G1201;
+  const T G1203 = X1 * X2;
+  const T G1204 = X0 * X3;
+  const T G1205 = G1203 + G1204;
+  const T G1206 = C2 * G1205;
+  const T G1207 = G35 * G1206;
+  const T G1208 = C1 * G1149;
+  const T G1209 = G1148 + G1208;
+  const T G1210 = C2 * G1209;
+  const T G1211 = G41 * G1210;
+  const T G1212 = G1202 + G1207 + G1211;
+  const T G1213 = G1212 * G1176;
+  const T G1214 = G7 * G1169;
+  const T G1215 = C2 * X7;
+  const T G1216 = G19 * G1215;
+  const T G1217 = C1 * X6;
+  const T G1218 = C2 * G1217;
+  const T G1219 = G24 * G1218;
+  const T G1220 = G1214 + G1216 + G1219;
+  const T G1221 = G1187 * G1220;
+  const T G1222 = C1 * G1221;
+  const T G1223 = G1213 + G1222;
+  const T G1224 = G76 * G1223;
+  const T G1225 = C1 * G1224;
+  const T G1226 = G1198 + G1225;
+  const T G1227 = G107 * G1197;
+  const T G1228 = C1 * G1204;
+  const T G1229 = G1203 + G1228;
+  const T G1230 = C2 * G1229;
+  const T G1231 = G30 * G1230;
+  const T G1232 = G1159 + G1163;
+  const T G1233 = G1162 + G1160;
+  const T G1234 = C1 * G1233;
+  const T G1235 = G1232 + G1234;
+  const T G1236 = G35 * G1235;
+  const T G1237 = G1153 + G1154;
+  const T G1238 = C2 * G1237;
+  const T G1239 = G41 * G1238;
+  const T G1240 = G1231 + G1236 + G1239;
+  const T G1241 = G1240 * G1176;
+  const T G1242 = C1 * X7;
+  const T G1243 = C2 * G1242;
+  const T G1244 = G7 * G1243;
+  const T G1245 = G19 * G1169;
+  const T G1246 = C2 * X5;
+  const T G1247 = G24 * G1246;
+  const T G1248 = G1244 + G1245 + G1247;
+  const T G1249 = G1187 * G1248;
+  const T G1250 = C1 * G1249;
+  const T G1251 = G1241 + G1250;
+  const T G1252 = G76 * G1251;
+  const T G1253 = C1 * G1252;
+  const T G1254 = G1227 + G1253;
+  const T G1255 = G154 * G1151;
+  const T G1256 = G158 * G1157;
+  const T G1257 = G162 * G1166;
+  const T G1258 = G1255 + G1256 + G1257;
+  const T G1259 = G141 * G1170;
+  const T G1260 = G145 * G1172;
+  const T G1261 = G149 * G1174;
+  const T G1262 = G1259 + G1260 + G1261;
+  const T G1263 = G1258 * G1262;
+  const T G1264 = G154 * G1181;
+  const T G1265 = G158 * G1183;
+  const T G1266 = G162 * G1185;
+  const T G1267 = G1264 + G1265 + G1266;
+  const T G1268 = G141 * G1188;
+  const T G1269 = G145 * G1191;
+  const T G1270 = G149 * G1169;
+  const T G1271 = G1268 + G1269 + G1270;
+  const T G1272 = G1267 * G1271;
+  const T G1273 = C1 * G1272;
+  const T G1274 = G1263 + G1273;
+  const T G1275 = G138 * G1274;
+  const T G1276 = G154 * G1201;
+  const T G1277 = G158 * G1206;
+  const T G1278 = G162 * G1210;
+  const T G1279 = G1276 + G1277 + G1278;
+  const T G1280 = G1279 * G1262;
+  const T G1281 = G141 * G1169;
+  const T G1282 = G145 * G1215;
+  const T G1283 = G149 * G1218;
+  const T G1284 = G1281 + G1282 + G1283;
+  const T G1285 = G1267 * G1284;
+  const T G1286 = C1 * G1285;
+  const T G1287 = G1280 + G1286;
+  const T G1288 = G180 * G1287;
+  const T G1289 = C1 * G1288;
+  const T G1290 = G1275 + G1289;
+  const T G1291 = G198 * G1274;
+  const T G1292 = G154 * G1230;
+  const T G1293 = G158 * G1235;
+  const T G1294 = G162 * G1238;
+  const T G1295 = G1292 + G1293 + G1294;
+  const T G1296 = G1295 * G1262;
+  const T G1297 = G141 * G1243;
+  const T G1298 = G145 * G1169;
+  const T G1299 = G149 * G1246;
+  const T G1300 = G1297 + G1298 + G1299;
+  const T G1301 = G1267 * G1300;
+  const T G1302 = C1 * G1301;
+  const T G1303 = G1296 + G1302;
+  const T G1304 = G180 * G1303;
+  const T G1305 = C1 * G1304;
+  const T G1306 = G1291 + G1305;
+  const T G1307 = G233 * G1151;
+  const T G1308 = G237 * G1157;
+  const T G1309 = G241 * G1166;
+  const T G1310 = G1307 + G1308 + G1309;
+  const T G1311 = G220 * G1170;
+  const T G1312 = G224 * G1172;
+  const T G1313 = G228 * G1174;
+  const T G1314 = G1311 + G1312 + G1313;
+  const T G1315 = G1310 * G1314;
+  const T G1316 = G233 * G1181;
+  const T G1317 = G237 * G1183;
+  const T G1318 = G241 * G1185;
+  const T G1319 = G1316 + G1317 + G1318;
+  const T G1320 = G220 * G1188;
+  const T G1321 = G224 * G1191;
+  const T G1322 = G228 * G1169;
+  const T G1323 = G1320 + G1321 + G1322;
+  const T G1324 = G1319 * G1323;
+  const T G1325 = C1 * G1324;
+  const T G1326 = G1315 + G1325;
+  const T G1327 = G217 * G1326;
+  const T G1328 = G233 * G1201;
+  const T G1329 = G237 * G1206;
+  const T G1330 = G241 * G1210;
+  const T G1331 = G1328 + G1329 + G1330;
+  const T G1332 = G1331 * G1314;
+  const T G1333 = G220 * G1169;
+  const T G1334 = G224 * G1215;
+  const T G1335 = G228 * G1218;
+  const T G1336 = G1333 + G1334 + G1335;
+  const T G1337 = G1319 * G1336;
+  const T G1338 = C1 * G1337;
+  const T G1339 = G1332 + G1338;
+  const T G1340 = G259 * G1339;
+  const T G1341 = C1 * G1340;
+  const T G1342 = G1327 + G1341;
+  const T G1343 = G277 * G1326;
+  const T G1344 = G233 * G1230;
+  const T G1345 = G237 * G1235;
+  const T G1346 = G241 * G1238;
+  const T G1347 = G1344 + G1345 + G1346;
+  const T G1348 = G1347 * G1314;
+  const T G1349 = G220 * G1243;
+  const T G1350 = G224 * G1169;
+  const T G1351 = G228 * G1246;
+  const T G1352 = G1349 + G1350 + G1351;
+  const T G1353 = G1319 * G1352;
+  const T G1354 = C1 * G1353;
+  const T G1355 = G1348 + G1354;
+  const T G1356 = G259 * G1355;
+  const T G1357 = C1 * G1356;
+  const T G1358 = G1343 + G1357;
+  const T G1359 = G330 * G1151;
+  const T G1360 = G334 * G1157;
+  const T G1361 = G338 * G1166;
+  const T G1362 = G1359 + G1360 + G1361;
+  const T G1363 = G311 * G1170;
+  const T G1364 = G315 * G1172;
+  const T G1365 = G319 * G1174;
+  const T G1366 = G1363 + G1364 + G1365;
+  const T G1367 = G1362 * G1366;
+  const T G1368 = G330 * G1181;
+  const T G1369 = G334 * G1183;
+  const T G1370 = G338 * G1185;
+  const T G1371 = G1368 + G1369 + G1370;
+  const T G1372 = G311 * G1188;
+  const T G1373 = G315 * G1191;
+  const T G1374 = G319 * G1169;
+  const T G1375 = G1372 + G1373 + G1374;
+  const T G1376 = G1371 * G1375;
+  const T G1377 = C1 * G1376;
+  const T G1378 = G1367 + G1377;
+  const T G1379 = G302 * G1378;
+  const T G1380 = G330 * G1201;
+  const T G1381 = G334 * G1206;
+  const T G1382 = G338 * G1210;
+  const T G1383 = G1380 + G1381 + G1382;
+  const T G1384 = G1383 * G1366;
+  const T G1385 = G311 * G1169;
+  const T G1386 = G315 * G1215;
+  const T G1387 = G319 * G1218;
+  const T G1388 = G1385 + G1386 + G1387;
+  const T G1389 = G1371 * G1388;
+  const T G1390 = C1 * G1389;
+  const T G1391 = G1384 + G1390;
+  const T G1392 = G356 * G1391;
+  const T G1393 = C1 * G1392;
+  const T G1394 = G1379 + G1393;
+  const T G1395 = G374 * G1378;
+  const T G1396 = G330 * G1230;
+  const T G1397 = G334 * G1235;
+  const T G1398 = G338 * G1238;
+  const T G1399 = G1396 + G1397 + G1398;
+  const T G1400 = G1399 * G1366;
+  const T G1401 = G311 * G1243;
+  const T G1402 = G315 * G1169;
+  const T G1403 = G319 * G1246;
+  const T G1404 = G1401 + G1402 + G1403;
+  const T G1405 = G1371 * G1404;
+  const T G1406 = C1 * G1405;
+  const T G1407 = G1400 + G1406;
+  const T G1408 = G356 * G1407;
+  const T G1409 = C1 * G1408;
+  const T G1410 = G1395 + G1409;
+  const T G1411 = G427 * G1151;
+  const T G1412 = G431 * G1157;
+  const T G1413 = G435 * G1166;
+  const T G1414 = G1411 + G1412 + G1413;
+  const T G1415 = G408 * G1170;
+  const T G1416 = G412 * G1172;
+  const T G1417 = G416 * G1174;
+  const T G1418 = G1415 + G1416 + G1417;
+  const T G1419 = G1414 * G1418;
+  const T G1420 = G427 * G1181;
+  const T G1421 = G431 * G1183;
+  const T G1422 = G435 * G1185;
+  const T G1423 = G1420 + G1421 + G1422;
+  const T G1424 = G408 * G1188;
+  const T G1425 = G412 * G1191;
+  const T G1426 = G416 * G1169;
+  const T G1427 = G1424 + G1425 + G1426;
+  const T G1428 = G1423 * G1427;
+  const T G1429 = C1 * G1428;
+  const T G1430 = G1419 + G1429;
+  const T G1431 = G399 * G1430;
+  const T G1432 = G427 * G1201;
+  const T G1433 = G431 * G1206;
+  const T G1434 = G435 * G1210;
+  const T G1435 = G1432 + G1433 + G1434;
+  const T G1436 = G1435 * G1418;
+  const T G1437 = G408 * G1169;
+  const T G1438 = G412 * G1215;
+  const T G1439 = G416 * G1218;
+  const T G1440 = G1437 + G1438 + G1439;
+  const T G1441 = G1423 * G1440;
+  const T G1442 = C1 * G1441;
+  const T G1443 = G1436 + G1442;
+  const T G1444 = G453 * G1443;
+  const T G1445 = C1 * G1444;
+  const T G1446 = G1431 + G1445;
+  const T G1447 = G471 * G1430;
+  const T G1448 = G427 * G1230;
+  const T G1449 = G431 * G1235;
+  const T G1450 = G435 * G1238;
+  const T G1451 = G1448 + G1449 + G1450;
+  const T G1452 = G1451 * G1418;
+  const T G1453 = G408 * G1243;
+  const T G1454 = G412 * G1169;
+  const T G1455 = G416 * G1246;
+  const T G1456 = G1453 + G1454 + G1455;
+  const T G1457 = G1423 * G1456;
+  const T G1458 = C1 * G1457;
+  const T G1459 = G1452 + G1458;
+  const T G1460 = G453 * G1459;
+  const T G1461 = C1 * G1460;
+  const T G1462 = G1447 + G1461;
+  const T G1463 = G1310 * G1262;
+  const T G1464 = G1319 * G1271;
+  const T G1465 = C1 * G1464;
+  const T G1466 = G1463 + G1465;
+  const T G1467 = G277 * G1466;
+  const T G1468 = G1347 * G1262;
+  const T G1469 = G1319 * G1300;
+  const T G1470 = C1 * G1469;
+  const T G1471 = G1468 + G1470;
+  const T G1472 = G259 * G1471;
+  const T G1473 = C1 * G1472;
+  const T G1474 = G1467 + G1473;
+  const T G1475 = G138 * G1474;
+  const T G1476 = G217 * G1466;
+  const T G1477 = G1331 * G1262;
+  const T G1478 = G1319 * G1284;
+  const T G1479 = C1 * G1478;
+  const T G1480 = G1477 + G1479;
+  const T G1481 = G259 * G1480;
+  const T G1482 = C1 * G1481;
+  const T G1483 = G1476 + G1482;
+  const T G1484 = G198 * G1483;
+  const T G1485 = C1 * G1484;
+  const T G1486 = G1475 + G1485;
+  const T G1487 = G217 * G1471;
+  const T G1488 = G277 * G1480;
+  const T G1489 = C1 * G1488;
+  const T G1490 = G1487 + G1489;
+  const T G1491 = G180 * G1490;
+  const T G1492 = G1486 + G1491;
+  const T G1495 = X66 + t * memo[51];
+  const T G1496 = X5 + X5;
+  const T G1497 = X11 * G1496;
+  const T G1498 = G7 * G1497;
+  const T G1499 = X12 * G1496;
+  const T G1500 = G19 * G1499;
+  const T G1501 = X13 * G1496;
+  const T G1502 = G24 * G1501;
+  const T G1503 = G1498 + G1500 + G1502;
+  const T G1504 = G1168 * G1503;
+  const T G1505 = G7 * G1215;
+  const T G1506 = C1 * X4;
+  const T G1507 = C2 * G1506;
+  const T G1508 = G19 * G1507;
+  const T G1509 = C1 * G1496;
+  const T G1510 = G24 * G1509;
+  const T G1511 = G1505 + G1508 + G1510;
+  const T G1512 = G1187 * G1511;
+  const T G1513 = C1 * G1512;
+  const T G1514 = G1504 + G1513;
+  const T G1515 = G4 * G1514;
+  const T G1516 = G1212 * G1503;
+  const T G1517 = G7 * G1496;
+  const T G1518 = G19 * G1188;
+  const T G1519 = G24 * G1215;
+  const T G1520 = G1517 + G1518 + G1519;
+  const T G1521 = G1187 * G1520;
+  const T G1522 = C1 * G1521;
+  const T G1523 = G1516 + G1522;
+  const T G1524 = G76 * G1523;
+  const T G1525 = C1 * G1524;
+  const T G1526 = G1515 + G1525;
+  const T G1527 = G107 * G1514;
+  const T G1528 = G1240 * G1503;
+  const T G1529 = G19 * G1509;
+  const T G1530 = C2 * X4;
+  const T G1531 = G24 * G1530;
+  const T G1532 = G1189 + G1529 + G1531;
+  const T G1533 = G1187 * G1532;
+  const T G1534 = C1 * G1533;
+  const T G1535 = G1528 + G1534;
+  const T G1536 = G76 * G1535;
+  const T G1537 = C1 * G1536;
+  const T G1538 = G1527 + G1537;
+  const T G1539 = G141 * G1497;
+  const T G1540 = G145 * G1499;
+  const T G1541 = G149 * G1501;
+  const T G1542 = G1539 + G1540 + G1541;
+  const T G1543 = G1258 * G1542;
+  const T G1544 = G141 * G1215;
+  const T G1545 = G145 * G1507;
+  const T G1546 = G149 * G1509;
+  const T G1547 = G1544 + G1545 + G1546;
+  const T G1548 = G1267 * G1547;
+  const T G1549 = C1 * G1548;
+  const T G1550 = G1543 + G1549;
+  const T G1551 = G138 * G1550;
+  const T G1552 = G1279 * G1542;
+  const T G1553 = G141 * G1496;
+  const T G1554 = G145 * G1188;
+  const T G1555 = G149 * G1215;
+  const T G1556 = G1553 + G1554 + G1555;
+  const T G1557 = G1267 * G1556;
+  const T G1558 = C1 * G1557;
+  const T G1559 = G1552 + G1558;
+  const T G1560 = G180 * G1559;
+  const T G1561 = C1 * G1560;
+  const T G1562 = G1551 + G1561;
+  const T G1563 = G198 * G1550;
+  const T G1564 = G1295 * G1542;
+  const T G1565 = G145 * G1509;
+  const T G1566 = G149 * G1530;
+  const T G1567 = G1268 + G1565 + G1566;
+  const T G1568 = G1267 * G1567;
+  const T G1569 = C1 * G1568;
+  const T G1570 = G1564 + G1569;
+  const T G1571 = G180 * G1570;
+  const T G1572 = C1 * G1571;
+  const T G1573 = G1563 + G1572;
+  const T G1574 = G220 * G1497;
+  const T G1575 = G224 * G1499;
+  const T G1576 = G228 * G1501;
+  const T G1577 = G1574 + G1575 + G1576;
+  const T G1578 = G1310 * G1577;
+  const T G1579 = G220 * G1215;
+  const T G1580 = G224 * G1507;
+  const T G1581 = G228 * G1509;
+  const T G1582 = G1579 + G1580 + G1581;
+  const T G1583 = G1319 * G1582;
+  const T G1584 = C1 * G1583;
+  const T G1585 = G1578 + G1584;
+  const T G1586 = G217 * G1585;
+  const T G1587 = G1331 * G1577;
+  const T G1588 = G220 * G1496;
+  const T G1589 = G224 * G1188;
+  const T G1590 = G228 * G1215;
+  const T G1591 = G1588 + G1589 + G1590;
+  const T G1592 = G1319 * G1591;
+  const T G1593 = C1 * G1592;
+  const T G1594 = G1587 + G1593;
+  const T G1595 = G259 * G1594;
+  const T G1596 = C1 * G1595;
+  const T G1597 = G1586 + G1596;
+  const T G1598 = G277 * G1585;
+  const T G1599 = G1347 * G1577;
+  const T G1600 = G224 * G1509;
+  const T G1601 = G228 * G1530;
+  const T G1602 = G1320 + G1600 + G1601;
+  const T G1603 = G1319 * G1602;
+  const T G1604 = C1 * G1603;
+  const T G1605 = G1599 + G1604;
+  const T G1606 = G259 * G1605;
+  const T G1607 = C1 * G1606;
+  const T G1608 = G1598 + G1607;
+  const T G1609 = G311 * G1497;
+  const T G1610 = G315 * G1499;
+  const T G1611 = G319 * G1501;
+  const T G1612 = G1609 + G1610 + G1611;
+  const T G1613 = G1362 * G1612;
+  const T G1614 = G311 * G1215;
+  const T G1615 = G315 * G1507;
+  const T G1616 = G319 * G1509;
+  const T G1617 = G1614 + G1615 + G1616;
+  const T G1618 = G1371 * G1617;
+  const T G1619 = C1 * G1618;
+  const T G1620 = G1613 + G1619;
+  const T G1621 = G302 * G1620;
+  const T G1622 = G1383 * G1612;
+  const T G1623 = G311 * G1496;
+  const T G1624 = G315 * G1188;
+  const T G1625 = G319 * G1215;
+  const T G1626 = G1623 + G1624 + G1625;
+  const T G1627 = G1371 * G1626;
+  const T G1628 = C1 * G1627;
+  const T G1629 = G1622 + G1628;
+  const T G1630 = G356 * G1629;
+  const T G1631 = C1 * G1630;
+  const T G1632 = G1621 + G1631;
+  const T G1633 = G374 * G1620;
+  const T G1634 = G1399 * G1612;
+  const T G1635 = G315 * G1509;
+  const T G1636 = G319 * G1530;
+  const T G1637 = G1372 + G1635 + G1636;
+  const T G1638 = G1371 * G1637;
+  const T G1639 = C1 * G1638;
+  const T G1640 = G1634 + G1639;
+  const T G1641 = G356 * G1640;
+  const T G1642 = C1 * G1641;
+  const T G1643 = G1633 + G1642;
+  const T G1644 = G408 * G1497;
+  const T G1645 = G412 * G1499;
+  const T G1646 = G416 * G1501;
+  const T G1647 = G1644 + G1645 + G1646;
+  const T G1648 = G1414 * G1647;
+  const T G1649 = G408 * G1215;
+  const T G1650 = G412 * G1507;
+  const T G1651 = G416 * G1509;
+  const T G1652 = G1649 + G1650 + G1651;
+  const T G1653 = G1423 * G1652;
+  const T G1654 = C1 * G1653;
+  const T G1655 = G1648 + G1654;
+  const T G1656 = G399 * G1655;
+  const T G1657 = G1435 * G1647;
+  const T G1658 = G408 * G1496;
+  const T G1659 = G412 * G1188;
+  const T G1660 = G416 * G1215;
+  const T G1661 = G1658 + G1659 + G1660;
+  const T G1662 = G1423 * G1661;
+  const T G1663 = C1 * G1662;
+  const T G1664 = G1657 + G1663;
+  const T G1665 = G453 * G1664;
+  const T G1666 = C1 * G1665;
+  const T G1667 = G1656 + G1666;
+  const T G1668 = G471 * G1655;
+  const T G1669 = G1451 * G1647;
+  const T G1670 = G412 * G1509;
+  const T G1671 = G416 * G1530;
+  const T G1672 = G1424 + G1670 + G1671;
+  const T G1673 = G1423 * G1672;
+  const T G1674 = C1 * G1673;
+  const T G1675 = G1669 + G1674;
+  const T G1676 = G453 * G1675;
+  const T G1677 = C1 * G1676;
+  const T G1678 = G1668 + G1677;
+  const T G1679 = G1310 * G1542;
+  const T G1680 = G1319 * G1547;
+  const T G1681 = C1 * G1680;
+  const T G1682 = G1679 + G1681;
+  const T G1683 = G277 * G1682;
+  const T G1684 = G1347 * G1542;
+  const T G1685 = G1319 * G1567;
+  const T G1686 = C1 * G1685;
+  const T G1687 = G1684 + G1686;
+  const T G1688 = G259 * G1687;
+  const T G1689 = C1 * G1688;
+  const T G1690 = G1683 + G1689;
+  const T G1691 = G138 * G1690;
+  const T G1692 = G217 * G1682;
+  const T G1693 = G1331 * G1542;
+  const T G1694 = G1319 * G1556;
+  const T G1695 = C1 * G1694;
+  const T G1696 = G1693 + G1695;
+  const T G1697 = G259 * G1696;
+  const T G1698 = C1 * G1697;
+  const T G1699 = G1692 + G1698;
+  const T G1700 = G198 * G1699;
+  const T G1701 = C1 * G1700;
+  const T G1702 = G1691 + G1701;
+  const T G1703 = G217 * G1687;
+  const T G1704 = G277 * G1696;
+  const T G1705 = C1 * G1704;
+  const T G1706 = G1703 + G1705;
+  const T G1707 = G180 * G1706;
+  const T G1708 = G1702 + G1707;
+  const T G1711 = X67 + t * memo[52];
+  const T G1712 = X6 + X6;
+  const T G1713 = X11 * G1712;
+  const T G1714 = G7 * G1713;
+  const T G1715 = X12 * G1712;
+  const T G1716 = G19 * G1715;
+  const T G1717 = X13 * G1712;
+  const T G1718 = G24 * G1717;
+  const T G1719 = G1714 + G1716 + G1718;
+  const T G1720 = G1168 * G1719;
+  const T G1721 = G7 * G1530;
+  const T G1722 = C1 * G1712;
+  const T G1723 = G24 * G1722;
+  const T G1724 = G1721 + G1216 + G1723;
+  const T G1725 = G1187 * G1724;
+  const T G1726 = C1 * G1725;
+  const T G1727 = G1720 + G1726;
+  const T G1728 = G4 * G1727;
+  const T G1729 = G1212 * G1719;
+  const T G1730 = G7 * G1722;
+  const T G1731 = G19 * G1246;
+  const T G1732 = G24 * G1507;
+  const T G1733 = G1730 + G1731 + G1732;
+  const T G1734 = G1187 * G1733;
+  const T G1735 = C1 * G1734;
+  const T G1736 = G1729 + G1735;
+  const T G1737 = G76 * G1736;
+  const T G1738 = C1 * G1737;
+  const T G1739 = G1728 + G1738;
+  const T G1740 = G107 * G1727;
+  const T G1741 = G1240 * G1719;
+  const T G1742 = G7 * G1246;
+  const T G1743 = G19 * G1712;
+  const T G1744 = G1742 + G1743 + G1519;
+  const T G1745 = G1187 * G1744;
+  const T G1746 = C1 * G1745;
+  const T G1747 = G1741 + G1746;
+  const T G1748 = G76 * G1747;
+  const T G1749 = C1 * G1748;
+  const T G1750 = G1740 + G1749;
+  const T G1751 = G141 * G1713;
+  const T G1752 = G145 * G1715;
+  const T G1753 = G149 * G1717;
+  const T G1754 = G1751 + G1752 + G1753;
+  const T G1755 = G1258 * G1754;
+  const T G1756 = G141 * G1530;
+  const T G1757 = G149 * G1722;
+  const T G1758 = G1756 + G1282 + G1757;
+  const T G1759 = G1267 * G1758;
+  const T G1760 = C1 * G1759;
+  const T G1761 = G1755 + G1760;
+  const T G1762 = G138 * G1761;
+  const T G1763 = G1279 * G1754;
+  const T G1764 = G141 * G1722;
+  const T G1765 = G145 * G1246;
+  const T G1766 = G149 * G1507;
+  const T G1767 = G1764 + G1765 + G1766;
+  const T G1768 = G1267 * G1767;
+  const T G1769 = C1 * G1768;
+  const T G1770 = G1763 + G1769;
+  const T G1771 = G180 * G1770;
+  const T G1772 = C1 * G1771;
+  const T G1773 = G1762 + G1772;
+  const T G1774 = G198 * G1761;
+  const T G1775 = G1295 * G1754;
+  const T G1776 = G141 * G1246;
+  const T G1777 = G145 * G1712;
+  const T G1778 = G1776 + G1777 + G1555;
+  const T G1779 = G1267 * G1778;
+  const T G1780 = C1 * G1779;
+  const T G1781 = G1775 + G1780;
+  const T G1782 = G180 * G1781;
+  const T G1783 = C1 * G1782;
+  const T G1784 = G1774 + G1783;
+  const T G1785 = G220 * G1713;
+  const T G1786 = G224 * G1715;
+  const T G1787 = G228 * G1717;
+  const T G1788 = G1785 + G1786 + G1787;
+  const T G1789 = G1310 * G1788;
+  const T G1790 = G220 * G1530;
+  const T G1791 = G228 * G1722;
+  const T G1792 = G1790 + G1334 + G1791;
+  const T G1793 = G1319 * G1792;
+  const T G1794 = C1 * G1793;
+  const T G1795 = G1789 + G1794;
+  const T G1796 = G217 * G1795;
+  const T G1797 = G1331 * G1788;
+  const T G1798 = G220 * G1722;
+  const T G1799 = G224 * G1246;
+  const T G1800 = G228 * G1507;
+  const T G1801 = G1798 + G1799 + G1800;
+  const T G1802 = G1319 * G1801;
+  const T G1803 = C1 * G1802;
+  const T G1804 = G1797 + G1803;
+  const T G1805 = G259 * G1804;
+  const T G1806 = C1 * G1805;
+  const T G1807 = G1796 + G1806;
+  const T G1808 = G277 * G1795;
+  const T G1809 = G1347 * G1788;
+  const T G1810 = G220 * G1246;
+  const T G1811 = G224 * G1712;
+  const T G1812 = G1810 + G1811 + G1590;
+  const T G1813 = G1319 * G1812;
+  const T G1814 = C1 * G1813;
+  const T G1815 = G1809 + G1814;
+  const T G1816 = G259 * G1815;
+  const T G1817 = C1 * G1816;
+  const T G1818 = G1808 + G1817;
+  const T G1819 = G311 * G1713;
+  const T G1820 = G315 * G1715;
+  const T G1821 = G319 * G1717;
+  const T G1822 = G1819 + G1820 + G1821;
+  const T G1823 = G1362 * G1822;
+  const T G1824 = G311 * G1530;
+  const T G1825 = G319 * G1722;
+  const T G1826 = G1824 + G1386 + G1825;
+  const T G1827 = G1371 * G1826;
+  const T G1828 = C1 * G1827;
+  const T G1829 = G1823 + G1828;
+  const T G1830 = G302 * G1829;
+  const T G1831 = G1383 * G1822;
+  const T G1832 = G311 * G1722;
+  const T G1833 = G315 * G1246;
+  const T G1834 = G319 * G1507;
+  const T G1835 = G1832 + G1833 + G1834;
+  const T G1836 = G1371 * G1835;
+  const T G1837 = C1 * G1836;
+  const T G1838 = G1831 + G1837;
+  const T G1839 = G356 * G1838;
+  const T G1840 = C1 * G1839;
+  const T G1841 = G1830 + G1840;
+  const T G1842 = G374 * G1829;
+  const T G1843 = G1399 * G1822;
+  const T G1844 = G311 * G1246;
+  const T G1845 = G315 * G1712;
+  const T G1846 = G1844 + G1845 + G1625;
+  const T G1847 = G1371 * G1846;
+  const T G1848 = C1 * G1847;
+  const T G1849 = G1843 + G1848;
+  const T G1850 = G356 * G1849;
+  const T G1851 = C1 * G1850;
+  const T G1852 = G1842 + G1851;
+  const T G1853 = G408 * G1713;
+  const T G1854 = G412 * G1715;
+  const T G1855 = G416 * G1717;
+  const T G1856 = G1853 + G1854 + G1855;
+  const T G1857 = G1414 * G1856;
+  const T G1858 = G408 * G1530;
+  const T G1859 = G416 * G1722;
+  const T G1860 = G1858 + G1438 + G1859;
+  const T G1861 = G1423 * G1860;
+  const T G1862 = C1 * G1861;
+  const T G1863 = G1857 + G1862;
+  const T G1864 = G399 * G1863;
+  const T G1865 = G1435 * G1856;
+  const T G1866 = G408 * G1722;
+  const T G1867 = G412 * G1246;
+  const T G1868 = G416 * G1507;
+  const T G1869 = G1866 + G1867 + G1868;
+  const T G1870 = G1423 * G1869;
+  const T G1871 = C1 * G1870;
+  const T G1872 = G1865 + G1871;
+  const T G1873 = G453 * G1872;
+  const T G1874 = C1 * G1873;
+  const T G1875 = G1864 + G1874;
+  const T G1876 = G471 * G1863;
+  const T G1877 = G1451 * G1856;
+  const T G1878 = G408 * G1246;
+  const T G1879 = G412 * G1712;
+  const T G1880 = G1878 + G1879 + G1660;
+  const T G1881 = G1423 * G1880;
+  const T G1882 = C1 * G1881;
+  const T G1883 = G1877 + G1882;
+  const T G1884 = G453 * G1883;
+  const T G1885 = C1 * G1884;
+  const T G1886 = G1876 + G1885;
+  const T G1887 = G1310 * G1754;
+  const T G1888 = G1319 * G1758;
+  const T G1889 = C1 * G1888;
+  const T G1890 = G1887 + G1889;
+  const T G1891 = G277 * G1890;
+  const T G1892 = G1347 * G1754;
+  const T G1893 = G1319 * G1778;
+  const T G1894 = C1 * G1893;
+  const T G1895 = G1892 + G1894;
+  const T G1896 = G259 * G1895;
+  const T G1897 = C1 * G1896;
+  const T G1898 = G1891 + G1897;
+  const T G1899 = G138 * G1898;
+  const T G1900 = G217 * G1890;
+  const T G1901 = G1331 * G1754;
+  const T G1902 = G1319 * G1767;
+  const T G1903 = C1 * G1902;
+  const T G1904 = G1901 + G1903;
+  const T G1905 = G259 * G1904;
+  const T G1906 = C1 * G1905;
+  const T G1907 = G1900 + G1906;
+  const T G1908 = G198 * G1907;
+  const T G1909 = C1 * G1908;
+  const T G1910 = G1899 + G1909;
+  const T G1911 = G217 * G1895;
+  const T G1912 = G277 * G1904;
+  const T G1913 = C1 * G1912;
+  const T G1914 = G1911 + G1913;
+  const T G1915 = G180 * G1914;
+  const T G1916 = G1910 + G1915;
+  const T G1919 = X68 + t * memo[53];
+  const T G1920 = X7 + X7;
+  const T G1921 = X11 * G1920;
+  const T G1922 = G7 * G1921;
+  const T G1923 = X12 * G1920;
+  const T G1924 = G19 * G1923;
+  const T G1925 = X13 * G1920;
+  const T G1926 = G24 * G1925;
+  const T G1927 = G1922 + G1924 + G1926;
+  const T G1928 = G1168 * G1927;
+  const T G1929 = G24 * G1920;
+  const T G1930 = G1742 + G1518 + G1929;
+  const T G1931 = G1187 * G1930;
+  const T G1932 = C1 * G1931;
+  const T G1933 = G1928 + G1932;
+  const T G1934 = G4 * G1933;
+  const T G1935 = G1212 * G1927;
+  const T G1936 = C1 * G1920;
+  const T G1937 = G7 * G1936;
+  const T G1938 = G19 * G1530;
+  const T G1939 = G1937 + G1938 + G1247;
+  const T G1940 = G1187 * G1939;
+  const T G1941 = C1 * G1940;
+  const T G1942 = G1935 + G1941;
+  const T G1943 = G76 * G1942;
+  const T G1944 = C1 * G1943;
+  const T G1945 = G1934 + G1944;
+  const T G1946 = G107 * G1933;
+  const T G1947 = G1240 * G1927;
+  const T G1948 = G7 * G1507;
+  const T G1949 = G19 * G1936;
+  const T G1950 = G24 * G1188;
+  const T G1951 = G1948 + G1949 + G1950;
+  const T G1952 = G1187 * G1951;
+  const T G1953 = C1 * G1952;
+  const T G1954 = G1947 + G1953;
+  const T G1955 = G76 * G1954;
+  const T G1956 = C1 * G1955;
+  const T G1957 = G1946 + G1956;
+  const T G1958 = G141 * G1921;
+  const T G1959 = G145 * G1923;
+  const T G1960 = G149 * G1925;
+  const T G1961 = G1958 + G1959 + G1960;
+  const T G1962 = G1258 * G1961;
+  const T G1963 = G149 * G1920;
+  const T G1964 = G1776 + G1554 + G1963;
+  const T G1965 = G1267 * G1964;
+  const T G1966 = C1 * G1965;
+  const T G1967 = G1962 + G1966;
+  const T G1968 = G138 * G1967;
+  const T G1969 = G1279 * G1961;
+  const T G1970 = G141 * G1936;
+  const T G1971 = G145 * G1530;
+  const T G1972 = G1970 + G1971 + G1299;
+  const T G1973 = G1267 * G1972;
+  const T G1974 = C1 * G1973;
+  const T G1975 = G1969 + G1974;
+  const T G1976 = G180 * G1975;
+  const T G1977 = C1 * G1976;
+  const T G1978 = G1968 + G1977;
+  const T G1979 = G198 * G1967;
+  const T G1980 = G1295 * G1961;
+  const T G1981 = G141 * G1507;
+  const T G1982 = G145 * G1936;
+  const T G1983 = G149 * G1188;
+  const T G1984 = G1981 + G1982 + G1983;
+  const T G1985 = G1267 * G1984;
+  const T G1986 = C1 * G1985;
+  const T G1987 = G1980 + G1986;
+  const T G1988 = G180 * G1987;
+  const T G1989 = C1 * G1988;
+  const T G1990 = G1979 + G1989;
+  const T G1991 = G220 * G1921;
+  const T G1992 = G224 * G1923;
+  const T G1993 = G228 * G1925;
+  const T G1994 = G1991 + G1992 + G1993;
+  const T G1995 = G1310 * G1994;
+  const T G1996 = G228 * G1920;
+  const T G1997 = G1810 + G1589 + G1996;
+  const T G1998 = G1319 * G1997;
+  const T G1999 = C1 * G1998;
+  const T G2000 = G1995 + G1999;
+  const T G2001 = G217 * G2000;
+  const T G2002 = G1331 * G1994;
+  const T G2003 = G220 * G1936;
+  const T G2004 = G224 * G1530;
+  const T G2005 = G2003 + G2004 + G1351;
+  const T G2006 = G1319 * G2005;
+  const T G2007 = C1 * G2006;
+  const T G2008 = G2002 + G2007;
+  const T G2009 = G259 * G2008;
+  const T G2010 = C1 * G2009;
+  const T G2011 = G2001 + G2010;
+  const T G2012 = G277 * G2000;
+  const T G2013 = G1347 * G1994;
+  const T G2014 = G220 * G1507;
+  const T G2015 = G224 * G1936;
+  const T G2016 = G228 * G1188;
+  const T G2017 = G2014 + G2015 + G2016;
+  const T G2018 = G1319 * G2017;
+  const T G2019 = C1 * G2018;
+  const T G2020 = G2013 + G2019;
+  const T G2021 = G259 * G2020;
+  const T G2022 = C1 * G2021;
+  const T G2023 = G2012 + G2022;
+  const T G2024 = G311 * G1921;
+  const T G2025 = G315 * G1923;
+  const T G2026 = G319 * G1925;
+  const T G2027 = G2024 + G2025 + G2026;
+  const T G2028 = G1362 * G2027;
+  const T G2029 = G319 * G1920;
+  const T G2030 = G1844 + G1624 + G2029;
+  const T G2031 = G1371 * G2030;
+  const T G2032 = C1 * G2031;
+  const T G2033 = G2028 + G2032;
+  const T G2034 = G302 * G2033;
+  const T G2035 = G1383 * G2027;
+  const T G2036 = G311 * G1936;
+  const T G2037 = G315 * G1530;
+  const T G2038 = G2036 + G2037 + G1403;
+  const T G2039 = G1371 * G2038;
+  const T G2040 = C1 * G2039;
+  const T G2041 = G2035 + G2040;
+  const T G2042 = G356 * G2041;
+  const T G2043 = C1 * G2042;
+  const T G2044 = G2034 + G2043;
+  const T G2045 = G374 * G2033;
+  const T G2046 = G1399 * G2027;
+  const T G2047 = G311 * G1507;
+  const T G2048 = G315 * G1936;
+  const T G2049 = G319 * G1188;
+  const T G2050 = G2047 + G2048 + G2049;
+  const T G2051 = G1371 * G2050;
+  const T G2052 = C1 * G2051;
+  const T G2053 = G2046 + G2052;
+  const T G2054 = G356 * G2053;
+  const T G2055 = C1 * G2054;
+  const T G2056 = G2045 + G2055;
+  const T G2057 = G408 * G1921;
+  const T G2058 = G412 * G1923;
+  const T G2059 = G416 * G1925;
+  const T G2060 = G2057 + G2058 + G2059;
+  const T G2061 = G1414 * G2060;
+  const T G2062 = G416 * G1920;
+  const T G2063 = G1878 + G1659 + G2062;
+  const T G2064 = G1423 * G2063;
+  const T G2065 = C1 * G2064;
+  const T G2066 = G2061 + G2065;
+  const T G2067 = G399 * G2066;
+  const T G2068 = G1435 * G2060;
+  const T G2069 = G408 * G1936;
+  const T G2070 = G412 * G1530;
+  const T G2071 = G2069 + G2070 + G1455;
+  const T G2072 = G1423 * G2071;
+  const T G2073 = C1 * G2072;
+  const T G2074 = G2068 + G2073;
+  const T G2075 = G453 * G2074;
+  const T G2076 = C1 * G2075;
+  const T G2077 = G2067 + G2076;
+  const T G2078 = G471 * G2066;
+  const T G2079 = G1451 * G2060;
+  const T G2080 = G408 * G1507;
+  const T G2081 = G412 * G1936;
+  const T G2082 = G416 * G1188;
+  const T G2083 = G2080 + G2081 + G2082;
+  const T G2084 = G1423 * G2083;
+  const T G2085 = C1 * G2084;
+  const T G2086 = G2079 + G2085;
+  const T G2087 = G453 * G2086;
+  const T G2088 = C1 * G2087;
+  const T G2089 = G2078 + G2088;
+  const T G2090 = G1310 * G1961;
+  const T G2091 = G1319 * G1964;
+  const T G2092 = C1 * G2091;
+  const T G2093 = G2090 + G2092;
+  const T G2094 = G277 * G2093;
+  const T G2095 = G1347 * G1961;
+  const T G2096 = G1319 * G1984;
+  const T G2097 = C1 * G2096;
+  const T G2098 = G2095 + G2097;
+  const T G2099 = G259 * G2098;
+  const T G2100 = C1 * G2099;
+  const T G2101 = G2094 + G2100;
+  const T G2102 = G138 * G2101;
+  const T G2103 = G217 * G2093;
+  const T G2104 = G1331 * G1961;
+  const T G2105 = G1319 * G1972;
+  const T G2106 = C1 * G2105;
+  const T G2107 = G2104 + G2106;
+  const T G2108 = G259 * G2107;
+  const T G2109 = C1 * G2108;
+  const T G2110 = G2103 + G2109;
+  const T G2111 = G198 * G2110;
+  const T G2112 = C1 * G2111;
+  const T G2113 = G2102 + G2112;
+  const T G2114 = G217 * G2098;
+  const T G2115 = G277 * G2107;
+  const T G2116 = C1 * G2115;
+  const T G2117 = G2114 + G2116;
+  const T G2118 = G180 * G2117;
+  const T G2119 = G2113 + G2118;
+  const T G2122 = X69 + t * memo[54];
+  const T G2123 = G30 * G1180;
+  const T G2124 = G62 * G2123;
+  const T G2125 = C1 * G2124;
+  const T G2126 = G4 * G2125;
+  const T G2127 = G98 * G2123;
+  const T G2128 = C1 * G2127;
+  const T G2129 = G76 * G2128;
+  const T G2130 = C1 * G2129;
+  const T G2131 = G2126 + G2130;
+  const T G2132 = G107 * G2125;
+  const T G2133 = G129 * G2123;
+  const T G2134 = C1 * G2133;
+  const T G2135 = G76 * G2134;
+  const T G2136 = C1 * G2135;
+  const T G2137 = G2132 + G2136;
+  const T G2138 = G154 * G1180;
+  const T G2139 = G169 * G2138;
+  const T G2140 = C1 * G2139;
+  const T G2141 = G138 * G2140;
+  const T G2142 = G189 * G2138;
+  const T G2143 = C1 * G2142;
+  const T G2144 = G180 * G2143;
+  const T G2145 = C1 * G2144;
+  const T G2146 = G2141 + G2145;
+  const T G2147 = G198 * G2140;
+  const T G2148 = G208 * G2138;
+  const T G2149 = C1 * G2148;
+  const T G2150 = G180 * G2149;
+  const T G2151 = C1 * G2150;
+  const T G2152 = G2147 + G2151;
+  const T G2153 = G233 * G1180;
+  const T G2154 = G248 * G2153;
+  const T G2155 = C1 * G2154;
+  const T G2156 = G217 * G2155;
+  const T G2157 = G268 * G2153;
+  const T G2158 = C1 * G2157;
+  const T G2159 = G259 * G2158;
+  const T G2160 = C1 * G2159;
+  const T G2161 = G2156 + G2160;
+  const T G2162 = G277 * G2155;
+  const T G2163 = G287 * G2153;
+  const T G2164 = C1 * G2163;
+  const T G2165 = G259 * G2164;
+  const T G2166 = C1 * G2165;
+  const T G2167 = G2162 + G2166;
+  const T G2168 = G330 * G1180;
+  const T G2169 = G345 * G2168;
+  const T G2170 = C1 * G2169;
+  const T G2171 = G302 * G2170;
+  const T G2172 = G365 * G2168;
+  const T G2173 = C1 * G2172;
+  const T G2174 = G356 * G2173;
+  const T G2175 = C1 * G2174;
+  const T G2176 = G2171 + G2175;
+  const T G2177 = G374 * G2170;
+  const T G2178 = G384 * G2168;
+  const T G2179 = C1 * G2178;
+  const T G2180 = G356 * G2179;
+  const T G2181 = C1 * G2180;
+  const T G2182 = G2177 + G2181;
+  const T G2183 = G427 * G1180;
+  const T G2184 = G442 * G2183;
+  const T G2185 = C1 * G2184;
+  const T G2186 = G399 * G2185;
+  const T G2187 = G462 * G2183;
+  const T G2188 = C1 * G2187;
+  const T G2189 = G453 * G2188;
+  const T G2190 = C1 * G2189;
+  const T G2191 = G2186 + G2190;
+  const T G2192 = G471 * G2185;
+  const T G2193 = G481 * G2183;
+  const T G2194 = C1 * G2193;
+  const T G2195 = G453 * G2194;
+  const T G2196 = C1 * G2195;
+  const T G2197 = G2192 + G2196;
+  const T G2198 = G169 * G2153;
+  const T G2199 = C1 * G2198;
+  const T G2200 = G277 * G2199;
+  const T G2201 = G208 * G2153;
+  const T G2202 = C1 * G2201;
+  const T G2203 = G259 * G2202;
+  const T G2204 = C1 * G2203;
+  const T G2205 = G2200 + G2204;
+  const T G2206 = G138 * G2205;
+  const T G2207 = G217 * G2199;
+  const T G2208 = G189 * G2153;
+  const T G2209 = C1 * G2208;
+  const T G2210 = G259 * G2209;
+  const T G2211 = C1 * G2210;
+  const T G2212 = G2207 + G2211;
+  const T G2213 = G198 * G2212;
+  const T G2214 = C1 * G2213;
+  const T G2215 = G2206 + G2214;
+  const T G2216 = G217 * G2202;
+  const T G2217 = G277 * G2209;
+  const T G2218 = C1 * G2217;
+  const T G2219 = G2216 + G2218;
+  const T G2220 = G180 * G2219;
+  const T G2221 = G2215 + G2220;
+  const T G2224 = X54 + t * memo[39];
+  const T G2225 = G35 * G1180;
+  const T G2226 = G62 * G2225;
+  const T G2227 = C1 * G2226;
+  const T G2228 = G4 * G2227;
+  const T G2229 = G98 * G2225;
+  const T G2230 = C1 * G2229;
+  const T G2231 = G76 * G2230;
+  const T G2232 = C1 * G2231;
+  const T G2233 = G2228 + G2232;
+  const T G2234 = G107 * G2227;
+  const T G2235 = G129 * G2225;
+  const T G2236 = C1 * G2235;
+  const T G2237 = G76 * G2236;
+  const T G2238 = C1 * G2237;
+  const T G2239 = G2234 + G2238;
+  const T G2240 = G158 * G1180;
+  const T G2241 = G169 * G2240;
+  const T G2242 = C1 * G2241;
+  const T G2243 = G138 * G2242;
+  const T G2244 = G189 * G2240;
+  const T G2245 = C1 * G2244;
+  const T G2246 = G180 * G2245;
+  const T G2247 = C1 * G2246;
+  const T G2248 = G2243 + G2247;
+  const T G2249 = G198 * G2242;
+  const T G2250 = G208 * G2240;
+  const T G2251 = C1 * G2250;
+  const T G2252 = G180 * G2251;
+  const T G2253 = C1 * G2252;
+  const T G2254 = G2249 + G2253;
+  const T G2255 = G237 * G1180;
+  const T G2256 = G248 * G2255;
+  const T G2257 = C1 * G2256;
+  const T G2258 = G217 * G2257;
+  const T G2259 = G268 * G2255;
+  const T G2260 = C1 * G2259;
+  const T G2261 = G259 * G2260;
+  const T G2262 = C1 * G2261;
+  const T G2263 = G2258 + G2262;
+  const T G2264 = G277 * G2257;
+  const T G2265 = G287 * G2255;
+  const T G2266 = C1 * G2265;
+  const T G2267 = G259 * G2266;
+  const T G2268 = C1 * G2267;
+  const T G2269 = G2264 + G2268;
+  const T G2270 = G334 * G1180;
+  const T G2271 = G345 * G2270;
+  const T G2272 = C1 * G2271;
+  const T G2273 = G302 * G2272;
+  const T G2274 = G365 * G2270;
+  const T G2275 = C1 * G2274;
+  const T G2276 = G356 * G2275;
+  const T G2277 = C1 * G2276;
+  const T G2278 = G2273 + G2277;
+  const T G2279 = G374 * G2272;
+  const T G2280 = G384 * G2270;
+  const T G2281 = C1 * G2280;
+  const T G2282 = G356 * G2281;
+  const T G2283 = C1 * G2282;
+  const T G2284 = G2279 + G2283;
+  const T G2285 = G431 * G1180;
+  const T G2286 = G442 * G2285;
+  const T G2287 = C1 * G2286;
+  const T G2288 = G399 * G2287;
+  const T G2289 = G462 * G2285;
+  const T G2290 = C1 * G2289;
+  const T G2291 = G453 * G2290;
+  const T G2292 = C1 * G2291;
+  const T G2293 = G2288 + G2292;
+  const T G2294 = G471 * G2287;
+  const T G2295 = G481 * G2285;
+  const T G2296 = C1 * G2295;
+  const T G2297 = G453 * G2296;
+  const T G2298 = C1 * G2297;
+  const T G2299 = G2294 + G2298;
+  const T G2300 = G169 * G2255;
+  const T G2301 = C1 * G2300;
+  const T G2302 = G277 * G2301;
+  const T G2303 = G208 * G2255;
+  const T G2304 = C1 * G2303;
+  const T G2305 = G259 * G2304;
+  const T G2306 = C1 * G2305;
+  const T G2307 = G2302 + G2306;
+  const T G2308 = G138 * G2307;
+  const T G2309 = G217 * G2301;
+  const T G2310 = G189 * G2255;
+  const T G2311 = C1 * G2310;
+  const T G2312 = G259 * G2311;
+  const T G2313 = C1 * G2312;
+  const T G2314 = G2309 + G2313;
+  const T G2315 = G198 * G2314;
+  const T G2316 = C1 * G2315;
+  const T G2317 = G2308 + G2316;
+  const T G2318 = G217 * G2304;
+  const T G2319 = G277 * G2311;
+  const T G2320 = C1 * G2319;
+  const T G2321 = G2318 + G2320;
+  const T G2322 = G180 * G2321;
+  const T G2323 = G2317 + G2322;
+  const T G2326 = X55 + t * memo[40];
+  const T G2327 = G41 * G1180;
+  const T G2328 = G62 * G2327;
+  const T G2329 = C1 * G2328;
+  const T G2330 = G4 * G2329;
+  const T G2331 = G98 * G2327;
+  const T G2332 = C1 * G2331;
+  const T G2333 = G76 * G2332;
+  const T G2334 = C1 * G2333;
+  const T G2335 = G2330 + G2334;
+  const T G2336 = G107 * G2329;
+  const T G2337 = G129 * G2327;
+  const T G2338 = C1 * G2337;
+  const T G2339 = G76 * G2338;
+  const T G2340 = C1 * G2339;
+  const T G2341 = G2336 + G2340;
+  const T G2342 = G162 * G1180;
+  const T G2343 = G169 * G2342;
+  const T G2344 = C1 * G2343;
+  const T G2345 = G138 * G2344;
+  const T G2346 = G189 * G2342;
+  const T G2347 = C1 * G2346;
+  const T G2348 = G180 * G2347;
+  const T G2349 = C1 * G2348;
+  const T G2350 = G2345 + G2349;
+  const T G2351 = G198 * G2344;
+  const T G2352 = G208 * G2342;
+  const T G2353 = C1 * G2352;
+  const T G2354 = G180 * G2353;
+  const T G2355 = C1 * G2354;
+  const T G2356 = G2351 + G2355;
+  const T G2357 = G241 * G1180;
+  const T G2358 = G248 * G2357;
+  const T G2359 = C1 * G2358;
+  const T G2360 = G217 * G2359;
+  const T G2361 = G268 * G2357;
+  const T G2362 = C1 * G2361;
+  const T G2363 = G259 * G2362;
+  const T G2364 = C1 * G2363;
+  const T G2365 = G2360 + G2364;
+  const T G2366 = G277 * G2359;
+  const T G2367 = G287 * G2357;
+  const T G2368 = C1 * G2367;
+  const T G2369 = G259 * G2368;
+  const T G2370 = C1 * G2369;
+  const T G2371 = G2366 + G2370;
+  const T G2372 = G338 * G1180;
+  const T G2373 = G345 * G2372;
+  const T G2374 = C1 * G2373;
+  const T G2375 = G302 * G2374;
+  const T G2376 = G365 * G2372;
+  const T G2377 = C1 * G2376;
+  const T G2378 = G356 * G2377;
+  const T G2379 = C1 * G2378;
+  const T G2380 = G2375 + G2379;
+  const T G2381 = G374 * G2374;
+  const T G2382 = G384 * G2372;
+  const T G2383 = C1 * G2382;
+  const T G2384 = G356 * G2383;
+  const T G2385 = C1 * G2384;
+  const T G2386 = G2381 + G2385;
+  const T G2387 = G435 * G1180;
+  const T G2388 = G442 * G2387;
+  const T G2389 = C1 * G2388;
+  const T G2390 = G399 * G2389;
+  const T G2391 = G462 * G2387;
+  const T G2392 = C1 * G2391;
+  const T G2393 = G453 * G2392;
+  const T G2394 = C1 * G2393;
+  const T G2395 = G2390 + G2394;
+  const T G2396 = G471 * G2389;
+  const T G2397 = G481 * G2387;
+  const T G2398 = C1 * G2397;
+  const T G2399 = G453 * G2398;
+  const T G2400 = C1 * G2399;
+  const T G2401 = G2396 + G2400;
+  const T G2402 = G169 * G2357;
+  const T G2403 = C1 * G2402;
+  const T G2404 = G277 * G2403;
+  const T G2405 = G208 * G2357;
+  const T G2406 = C1 * G2405;
+  const T G2407 = G259 * G2406;
+  const T G2408 = C1 * G2407;
+  const T G2409 = G2404 + G2408;
+  const T G2410 = G138 * G2409;
+  const T G2411 = G217 * G2403;
+  const T G2412 = G189 * G2357;
+  const T G2413 = C1 * G2412;
+  const T G2414 = G259 * G2413;
+  const T G2415 = C1 * G2414;
+  const T G2416 = G2411 + G2415;
+  const T G2417 = G198 * G2416;
+  const T G2418 = C1 * G2417;
+  const T G2419 = G2410 + G2418;
+  const T G2420 = G217 * G2406;
+  const T G2421 = G277 * G2413;
+  const T G2422 = C1 * G2421;
+  const T G2423 = G2420 + G2422;
+  const T G2424 = G180 * G2423;
+  const T G2425 = G2419 + G2424;
+  const T G2428 = X56 + t * memo[41];
+  const T G2429 = G7 * G14;
+  const T G2430 = G1168 * G2429;
+  const T G2431 = G4 * G2430;
+  const T G2432 = G1212 * G2429;
+  const T G2433 = G76 * G2432;
+  const T G2434 = C1 * G2433;
+  const T G2435 = G2431 + G2434;
+  const T G2436 = G107 * G2430;
+  const T G2437 = G1240 * G2429;
+  const T G2438 = G76 * G2437;
+  const T G2439 = C1 * G2438;
+  const T G2440 = G2436 + G2439;
+  const T G2441 = G141 * G14;
+  const T G2442 = G1258 * G2441;
+  const T G2443 = G138 * G2442;
+  const T G2444 = G1279 * G2441;
+  const T G2445 = G180 * G2444;
+  const T G2446 = C1 * G2445;
+  const T G2447 = G2443 + G2446;
+  const T G2448 = G198 * G2442;
+  const T G2449 = G1295 * G2441;
+  const T G2450 = G180 * G2449;
+  const T G2451 = C1 * G2450;
+  const T G2452 = G2448 + G2451;
+  const T G2453 = G220 * G14;
+  const T G2454 = G1310 * G2453;
+  const T G2455 = G217 * G2454;
+  const T G2456 = G1331 * G2453;
+  const T G2457 = G259 * G2456;
+  const T G2458 = C1 * G2457;
+  const T G2459 = G2455 + G2458;
+  const T G2460 = G277 * G2454;
+  const T G2461 = G1347 * G2453;
+  const T G2462 = G259 * G2461;
+  const T G2463 = C1 * G2462;
+  const T G2464 = G2460 + G2463;
+  const T G2465 = G311 * G14;
+  const T G2466 = G1362 * G2465;
+  const T G2467 = G302 * G2466;
+  const T G2468 = G1383 * G2465;
+  const T G2469 = G356 * G2468;
+  const T G2470 = C1 * G2469;
+  const T G2471 = G2467 + G2470;
+  const T G2472 = G374 * G2466;
+  const T G2473 = G1399 * G2465;
+  const T G2474 = G356 * G2473;
+  const T G2475 = C1 * G2474;
+  const T G2476 = G2472 + G2475;
+  const T G2477 = G408 * G14;
+  const T G2478 = G1414 * G2477;
+  const T G2479 = G399 * G2478;
+  const T G2480 = G1435 * G2477;
+  const T G2481 = G453 * G2480;
+  const T G2482 = C1 * G2481;
+  const T G2483 = G2479 + G2482;
+  const T G2484 = G471 * G2478;
+  const T G2485 = G1451 * G2477;
+  const T G2486 = G453 * G2485;
+  const T G2487 = C1 * G2486;
+  const T G2488 = G2484 + G2487;
+  const T G2489 = G1310 * G2441;
+  const T G2490 = G277 * G2489;
+  const T G2491 = G1347 * G2441;
+  const T G2492 = G259 * G2491;
+  const T G2493 = C1 * G2492;
+  const T G2494 = G2490 + G2493;
+  const T G2495 = G138 * G2494;
+  const T G2496 = G217 * G2489;
+  const T G2497 = G1331 * G2441;
+  const T G2498 = G259 * G2497;
+  const T G2499 = C1 * G2498;
+  const T G2500 = G2496 + G2499;
+  const T G2501 = G198 * G2500;
+  const T G2502 = C1 * G2501;
+  const T G2503 = G2495 + G2502;
+  const T G2504 = G217 * G2491;
+  const T G2505 = G277 * G2497;
+  const T G2506 = C1 * G2505;
+  const T G2507 = G2504 + G2506;
+  const T G2508 = G180 * G2507;
+  const T G2509 = G2503 + G2508;
+  const T G2512 = X57 + t * memo[42];
+  const T G2513 = G19 * G14;
+  const T G2514 = G1168 * G2513;
+  const T G2515 = G4 * G2514;
+  const T G2516 = G1212 * G2513;
+  const T G2517 = G76 * G2516;
+  const T G2518 = C1 * G2517;
+  const T G2519 = G2515 + G2518;
+  const T G2520 = G107 * G2514;
+  const T G2521 = G1240 * G2513;
+  const T G2522 = G76 * G2521;
+  const T G2523 = C1 * G2522;
+  const T G2524 = G2520 + G2523;
+  const T G2525 = G145 * G14;
+  const T G2526 = G1258 * G2525;
+  const T G2527 = G138 * G2526;
+  const T G2528 = G1279 * G2525;
+  const T G2529 = G180 * G2528;
+  const T G2530 = C1 * G2529;
+  const T G2531 = G2527 + G2530;
+  const T G2532 = G198 * G2526;
+  const T G2533 = G1295 * G2525;
+  const T G2534 = G180 * G2533;
+  const T G2535 = C1 * G2534;
+  const T G2536 = G2532 + G2535;
+  const T G2537 = G224 * G14;
+  const T G2538 = G1310 * G2537;
+  const T G2539 = G217 * G2538;
+  const T G2540 = G1331 * G2537;
+  const T G2541 = G259 * G2540;
+  const T G2542 = C1 * G2541;
+  const T G2543 = G2539 + G2542;
+  const T G2544 = G277 * G2538;
+  const T G2545 = G1347 * G2537;
+  const T G2546 = G259 * G2545;
+  const T G2547 = C1 * G2546;
+  const T G2548 = G2544 + G2547;
+  const T G2549 = G315 * G14;
+  const T G2550 = G1362 * G2549;
+  const T G2551 = G302 * G2550;
+  const T G2552 = G1383 * G2549;
+  const T G2553 = G356 * G2552;
+  const T G2554 = C1 * G2553;
+  const T G2555 = G2551 + G2554;
+  const T G2556 = G374 * G2550;
+  const T G2557 = G1399 * G2549;
+  const T G2558 = G356 * G2557;
+  const T G2559 = C1 * G2558;
+  const T G2560 = G2556 + G2559;
+  const T G2561 = G412 * G14;
+  const T G2562 = G1414 * G2561;
+  const T G2563 = G399 * G2562;
+  const T G2564 = G1435 * G2561;
+  const T G2565 = G453 * G2564;
+  const T G2566 = C1 * G2565;
+  const T G2567 = G2563 + G2566;
+  const T G2568 = G471 * G2562;
+  const T G2569 = G1451 * G2561;
+  const T G2570 = G453 * G2569;
+  const T G2571 = C1 * G2570;
+  const T G2572 = G2568 + G2571;
+  const T G2573 = G1310 * G2525;
+  const T G2574 = G277 * G2573;
+  const T G2575 = G1347 * G2525;
+  const T G2576 = G259 * G2575;
+  const T G2577 = C1 * G2576;
+  const T G2578 = G2574 + G2577;
+  const T G2579 = G138 * G2578;
+  const T G2580 = G217 * G2573;
+  const T G2581 = G1331 * G2525;
+  const T G2582 = G259 * G2581;
+  const T G2583 = C1 * G2582;
+  const T G2584 = G2580 + G2583;
+  const T G2585 = G198 * G2584;
+  const T G2586 = C1 * G2585;
+  const T G2587 = G2579 + G2586;
+  const T G2588 = G217 * G2575;
+  const T G2589 = G277 * G2581;
+  const T G2590 = C1 * G2589;
+  const T G2591 = G2588 + G2590;
+  const T G2592 = G180 * G2591;
+  const T G2593 = G2587 + G2592;
+  const T G2596 = X58 + t * memo[43];
+  const T G2597 = G24 * G14;
+  const T G2598 = G1168 * G2597;
+  const T G2599 = G4 * G2598;
+  const T G2600 = G1212 * G2597;
+  const T G2601 = G76 * G2600;
+  const T G2602 = C1 * G2601;
+  const T G2603 = G2599 + G2602;
+  const T G2604 = G107 * G2598;
+  const T G2605 = G1240 * G2597;
+  const T G2606 = G76 * G2605;
+  const T G2607 = C1 * G2606;
+  const T G2608 = G2604 + G2607;
+  const T G2609 = G149 * G14;
+  const T G2610 = G1258 * G2609;
+  const T G2611 = G138 * G2610;
+  const T G2612 = G1279 * G2609;
+  const T G2613 = G180 * G2612;
+  const T G2614 = C1 * G2613;
+  const T G2615 = G2611 + G2614;
+  const T G2616 = G198 * G2610;
+  const T G2617 = G1295 * G2609;
+  const T G2618 = G180 * G2617;
+  const T G2619 = C1 * G2618;
+  const T G2620 = G2616 + G2619;
+  const T G2621 = G228 * G14;
+  const T G2622 = G1310 * G2621;
+  const T G2623 = G217 * G2622;
+  const T G2624 = G1331 * G2621;
+  const T G2625 = G259 * G2624;
+  const T G2626 = C1 * G2625;
+  const T G2627 = G2623 + G2626;
+  const T G2628 = G277 * G2622;
+  const T G2629 = G1347 * G2621;
+  const T G2630 = G259 * G2629;
+  const T G2631 = C1 * G2630;
+  const T G2632 = G2628 + G2631;
+  const T G2633 = G319 * G14;
+  const T G2634 = G1362 * G2633;
+  const T G2635 = G302 * G2634;
+  const T G2636 = G1383 * G2633;
+  const T G2637 = G356 * G2636;
+  const T G2638 = C1 * G2637;
+  const T G2639 = G2635 + G2638;
+  const T G2640 = G374 * G2634;
+  const T G2641 = G1399 * G2633;
+  const T G2642 = G356 * G2641;
+  const T G2643 = C1 * G2642;
+  const T G2644 = G2640 + G2643;
+  const T G2645 = G416 * G14;
+  const T G2646 = G1414 * G2645;
+  const T G2647 = G399 * G2646;
+  const T G2648 = G1435 * G2645;
+  const T G2649 = G453 * G2648;
+  const T G2650 = C1 * G2649;
+  const T G2651 = G2647 + G2650;
+  const T G2652 = G471 * G2646;
+  const T G2653 = G1451 * G2645;
+  const T G2654 = G453 * G2653;
+  const T G2655 = C1 * G2654;
+  const T G2656 = G2652 + G2655;
+  const T G2657 = G1310 * G2609;
+  const T G2658 = G277 * G2657;
+  const T G2659 = G1347 * G2609;
+  const T G2660 = G259 * G2659;
+  const T G2661 = C1 * G2660;
+  const T G2662 = G2658 + G2661;
+  const T G2663 = G138 * G2662;
+  const T G2664 = G217 * G2657;
+  const T G2665 = G1331 * G2609;
+  const T G2666 = G259 * G2665;
+  const T G2667 = C1 * G2666;
+  const T G2668 = G2664 + G2667;
+  const T G2669 = G198 * G2668;
+  const T G2670 = C1 * G2669;
+  const T G2671 = G2663 + G2670;
+  const T G2672 = G217 * G2659;
+  const T G2673 = G277 * G2665;
+  const T G2674 = C1 * G2673;
+  const T G2675 = G2672 + G2674;
+  const T G2676 = G180 * G2675;
+  const T G2677 = G2671 + G2676;
+  const T G2680 = X59 + t * memo[44];
+  const T G2681 = G1168 * G27;
+  const T G2682 = G62 * G1187;
+  const T G2683 = C1 * G2682;
+  const T G2684 = G2681 + G2683;
+  const T G2685 = G4 * G2684;
+  const T G2686 = G1212 * G27;
+  const T G2687 = G98 * G1187;
+  const T G2688 = C1 * G2687;
+  const T G2689 = G2686 + G2688;
+  const T G2690 = G76 * G2689;
+  const T G2691 = C1 * G2690;
+  const T G2692 = G2685 + G2691;
+  const T G2693 = G107 * G2684;
+  const T G2694 = G1240 * G27;
+  const T G2695 = G129 * G1187;
+  const T G2696 = C1 * G2695;
+  const T G2697 = G2694 + G2696;
+  const T G2698 = G76 * G2697;
+  const T G2699 = C1 * G2698;
+  const T G2700 = G2693 + G2699;
+  const T G2701 = G1258 * G151;
+  const T G2702 = G169 * G1267;
+  const T G2703 = C1 * G2702;
+  const T G2704 = G2701 + G2703;
+  const T G2705 = G138 * G2704;
+  const T G2706 = G1279 * G151;
+  const T G2707 = G189 * G1267;
+  const T G2708 = C1 * G2707;
+  const T G2709 = G2706 + G2708;
+  const T G2710 = G180 * G2709;
+  const T G2711 = C1 * G2710;
+  const T G2712 = G2705 + G2711;
+  const T G2713 = G198 * G2704;
+  const T G2714 = G1295 * G151;
+  const T G2715 = G208 * G1267;
+  const T G2716 = C1 * G2715;
+  const T G2717 = G2714 + G2716;
+  const T G2718 = G180 * G2717;
+  const T G2719 = C1 * G2718;
+  const T G2720 = G2713 + G2719;
+  const T G2721 = G1310 * G230;
+  const T G2722 = G248 * G1319;
+  const T G2723 = C1 * G2722;
+  const T G2724 = G2721 + G2723;
+  const T G2725 = G217 * G2724;
+  const T G2726 = G1331 * G230;
+  const T G2727 = G268 * G1319;
+  const T G2728 = C1 * G2727;
+  const T G2729 = G2726 + G2728;
+  const T G2730 = G259 * G2729;
+  const T G2731 = C1 * G2730;
+  const T G2732 = G2725 + G2731;
+  const T G2733 = G277 * G2724;
+  const T G2734 = G1347 * G230;
+  const T G2735 = G287 * G1319;
+  const T G2736 = C1 * G2735;
+  const T G2737 = G2734 + G2736;
+  const T G2738 = G259 * G2737;
+  const T G2739 = C1 * G2738;
+  const T G2740 = G2733 + G2739;
+  const T G2741 = G1362 * G321;
+  const T G2742 = G345 * G1371;
+  const T G2743 = C1 * G2742;
+  const T G2744 = G2741 + G2743;
+  const T G2745 = G302 * G2744;
+  const T G2746 = G1383 * G321;
+  const T G2747 = G365 * G1371;
+  const T G2748 = C1 * G2747;
+  const T G2749 = G2746 + G2748;
+  const T G2750 = G356 * G2749;
+  const T G2751 = C1 * G2750;
+  const T G2752 = G2745 + G2751;
+  const T G2753 = G374 * G2744;
+  const T G2754 = G1399 * G321;
+  const T G2755 = G384 * G1371;
+  const T G2756 = C1 * G2755;
+  const T G2757 = G2754 + G2756;
+  const T G2758 = G356 * G2757;
+  const T G2759 = C1 * G2758;
+  const T G2760 = G2753 + G2759;
+  const T G2761 = G1414 * G418;
+  const T G2762 = G442 * G1423;
+  const T G2763 = C1 * G2762;
+  const T G2764 = G2761 + G2763;
+  const T G2765 = G399 * G2764;
+  const T G2766 = G1435 * G418;
+  const T G2767 = G462 * G1423;
+  const T G2768 = C1 * G2767;
+  const T G2769 = G2766 + G2768;
+  const T G2770 = G453 * G2769;
+  const T G2771 = C1 * G2770;
+  const T G2772 = G2765 + G2771;
+  const T G2773 = G471 * G2764;
+  const T G2774 = G1451 * G418;
+  const T G2775 = G481 * G1423;
+  const T G2776 = C1 * G2775;
+  const T G2777 = G2774 + G2776;
+  const T G2778 = G453 * G2777;
+  const T G2779 = C1 * G2778;
+  const T G2780 = G2773 + G2779;
+  const T G2781 = G1310 * G151;
+  const T G2782 = G169 * G1319;
+  const T G2783 = C1 * G2782;
+  const T G2784 = G2781 + G2783;
+  const T G2785 = G277 * G2784;
+  const T G2786 = G1347 * G151;
+  const T G2787 = G208 * G1319;
+  const T G2788 = C1 * G2787;
+  const T G2789 = G2786 + G2788;
+  const T G2790 = G259 * G2789;
+  const T G2791 = C1 * G2790;
+  const T G2792 = G2785 + G2791;
+  const T G2793 = G138 * G2792;
+  const T G2794 = G217 * G2784;
+  const T G2795 = G1331 * G151;
+  const T G2796 = G189 * G1319;
+  const T G2797 = C1 * G2796;
+  const T G2798 = G2795 + G2797;
+  const T G2799 = G259 * G2798;
+  const T G2800 = C1 * G2799;
+  const T G2801 = G2794 + G2800;
+  const T G2802 = G198 * G2801;
+  const T G2803 = C1 * G2802;
+  const T G2804 = G2793 + G2803;
+  const T G2805 = G217 * G2789;
+  const T G2806 = G277 * G2798;
+  const T G2807 = C1 * G2806;
+  const T G2808 = G2805 + G2807;
+  const T G2809 = G180 * G2808;
+  const T G2810 = G2804 + G2809;
+  const T G2811 = G2224 * X8;
+  const T G2812 = G2326 * X9;
+  const T G2813 = G2428 * X10;
+  const T G2814 = G2512 * X11;
+  const T G2815 = G2596 * X12;
+  const T G2816 = G2680 * X13;
+  const T G2819 = X60 + t * memo[45];
+  const T G2820 = G2811 + G2812 + G2813 + G2814 + G2815 + G2816 + G2819;
+  const T G2821 = G520 * X0;
+  const T G2822 = G736 * X1;
+  const T G2823 = G944 * X2;
+  const T G2824 = G1147 * X3;
+  const T G2827 = X65 + t * memo[50];
+  const T G2828 = G2821 + G2822 + G2823 + G2824 + G2827;
+  const T G2829 = G1495 * X4;
+  const T G2830 = G1711 * X5;
+  const T G2831 = G1919 * X6;
+  const T G2832 = G2122 * X7;
+  const T G2835 = X70 + t * memo[55];
+  const T G2836 = G2829 + G2830 + G2831 + G2832 + G2835;
   y[0] = G104;
   y[1] = G135;
   y[2] = G195;
@@ -3171,6408 +3057,3 @@ HxH(const C<F>* __restrict ux /*x and t*/, const C<F> * __restrict uparams, C<F>
   y[137] = G2326;
   y[151] = G2428;
 }
-
-// Evaluates Hx and H at the same time, reusing expressions.
-// 
-// Map from a multivariate poly with x 127-dimensional to y NVExNVEPLUS1 dimensional
-// Where 127 = 14 for x, 1 for t, 2*56 total parameters. Returns where y = [Hx|H]
-// 
-// cCode(PH.GateHomotopy#"Hx"|PH.GateHomotopy#"H",gateMatrix{cameraVars})
-// (Ask Tim for the way to use cCode so that the input orders are like this.
-template <typename F>
-inline __attribute__((always_inline)) void 
-eval<chicago14a, F>::
-HxH_constants(const C<F>* __restrict ux /*x and t*/, const C<F> * __restrict uparams, C<F>* __restrict uy /*HxH*/) 
-{
-#if 0
-  const C<F> *params = reinterpret_cast<C<F> *> (__builtin_assume_aligned(uparams,64));
-  const C<F> *x = reinterpret_cast<C<F> *> (__builtin_assume_aligned(ux,64));
-  C<F> *yc = reinterpret_cast<C<F> *> (__builtin_assume_aligned(uy,64));
-
-  const C<F> &X0 = x[0];    // q0
-  const C<F> &X1 = x[1];    // q1
-  const C<F> &X2 = x[2];    // q2
-  const C<F> &X3 = x[3];    // q3
-  const C<F> &X4 = x[4];    // q0
-  const C<F> &X5 = x[5];    // q1
-  const C<F> &X6 = x[6];    // q2
-  const C<F> &X7 = x[7];    // q3
-  const C<F> &X8 = x[8];    // transl
-  const C<F> &X9 = x[9];    // transl
-  const C<F> &X10 = x[10];  // transl
-  const C<F> &X11 = x[11];  // transl
-  const C<F> &X12 = x[12];  // transl
-  const C<F> &X13 = x[13];  // transl
-  const F &t = (F &) ux[14];
-  
-  const C<F> &X15 =  params[0];
-  const C<F> &X16 =  params[1];
-  const C<F> &X17 =  params[2];
-  const C<F> &X18 =  params[3];
-  const C<F> &X19 =  params[4];
-  const C<F> &X20 =  params[5];
-  const C<F> &X21 =  params[6];
-  const C<F> &X22 =  params[7];
-  const C<F> &X23 =  params[8];
-  const C<F> &X24 =  params[9];
-  const C<F> &X25 =  params[10];
-  const C<F> &X26 =  params[11];
-  const C<F> &X27 =  params[12];
-  const C<F> &X28 =  params[13];
-  const C<F> &X29 =  params[14];
-  const C<F> &X30 =  params[15];
-  const C<F> &X31 =  params[16];
-  const C<F> &X32 =  params[17];
-  const C<F> &X33 =  params[18];
-  const C<F> &X34 =  params[19];
-  const C<F> &X35 =  params[20];
-  const C<F> &X36 =  params[21];
-  const C<F> &X37 =  params[22];
-  const C<F> &X38 =  params[23];
-  const C<F> &X39 =  params[24];
-  const C<F> &X40 =  params[25];
-  const C<F> &X41 =  params[26];
-  const C<F> &X42 =  params[27];
-  const C<F> &X43 =  params[28];
-  const C<F> &X44 =  params[29];
-  const C<F> &X45 =  params[30];
-  const C<F> &X46 =  params[31];
-  const C<F> &X47 =  params[32];
-  const C<F> &X48 =  params[33];
-  const C<F> &X49 =  params[34];
-  const C<F> &X50 =  params[35];
-  const C<F> &X51 =  params[36];
-  const C<F> &X52 =  params[37];
-  const C<F> &X53 =  params[38];
-  const C<F> &X54 =  params[39];
-  const C<F> &X55 =  params[40];
-  const C<F> &X56 =  params[41];
-  const C<F> &X57 =  params[42];
-  const C<F> &X58 =  params[43];
-  const C<F> &X59 =  params[44];
-  const C<F> &X60 =  params[45];
-  const C<F> &X61 =  params[46];
-  const C<F> &X62 =  params[47];
-  const C<F> &X63 =  params[48];
-  const C<F> &X64 =  params[49];
-  const C<F> &X65 =  params[50];
-  const C<F> &X66 =  params[51];
-  const C<F> &X67 =  params[52];
-  const C<F> &X68 =  params[53];
-  const C<F> &X69 =  params[54];
-  const C<F> &X70 =  params[55];
-  const C<F> &X71 =  params[56];
-  const C<F> &X72 =  params[57];
-  const C<F> &X73 =  params[58];
-  const C<F> &X74 =  params[59];
-  const C<F> &X75 =  params[60];
-  const C<F> &X76 =  params[61];
-  const C<F> &X77 =  params[62];
-  const C<F> &X78 =  params[63];
-  const C<F> &X79 =  params[64];
-  const C<F> &X80 =  params[65];
-  const C<F> &X81 =  params[66];
-  const C<F> &X82 =  params[67];
-  const C<F> &X83 =  params[68];
-  const C<F> &X84 =  params[69];
-  const C<F> &X85 =  params[70];
-  const C<F> &X86 =  params[71];
-  const C<F> &X87 =  params[72];
-  const C<F> &X88 =  params[73];
-  const C<F> &X89 =  params[74];
-  const C<F> &X90 =  params[75];
-  const C<F> &X91 =  params[76];
-  const C<F> &X92 =  params[77];
-  const C<F> &X93 =  params[78];
-  const C<F> &X94 =  params[79];
-  const C<F> &X95 =  params[80];
-  const C<F> &X96 =  params[81];
-  const C<F> &X97 =  params[82];
-  const C<F> &X98 =  params[83];
-  const C<F> &X99 =  params[84];
-  const C<F> &X100 = params[85];
-  const C<F> &X101 = params[86];
-  const C<F> &X102 = params[87];
-  const C<F> &X103 = params[88];
-  const C<F> &X104 = params[89];
-  const C<F> &X105 = params[90];
-  const C<F> &X106 = params[91];
-  const C<F> &X107 = params[92];
-  const C<F> &X108 = params[93];
-  const C<F> &X109 = params[94];
-  const C<F> &X110 = params[95];
-  const C<F> &X111 = params[96];
-  const C<F> &X112 = params[97];
-  const C<F> &X113 = params[98];
-  const C<F> &X114 = params[99];
-  const C<F> &X115 = params[100];
-  const C<F> &X116 = params[101];
-  const C<F> &X117 = params[102];
-  const C<F> &X118 = params[103];
-  const C<F> &X119 = params[104];
-  const C<F> &X120 = params[105];
-  const C<F> &X121 = params[106];
-  const C<F> &X122 = params[107];
-  const C<F> &X123 = params[108];
-  const C<F> &X124 = params[109];
-  const C<F> &X125 = params[110];
-  const C<F> &X126 = params[111];
-  
-  static constexpr F C0 = 1.;
-  static constexpr F C1 = -1.;
-  static constexpr F C2 = 2.;
-//  static constexpr F C3 = 0.;
-  const C<F> G0  = C1 * t;
-  const C<F> G1  = C0 + G0;
-  const C<F> G2  = G1 * X15;
-  const C<F> G3  = t * X71;
-  const C<F> G4  = G2 + G3;
-  const C<F> G5  = G1 * X21;
-  const C<F> G6  = t * X77;
-  const C<F> G7  = G5 + G6;
-  const C<F> G8  = X4 * X4;
-  const C<F> G9  = X5 * X5;
-  const C<F> G10 = G8 + G9;
-  const C<F> G11 = X6 * X6;
-  const C<F> G12 = G10 + G11;
-  const C<F> G13 = X7 * X7;
-  const C<F> G14 = G12 + G13;
-  const C<F> G15 = G14 * X11;
-  const C<F> G16 = G7 * G15;
-  const C<F> G17 = G1 * X22;
-  const C<F> G18 = t * X78;
-  const C<F> G19 = G17 + G18;
-  const C<F> G20 = G14 * X12;
-  const C<F> G21 = G19 * G20;
-  const C<F> G22 = G1 * X23;
-  const C<F> G23 = t * X79;
-  const C<F> G24 = G22 + G23;
-  const C<F> G25 = G14 * X13;
-  const C<F> G26 = G24 * G25;
-  const C<F> G27 = G16 + G21 + G26;
-  const C<F> G28 = G1 * X18;
-  const C<F> G29 = t * X74;
-  const C<F> G30 = G28 + G29;
-  const C<F> G31 = C2 * X2;
-  const C<F> G32 = G30 * G31;
-  const C<F> G33 = G1 * X19;
-  const C<F> G34 = t * X75;
-  const C<F> G35 = G33 + G34;
-  const C<F> G36 = C1 * X1;
-  const C<F> G37 = C2 * G36;
-  const C<F> G38 = G35 * G37;
-  const C<F> G39 = G1 * X20;
-  const C<F> G40 = t * X76;
-  const C<F> G41 = G39 + G40;
-  const C<F> G42 = X0 + X0;
-  const C<F> G43 = G41 * G42;
-  const C<F> G44 = G32 + G38 + G43;
-  const C<F> G45 = G27 * G44;
-  const C<F> G46 = X5 * X7;
-  const C<F> G47 = X4 * X6;
-  const C<F> G48 = G46 + G47;
-  const C<F> G49 = C2 * G48;
-  const C<F> G50 = G7 * G49;
-  const C<F> G51 = X6 * X7;
-  const C<F> G52 = X4 * X5;
-  const C<F> G53 = C1 * G52;
-  const C<F> G54 = G51 + G53;
-  const C<F> G55 = C2 * G54;
-  const C<F> G56 = G19 * G55;
-  const C<F> G57 = G8 + G13;
-  const C<F> G58 = G9 + G11;
-  const C<F> G59 = C1 * G58;
-  const C<F> G60 = G57 + G59;
-  const C<F> G61 = G24 * G60;
-  const C<F> G62 = G50 + G56 + G61;
-  const C<F> G63 = X8 * G42;
-  const C<F> G64 = G30 * G63;
-  const C<F> G65 = X9 * G42;
-  const C<F> G66 = G35 * G65;
-  const C<F> G67 = X10 * G42;
-  const C<F> G68 = G41 * G67;
-  const C<F> G69 = G64 + G66 + G68;
-  const C<F> G70 = G62 * G69;
-  const C<F> G71 = C1 * G70;
-  const C<F> G72 = G45 + G71;
-  const C<F> G73 = G4 * G72;
-  const C<F> G74 = G1 * X17;
-  const C<F> G75 = t * X73;
-  const C<F> G76 = G74 + G75;
-  const C<F> G77 = G30 * G42;
-  const C<F> G78 = C2 * X3;
-  const C<F> G79 = G35 * G78;
-  const C<F> G80 = C1 * X2;
-  const C<F> G81 = C2 * G80;
-  const C<F> G82 = G41 * G81;
-  const C<F> G83 = G77 + G79 + G82;
-  const C<F> G84 = G27 * G83;
-  const C<F> G85 = G11 + G13;
-  const C<F> G86 = C1 * G85;
-  const C<F> G87 = G10 + G86;
-  const C<F> G88 = G7 * G87;
-  const C<F> G89 = X5 * X6;
-  const C<F> G90 = X4 * X7;
-  const C<F> G91 = G89 + G90;
-  const C<F> G92 = C2 * G91;
-  const C<F> G93 = G19 * G92;
-  const C<F> G94 = C1 * G47;
-  const C<F> G95 = G46 + G94;
-  const C<F> G96 = C2 * G95;
-  const C<F> G97 = G24 * G96;
-  const C<F> G98 = G88 + G93 + G97;
-  const C<F> G99 = G98 * G69;
-  const C<F> G100 = C1 * G99;
-  const C<F> G101 = G84 + G100;
-  const C<F> G102 = G76 * G101;
-  const C<F> G103 = C1 * G102;
-  const C<F> G104 = G73 + G103;
-  const C<F> G105 = G1 * X16;
-  const C<F> G106 = t * X72;
-  const C<F> G107 = G105 + G106;
-  const C<F> G108 = G107 * G72;
-  const C<F> G109 = C1 * X3;
-  const C<F> G110 = C2 * G109;
-  const C<F> G111 = G30 * G110;
-  const C<F> G112 = G35 * G42;
-  const C<F> G113 = C2 * X1;
-  const C<F> G114 = G41 * G113;
-  const C<F> G115 = G111 + G112 + G114;
-  const C<F> G116 = G27 * G115;
-  const C<F> G117 = C1 * G90;
-  const C<F> G118 = G89 + G117;
-  const C<F> G119 = C2 * G118;
-  const C<F> G120 = G7 * G119;
-  const C<F> G121 = G8 + G11;
-  const C<F> G122 = G9 + G13;
-  const C<F> G123 = C1 * G122;
-  const C<F> G124 = G121 + G123;
-  const C<F> G125 = G19 * G124;
-  const C<F> G126 = G51 + G52;
-  const C<F> G127 = C2 * G126;
-  const C<F> G128 = G24 * G127;
-  const C<F> G129 = G120 + G125 + G128;
-  const C<F> G130 = G129 * G69;
-  const C<F> G131 = C1 * G130;
-  const C<F> G132 = G116 + G131;
-  const C<F> G133 = G76 * G132;
-  const C<F> G134 = C1 * G133;
-  const C<F> G135 = G108 + G134;
-  const C<F> G136 = G1 * X24;
-  const C<F> G137 = t * X80;
-  const C<F> G138 = G136 + G137;
-  const C<F> G139 = G1 * X30;
-  const C<F> G140 = t * X86;
-  const C<F> G141 = G139 + G140;
-  const C<F> G142 = G141 * G15;
-  const C<F> G143 = G1 * X31;
-  const C<F> G144 = t * X87;
-  const C<F> G145 = G143 + G144;
-  const C<F> G146 = G145 * G20;
-  const C<F> G147 = G1 * X32;
-  const C<F> G148 = t * X88;
-  const C<F> G149 = G147 + G148;
-  const C<F> G150 = G149 * G25;
-  const C<F> G151 = G142 + G146 + G150;
-  const C<F> G152 = G1 * X27;
-  const C<F> G153 = t * X83;
-  const C<F> G154 = G152 + G153;
-  const C<F> G155 = G154 * G31;
-  const C<F> G156 = G1 * X28;
-  const C<F> G157 = t * X84;
-  const C<F> G158 = G156 + G157;
-  const C<F> G159 = G158 * G37;
-  const C<F> G160 = G1 * X29;
-  const C<F> G161 = t * X85;
-  const C<F> G162 = G160 + G161;
-  const C<F> G163 = G162 * G42;
-  const C<F> G164 = G155 + G159 + G163;
-  const C<F> G165 = G151 * G164;
-  const C<F> G166 = G141 * G49;
-  const C<F> G167 = G145 * G55;
-  const C<F> G168 = G149 * G60;
-  const C<F> G169 = G166 + G167 + G168;
-  const C<F> G170 = G154 * G63;
-  const C<F> G171 = G158 * G65;
-  const C<F> G172 = G162 * G67;
-  const C<F> G173 = G170 + G171 + G172;
-  const C<F> G174 = G169 * G173;
-  const C<F> G175 = C1 * G174;
-  const C<F> G176 = G165 + G175;
-  const C<F> G177 = G138 * G176;
-  const C<F> G178 = G1 * X26;
-  const C<F> G179 = t * X82;
-  const C<F> G180 = G178 + G179;
-  const C<F> G181 = G154 * G42;
-  const C<F> G182 = G158 * G78;
-  const C<F> G183 = G162 * G81;
-  const C<F> G184 = G181 + G182 + G183;
-  const C<F> G185 = G151 * G184;
-  const C<F> G186 = G141 * G87;
-  const C<F> G187 = G145 * G92;
-  const C<F> G188 = G149 * G96;
-  const C<F> G189 = G186 + G187 + G188;
-  const C<F> G190 = G189 * G173;
-  const C<F> G191 = C1 * G190;
-  const C<F> G192 = G185 + G191;
-  const C<F> G193 = G180 * G192;
-  const C<F> G194 = C1 * G193;
-  const C<F> G195 = G177 + G194;
-  const C<F> G196 = G1 * X25;
-  const C<F> G197 = t * X81;
-  const C<F> G198 = G196 + G197;
-  const C<F> G199 = G198 * G176;
-  const C<F> G200 = G154 * G110;
-  const C<F> G201 = G158 * G42;
-  const C<F> G202 = G162 * G113;
-  const C<F> G203 = G200 + G201 + G202;
-  const C<F> G204 = G151 * G203;
-  const C<F> G205 = G141 * G119;
-  const C<F> G206 = G145 * G124;
-  const C<F> G207 = G149 * G127;
-  const C<F> G208 = G205 + G206 + G207;
-  const C<F> G209 = G208 * G173;
-  const C<F> G210 = C1 * G209;
-  const C<F> G211 = G204 + G210;
-  const C<F> G212 = G180 * G211;
-  const C<F> G213 = C1 * G212;
-  const C<F> G214 = G199 + G213;
-  const C<F> G215 = G1 * X33;
-  const C<F> G216 = t * X89;
-  const C<F> G217 = G215 + G216;
-  const C<F> G218 = G1 * X39;
-  const C<F> G219 = t * X95;
-  const C<F> G220 = G218 + G219;
-  const C<F> G221 = G220 * G15;
-  const C<F> G222 = G1 * X40;
-  const C<F> G223 = t * X96;
-  const C<F> G224 = G222 + G223;
-  const C<F> G225 = G224 * G20;
-  const C<F> G226 = G1 * X41;
-  const C<F> G227 = t * X97;
-  const C<F> G228 = G226 + G227;
-  const C<F> G229 = G228 * G25;
-  const C<F> G230 = G221 + G225 + G229;
-  const C<F> G231 = G1 * X36;
-  const C<F> G232 = t * X92;
-  const C<F> G233 = G231 + G232;
-  const C<F> G234 = G233 * G31;
-  const C<F> G235 = G1 * X37;
-  const C<F> G236 = t * X93;
-  const C<F> G237 = G235 + G236;
-  const C<F> G238 = G237 * G37;
-  const C<F> G239 = G1 * X38;
-  const C<F> G240 = t * X94;
-  const C<F> G241 = G239 + G240;
-  const C<F> G242 = G241 * G42;
-  const C<F> G243 = G234 + G238 + G242;
-  const C<F> G244 = G230 * G243;
-  const C<F> G245 = G220 * G49;
-  const C<F> G246 = G224 * G55;
-  const C<F> G247 = G228 * G60;
-  const C<F> G248 = G245 + G246 + G247;
-  const C<F> G249 = G233 * G63;
-  const C<F> G250 = G237 * G65;
-  const C<F> G251 = G241 * G67;
-  const C<F> G252 = G249 + G250 + G251;
-  const C<F> G253 = G248 * G252;
-  const C<F> G254 = C1 * G253;
-  const C<F> G255 = G244 + G254;
-  const C<F> G256 = G217 * G255;
-  const C<F> G257 = G1 * X35;
-  const C<F> G258 = t * X91;
-  const C<F> G259 = G257 + G258;
-  const C<F> G260 = G233 * G42;
-  const C<F> G261 = G237 * G78;
-  const C<F> G262 = G241 * G81;
-  const C<F> G263 = G260 + G261 + G262;
-  const C<F> G264 = G230 * G263;
-  const C<F> G265 = G220 * G87;
-  const C<F> G266 = G224 * G92;
-  const C<F> G267 = G228 * G96;
-  const C<F> G268 = G265 + G266 + G267;
-  const C<F> G269 = G268 * G252;
-  const C<F> G270 = C1 * G269;
-  const C<F> G271 = G264 + G270;
-  const C<F> G272 = G259 * G271;
-  const C<F> G273 = C1 * G272;
-  const C<F> G274 = G256 + G273;
-  const C<F> G275 = G1 * X34;
-  const C<F> G276 = t * X90;
-  const C<F> G277 = G275 + G276;
-  const C<F> G278 = G277 * G255;
-  const C<F> G279 = G233 * G110;
-  const C<F> G280 = G237 * G42;
-  const C<F> G281 = G241 * G113;
-  const C<F> G282 = G279 + G280 + G281;
-  const C<F> G283 = G230 * G282;
-  const C<F> G284 = G220 * G119;
-  const C<F> G285 = G224 * G124;
-  const C<F> G286 = G228 * G127;
-  const C<F> G287 = G284 + G285 + G286;
-  const C<F> G288 = G287 * G252;
-  const C<F> G289 = C1 * G288;
-  const C<F> G290 = G283 + G289;
-  const C<F> G291 = G259 * G290;
-  const C<F> G292 = C1 * G291;
-  const C<F> G293 = G278 + G292;
-  const C<F> G294 = G1 * X42;
-  const C<F> G295 = t * X98;
-  const C<F> G296 = G294 + G295;
-  const C<F> G297 = G296 * G4;
-  const C<F> G298 = G1 * X43;
-  const C<F> G299 = t * X99;
-  const C<F> G300 = G298 + G299;
-  const C<F> G301 = G300 * G138;
-  const C<F> G302 = G297 + G301;
-  const C<F> G303 = G1 * X46;
-  const C<F> G304 = t * X102;
-  const C<F> G305 = G303 + G304;
-  const C<F> G306 = G305 * G7;
-  const C<F> G307 = G1 * X47;
-  const C<F> G308 = t * X103;
-  const C<F> G309 = G307 + G308;
-  const C<F> G310 = G309 * G141;
-  const C<F> G311 = G306 + G310;
-  const C<F> G312 = G311 * G15;
-  const C<F> G313 = G305 * G19;
-  const C<F> G314 = G309 * G145;
-  const C<F> G315 = G313 + G314;
-  const C<F> G316 = G315 * G20;
-  const C<F> G317 = G305 * G24;
-  const C<F> G318 = G309 * G149;
-  const C<F> G319 = G317 + G318;
-  const C<F> G320 = G319 * G25;
-  const C<F> G321 = G312 + G316 + G320;
-  const C<F> G322 = G1 * X44;
-  const C<F> G323 = t * X100;
-  const C<F> G324 = G322 + G323;
-  const C<F> G325 = G324 * G30;
-  const C<F> G326 = G1 * X45;
-  const C<F> G327 = t * X101;
-  const C<F> G328 = G326 + G327;
-  const C<F> G329 = G328 * G154;
-  const C<F> G330 = G325 + G329;
-  const C<F> G331 = G330 * G31;
-  const C<F> G332 = G324 * G35;
-  const C<F> G333 = G328 * G158;
-  const C<F> G334 = G332 + G333;
-  const C<F> G335 = G334 * G37;
-  const C<F> G336 = G324 * G41;
-  const C<F> G337 = G328 * G162;
-  const C<F> G338 = G336 + G337;
-  const C<F> G339 = G338 * G42;
-  const C<F> G340 = G331 + G335 + G339;
-  const C<F> G341 = G321 * G340;
-  const C<F> G342 = G311 * G49;
-  const C<F> G343 = G315 * G55;
-  const C<F> G344 = G319 * G60;
-  const C<F> G345 = G342 + G343 + G344;
-  const C<F> G346 = G330 * G63;
-  const C<F> G347 = G334 * G65;
-  const C<F> G348 = G338 * G67;
-  const C<F> G349 = G346 + G347 + G348;
-  const C<F> G350 = G345 * G349;
-  const C<F> G351 = C1 * G350;
-  const C<F> G352 = G341 + G351;
-  const C<F> G353 = G302 * G352;
-  const C<F> G354 = G296 * G76;
-  const C<F> G355 = G300 * G180;
-  const C<F> G356 = G354 + G355;
-  const C<F> G357 = G330 * G42;
-  const C<F> G358 = G334 * G78;
-  const C<F> G359 = G338 * G81;
-  const C<F> G360 = G357 + G358 + G359;
-  const C<F> G361 = G321 * G360;
-  const C<F> G362 = G311 * G87;
-  const C<F> G363 = G315 * G92;
-  const C<F> G364 = G319 * G96;
-  const C<F> G365 = G362 + G363 + G364;
-  const C<F> G366 = G365 * G349;
-  const C<F> G367 = C1 * G366;
-  const C<F> G368 = G361 + G367;
-  const C<F> G369 = G356 * G368;
-  const C<F> G370 = C1 * G369;
-  const C<F> G371 = G353 + G370;
-  const C<F> G372 = G296 * G107;
-  const C<F> G373 = G300 * G198;
-  const C<F> G374 = G372 + G373;
-  const C<F> G375 = G374 * G352;
-  const C<F> G376 = G330 * G110;
-  const C<F> G377 = G334 * G42;
-  const C<F> G378 = G338 * G113;
-  const C<F> G379 = G376 + G377 + G378;
-  const C<F> G380 = G321 * G379;
-  const C<F> G381 = G311 * G119;
-  const C<F> G382 = G315 * G124;
-  const C<F> G383 = G319 * G127;
-  const C<F> G384 = G381 + G382 + G383;
-  const C<F> G385 = G384 * G349;
-  const C<F> G386 = C1 * G385;
-  const C<F> G387 = G380 + G386;
-  const C<F> G388 = G356 * G387;
-  const C<F> G389 = C1 * G388;
-  const C<F> G390 = G375 + G389;
-  const C<F> G391 = G1 * X48;
-  const C<F> G392 = t * X104;
-  const C<F> G393 = G391 + G392;
-  const C<F> G394 = G393 * G4;
-  const C<F> G395 = G1 * X49;
-  const C<F> G396 = t * X105;
-  const C<F> G397 = G395 + G396;
-  const C<F> G398 = G397 * G217;
-  const C<F> G399 = G394 + G398;
-  const C<F> G400 = G1 * X52;
-  const C<F> G401 = t * X108;
-  const C<F> G402 = G400 + G401;
-  const C<F> G403 = G402 * G7;
-  const C<F> G404 = G1 * X53;
-  const C<F> G405 = t * X109;
-  const C<F> G406 = G404 + G405;
-  const C<F> G407 = G406 * G220;
-  const C<F> G408 = G403 + G407;
-  const C<F> G409 = G408 * G15;
-  const C<F> G410 = G402 * G19;
-  const C<F> G411 = G406 * G224;
-  const C<F> G412 = G410 + G411;
-  const C<F> G413 = G412 * G20;
-  const C<F> G414 = G402 * G24;
-  const C<F> G415 = G406 * G228;
-  const C<F> G416 = G414 + G415;
-  const C<F> G417 = G416 * G25;
-  const C<F> G418 = G409 + G413 + G417;
-  const C<F> G419 = G1 * X50;
-  const C<F> G420 = t * X106;
-  const C<F> G421 = G419 + G420;
-  const C<F> G422 = G421 * G30;
-  const C<F> G423 = G1 * X51;
-  const C<F> G424 = t * X107;
-  const C<F> G425 = G423 + G424;
-  const C<F> G426 = G425 * G233;
-  const C<F> G427 = G422 + G426;
-  const C<F> G428 = G427 * G31;
-  const C<F> G429 = G421 * G35;
-  const C<F> G430 = G425 * G237;
-  const C<F> G431 = G429 + G430;
-  const C<F> G432 = G431 * G37;
-  const C<F> G433 = G421 * G41;
-  const C<F> G434 = G425 * G241;
-  const C<F> G435 = G433 + G434;
-  const C<F> G436 = G435 * G42;
-  const C<F> G437 = G428 + G432 + G436;
-  const C<F> G438 = G418 * G437;
-  const C<F> G439 = G408 * G49;
-  const C<F> G440 = G412 * G55;
-  const C<F> G441 = G416 * G60;
-  const C<F> G442 = G439 + G440 + G441;
-  const C<F> G443 = G427 * G63;
-  const C<F> G444 = G431 * G65;
-  const C<F> G445 = G435 * G67;
-  const C<F> G446 = G443 + G444 + G445;
-  const C<F> G447 = G442 * G446;
-  const C<F> G448 = C1 * G447;
-  const C<F> G449 = G438 + G448;
-  const C<F> G450 = G399 * G449;
-  const C<F> G451 = G393 * G76;
-  const C<F> G452 = G397 * G259;
-  const C<F> G453 = G451 + G452;
-  const C<F> G454 = G427 * G42;
-  const C<F> G455 = G431 * G78;
-  const C<F> G456 = G435 * G81;
-  const C<F> G457 = G454 + G455 + G456;
-  const C<F> G458 = G418 * G457;
-  const C<F> G459 = G408 * G87;
-  const C<F> G460 = G412 * G92;
-  const C<F> G461 = G416 * G96;
-  const C<F> G462 = G459 + G460 + G461;
-  const C<F> G463 = G462 * G446;
-  const C<F> G464 = C1 * G463;
-  const C<F> G465 = G458 + G464;
-  const C<F> G466 = G453 * G465;
-  const C<F> G467 = C1 * G466;
-  const C<F> G468 = G450 + G467;
-  const C<F> G469 = G393 * G107;
-  const C<F> G470 = G397 * G277;
-  const C<F> G471 = G469 + G470;
-  const C<F> G472 = G471 * G449;
-  const C<F> G473 = G427 * G110;
-  const C<F> G474 = G431 * G42;
-  const C<F> G475 = G435 * G113;
-  const C<F> G476 = G473 + G474 + G475;
-  const C<F> G477 = G418 * G476;
-  const C<F> G478 = G408 * G119;
-  const C<F> G479 = G412 * G124;
-  const C<F> G480 = G416 * G127;
-  const C<F> G481 = G478 + G479 + G480;
-  const C<F> G482 = G481 * G446;
-  const C<F> G483 = C1 * G482;
-  const C<F> G484 = G477 + G483;
-  const C<F> G485 = G453 * G484;
-  const C<F> G486 = C1 * G485;
-  const C<F> G487 = G472 + G486;
-  const C<F> G488 = G151 * G243;
-  const C<F> G489 = G169 * G252;
-  const C<F> G490 = C1 * G489;
-  const C<F> G491 = G488 + G490;
-  const C<F> G492 = G277 * G491;
-  const C<F> G493 = G151 * G282;
-  const C<F> G494 = G208 * G252;
-  const C<F> G495 = C1 * G494;
-  const C<F> G496 = G493 + G495;
-  const C<F> G497 = G259 * G496;
-  const C<F> G498 = C1 * G497;
-  const C<F> G499 = G492 + G498;
-  const C<F> G500 = G138 * G499;
-  const C<F> G501 = G217 * G491;
-  const C<F> G502 = G151 * G263;
-  const C<F> G503 = G189 * G252;
-  const C<F> G504 = C1 * G503;
-  const C<F> G505 = G502 + G504;
-  const C<F> G506 = G259 * G505;
-  const C<F> G507 = C1 * G506;
-  const C<F> G508 = G501 + G507;
-  const C<F> G509 = G198 * G508;
-  const C<F> G510 = C1 * G509;
-  const C<F> G511 = G500 + G510;
-  const C<F> G512 = G217 * G496;
-  const C<F> G513 = G277 * G505;
-  const C<F> G514 = C1 * G513;
-  const C<F> G515 = G512 + G514;
-  const C<F> G516 = G180 * G515;
-  const C<F> G517 = G511 + G516;
-  const C<F> G518 = G1 * X61;
-  const C<F> G519 = t * X117;
-  const C<F> G520 = G518 + G519;
-  const C<F> G521 = G30 * G78;
-  const C<F> G522 = C1 * X0;
-  const C<F> G523 = C2 * G522;
-  const C<F> G524 = G35 * G523;
-  const C<F> G525 = X1 + X1;
-  const C<F> G526 = C1 * G525;
-  const C<F> G527 = G41 * G526;
-  const C<F> G528 = G521 + G524 + G527;
-  const C<F> G529 = G27 * G528;
-  const C<F> G530 = X8 * G525;
-  const C<F> G531 = G30 * G530;
-  const C<F> G532 = X9 * G525;
-  const C<F> G533 = G35 * G532;
-  const C<F> G534 = X10 * G525;
-  const C<F> G535 = G41 * G534;
-  const C<F> G536 = G531 + G533 + G535;
-  const C<F> G537 = G62 * G536;
-  const C<F> G538 = C1 * G537;
-  const C<F> G539 = G529 + G538;
-  const C<F> G540 = G4 * G539;
-  const C<F> G541 = G30 * G525;
-  const C<F> G542 = G35 * G31;
-  const C<F> G543 = G41 * G78;
-  const C<F> G544 = G541 + G542 + G543;
-  const C<F> G545 = G27 * G544;
-  const C<F> G546 = G98 * G536;
-  const C<F> G547 = C1 * G546;
-  const C<F> G548 = G545 + G547;
-  const C<F> G549 = G76 * G548;
-  const C<F> G550 = C1 * G549;
-  const C<F> G551 = G540 + G550;
-  const C<F> G552 = G107 * G539;
-  const C<F> G553 = G35 * G526;
-  const C<F> G554 = C2 * X0;
-  const C<F> G555 = G41 * G554;
-  const C<F> G556 = G32 + G553 + G555;
-  const C<F> G557 = G27 * G556;
-  const C<F> G558 = G129 * G536;
-  const C<F> G559 = C1 * G558;
-  const C<F> G560 = G557 + G559;
-  const C<F> G561 = G76 * G560;
-  const C<F> G562 = C1 * G561;
-  const C<F> G563 = G552 + G562;
-  const C<F> G564 = G154 * G78;
-  const C<F> G565 = G158 * G523;
-  const C<F> G566 = G162 * G526;
-  const C<F> G567 = G564 + G565 + G566;
-  const C<F> G568 = G151 * G567;
-  const C<F> G569 = G154 * G530;
-  const C<F> G570 = G158 * G532;
-  const C<F> G571 = G162 * G534;
-  const C<F> G572 = G569 + G570 + G571;
-  const C<F> G573 = G169 * G572;
-  const C<F> G574 = C1 * G573;
-  const C<F> G575 = G568 + G574;
-  const C<F> G576 = G138 * G575;
-  const C<F> G577 = G154 * G525;
-  const C<F> G578 = G158 * G31;
-  const C<F> G579 = G162 * G78;
-  const C<F> G580 = G577 + G578 + G579;
-  const C<F> G581 = G151 * G580;
-  const C<F> G582 = G189 * G572;
-  const C<F> G583 = C1 * G582;
-  const C<F> G584 = G581 + G583;
-  const C<F> G585 = G180 * G584;
-  const C<F> G586 = C1 * G585;
-  const C<F> G587 = G576 + G586;
-  const C<F> G588 = G198 * G575;
-  const C<F> G589 = G158 * G526;
-  const C<F> G590 = G162 * G554;
-  const C<F> G591 = G155 + G589 + G590;
-  const C<F> G592 = G151 * G591;
-  const C<F> G593 = G208 * G572;
-  const C<F> G594 = C1 * G593;
-  const C<F> G595 = G592 + G594;
-  const C<F> G596 = G180 * G595;
-  const C<F> G597 = C1 * G596;
-  const C<F> G598 = G588 + G597;
-  const C<F> G599 = G233 * G78;
-  const C<F> G600 = G237 * G523;
-  const C<F> G601 = G241 * G526;
-  const C<F> G602 = G599 + G600 + G601;
-  const C<F> G603 = G230 * G602;
-  const C<F> G604 = G233 * G530;
-  const C<F> G605 = G237 * G532;
-  const C<F> G606 = G241 * G534;
-  const C<F> G607 = G604 + G605 + G606;
-  const C<F> G608 = G248 * G607;
-  const C<F> G609 = C1 * G608;
-  const C<F> G610 = G603 + G609;
-  const C<F> G611 = G217 * G610;
-  const C<F> G612 = G233 * G525;
-  const C<F> G613 = G237 * G31;
-  const C<F> G614 = G241 * G78;
-  const C<F> G615 = G612 + G613 + G614;
-  const C<F> G616 = G230 * G615;
-  const C<F> G617 = G268 * G607;
-  const C<F> G618 = C1 * G617;
-  const C<F> G619 = G616 + G618;
-  const C<F> G620 = G259 * G619;
-  const C<F> G621 = C1 * G620;
-  const C<F> G622 = G611 + G621;
-  const C<F> G623 = G277 * G610;
-  const C<F> G624 = G237 * G526;
-  const C<F> G625 = G241 * G554;
-  const C<F> G626 = G234 + G624 + G625;
-  const C<F> G627 = G230 * G626;
-  const C<F> G628 = G287 * G607;
-  const C<F> G629 = C1 * G628;
-  const C<F> G630 = G627 + G629;
-  const C<F> G631 = G259 * G630;
-  const C<F> G632 = C1 * G631;
-  const C<F> G633 = G623 + G632;
-  const C<F> G634 = G330 * G78;
-  const C<F> G635 = G334 * G523;
-  const C<F> G636 = G338 * G526;
-  const C<F> G637 = G634 + G635 + G636;
-  const C<F> G638 = G321 * G637;
-  const C<F> G639 = G330 * G530;
-  const C<F> G640 = G334 * G532;
-  const C<F> G641 = G338 * G534;
-  const C<F> G642 = G639 + G640 + G641;
-  const C<F> G643 = G345 * G642;
-  const C<F> G644 = C1 * G643;
-  const C<F> G645 = G638 + G644;
-  const C<F> G646 = G302 * G645;
-  const C<F> G647 = G330 * G525;
-  const C<F> G648 = G334 * G31;
-  const C<F> G649 = G338 * G78;
-  const C<F> G650 = G647 + G648 + G649;
-  const C<F> G651 = G321 * G650;
-  const C<F> G652 = G365 * G642;
-  const C<F> G653 = C1 * G652;
-  const C<F> G654 = G651 + G653;
-  const C<F> G655 = G356 * G654;
-  const C<F> G656 = C1 * G655;
-  const C<F> G657 = G646 + G656;
-  const C<F> G658 = G374 * G645;
-  const C<F> G659 = G334 * G526;
-  const C<F> G660 = G338 * G554;
-  const C<F> G661 = G331 + G659 + G660;
-  const C<F> G662 = G321 * G661;
-  const C<F> G663 = G384 * G642;
-  const C<F> G664 = C1 * G663;
-  const C<F> G665 = G662 + G664;
-  const C<F> G666 = G356 * G665;
-  const C<F> G667 = C1 * G666;
-  const C<F> G668 = G658 + G667;
-  const C<F> G669 = G427 * G78;
-  const C<F> G670 = G431 * G523;
-  const C<F> G671 = G435 * G526;
-  const C<F> G672 = G669 + G670 + G671;
-  const C<F> G673 = G418 * G672;
-  const C<F> G674 = G427 * G530;
-  const C<F> G675 = G431 * G532;
-  const C<F> G676 = G435 * G534;
-  const C<F> G677 = G674 + G675 + G676;
-  const C<F> G678 = G442 * G677;
-  const C<F> G679 = C1 * G678;
-  const C<F> G680 = G673 + G679;
-  const C<F> G681 = G399 * G680;
-  const C<F> G682 = G427 * G525;
-  const C<F> G683 = G431 * G31;
-  const C<F> G684 = G435 * G78;
-  const C<F> G685 = G682 + G683 + G684;
-  const C<F> G686 = G418 * G685;
-  const C<F> G687 = G462 * G677;
-  const C<F> G688 = C1 * G687;
-  const C<F> G689 = G686 + G688;
-  const C<F> G690 = G453 * G689;
-  const C<F> G691 = C1 * G690;
-  const C<F> G692 = G681 + G691;
-  const C<F> G693 = G471 * G680;
-  const C<F> G694 = G431 * G526;
-  const C<F> G695 = G435 * G554;
-  const C<F> G696 = G428 + G694 + G695;
-  const C<F> G697 = G418 * G696;
-  const C<F> G698 = G481 * G677;
-  const C<F> G699 = C1 * G698;
-  const C<F> G700 = G697 + G699;
-  const C<F> G701 = G453 * G700;
-  const C<F> G702 = C1 * G701;
-  const C<F> G703 = G693 + G702;
-  const C<F> G704 = G151 * G602;
-  const C<F> G705 = G169 * G607;
-  const C<F> G706 = C1 * G705;
-  const C<F> G707 = G704 + G706;
-  const C<F> G708 = G277 * G707;
-  const C<F> G709 = G151 * G626;
-  const C<F> G710 = G208 * G607;
-  const C<F> G711 = C1 * G710;
-  const C<F> G712 = G709 + G711;
-  const C<F> G713 = G259 * G712;
-  const C<F> G714 = C1 * G713;
-  const C<F> G715 = G708 + G714;
-  const C<F> G716 = G138 * G715;
-  const C<F> G717 = G217 * G707;
-  const C<F> G718 = G151 * G615;
-  const C<F> G719 = G189 * G607;
-  const C<F> G720 = C1 * G719;
-  const C<F> G721 = G718 + G720;
-  const C<F> G722 = G259 * G721;
-  const C<F> G723 = C1 * G722;
-  const C<F> G724 = G717 + G723;
-  const C<F> G725 = G198 * G724;
-  const C<F> G726 = C1 * G725;
-  const C<F> G727 = G716 + G726;
-  const C<F> G728 = G217 * G712;
-  const C<F> G729 = G277 * G721;
-  const C<F> G730 = C1 * G729;
-  const C<F> G731 = G728 + G730;
-  const C<F> G732 = G180 * G731;
-  const C<F> G733 = G727 + G732;
-  const C<F> G734 = G1 * X62;
-  const C<F> G735 = t * X118;
-  const C<F> G736 = G734 + G735;
-  const C<F> G737 = G30 * G554;
-  const C<F> G738 = X2 + X2;
-  const C<F> G739 = C1 * G738;
-  const C<F> G740 = G41 * G739;
-  const C<F> G741 = G737 + G79 + G740;
-  const C<F> G742 = G27 * G741;
-  const C<F> G743 = X8 * G738;
-  const C<F> G744 = G30 * G743;
-  const C<F> G745 = X9 * G738;
-  const C<F> G746 = G35 * G745;
-  const C<F> G747 = X10 * G738;
-  const C<F> G748 = G41 * G747;
-  const C<F> G749 = G744 + G746 + G748;
-  const C<F> G750 = G62 * G749;
-  const C<F> G751 = C1 * G750;
-  const C<F> G752 = G742 + G751;
-  const C<F> G753 = G4 * G752;
-  const C<F> G754 = G30 * G739;
-  const C<F> G755 = G35 * G113;
-  const C<F> G756 = G41 * G523;
-  const C<F> G757 = G754 + G755 + G756;
-  const C<F> G758 = G27 * G757;
-  const C<F> G759 = G98 * G749;
-  const C<F> G760 = C1 * G759;
-  const C<F> G761 = G758 + G760;
-  const C<F> G762 = G76 * G761;
-  const C<F> G763 = C1 * G762;
-  const C<F> G764 = G753 + G763;
-  const C<F> G765 = G107 * G752;
-  const C<F> G766 = G30 * G113;
-  const C<F> G767 = G35 * G738;
-  const C<F> G768 = G766 + G767 + G543;
-  const C<F> G769 = G27 * G768;
-  const C<F> G770 = G129 * G749;
-  const C<F> G771 = C1 * G770;
-  const C<F> G772 = G769 + G771;
-  const C<F> G773 = G76 * G772;
-  const C<F> G774 = C1 * G773;
-  const C<F> G775 = G765 + G774;
-  const C<F> G776 = G154 * G554;
-  const C<F> G777 = G162 * G739;
-  const C<F> G778 = G776 + G182 + G777;
-  const C<F> G779 = G151 * G778;
-  const C<F> G780 = G154 * G743;
-  const C<F> G781 = G158 * G745;
-  const C<F> G782 = G162 * G747;
-  const C<F> G783 = G780 + G781 + G782;
-  const C<F> G784 = G169 * G783;
-  const C<F> G785 = C1 * G784;
-  const C<F> G786 = G779 + G785;
-  const C<F> G787 = G138 * G786;
-  const C<F> G788 = G154 * G739;
-  const C<F> G789 = G158 * G113;
-  const C<F> G790 = G162 * G523;
-  const C<F> G791 = G788 + G789 + G790;
-  const C<F> G792 = G151 * G791;
-  const C<F> G793 = G189 * G783;
-  const C<F> G794 = C1 * G793;
-  const C<F> G795 = G792 + G794;
-  const C<F> G796 = G180 * G795;
-  const C<F> G797 = C1 * G796;
-  const C<F> G798 = G787 + G797;
-  const C<F> G799 = G198 * G786;
-  const C<F> G800 = G154 * G113;
-  const C<F> G801 = G158 * G738;
-  const C<F> G802 = G800 + G801 + G579;
-  const C<F> G803 = G151 * G802;
-  const C<F> G804 = G208 * G783;
-  const C<F> G805 = C1 * G804;
-  const C<F> G806 = G803 + G805;
-  const C<F> G807 = G180 * G806;
-  const C<F> G808 = C1 * G807;
-  const C<F> G809 = G799 + G808;
-  const C<F> G810 = G233 * G554;
-  const C<F> G811 = G241 * G739;
-  const C<F> G812 = G810 + G261 + G811;
-  const C<F> G813 = G230 * G812;
-  const C<F> G814 = G233 * G743;
-  const C<F> G815 = G237 * G745;
-  const C<F> G816 = G241 * G747;
-  const C<F> G817 = G814 + G815 + G816;
-  const C<F> G818 = G248 * G817;
-  const C<F> G819 = C1 * G818;
-  const C<F> G820 = G813 + G819;
-  const C<F> G821 = G217 * G820;
-  const C<F> G822 = G233 * G739;
-  const C<F> G823 = G237 * G113;
-  const C<F> G824 = G241 * G523;
-  const C<F> G825 = G822 + G823 + G824;
-  const C<F> G826 = G230 * G825;
-  const C<F> G827 = G268 * G817;
-  const C<F> G828 = C1 * G827;
-  const C<F> G829 = G826 + G828;
-  const C<F> G830 = G259 * G829;
-  const C<F> G831 = C1 * G830;
-  const C<F> G832 = G821 + G831;
-  const C<F> G833 = G277 * G820;
-  const C<F> G834 = G233 * G113;
-  const C<F> G835 = G237 * G738;
-  const C<F> G836 = G834 + G835 + G614;
-  const C<F> G837 = G230 * G836;
-  const C<F> G838 = G287 * G817;
-  const C<F> G839 = C1 * G838;
-  const C<F> G840 = G837 + G839;
-  const C<F> G841 = G259 * G840;
-  const C<F> G842 = C1 * G841;
-  const C<F> G843 = G833 + G842;
-  const C<F> G844 = G330 * G554;
-  const C<F> G845 = G338 * G739;
-  const C<F> G846 = G844 + G358 + G845;
-  const C<F> G847 = G321 * G846;
-  const C<F> G848 = G330 * G743;
-  const C<F> G849 = G334 * G745;
-  const C<F> G850 = G338 * G747;
-  const C<F> G851 = G848 + G849 + G850;
-  const C<F> G852 = G345 * G851;
-  const C<F> G853 = C1 * G852;
-  const C<F> G854 = G847 + G853;
-  const C<F> G855 = G302 * G854;
-  const C<F> G856 = G330 * G739;
-  const C<F> G857 = G334 * G113;
-  const C<F> G858 = G338 * G523;
-  const C<F> G859 = G856 + G857 + G858;
-  const C<F> G860 = G321 * G859;
-  const C<F> G861 = G365 * G851;
-  const C<F> G862 = C1 * G861;
-  const C<F> G863 = G860 + G862;
-  const C<F> G864 = G356 * G863;
-  const C<F> G865 = C1 * G864;
-  const C<F> G866 = G855 + G865;
-  const C<F> G867 = G374 * G854;
-  const C<F> G868 = G330 * G113;
-  const C<F> G869 = G334 * G738;
-  const C<F> G870 = G868 + G869 + G649;
-  const C<F> G871 = G321 * G870;
-  const C<F> G872 = G384 * G851;
-  const C<F> G873 = C1 * G872;
-  const C<F> G874 = G871 + G873;
-  const C<F> G875 = G356 * G874;
-  const C<F> G876 = C1 * G875;
-  const C<F> G877 = G867 + G876;
-  const C<F> G878 = G427 * G554;
-  const C<F> G879 = G435 * G739;
-  const C<F> G880 = G878 + G455 + G879;
-  const C<F> G881 = G418 * G880;
-  const C<F> G882 = G427 * G743;
-  const C<F> G883 = G431 * G745;
-  const C<F> G884 = G435 * G747;
-  const C<F> G885 = G882 + G883 + G884;
-  const C<F> G886 = G442 * G885;
-  const C<F> G887 = C1 * G886;
-  const C<F> G888 = G881 + G887;
-  const C<F> G889 = G399 * G888;
-  const C<F> G890 = G427 * G739;
-  const C<F> G891 = G431 * G113;
-  const C<F> G892 = G435 * G523;
-  const C<F> G893 = G890 + G891 + G892;
-  const C<F> G894 = G418 * G893;
-  const C<F> G895 = G462 * G885;
-  const C<F> G896 = C1 * G895;
-  const C<F> G897 = G894 + G896;
-  const C<F> G898 = G453 * G897;
-  const C<F> G899 = C1 * G898;
-  const C<F> G900 = G889 + G899;
-  const C<F> G901 = G471 * G888;
-  const C<F> G902 = G427 * G113;
-  const C<F> G903 = G431 * G738;
-  const C<F> G904 = G902 + G903 + G684;
-  const C<F> G905 = G418 * G904;
-  const C<F> G906 = G481 * G885;
-  const C<F> G907 = C1 * G906;
-  const C<F> G908 = G905 + G907;
-  const C<F> G909 = G453 * G908;
-  const C<F> G910 = C1 * G909;
-  const C<F> G911 = G901 + G910;
-  const C<F> G912 = G151 * G812;
-  const C<F> G913 = G169 * G817;
-  const C<F> G914 = C1 * G913;
-  const C<F> G915 = G912 + G914;
-  const C<F> G916 = G277 * G915;
-  const C<F> G917 = G151 * G836;
-  const C<F> G918 = G208 * G817;
-  const C<F> G919 = C1 * G918;
-  const C<F> G920 = G917 + G919;
-  const C<F> G921 = G259 * G920;
-  const C<F> G922 = C1 * G921;
-  const C<F> G923 = G916 + G922;
-  const C<F> G924 = G138 * G923;
-  const C<F> G925 = G217 * G915;
-  const C<F> G926 = G151 * G825;
-  const C<F> G927 = G189 * G817;
-  const C<F> G928 = C1 * G927;
-  const C<F> G929 = G926 + G928;
-  const C<F> G930 = G259 * G929;
-  const C<F> G931 = C1 * G930;
-  const C<F> G932 = G925 + G931;
-  const C<F> G933 = G198 * G932;
-  const C<F> G934 = C1 * G933;
-  const C<F> G935 = G924 + G934;
-  const C<F> G936 = G217 * G920;
-  const C<F> G937 = G277 * G929;
-  const C<F> G938 = C1 * G937;
-  const C<F> G939 = G936 + G938;
-  const C<F> G940 = G180 * G939;
-  const C<F> G941 = G935 + G940;
-  const C<F> G942 = G1 * X63;
-  const C<F> G943 = t * X119;
-  const C<F> G944 = G942 + G943;
-  const C<F> G945 = X3 + X3;
-  const C<F> G946 = G41 * G945;
-  const C<F> G947 = G766 + G542 + G946;
-  const C<F> G948 = G27 * G947;
-  const C<F> G949 = X8 * G945;
-  const C<F> G950 = G30 * G949;
-  const C<F> G951 = X9 * G945;
-  const C<F> G952 = G35 * G951;
-  const C<F> G953 = X10 * G945;
-  const C<F> G954 = G41 * G953;
-  const C<F> G955 = G950 + G952 + G954;
-  const C<F> G956 = G62 * G955;
-  const C<F> G957 = C1 * G956;
-  const C<F> G958 = G948 + G957;
-  const C<F> G959 = G4 * G958;
-  const C<F> G960 = C1 * G945;
-  const C<F> G961 = G30 * G960;
-  const C<F> G962 = G35 * G554;
-  const C<F> G963 = G961 + G962 + G114;
-  const C<F> G964 = G27 * G963;
-  const C<F> G965 = G98 * G955;
-  const C<F> G966 = C1 * G965;
-  const C<F> G967 = G964 + G966;
-  const C<F> G968 = G76 * G967;
-  const C<F> G969 = C1 * G968;
-  const C<F> G970 = G959 + G969;
-  const C<F> G971 = G107 * G958;
-  const C<F> G972 = G30 * G523;
-  const C<F> G973 = G35 * G960;
-  const C<F> G974 = G41 * G31;
-  const C<F> G975 = G972 + G973 + G974;
-  const C<F> G976 = G27 * G975;
-  const C<F> G977 = G129 * G955;
-  const C<F> G978 = C1 * G977;
-  const C<F> G979 = G976 + G978;
-  const C<F> G980 = G76 * G979;
-  const C<F> G981 = C1 * G980;
-  const C<F> G982 = G971 + G981;
-  const C<F> G983 = G162 * G945;
-  const C<F> G984 = G800 + G578 + G983;
-  const C<F> G985 = G151 * G984;
-  const C<F> G986 = G154 * G949;
-  const C<F> G987 = G158 * G951;
-  const C<F> G988 = G162 * G953;
-  const C<F> G989 = G986 + G987 + G988;
-  const C<F> G990 = G169 * G989;
-  const C<F> G991 = C1 * G990;
-  const C<F> G992 = G985 + G991;
-  const C<F> G993 = G138 * G992;
-  const C<F> G994 = G154 * G960;
-  const C<F> G995 = G158 * G554;
-  const C<F> G996 = G994 + G995 + G202;
-  const C<F> G997 = G151 * G996;
-  const C<F> G998 = G189 * G989;
-  const C<F> G999 = C1 * G998;
-  const C<F> G1000 = G997 + G999;
-  const C<F> G1001 = G180 * G1000;
-  const C<F> G1002 = C1 * G1001;
-  const C<F> G1003 = G993 + G1002;
-  const C<F> G1004 = G198 * G992;
-  const C<F> G1005 = G154 * G523;
-  const C<F> G1006 = G158 * G960;
-  const C<F> G1007 = G162 * G31;
-  const C<F> G1008 = G1005 + G1006 + G1007;
-  const C<F> G1009 = G151 * G1008;
-  const C<F> G1010 = G208 * G989;
-  const C<F> G1011 = C1 * G1010;
-  const C<F> G1012 = G1009 + G1011;
-  const C<F> G1013 = G180 * G1012;
-  const C<F> G1014 = C1 * G1013;
-  const C<F> G1015 = G1004 + G1014;
-  const C<F> G1016 = G241 * G945;
-  const C<F> G1017 = G834 + G613 + G1016;
-  const C<F> G1018 = G230 * G1017;
-  const C<F> G1019 = G233 * G949;
-  const C<F> G1020 = G237 * G951;
-  const C<F> G1021 = G241 * G953;
-  const C<F> G1022 = G1019 + G1020 + G1021;
-  const C<F> G1023 = G248 * G1022;
-  const C<F> G1024 = C1 * G1023;
-  const C<F> G1025 = G1018 + G1024;
-  const C<F> G1026 = G217 * G1025;
-  const C<F> G1027 = G233 * G960;
-  const C<F> G1028 = G237 * G554;
-  const C<F> G1029 = G1027 + G1028 + G281;
-  const C<F> G1030 = G230 * G1029;
-  const C<F> G1031 = G268 * G1022;
-  const C<F> G1032 = C1 * G1031;
-  const C<F> G1033 = G1030 + G1032;
-  const C<F> G1034 = G259 * G1033;
-  const C<F> G1035 = C1 * G1034;
-  const C<F> G1036 = G1026 + G1035;
-  const C<F> G1037 = G277 * G1025;
-  const C<F> G1038 = G233 * G523;
-  const C<F> G1039 = G237 * G960;
-  const C<F> G1040 = G241 * G31;
-  const C<F> G1041 = G1038 + G1039 + G1040;
-  const C<F> G1042 = G230 * G1041;
-  const C<F> G1043 = G287 * G1022;
-  const C<F> G1044 = C1 * G1043;
-  const C<F> G1045 = G1042 + G1044;
-  const C<F> G1046 = G259 * G1045;
-  const C<F> G1047 = C1 * G1046;
-  const C<F> G1048 = G1037 + G1047;
-  const C<F> G1049 = G338 * G945;
-  const C<F> G1050 = G868 + G648 + G1049;
-  const C<F> G1051 = G321 * G1050;
-  const C<F> G1052 = G330 * G949;
-  const C<F> G1053 = G334 * G951;
-  const C<F> G1054 = G338 * G953;
-  const C<F> G1055 = G1052 + G1053 + G1054;
-  const C<F> G1056 = G345 * G1055;
-  const C<F> G1057 = C1 * G1056;
-  const C<F> G1058 = G1051 + G1057;
-  const C<F> G1059 = G302 * G1058;
-  const C<F> G1060 = G330 * G960;
-  const C<F> G1061 = G334 * G554;
-  const C<F> G1062 = G1060 + G1061 + G378;
-  const C<F> G1063 = G321 * G1062;
-  const C<F> G1064 = G365 * G1055;
-  const C<F> G1065 = C1 * G1064;
-  const C<F> G1066 = G1063 + G1065;
-  const C<F> G1067 = G356 * G1066;
-  const C<F> G1068 = C1 * G1067;
-  const C<F> G1069 = G1059 + G1068;
-  const C<F> G1070 = G374 * G1058;
-  const C<F> G1071 = G330 * G523;
-  const C<F> G1072 = G334 * G960;
-  const C<F> G1073 = G338 * G31;
-  const C<F> G1074 = G1071 + G1072 + G1073;
-  const C<F> G1075 = G321 * G1074;
-  const C<F> G1076 = G384 * G1055;
-  const C<F> G1077 = C1 * G1076;
-  const C<F> G1078 = G1075 + G1077;
-  const C<F> G1079 = G356 * G1078;
-  const C<F> G1080 = C1 * G1079;
-  const C<F> G1081 = G1070 + G1080;
-  const C<F> G1082 = G435 * G945;
-  const C<F> G1083 = G902 + G683 + G1082;
-  const C<F> G1084 = G418 * G1083;
-  const C<F> G1085 = G427 * G949;
-  const C<F> G1086 = G431 * G951;
-  const C<F> G1087 = G435 * G953;
-  const C<F> G1088 = G1085 + G1086 + G1087;
-  const C<F> G1089 = G442 * G1088;
-  const C<F> G1090 = C1 * G1089;
-  const C<F> G1091 = G1084 + G1090;
-  const C<F> G1092 = G399 * G1091;
-  const C<F> G1093 = G427 * G960;
-  const C<F> G1094 = G431 * G554;
-  const C<F> G1095 = G1093 + G1094 + G475;
-  const C<F> G1096 = G418 * G1095;
-  const C<F> G1097 = G462 * G1088;
-  const C<F> G1098 = C1 * G1097;
-  const C<F> G1099 = G1096 + G1098;
-  const C<F> G1100 = G453 * G1099;
-  const C<F> G1101 = C1 * G1100;
-  const C<F> G1102 = G1092 + G1101;
-  const C<F> G1103 = G471 * G1091;
-  const C<F> G1104 = G427 * G523;
-  const C<F> G1105 = G431 * G960;
-  const C<F> G1106 = G435 * G31;
-  const C<F> G1107 = G1104 + G1105 + G1106;
-  const C<F> G1108 = G418 * G1107;
-  const C<F> G1109 = G481 * G1088;
-  const C<F> G1110 = C1 * G1109;
-  const C<F> G1111 = G1108 + G1110;
-  const C<F> G1112 = G453 * G1111;
-  const C<F> G1113 = C1 * G1112;
-  const C<F> G1114 = G1103 + G1113;
-  const C<F> G1115 = G151 * G1017;
-  const C<F> G1116 = G169 * G1022;
-  const C<F> G1117 = C1 * G1116;
-  const C<F> G1118 = G1115 + G1117;
-  const C<F> G1119 = G277 * G1118;
-  const C<F> G1120 = G151 * G1041;
-  const C<F> G1121 = G208 * G1022;
-  const C<F> G1122 = C1 * G1121;
-  const C<F> G1123 = G1120 + G1122;
-  const C<F> G1124 = G259 * G1123;
-  const C<F> G1125 = C1 * G1124;
-  const C<F> G1126 = G1119 + G1125;
-  const C<F> G1127 = G138 * G1126;
-  const C<F> G1128 = G217 * G1118;
-  const C<F> G1129 = G151 * G1029;
-  const C<F> G1130 = G189 * G1022;
-  const C<F> G1131 = C1 * G1130;
-  const C<F> G1132 = G1129 + G1131;
-  const C<F> G1133 = G259 * G1132;
-  const C<F> G1134 = C1 * G1133;
-  const C<F> G1135 = G1128 + G1134;
-  const C<F> G1136 = G198 * G1135;
-  const C<F> G1137 = C1 * G1136;
-  const C<F> G1138 = G1127 + G1137;
-  const C<F> G1139 = G217 * G1123;
-  const C<F> G1140 = G277 * G1132;
-  const C<F> G1141 = C1 * G1140;
-  const C<F> G1142 = G1139 + G1141;
-  const C<F> G1143 = G180 * G1142;
-  const C<F> G1144 = G1138 + G1143;
-  const C<F> G1145 = G1 * X64;
-  const C<F> G1146 = t * X120;
-  const C<F> G1147 = G1145 + G1146;
-  const C<F> G1148 = X1 * X3;
-  const C<F> G1149 = X0 * X2;
-  const C<F> G1150 = G1148 + G1149;
-  const C<F> G1151 = C2 * G1150;
-  const C<F> G1152 = G30 * G1151;
-  const C<F> G1153 = X2 * X3;
-  const C<F> G1154 = X0 * X1;
-  const C<F> G1155 = C1 * G1154;
-  const C<F> G1156 = G1153 + G1155;
-  const C<F> G1157 = C2 * G1156;
-  const C<F> G1158 = G35 * G1157;
-  const C<F> G1159 = X0 * X0;
-  const C<F> G1160 = X3 * X3;
-  const C<F> G1161 = G1159 + G1160;
-  const C<F> G1162 = X1 * X1;
-  const C<F> G1163 = X2 * X2;
-  const C<F> G1164 = G1162 + G1163;
-  const C<F> G1165 = C1 * G1164;
-  const C<F> G1166 = G1161 + G1165;
-  const C<F> G1167 = G41 * G1166;
-  const C<F> G1168 = G1152 + G1158 + G1167;
-  const C<F> G1169 = X4 + X4;
-  const C<F> G1170 = X11 * G1169;
-  const C<F> G1171 = G7 * G1170;
-  const C<F> G1172 = X12 * G1169;
-  const C<F> G1173 = G19 * G1172;
-  const C<F> G1174 = X13 * G1169;
-  const C<F> G1175 = G24 * G1174;
-  const C<F> G1176 = G1171 + G1173 + G1175;
-  const C<F> G1177 = G1168 * G1176;
-  const C<F> G1178 = G1159 + G1162;
-  const C<F> G1179 = G1178 + G1163;
-  const C<F> G1180 = G1179 + G1160;
-  const C<F> G1181 = G1180 * X8;
-  const C<F> G1182 = G30 * G1181;
-  const C<F> G1183 = G1180 * X9;
-  const C<F> G1184 = G35 * G1183;
-  const C<F> G1185 = G1180 * X10;
-  const C<F> G1186 = G41 * G1185;
-  const C<F> G1187 = G1182 + G1184 + G1186;
-  const C<F> G1188 = C2 * X6;
-  const C<F> G1189 = G7 * G1188;
-  const C<F> G1190 = C1 * X5;
-  const C<F> G1191 = C2 * G1190;
-  const C<F> G1192 = G19 * G1191;
-  const C<F> G1193 = G24 * G1169;
-  const C<F> G1194 = G1189 + G1192 + G1193;
-  const C<F> G1195 = G1187 * G1194;
-  const C<F> G1196 = C1 * G1195;
-  const C<F> G1197 = G1177 + G1196;
-  const C<F> G1198 = G4 * G1197;
-  const C<F> G1199 = G1163 + G1160;
-  const C<F> G1200 = C1 * G1199;
-  const C<F> G1201 = G1178 + G1200;
-  const C<F> G1202 = G30 * G1201;
-  const C<F> G1203 = X1 * X2;
-  const C<F> G1204 = X0 * X3;
-  const C<F> G1205 = G1203 + G1204;
-  const C<F> G1206 = C2 * G1205;
-  const C<F> G1207 = G35 * G1206;
-  const C<F> G1208 = C1 * G1149;
-  const C<F> G1209 = G1148 + G1208;
-  const C<F> G1210 = C2 * G1209;
-  const C<F> G1211 = G41 * G1210;
-  const C<F> G1212 = G1202 + G1207 + G1211;
-  const C<F> G1213 = G1212 * G1176;
-  const C<F> G1214 = G7 * G1169;
-  const C<F> G1215 = C2 * X7;
-  const C<F> G1216 = G19 * G1215;
-  const C<F> G1217 = C1 * X6;
-  const C<F> G1218 = C2 * G1217;
-  const C<F> G1219 = G24 * G1218;
-  const C<F> G1220 = G1214 + G1216 + G1219;
-  const C<F> G1221 = G1187 * G1220;
-  const C<F> G1222 = C1 * G1221;
-  const C<F> G1223 = G1213 + G1222;
-  const C<F> G1224 = G76 * G1223;
-  const C<F> G1225 = C1 * G1224;
-  const C<F> G1226 = G1198 + G1225;
-  const C<F> G1227 = G107 * G1197;
-  const C<F> G1228 = C1 * G1204;
-  const C<F> G1229 = G1203 + G1228;
-  const C<F> G1230 = C2 * G1229;
-  const C<F> G1231 = G30 * G1230;
-  const C<F> G1232 = G1159 + G1163;
-  const C<F> G1233 = G1162 + G1160;
-  const C<F> G1234 = C1 * G1233;
-  const C<F> G1235 = G1232 + G1234;
-  const C<F> G1236 = G35 * G1235;
-  const C<F> G1237 = G1153 + G1154;
-  const C<F> G1238 = C2 * G1237;
-  const C<F> G1239 = G41 * G1238;
-  const C<F> G1240 = G1231 + G1236 + G1239;
-  const C<F> G1241 = G1240 * G1176;
-  const C<F> G1242 = C1 * X7;
-  const C<F> G1243 = C2 * G1242;
-  const C<F> G1244 = G7 * G1243;
-  const C<F> G1245 = G19 * G1169;
-  const C<F> G1246 = C2 * X5;
-  const C<F> G1247 = G24 * G1246;
-  const C<F> G1248 = G1244 + G1245 + G1247;
-  const C<F> G1249 = G1187 * G1248;
-  const C<F> G1250 = C1 * G1249;
-  const C<F> G1251 = G1241 + G1250;
-  const C<F> G1252 = G76 * G1251;
-  const C<F> G1253 = C1 * G1252;
-  const C<F> G1254 = G1227 + G1253;
-  const C<F> G1255 = G154 * G1151;
-  const C<F> G1256 = G158 * G1157;
-  const C<F> G1257 = G162 * G1166;
-  const C<F> G1258 = G1255 + G1256 + G1257;
-  const C<F> G1259 = G141 * G1170;
-  const C<F> G1260 = G145 * G1172;
-  const C<F> G1261 = G149 * G1174;
-  const C<F> G1262 = G1259 + G1260 + G1261;
-  const C<F> G1263 = G1258 * G1262;
-  const C<F> G1264 = G154 * G1181;
-  const C<F> G1265 = G158 * G1183;
-  const C<F> G1266 = G162 * G1185;
-  const C<F> G1267 = G1264 + G1265 + G1266;
-  const C<F> G1268 = G141 * G1188;
-  const C<F> G1269 = G145 * G1191;
-  const C<F> G1270 = G149 * G1169;
-  const C<F> G1271 = G1268 + G1269 + G1270;
-  const C<F> G1272 = G1267 * G1271;
-  const C<F> G1273 = C1 * G1272;
-  const C<F> G1274 = G1263 + G1273;
-  const C<F> G1275 = G138 * G1274;
-  const C<F> G1276 = G154 * G1201;
-  const C<F> G1277 = G158 * G1206;
-  const C<F> G1278 = G162 * G1210;
-  const C<F> G1279 = G1276 + G1277 + G1278;
-  const C<F> G1280 = G1279 * G1262;
-  const C<F> G1281 = G141 * G1169;
-  const C<F> G1282 = G145 * G1215;
-  const C<F> G1283 = G149 * G1218;
-  const C<F> G1284 = G1281 + G1282 + G1283;
-  const C<F> G1285 = G1267 * G1284;
-  const C<F> G1286 = C1 * G1285;
-  const C<F> G1287 = G1280 + G1286;
-  const C<F> G1288 = G180 * G1287;
-  const C<F> G1289 = C1 * G1288;
-  const C<F> G1290 = G1275 + G1289;
-  const C<F> G1291 = G198 * G1274;
-  const C<F> G1292 = G154 * G1230;
-  const C<F> G1293 = G158 * G1235;
-  const C<F> G1294 = G162 * G1238;
-  const C<F> G1295 = G1292 + G1293 + G1294;
-  const C<F> G1296 = G1295 * G1262;
-  const C<F> G1297 = G141 * G1243;
-  const C<F> G1298 = G145 * G1169;
-  const C<F> G1299 = G149 * G1246;
-  const C<F> G1300 = G1297 + G1298 + G1299;
-  const C<F> G1301 = G1267 * G1300;
-  const C<F> G1302 = C1 * G1301;
-  const C<F> G1303 = G1296 + G1302;
-  const C<F> G1304 = G180 * G1303;
-  const C<F> G1305 = C1 * G1304;
-  const C<F> G1306 = G1291 + G1305;
-  const C<F> G1307 = G233 * G1151;
-  const C<F> G1308 = G237 * G1157;
-  const C<F> G1309 = G241 * G1166;
-  const C<F> G1310 = G1307 + G1308 + G1309;
-  const C<F> G1311 = G220 * G1170;
-  const C<F> G1312 = G224 * G1172;
-  const C<F> G1313 = G228 * G1174;
-  const C<F> G1314 = G1311 + G1312 + G1313;
-  const C<F> G1315 = G1310 * G1314;
-  const C<F> G1316 = G233 * G1181;
-  const C<F> G1317 = G237 * G1183;
-  const C<F> G1318 = G241 * G1185;
-  const C<F> G1319 = G1316 + G1317 + G1318;
-  const C<F> G1320 = G220 * G1188;
-  const C<F> G1321 = G224 * G1191;
-  const C<F> G1322 = G228 * G1169;
-  const C<F> G1323 = G1320 + G1321 + G1322;
-  const C<F> G1324 = G1319 * G1323;
-  const C<F> G1325 = C1 * G1324;
-  const C<F> G1326 = G1315 + G1325;
-  const C<F> G1327 = G217 * G1326;
-  const C<F> G1328 = G233 * G1201;
-  const C<F> G1329 = G237 * G1206;
-  const C<F> G1330 = G241 * G1210;
-  const C<F> G1331 = G1328 + G1329 + G1330;
-  const C<F> G1332 = G1331 * G1314;
-  const C<F> G1333 = G220 * G1169;
-  const C<F> G1334 = G224 * G1215;
-  const C<F> G1335 = G228 * G1218;
-  const C<F> G1336 = G1333 + G1334 + G1335;
-  const C<F> G1337 = G1319 * G1336;
-  const C<F> G1338 = C1 * G1337;
-  const C<F> G1339 = G1332 + G1338;
-  const C<F> G1340 = G259 * G1339;
-  const C<F> G1341 = C1 * G1340;
-  const C<F> G1342 = G1327 + G1341;
-  const C<F> G1343 = G277 * G1326;
-  const C<F> G1344 = G233 * G1230;
-  const C<F> G1345 = G237 * G1235;
-  const C<F> G1346 = G241 * G1238;
-  const C<F> G1347 = G1344 + G1345 + G1346;
-  const C<F> G1348 = G1347 * G1314;
-  const C<F> G1349 = G220 * G1243;
-  const C<F> G1350 = G224 * G1169;
-  const C<F> G1351 = G228 * G1246;
-  const C<F> G1352 = G1349 + G1350 + G1351;
-  const C<F> G1353 = G1319 * G1352;
-  const C<F> G1354 = C1 * G1353;
-  const C<F> G1355 = G1348 + G1354;
-  const C<F> G1356 = G259 * G1355;
-  const C<F> G1357 = C1 * G1356;
-  const C<F> G1358 = G1343 + G1357;
-  const C<F> G1359 = G330 * G1151;
-  const C<F> G1360 = G334 * G1157;
-  const C<F> G1361 = G338 * G1166;
-  const C<F> G1362 = G1359 + G1360 + G1361;
-  const C<F> G1363 = G311 * G1170;
-  const C<F> G1364 = G315 * G1172;
-  const C<F> G1365 = G319 * G1174;
-  const C<F> G1366 = G1363 + G1364 + G1365;
-  const C<F> G1367 = G1362 * G1366;
-  const C<F> G1368 = G330 * G1181;
-  const C<F> G1369 = G334 * G1183;
-  const C<F> G1370 = G338 * G1185;
-  const C<F> G1371 = G1368 + G1369 + G1370;
-  const C<F> G1372 = G311 * G1188;
-  const C<F> G1373 = G315 * G1191;
-  const C<F> G1374 = G319 * G1169;
-  const C<F> G1375 = G1372 + G1373 + G1374;
-  const C<F> G1376 = G1371 * G1375;
-  const C<F> G1377 = C1 * G1376;
-  const C<F> G1378 = G1367 + G1377;
-  const C<F> G1379 = G302 * G1378;
-  const C<F> G1380 = G330 * G1201;
-  const C<F> G1381 = G334 * G1206;
-  const C<F> G1382 = G338 * G1210;
-  const C<F> G1383 = G1380 + G1381 + G1382;
-  const C<F> G1384 = G1383 * G1366;
-  const C<F> G1385 = G311 * G1169;
-  const C<F> G1386 = G315 * G1215;
-  const C<F> G1387 = G319 * G1218;
-  const C<F> G1388 = G1385 + G1386 + G1387;
-  const C<F> G1389 = G1371 * G1388;
-  const C<F> G1390 = C1 * G1389;
-  const C<F> G1391 = G1384 + G1390;
-  const C<F> G1392 = G356 * G1391;
-  const C<F> G1393 = C1 * G1392;
-  const C<F> G1394 = G1379 + G1393;
-  const C<F> G1395 = G374 * G1378;
-  const C<F> G1396 = G330 * G1230;
-  const C<F> G1397 = G334 * G1235;
-  const C<F> G1398 = G338 * G1238;
-  const C<F> G1399 = G1396 + G1397 + G1398;
-  const C<F> G1400 = G1399 * G1366;
-  const C<F> G1401 = G311 * G1243;
-  const C<F> G1402 = G315 * G1169;
-  const C<F> G1403 = G319 * G1246;
-  const C<F> G1404 = G1401 + G1402 + G1403;
-  const C<F> G1405 = G1371 * G1404;
-  const C<F> G1406 = C1 * G1405;
-  const C<F> G1407 = G1400 + G1406;
-  const C<F> G1408 = G356 * G1407;
-  const C<F> G1409 = C1 * G1408;
-  const C<F> G1410 = G1395 + G1409;
-  const C<F> G1411 = G427 * G1151;
-  const C<F> G1412 = G431 * G1157;
-  const C<F> G1413 = G435 * G1166;
-  const C<F> G1414 = G1411 + G1412 + G1413;
-  const C<F> G1415 = G408 * G1170;
-  const C<F> G1416 = G412 * G1172;
-  const C<F> G1417 = G416 * G1174;
-  const C<F> G1418 = G1415 + G1416 + G1417;
-  const C<F> G1419 = G1414 * G1418;
-  const C<F> G1420 = G427 * G1181;
-  const C<F> G1421 = G431 * G1183;
-  const C<F> G1422 = G435 * G1185;
-  const C<F> G1423 = G1420 + G1421 + G1422;
-  const C<F> G1424 = G408 * G1188;
-  const C<F> G1425 = G412 * G1191;
-  const C<F> G1426 = G416 * G1169;
-  const C<F> G1427 = G1424 + G1425 + G1426;
-  const C<F> G1428 = G1423 * G1427;
-  const C<F> G1429 = C1 * G1428;
-  const C<F> G1430 = G1419 + G1429;
-  const C<F> G1431 = G399 * G1430;
-  const C<F> G1432 = G427 * G1201;
-  const C<F> G1433 = G431 * G1206;
-  const C<F> G1434 = G435 * G1210;
-  const C<F> G1435 = G1432 + G1433 + G1434;
-  const C<F> G1436 = G1435 * G1418;
-  const C<F> G1437 = G408 * G1169;
-  const C<F> G1438 = G412 * G1215;
-  const C<F> G1439 = G416 * G1218;
-  const C<F> G1440 = G1437 + G1438 + G1439;
-  const C<F> G1441 = G1423 * G1440;
-  const C<F> G1442 = C1 * G1441;
-  const C<F> G1443 = G1436 + G1442;
-  const C<F> G1444 = G453 * G1443;
-  const C<F> G1445 = C1 * G1444;
-  const C<F> G1446 = G1431 + G1445;
-  const C<F> G1447 = G471 * G1430;
-  const C<F> G1448 = G427 * G1230;
-  const C<F> G1449 = G431 * G1235;
-  const C<F> G1450 = G435 * G1238;
-  const C<F> G1451 = G1448 + G1449 + G1450;
-  const C<F> G1452 = G1451 * G1418;
-  const C<F> G1453 = G408 * G1243;
-  const C<F> G1454 = G412 * G1169;
-  const C<F> G1455 = G416 * G1246;
-  const C<F> G1456 = G1453 + G1454 + G1455;
-  const C<F> G1457 = G1423 * G1456;
-  const C<F> G1458 = C1 * G1457;
-  const C<F> G1459 = G1452 + G1458;
-  const C<F> G1460 = G453 * G1459;
-  const C<F> G1461 = C1 * G1460;
-  const C<F> G1462 = G1447 + G1461;
-  const C<F> G1463 = G1310 * G1262;
-  const C<F> G1464 = G1319 * G1271;
-  const C<F> G1465 = C1 * G1464;
-  const C<F> G1466 = G1463 + G1465;
-  const C<F> G1467 = G277 * G1466;
-  const C<F> G1468 = G1347 * G1262;
-  const C<F> G1469 = G1319 * G1300;
-  const C<F> G1470 = C1 * G1469;
-  const C<F> G1471 = G1468 + G1470;
-  const C<F> G1472 = G259 * G1471;
-  const C<F> G1473 = C1 * G1472;
-  const C<F> G1474 = G1467 + G1473;
-  const C<F> G1475 = G138 * G1474;
-  const C<F> G1476 = G217 * G1466;
-  const C<F> G1477 = G1331 * G1262;
-  const C<F> G1478 = G1319 * G1284;
-  const C<F> G1479 = C1 * G1478;
-  const C<F> G1480 = G1477 + G1479;
-  const C<F> G1481 = G259 * G1480;
-  const C<F> G1482 = C1 * G1481;
-  const C<F> G1483 = G1476 + G1482;
-  const C<F> G1484 = G198 * G1483;
-  const C<F> G1485 = C1 * G1484;
-  const C<F> G1486 = G1475 + G1485;
-  const C<F> G1487 = G217 * G1471;
-  const C<F> G1488 = G277 * G1480;
-  const C<F> G1489 = C1 * G1488;
-  const C<F> G1490 = G1487 + G1489;
-  const C<F> G1491 = G180 * G1490;
-  const C<F> G1492 = G1486 + G1491;
-  const C<F> G1493 = G1 * X66;
-  const C<F> G1494 = t * X122;
-  const C<F> G1495 = G1493 + G1494;
-  const C<F> G1496 = X5 + X5;
-  const C<F> G1497 = X11 * G1496;
-  const C<F> G1498 = G7 * G1497;
-  const C<F> G1499 = X12 * G1496;
-  const C<F> G1500 = G19 * G1499;
-  const C<F> G1501 = X13 * G1496;
-  const C<F> G1502 = G24 * G1501;
-  const C<F> G1503 = G1498 + G1500 + G1502;
-  const C<F> G1504 = G1168 * G1503;
-  const C<F> G1505 = G7 * G1215;
-  const C<F> G1506 = C1 * X4;
-  const C<F> G1507 = C2 * G1506;
-  const C<F> G1508 = G19 * G1507;
-  const C<F> G1509 = C1 * G1496;
-  const C<F> G1510 = G24 * G1509;
-  const C<F> G1511 = G1505 + G1508 + G1510;
-  const C<F> G1512 = G1187 * G1511;
-  const C<F> G1513 = C1 * G1512;
-  const C<F> G1514 = G1504 + G1513;
-  const C<F> G1515 = G4 * G1514;
-  const C<F> G1516 = G1212 * G1503;
-  const C<F> G1517 = G7 * G1496;
-  const C<F> G1518 = G19 * G1188;
-  const C<F> G1519 = G24 * G1215;
-  const C<F> G1520 = G1517 + G1518 + G1519;
-  const C<F> G1521 = G1187 * G1520;
-  const C<F> G1522 = C1 * G1521;
-  const C<F> G1523 = G1516 + G1522;
-  const C<F> G1524 = G76 * G1523;
-  const C<F> G1525 = C1 * G1524;
-  const C<F> G1526 = G1515 + G1525;
-  const C<F> G1527 = G107 * G1514;
-  const C<F> G1528 = G1240 * G1503;
-  const C<F> G1529 = G19 * G1509;
-  const C<F> G1530 = C2 * X4;
-  const C<F> G1531 = G24 * G1530;
-  const C<F> G1532 = G1189 + G1529 + G1531;
-  const C<F> G1533 = G1187 * G1532;
-  const C<F> G1534 = C1 * G1533;
-  const C<F> G1535 = G1528 + G1534;
-  const C<F> G1536 = G76 * G1535;
-  const C<F> G1537 = C1 * G1536;
-  const C<F> G1538 = G1527 + G1537;
-  const C<F> G1539 = G141 * G1497;
-  const C<F> G1540 = G145 * G1499;
-  const C<F> G1541 = G149 * G1501;
-  const C<F> G1542 = G1539 + G1540 + G1541;
-  const C<F> G1543 = G1258 * G1542;
-  const C<F> G1544 = G141 * G1215;
-  const C<F> G1545 = G145 * G1507;
-  const C<F> G1546 = G149 * G1509;
-  const C<F> G1547 = G1544 + G1545 + G1546;
-  const C<F> G1548 = G1267 * G1547;
-  const C<F> G1549 = C1 * G1548;
-  const C<F> G1550 = G1543 + G1549;
-  const C<F> G1551 = G138 * G1550;
-  const C<F> G1552 = G1279 * G1542;
-  const C<F> G1553 = G141 * G1496;
-  const C<F> G1554 = G145 * G1188;
-  const C<F> G1555 = G149 * G1215;
-  const C<F> G1556 = G1553 + G1554 + G1555;
-  const C<F> G1557 = G1267 * G1556;
-  const C<F> G1558 = C1 * G1557;
-  const C<F> G1559 = G1552 + G1558;
-  const C<F> G1560 = G180 * G1559;
-  const C<F> G1561 = C1 * G1560;
-  const C<F> G1562 = G1551 + G1561;
-  const C<F> G1563 = G198 * G1550;
-  const C<F> G1564 = G1295 * G1542;
-  const C<F> G1565 = G145 * G1509;
-  const C<F> G1566 = G149 * G1530;
-  const C<F> G1567 = G1268 + G1565 + G1566;
-  const C<F> G1568 = G1267 * G1567;
-  const C<F> G1569 = C1 * G1568;
-  const C<F> G1570 = G1564 + G1569;
-  const C<F> G1571 = G180 * G1570;
-  const C<F> G1572 = C1 * G1571;
-  const C<F> G1573 = G1563 + G1572;
-  const C<F> G1574 = G220 * G1497;
-  const C<F> G1575 = G224 * G1499;
-  const C<F> G1576 = G228 * G1501;
-  const C<F> G1577 = G1574 + G1575 + G1576;
-  const C<F> G1578 = G1310 * G1577;
-  const C<F> G1579 = G220 * G1215;
-  const C<F> G1580 = G224 * G1507;
-  const C<F> G1581 = G228 * G1509;
-  const C<F> G1582 = G1579 + G1580 + G1581;
-  const C<F> G1583 = G1319 * G1582;
-  const C<F> G1584 = C1 * G1583;
-  const C<F> G1585 = G1578 + G1584;
-  const C<F> G1586 = G217 * G1585;
-  const C<F> G1587 = G1331 * G1577;
-  const C<F> G1588 = G220 * G1496;
-  const C<F> G1589 = G224 * G1188;
-  const C<F> G1590 = G228 * G1215;
-  const C<F> G1591 = G1588 + G1589 + G1590;
-  const C<F> G1592 = G1319 * G1591;
-  const C<F> G1593 = C1 * G1592;
-  const C<F> G1594 = G1587 + G1593;
-  const C<F> G1595 = G259 * G1594;
-  const C<F> G1596 = C1 * G1595;
-  const C<F> G1597 = G1586 + G1596;
-  const C<F> G1598 = G277 * G1585;
-  const C<F> G1599 = G1347 * G1577;
-  const C<F> G1600 = G224 * G1509;
-  const C<F> G1601 = G228 * G1530;
-  const C<F> G1602 = G1320 + G1600 + G1601;
-  const C<F> G1603 = G1319 * G1602;
-  const C<F> G1604 = C1 * G1603;
-  const C<F> G1605 = G1599 + G1604;
-  const C<F> G1606 = G259 * G1605;
-  const C<F> G1607 = C1 * G1606;
-  const C<F> G1608 = G1598 + G1607;
-  const C<F> G1609 = G311 * G1497;
-  const C<F> G1610 = G315 * G1499;
-  const C<F> G1611 = G319 * G1501;
-  const C<F> G1612 = G1609 + G1610 + G1611;
-  const C<F> G1613 = G1362 * G1612;
-  const C<F> G1614 = G311 * G1215;
-  const C<F> G1615 = G315 * G1507;
-  const C<F> G1616 = G319 * G1509;
-  const C<F> G1617 = G1614 + G1615 + G1616;
-  const C<F> G1618 = G1371 * G1617;
-  const C<F> G1619 = C1 * G1618;
-  const C<F> G1620 = G1613 + G1619;
-  const C<F> G1621 = G302 * G1620;
-  const C<F> G1622 = G1383 * G1612;
-  const C<F> G1623 = G311 * G1496;
-  const C<F> G1624 = G315 * G1188;
-  const C<F> G1625 = G319 * G1215;
-  const C<F> G1626 = G1623 + G1624 + G1625;
-  const C<F> G1627 = G1371 * G1626;
-  const C<F> G1628 = C1 * G1627;
-  const C<F> G1629 = G1622 + G1628;
-  const C<F> G1630 = G356 * G1629;
-  const C<F> G1631 = C1 * G1630;
-  const C<F> G1632 = G1621 + G1631;
-  const C<F> G1633 = G374 * G1620;
-  const C<F> G1634 = G1399 * G1612;
-  const C<F> G1635 = G315 * G1509;
-  const C<F> G1636 = G319 * G1530;
-  const C<F> G1637 = G1372 + G1635 + G1636;
-  const C<F> G1638 = G1371 * G1637;
-  const C<F> G1639 = C1 * G1638;
-  const C<F> G1640 = G1634 + G1639;
-  const C<F> G1641 = G356 * G1640;
-  const C<F> G1642 = C1 * G1641;
-  const C<F> G1643 = G1633 + G1642;
-  const C<F> G1644 = G408 * G1497;
-  const C<F> G1645 = G412 * G1499;
-  const C<F> G1646 = G416 * G1501;
-  const C<F> G1647 = G1644 + G1645 + G1646;
-  const C<F> G1648 = G1414 * G1647;
-  const C<F> G1649 = G408 * G1215;
-  const C<F> G1650 = G412 * G1507;
-  const C<F> G1651 = G416 * G1509;
-  const C<F> G1652 = G1649 + G1650 + G1651;
-  const C<F> G1653 = G1423 * G1652;
-  const C<F> G1654 = C1 * G1653;
-  const C<F> G1655 = G1648 + G1654;
-  const C<F> G1656 = G399 * G1655;
-  const C<F> G1657 = G1435 * G1647;
-  const C<F> G1658 = G408 * G1496;
-  const C<F> G1659 = G412 * G1188;
-  const C<F> G1660 = G416 * G1215;
-  const C<F> G1661 = G1658 + G1659 + G1660;
-  const C<F> G1662 = G1423 * G1661;
-  const C<F> G1663 = C1 * G1662;
-  const C<F> G1664 = G1657 + G1663;
-  const C<F> G1665 = G453 * G1664;
-  const C<F> G1666 = C1 * G1665;
-  const C<F> G1667 = G1656 + G1666;
-  const C<F> G1668 = G471 * G1655;
-  const C<F> G1669 = G1451 * G1647;
-  const C<F> G1670 = G412 * G1509;
-  const C<F> G1671 = G416 * G1530;
-  const C<F> G1672 = G1424 + G1670 + G1671;
-  const C<F> G1673 = G1423 * G1672;
-  const C<F> G1674 = C1 * G1673;
-  const C<F> G1675 = G1669 + G1674;
-  const C<F> G1676 = G453 * G1675;
-  const C<F> G1677 = C1 * G1676;
-  const C<F> G1678 = G1668 + G1677;
-  const C<F> G1679 = G1310 * G1542;
-  const C<F> G1680 = G1319 * G1547;
-  const C<F> G1681 = C1 * G1680;
-  const C<F> G1682 = G1679 + G1681;
-  const C<F> G1683 = G277 * G1682;
-  const C<F> G1684 = G1347 * G1542;
-  const C<F> G1685 = G1319 * G1567;
-  const C<F> G1686 = C1 * G1685;
-  const C<F> G1687 = G1684 + G1686;
-  const C<F> G1688 = G259 * G1687;
-  const C<F> G1689 = C1 * G1688;
-  const C<F> G1690 = G1683 + G1689;
-  const C<F> G1691 = G138 * G1690;
-  const C<F> G1692 = G217 * G1682;
-  const C<F> G1693 = G1331 * G1542;
-  const C<F> G1694 = G1319 * G1556;
-  const C<F> G1695 = C1 * G1694;
-  const C<F> G1696 = G1693 + G1695;
-  const C<F> G1697 = G259 * G1696;
-  const C<F> G1698 = C1 * G1697;
-  const C<F> G1699 = G1692 + G1698;
-  const C<F> G1700 = G198 * G1699;
-  const C<F> G1701 = C1 * G1700;
-  const C<F> G1702 = G1691 + G1701;
-  const C<F> G1703 = G217 * G1687;
-  const C<F> G1704 = G277 * G1696;
-  const C<F> G1705 = C1 * G1704;
-  const C<F> G1706 = G1703 + G1705;
-  const C<F> G1707 = G180 * G1706;
-  const C<F> G1708 = G1702 + G1707;
-  const C<F> G1709 = G1 * X67;
-  const C<F> G1710 = t * X123;
-  const C<F> G1711 = G1709 + G1710;
-  const C<F> G1712 = X6 + X6;
-  const C<F> G1713 = X11 * G1712;
-  const C<F> G1714 = G7 * G1713;
-  const C<F> G1715 = X12 * G1712;
-  const C<F> G1716 = G19 * G1715;
-  const C<F> G1717 = X13 * G1712;
-  const C<F> G1718 = G24 * G1717;
-  const C<F> G1719 = G1714 + G1716 + G1718;
-  const C<F> G1720 = G1168 * G1719;
-  const C<F> G1721 = G7 * G1530;
-  const C<F> G1722 = C1 * G1712;
-  const C<F> G1723 = G24 * G1722;
-  const C<F> G1724 = G1721 + G1216 + G1723;
-  const C<F> G1725 = G1187 * G1724;
-  const C<F> G1726 = C1 * G1725;
-  const C<F> G1727 = G1720 + G1726;
-  const C<F> G1728 = G4 * G1727;
-  const C<F> G1729 = G1212 * G1719;
-  const C<F> G1730 = G7 * G1722;
-  const C<F> G1731 = G19 * G1246;
-  const C<F> G1732 = G24 * G1507;
-  const C<F> G1733 = G1730 + G1731 + G1732;
-  const C<F> G1734 = G1187 * G1733;
-  const C<F> G1735 = C1 * G1734;
-  const C<F> G1736 = G1729 + G1735;
-  const C<F> G1737 = G76 * G1736;
-  const C<F> G1738 = C1 * G1737;
-  const C<F> G1739 = G1728 + G1738;
-  const C<F> G1740 = G107 * G1727;
-  const C<F> G1741 = G1240 * G1719;
-  const C<F> G1742 = G7 * G1246;
-  const C<F> G1743 = G19 * G1712;
-  const C<F> G1744 = G1742 + G1743 + G1519;
-  const C<F> G1745 = G1187 * G1744;
-  const C<F> G1746 = C1 * G1745;
-  const C<F> G1747 = G1741 + G1746;
-  const C<F> G1748 = G76 * G1747;
-  const C<F> G1749 = C1 * G1748;
-  const C<F> G1750 = G1740 + G1749;
-  const C<F> G1751 = G141 * G1713;
-  const C<F> G1752 = G145 * G1715;
-  const C<F> G1753 = G149 * G1717;
-  const C<F> G1754 = G1751 + G1752 + G1753;
-  const C<F> G1755 = G1258 * G1754;
-  const C<F> G1756 = G141 * G1530;
-  const C<F> G1757 = G149 * G1722;
-  const C<F> G1758 = G1756 + G1282 + G1757;
-  const C<F> G1759 = G1267 * G1758;
-  const C<F> G1760 = C1 * G1759;
-  const C<F> G1761 = G1755 + G1760;
-  const C<F> G1762 = G138 * G1761;
-  const C<F> G1763 = G1279 * G1754;
-  const C<F> G1764 = G141 * G1722;
-  const C<F> G1765 = G145 * G1246;
-  const C<F> G1766 = G149 * G1507;
-  const C<F> G1767 = G1764 + G1765 + G1766;
-  const C<F> G1768 = G1267 * G1767;
-  const C<F> G1769 = C1 * G1768;
-  const C<F> G1770 = G1763 + G1769;
-  const C<F> G1771 = G180 * G1770;
-  const C<F> G1772 = C1 * G1771;
-  const C<F> G1773 = G1762 + G1772;
-  const C<F> G1774 = G198 * G1761;
-  const C<F> G1775 = G1295 * G1754;
-  const C<F> G1776 = G141 * G1246;
-  const C<F> G1777 = G145 * G1712;
-  const C<F> G1778 = G1776 + G1777 + G1555;
-  const C<F> G1779 = G1267 * G1778;
-  const C<F> G1780 = C1 * G1779;
-  const C<F> G1781 = G1775 + G1780;
-  const C<F> G1782 = G180 * G1781;
-  const C<F> G1783 = C1 * G1782;
-  const C<F> G1784 = G1774 + G1783;
-  const C<F> G1785 = G220 * G1713;
-  const C<F> G1786 = G224 * G1715;
-  const C<F> G1787 = G228 * G1717;
-  const C<F> G1788 = G1785 + G1786 + G1787;
-  const C<F> G1789 = G1310 * G1788;
-  const C<F> G1790 = G220 * G1530;
-  const C<F> G1791 = G228 * G1722;
-  const C<F> G1792 = G1790 + G1334 + G1791;
-  const C<F> G1793 = G1319 * G1792;
-  const C<F> G1794 = C1 * G1793;
-  const C<F> G1795 = G1789 + G1794;
-  const C<F> G1796 = G217 * G1795;
-  const C<F> G1797 = G1331 * G1788;
-  const C<F> G1798 = G220 * G1722;
-  const C<F> G1799 = G224 * G1246;
-  const C<F> G1800 = G228 * G1507;
-  const C<F> G1801 = G1798 + G1799 + G1800;
-  const C<F> G1802 = G1319 * G1801;
-  const C<F> G1803 = C1 * G1802;
-  const C<F> G1804 = G1797 + G1803;
-  const C<F> G1805 = G259 * G1804;
-  const C<F> G1806 = C1 * G1805;
-  const C<F> G1807 = G1796 + G1806;
-  const C<F> G1808 = G277 * G1795;
-  const C<F> G1809 = G1347 * G1788;
-  const C<F> G1810 = G220 * G1246;
-  const C<F> G1811 = G224 * G1712;
-  const C<F> G1812 = G1810 + G1811 + G1590;
-  const C<F> G1813 = G1319 * G1812;
-  const C<F> G1814 = C1 * G1813;
-  const C<F> G1815 = G1809 + G1814;
-  const C<F> G1816 = G259 * G1815;
-  const C<F> G1817 = C1 * G1816;
-  const C<F> G1818 = G1808 + G1817;
-  const C<F> G1819 = G311 * G1713;
-  const C<F> G1820 = G315 * G1715;
-  const C<F> G1821 = G319 * G1717;
-  const C<F> G1822 = G1819 + G1820 + G1821;
-  const C<F> G1823 = G1362 * G1822;
-  const C<F> G1824 = G311 * G1530;
-  const C<F> G1825 = G319 * G1722;
-  const C<F> G1826 = G1824 + G1386 + G1825;
-  const C<F> G1827 = G1371 * G1826;
-  const C<F> G1828 = C1 * G1827;
-  const C<F> G1829 = G1823 + G1828;
-  const C<F> G1830 = G302 * G1829;
-  const C<F> G1831 = G1383 * G1822;
-  const C<F> G1832 = G311 * G1722;
-  const C<F> G1833 = G315 * G1246;
-  const C<F> G1834 = G319 * G1507;
-  const C<F> G1835 = G1832 + G1833 + G1834;
-  const C<F> G1836 = G1371 * G1835;
-  const C<F> G1837 = C1 * G1836;
-  const C<F> G1838 = G1831 + G1837;
-  const C<F> G1839 = G356 * G1838;
-  const C<F> G1840 = C1 * G1839;
-  const C<F> G1841 = G1830 + G1840;
-  const C<F> G1842 = G374 * G1829;
-  const C<F> G1843 = G1399 * G1822;
-  const C<F> G1844 = G311 * G1246;
-  const C<F> G1845 = G315 * G1712;
-  const C<F> G1846 = G1844 + G1845 + G1625;
-  const C<F> G1847 = G1371 * G1846;
-  const C<F> G1848 = C1 * G1847;
-  const C<F> G1849 = G1843 + G1848;
-  const C<F> G1850 = G356 * G1849;
-  const C<F> G1851 = C1 * G1850;
-  const C<F> G1852 = G1842 + G1851;
-  const C<F> G1853 = G408 * G1713;
-  const C<F> G1854 = G412 * G1715;
-  const C<F> G1855 = G416 * G1717;
-  const C<F> G1856 = G1853 + G1854 + G1855;
-  const C<F> G1857 = G1414 * G1856;
-  const C<F> G1858 = G408 * G1530;
-  const C<F> G1859 = G416 * G1722;
-  const C<F> G1860 = G1858 + G1438 + G1859;
-  const C<F> G1861 = G1423 * G1860;
-  const C<F> G1862 = C1 * G1861;
-  const C<F> G1863 = G1857 + G1862;
-  const C<F> G1864 = G399 * G1863;
-  const C<F> G1865 = G1435 * G1856;
-  const C<F> G1866 = G408 * G1722;
-  const C<F> G1867 = G412 * G1246;
-  const C<F> G1868 = G416 * G1507;
-  const C<F> G1869 = G1866 + G1867 + G1868;
-  const C<F> G1870 = G1423 * G1869;
-  const C<F> G1871 = C1 * G1870;
-  const C<F> G1872 = G1865 + G1871;
-  const C<F> G1873 = G453 * G1872;
-  const C<F> G1874 = C1 * G1873;
-  const C<F> G1875 = G1864 + G1874;
-  const C<F> G1876 = G471 * G1863;
-  const C<F> G1877 = G1451 * G1856;
-  const C<F> G1878 = G408 * G1246;
-  const C<F> G1879 = G412 * G1712;
-  const C<F> G1880 = G1878 + G1879 + G1660;
-  const C<F> G1881 = G1423 * G1880;
-  const C<F> G1882 = C1 * G1881;
-  const C<F> G1883 = G1877 + G1882;
-  const C<F> G1884 = G453 * G1883;
-  const C<F> G1885 = C1 * G1884;
-  const C<F> G1886 = G1876 + G1885;
-  const C<F> G1887 = G1310 * G1754;
-  const C<F> G1888 = G1319 * G1758;
-  const C<F> G1889 = C1 * G1888;
-  const C<F> G1890 = G1887 + G1889;
-  const C<F> G1891 = G277 * G1890;
-  const C<F> G1892 = G1347 * G1754;
-  const C<F> G1893 = G1319 * G1778;
-  const C<F> G1894 = C1 * G1893;
-  const C<F> G1895 = G1892 + G1894;
-  const C<F> G1896 = G259 * G1895;
-  const C<F> G1897 = C1 * G1896;
-  const C<F> G1898 = G1891 + G1897;
-  const C<F> G1899 = G138 * G1898;
-  const C<F> G1900 = G217 * G1890;
-  const C<F> G1901 = G1331 * G1754;
-  const C<F> G1902 = G1319 * G1767;
-  const C<F> G1903 = C1 * G1902;
-  const C<F> G1904 = G1901 + G1903;
-  const C<F> G1905 = G259 * G1904;
-  const C<F> G1906 = C1 * G1905;
-  const C<F> G1907 = G1900 + G1906;
-  const C<F> G1908 = G198 * G1907;
-  const C<F> G1909 = C1 * G1908;
-  const C<F> G1910 = G1899 + G1909;
-  const C<F> G1911 = G217 * G1895;
-  const C<F> G1912 = G277 * G1904;
-  const C<F> G1913 = C1 * G1912;
-  const C<F> G1914 = G1911 + G1913;
-  const C<F> G1915 = G180 * G1914;
-  const C<F> G1916 = G1910 + G1915;
-  const C<F> G1917 = G1 * X68;
-  const C<F> G1918 = t * X124;
-  const C<F> G1919 = G1917 + G1918;
-  const C<F> G1920 = X7 + X7;
-  const C<F> G1921 = X11 * G1920;
-  const C<F> G1922 = G7 * G1921;
-  const C<F> G1923 = X12 * G1920;
-  const C<F> G1924 = G19 * G1923;
-  const C<F> G1925 = X13 * G1920;
-  const C<F> G1926 = G24 * G1925;
-  const C<F> G1927 = G1922 + G1924 + G1926;
-  const C<F> G1928 = G1168 * G1927;
-  const C<F> G1929 = G24 * G1920;
-  const C<F> G1930 = G1742 + G1518 + G1929;
-  const C<F> G1931 = G1187 * G1930;
-  const C<F> G1932 = C1 * G1931;
-  const C<F> G1933 = G1928 + G1932;
-  const C<F> G1934 = G4 * G1933;
-  const C<F> G1935 = G1212 * G1927;
-  const C<F> G1936 = C1 * G1920;
-  const C<F> G1937 = G7 * G1936;
-  const C<F> G1938 = G19 * G1530;
-  const C<F> G1939 = G1937 + G1938 + G1247;
-  const C<F> G1940 = G1187 * G1939;
-  const C<F> G1941 = C1 * G1940;
-  const C<F> G1942 = G1935 + G1941;
-  const C<F> G1943 = G76 * G1942;
-  const C<F> G1944 = C1 * G1943;
-  const C<F> G1945 = G1934 + G1944;
-  const C<F> G1946 = G107 * G1933;
-  const C<F> G1947 = G1240 * G1927;
-  const C<F> G1948 = G7 * G1507;
-  const C<F> G1949 = G19 * G1936;
-  const C<F> G1950 = G24 * G1188;
-  const C<F> G1951 = G1948 + G1949 + G1950;
-  const C<F> G1952 = G1187 * G1951;
-  const C<F> G1953 = C1 * G1952;
-  const C<F> G1954 = G1947 + G1953;
-  const C<F> G1955 = G76 * G1954;
-  const C<F> G1956 = C1 * G1955;
-  const C<F> G1957 = G1946 + G1956;
-  const C<F> G1958 = G141 * G1921;
-  const C<F> G1959 = G145 * G1923;
-  const C<F> G1960 = G149 * G1925;
-  const C<F> G1961 = G1958 + G1959 + G1960;
-  const C<F> G1962 = G1258 * G1961;
-  const C<F> G1963 = G149 * G1920;
-  const C<F> G1964 = G1776 + G1554 + G1963;
-  const C<F> G1965 = G1267 * G1964;
-  const C<F> G1966 = C1 * G1965;
-  const C<F> G1967 = G1962 + G1966;
-  const C<F> G1968 = G138 * G1967;
-  const C<F> G1969 = G1279 * G1961;
-  const C<F> G1970 = G141 * G1936;
-  const C<F> G1971 = G145 * G1530;
-  const C<F> G1972 = G1970 + G1971 + G1299;
-  const C<F> G1973 = G1267 * G1972;
-  const C<F> G1974 = C1 * G1973;
-  const C<F> G1975 = G1969 + G1974;
-  const C<F> G1976 = G180 * G1975;
-  const C<F> G1977 = C1 * G1976;
-  const C<F> G1978 = G1968 + G1977;
-  const C<F> G1979 = G198 * G1967;
-  const C<F> G1980 = G1295 * G1961;
-  const C<F> G1981 = G141 * G1507;
-  const C<F> G1982 = G145 * G1936;
-  const C<F> G1983 = G149 * G1188;
-  const C<F> G1984 = G1981 + G1982 + G1983;
-  const C<F> G1985 = G1267 * G1984;
-  const C<F> G1986 = C1 * G1985;
-  const C<F> G1987 = G1980 + G1986;
-  const C<F> G1988 = G180 * G1987;
-  const C<F> G1989 = C1 * G1988;
-  const C<F> G1990 = G1979 + G1989;
-  const C<F> G1991 = G220 * G1921;
-  const C<F> G1992 = G224 * G1923;
-  const C<F> G1993 = G228 * G1925;
-  const C<F> G1994 = G1991 + G1992 + G1993;
-  const C<F> G1995 = G1310 * G1994;
-  const C<F> G1996 = G228 * G1920;
-  const C<F> G1997 = G1810 + G1589 + G1996;
-  const C<F> G1998 = G1319 * G1997;
-  const C<F> G1999 = C1 * G1998;
-  const C<F> G2000 = G1995 + G1999;
-  const C<F> G2001 = G217 * G2000;
-  const C<F> G2002 = G1331 * G1994;
-  const C<F> G2003 = G220 * G1936;
-  const C<F> G2004 = G224 * G1530;
-  const C<F> G2005 = G2003 + G2004 + G1351;
-  const C<F> G2006 = G1319 * G2005;
-  const C<F> G2007 = C1 * G2006;
-  const C<F> G2008 = G2002 + G2007;
-  const C<F> G2009 = G259 * G2008;
-  const C<F> G2010 = C1 * G2009;
-  const C<F> G2011 = G2001 + G2010;
-  const C<F> G2012 = G277 * G2000;
-  const C<F> G2013 = G1347 * G1994;
-  const C<F> G2014 = G220 * G1507;
-  const C<F> G2015 = G224 * G1936;
-  const C<F> G2016 = G228 * G1188;
-  const C<F> G2017 = G2014 + G2015 + G2016;
-  const C<F> G2018 = G1319 * G2017;
-  const C<F> G2019 = C1 * G2018;
-  const C<F> G2020 = G2013 + G2019;
-  const C<F> G2021 = G259 * G2020;
-  const C<F> G2022 = C1 * G2021;
-  const C<F> G2023 = G2012 + G2022;
-  const C<F> G2024 = G311 * G1921;
-  const C<F> G2025 = G315 * G1923;
-  const C<F> G2026 = G319 * G1925;
-  const C<F> G2027 = G2024 + G2025 + G2026;
-  const C<F> G2028 = G1362 * G2027;
-  const C<F> G2029 = G319 * G1920;
-  const C<F> G2030 = G1844 + G1624 + G2029;
-  const C<F> G2031 = G1371 * G2030;
-  const C<F> G2032 = C1 * G2031;
-  const C<F> G2033 = G2028 + G2032;
-  const C<F> G2034 = G302 * G2033;
-  const C<F> G2035 = G1383 * G2027;
-  const C<F> G2036 = G311 * G1936;
-  const C<F> G2037 = G315 * G1530;
-  const C<F> G2038 = G2036 + G2037 + G1403;
-  const C<F> G2039 = G1371 * G2038;
-  const C<F> G2040 = C1 * G2039;
-  const C<F> G2041 = G2035 + G2040;
-  const C<F> G2042 = G356 * G2041;
-  const C<F> G2043 = C1 * G2042;
-  const C<F> G2044 = G2034 + G2043;
-  const C<F> G2045 = G374 * G2033;
-  const C<F> G2046 = G1399 * G2027;
-  const C<F> G2047 = G311 * G1507;
-  const C<F> G2048 = G315 * G1936;
-  const C<F> G2049 = G319 * G1188;
-  const C<F> G2050 = G2047 + G2048 + G2049;
-  const C<F> G2051 = G1371 * G2050;
-  const C<F> G2052 = C1 * G2051;
-  const C<F> G2053 = G2046 + G2052;
-  const C<F> G2054 = G356 * G2053;
-  const C<F> G2055 = C1 * G2054;
-  const C<F> G2056 = G2045 + G2055;
-  const C<F> G2057 = G408 * G1921;
-  const C<F> G2058 = G412 * G1923;
-  const C<F> G2059 = G416 * G1925;
-  const C<F> G2060 = G2057 + G2058 + G2059;
-  const C<F> G2061 = G1414 * G2060;
-  const C<F> G2062 = G416 * G1920;
-  const C<F> G2063 = G1878 + G1659 + G2062;
-  const C<F> G2064 = G1423 * G2063;
-  const C<F> G2065 = C1 * G2064;
-  const C<F> G2066 = G2061 + G2065;
-  const C<F> G2067 = G399 * G2066;
-  const C<F> G2068 = G1435 * G2060;
-  const C<F> G2069 = G408 * G1936;
-  const C<F> G2070 = G412 * G1530;
-  const C<F> G2071 = G2069 + G2070 + G1455;
-  const C<F> G2072 = G1423 * G2071;
-  const C<F> G2073 = C1 * G2072;
-  const C<F> G2074 = G2068 + G2073;
-  const C<F> G2075 = G453 * G2074;
-  const C<F> G2076 = C1 * G2075;
-  const C<F> G2077 = G2067 + G2076;
-  const C<F> G2078 = G471 * G2066;
-  const C<F> G2079 = G1451 * G2060;
-  const C<F> G2080 = G408 * G1507;
-  const C<F> G2081 = G412 * G1936;
-  const C<F> G2082 = G416 * G1188;
-  const C<F> G2083 = G2080 + G2081 + G2082;
-  const C<F> G2084 = G1423 * G2083;
-  const C<F> G2085 = C1 * G2084;
-  const C<F> G2086 = G2079 + G2085;
-  const C<F> G2087 = G453 * G2086;
-  const C<F> G2088 = C1 * G2087;
-  const C<F> G2089 = G2078 + G2088;
-  const C<F> G2090 = G1310 * G1961;
-  const C<F> G2091 = G1319 * G1964;
-  const C<F> G2092 = C1 * G2091;
-  const C<F> G2093 = G2090 + G2092;
-  const C<F> G2094 = G277 * G2093;
-  const C<F> G2095 = G1347 * G1961;
-  const C<F> G2096 = G1319 * G1984;
-  const C<F> G2097 = C1 * G2096;
-  const C<F> G2098 = G2095 + G2097;
-  const C<F> G2099 = G259 * G2098;
-  const C<F> G2100 = C1 * G2099;
-  const C<F> G2101 = G2094 + G2100;
-  const C<F> G2102 = G138 * G2101;
-  const C<F> G2103 = G217 * G2093;
-  const C<F> G2104 = G1331 * G1961;
-  const C<F> G2105 = G1319 * G1972;
-  const C<F> G2106 = C1 * G2105;
-  const C<F> G2107 = G2104 + G2106;
-  const C<F> G2108 = G259 * G2107;
-  const C<F> G2109 = C1 * G2108;
-  const C<F> G2110 = G2103 + G2109;
-  const C<F> G2111 = G198 * G2110;
-  const C<F> G2112 = C1 * G2111;
-  const C<F> G2113 = G2102 + G2112;
-  const C<F> G2114 = G217 * G2098;
-  const C<F> G2115 = G277 * G2107;
-  const C<F> G2116 = C1 * G2115;
-  const C<F> G2117 = G2114 + G2116;
-  const C<F> G2118 = G180 * G2117;
-  const C<F> G2119 = G2113 + G2118;
-  const C<F> G2120 = G1 * X69;
-  const C<F> G2121 = t * X125;
-  const C<F> G2122 = G2120 + G2121;
-  const C<F> G2123 = G30 * G1180;
-  const C<F> G2124 = G62 * G2123;
-  const C<F> G2125 = C1 * G2124;
-  const C<F> G2126 = G4 * G2125;
-  const C<F> G2127 = G98 * G2123;
-  const C<F> G2128 = C1 * G2127;
-  const C<F> G2129 = G76 * G2128;
-  const C<F> G2130 = C1 * G2129;
-  const C<F> G2131 = G2126 + G2130;
-  const C<F> G2132 = G107 * G2125;
-  const C<F> G2133 = G129 * G2123;
-  const C<F> G2134 = C1 * G2133;
-  const C<F> G2135 = G76 * G2134;
-  const C<F> G2136 = C1 * G2135;
-  const C<F> G2137 = G2132 + G2136;
-  const C<F> G2138 = G154 * G1180;
-  const C<F> G2139 = G169 * G2138;
-  const C<F> G2140 = C1 * G2139;
-  const C<F> G2141 = G138 * G2140;
-  const C<F> G2142 = G189 * G2138;
-  const C<F> G2143 = C1 * G2142;
-  const C<F> G2144 = G180 * G2143;
-  const C<F> G2145 = C1 * G2144;
-  const C<F> G2146 = G2141 + G2145;
-  const C<F> G2147 = G198 * G2140;
-  const C<F> G2148 = G208 * G2138;
-  const C<F> G2149 = C1 * G2148;
-  const C<F> G2150 = G180 * G2149;
-  const C<F> G2151 = C1 * G2150;
-  const C<F> G2152 = G2147 + G2151;
-  const C<F> G2153 = G233 * G1180;
-  const C<F> G2154 = G248 * G2153;
-  const C<F> G2155 = C1 * G2154;
-  const C<F> G2156 = G217 * G2155;
-  const C<F> G2157 = G268 * G2153;
-  const C<F> G2158 = C1 * G2157;
-  const C<F> G2159 = G259 * G2158;
-  const C<F> G2160 = C1 * G2159;
-  const C<F> G2161 = G2156 + G2160;
-  const C<F> G2162 = G277 * G2155;
-  const C<F> G2163 = G287 * G2153;
-  const C<F> G2164 = C1 * G2163;
-  const C<F> G2165 = G259 * G2164;
-  const C<F> G2166 = C1 * G2165;
-  const C<F> G2167 = G2162 + G2166;
-  const C<F> G2168 = G330 * G1180;
-  const C<F> G2169 = G345 * G2168;
-  const C<F> G2170 = C1 * G2169;
-  const C<F> G2171 = G302 * G2170;
-  const C<F> G2172 = G365 * G2168;
-  const C<F> G2173 = C1 * G2172;
-  const C<F> G2174 = G356 * G2173;
-  const C<F> G2175 = C1 * G2174;
-  const C<F> G2176 = G2171 + G2175;
-  const C<F> G2177 = G374 * G2170;
-  const C<F> G2178 = G384 * G2168;
-  const C<F> G2179 = C1 * G2178;
-  const C<F> G2180 = G356 * G2179;
-  const C<F> G2181 = C1 * G2180;
-  const C<F> G2182 = G2177 + G2181;
-  const C<F> G2183 = G427 * G1180;
-  const C<F> G2184 = G442 * G2183;
-  const C<F> G2185 = C1 * G2184;
-  const C<F> G2186 = G399 * G2185;
-  const C<F> G2187 = G462 * G2183;
-  const C<F> G2188 = C1 * G2187;
-  const C<F> G2189 = G453 * G2188;
-  const C<F> G2190 = C1 * G2189;
-  const C<F> G2191 = G2186 + G2190;
-  const C<F> G2192 = G471 * G2185;
-  const C<F> G2193 = G481 * G2183;
-  const C<F> G2194 = C1 * G2193;
-  const C<F> G2195 = G453 * G2194;
-  const C<F> G2196 = C1 * G2195;
-  const C<F> G2197 = G2192 + G2196;
-  const C<F> G2198 = G169 * G2153;
-  const C<F> G2199 = C1 * G2198;
-  const C<F> G2200 = G277 * G2199;
-  const C<F> G2201 = G208 * G2153;
-  const C<F> G2202 = C1 * G2201;
-  const C<F> G2203 = G259 * G2202;
-  const C<F> G2204 = C1 * G2203;
-  const C<F> G2205 = G2200 + G2204;
-  const C<F> G2206 = G138 * G2205;
-  const C<F> G2207 = G217 * G2199;
-  const C<F> G2208 = G189 * G2153;
-  const C<F> G2209 = C1 * G2208;
-  const C<F> G2210 = G259 * G2209;
-  const C<F> G2211 = C1 * G2210;
-  const C<F> G2212 = G2207 + G2211;
-  const C<F> G2213 = G198 * G2212;
-  const C<F> G2214 = C1 * G2213;
-  const C<F> G2215 = G2206 + G2214;
-  const C<F> G2216 = G217 * G2202;
-  const C<F> G2217 = G277 * G2209;
-  const C<F> G2218 = C1 * G2217;
-  const C<F> G2219 = G2216 + G2218;
-  const C<F> G2220 = G180 * G2219;
-  const C<F> G2221 = G2215 + G2220;
-  const C<F> G2222 = G1 * X54;
-  const C<F> G2223 = t * X110;
-  const C<F> G2224 = G2222 + G2223;
-  const C<F> G2225 = G35 * G1180;
-  const C<F> G2226 = G62 * G2225;
-  const C<F> G2227 = C1 * G2226;
-  const C<F> G2228 = G4 * G2227;
-  const C<F> G2229 = G98 * G2225;
-  const C<F> G2230 = C1 * G2229;
-  const C<F> G2231 = G76 * G2230;
-  const C<F> G2232 = C1 * G2231;
-  const C<F> G2233 = G2228 + G2232;
-  const C<F> G2234 = G107 * G2227;
-  const C<F> G2235 = G129 * G2225;
-  const C<F> G2236 = C1 * G2235;
-  const C<F> G2237 = G76 * G2236;
-  const C<F> G2238 = C1 * G2237;
-  const C<F> G2239 = G2234 + G2238;
-  const C<F> G2240 = G158 * G1180;
-  const C<F> G2241 = G169 * G2240;
-  const C<F> G2242 = C1 * G2241;
-  const C<F> G2243 = G138 * G2242;
-  const C<F> G2244 = G189 * G2240;
-  const C<F> G2245 = C1 * G2244;
-  const C<F> G2246 = G180 * G2245;
-  const C<F> G2247 = C1 * G2246;
-  const C<F> G2248 = G2243 + G2247;
-  const C<F> G2249 = G198 * G2242;
-  const C<F> G2250 = G208 * G2240;
-  const C<F> G2251 = C1 * G2250;
-  const C<F> G2252 = G180 * G2251;
-  const C<F> G2253 = C1 * G2252;
-  const C<F> G2254 = G2249 + G2253;
-  const C<F> G2255 = G237 * G1180;
-  const C<F> G2256 = G248 * G2255;
-  const C<F> G2257 = C1 * G2256;
-  const C<F> G2258 = G217 * G2257;
-  const C<F> G2259 = G268 * G2255;
-  const C<F> G2260 = C1 * G2259;
-  const C<F> G2261 = G259 * G2260;
-  const C<F> G2262 = C1 * G2261;
-  const C<F> G2263 = G2258 + G2262;
-  const C<F> G2264 = G277 * G2257;
-  const C<F> G2265 = G287 * G2255;
-  const C<F> G2266 = C1 * G2265;
-  const C<F> G2267 = G259 * G2266;
-  const C<F> G2268 = C1 * G2267;
-  const C<F> G2269 = G2264 + G2268;
-  const C<F> G2270 = G334 * G1180;
-  const C<F> G2271 = G345 * G2270;
-  const C<F> G2272 = C1 * G2271;
-  const C<F> G2273 = G302 * G2272;
-  const C<F> G2274 = G365 * G2270;
-  const C<F> G2275 = C1 * G2274;
-  const C<F> G2276 = G356 * G2275;
-  const C<F> G2277 = C1 * G2276;
-  const C<F> G2278 = G2273 + G2277;
-  const C<F> G2279 = G374 * G2272;
-  const C<F> G2280 = G384 * G2270;
-  const C<F> G2281 = C1 * G2280;
-  const C<F> G2282 = G356 * G2281;
-  const C<F> G2283 = C1 * G2282;
-  const C<F> G2284 = G2279 + G2283;
-  const C<F> G2285 = G431 * G1180;
-  const C<F> G2286 = G442 * G2285;
-  const C<F> G2287 = C1 * G2286;
-  const C<F> G2288 = G399 * G2287;
-  const C<F> G2289 = G462 * G2285;
-  const C<F> G2290 = C1 * G2289;
-  const C<F> G2291 = G453 * G2290;
-  const C<F> G2292 = C1 * G2291;
-  const C<F> G2293 = G2288 + G2292;
-  const C<F> G2294 = G471 * G2287;
-  const C<F> G2295 = G481 * G2285;
-  const C<F> G2296 = C1 * G2295;
-  const C<F> G2297 = G453 * G2296;
-  const C<F> G2298 = C1 * G2297;
-  const C<F> G2299 = G2294 + G2298;
-  const C<F> G2300 = G169 * G2255;
-  const C<F> G2301 = C1 * G2300;
-  const C<F> G2302 = G277 * G2301;
-  const C<F> G2303 = G208 * G2255;
-  const C<F> G2304 = C1 * G2303;
-  const C<F> G2305 = G259 * G2304;
-  const C<F> G2306 = C1 * G2305;
-  const C<F> G2307 = G2302 + G2306;
-  const C<F> G2308 = G138 * G2307;
-  const C<F> G2309 = G217 * G2301;
-  const C<F> G2310 = G189 * G2255;
-  const C<F> G2311 = C1 * G2310;
-  const C<F> G2312 = G259 * G2311;
-  const C<F> G2313 = C1 * G2312;
-  const C<F> G2314 = G2309 + G2313;
-  const C<F> G2315 = G198 * G2314;
-  const C<F> G2316 = C1 * G2315;
-  const C<F> G2317 = G2308 + G2316;
-  const C<F> G2318 = G217 * G2304;
-  const C<F> G2319 = G277 * G2311;
-  const C<F> G2320 = C1 * G2319;
-  const C<F> G2321 = G2318 + G2320;
-  const C<F> G2322 = G180 * G2321;
-  const C<F> G2323 = G2317 + G2322;
-  const C<F> G2324 = G1 * X55;
-  const C<F> G2325 = t * X111;
-  const C<F> G2326 = G2324 + G2325;
-  const C<F> G2327 = G41 * G1180;
-  const C<F> G2328 = G62 * G2327;
-  const C<F> G2329 = C1 * G2328;
-  const C<F> G2330 = G4 * G2329;
-  const C<F> G2331 = G98 * G2327;
-  const C<F> G2332 = C1 * G2331;
-  const C<F> G2333 = G76 * G2332;
-  const C<F> G2334 = C1 * G2333;
-  const C<F> G2335 = G2330 + G2334;
-  const C<F> G2336 = G107 * G2329;
-  const C<F> G2337 = G129 * G2327;
-  const C<F> G2338 = C1 * G2337;
-  const C<F> G2339 = G76 * G2338;
-  const C<F> G2340 = C1 * G2339;
-  const C<F> G2341 = G2336 + G2340;
-  const C<F> G2342 = G162 * G1180;
-  const C<F> G2343 = G169 * G2342;
-  const C<F> G2344 = C1 * G2343;
-  const C<F> G2345 = G138 * G2344;
-  const C<F> G2346 = G189 * G2342;
-  const C<F> G2347 = C1 * G2346;
-  const C<F> G2348 = G180 * G2347;
-  const C<F> G2349 = C1 * G2348;
-  const C<F> G2350 = G2345 + G2349;
-  const C<F> G2351 = G198 * G2344;
-  const C<F> G2352 = G208 * G2342;
-  const C<F> G2353 = C1 * G2352;
-  const C<F> G2354 = G180 * G2353;
-  const C<F> G2355 = C1 * G2354;
-  const C<F> G2356 = G2351 + G2355;
-  const C<F> G2357 = G241 * G1180;
-  const C<F> G2358 = G248 * G2357;
-  const C<F> G2359 = C1 * G2358;
-  const C<F> G2360 = G217 * G2359;
-  const C<F> G2361 = G268 * G2357;
-  const C<F> G2362 = C1 * G2361;
-  const C<F> G2363 = G259 * G2362;
-  const C<F> G2364 = C1 * G2363;
-  const C<F> G2365 = G2360 + G2364;
-  const C<F> G2366 = G277 * G2359;
-  const C<F> G2367 = G287 * G2357;
-  const C<F> G2368 = C1 * G2367;
-  const C<F> G2369 = G259 * G2368;
-  const C<F> G2370 = C1 * G2369;
-  const C<F> G2371 = G2366 + G2370;
-  const C<F> G2372 = G338 * G1180;
-  const C<F> G2373 = G345 * G2372;
-  const C<F> G2374 = C1 * G2373;
-  const C<F> G2375 = G302 * G2374;
-  const C<F> G2376 = G365 * G2372;
-  const C<F> G2377 = C1 * G2376;
-  const C<F> G2378 = G356 * G2377;
-  const C<F> G2379 = C1 * G2378;
-  const C<F> G2380 = G2375 + G2379;
-  const C<F> G2381 = G374 * G2374;
-  const C<F> G2382 = G384 * G2372;
-  const C<F> G2383 = C1 * G2382;
-  const C<F> G2384 = G356 * G2383;
-  const C<F> G2385 = C1 * G2384;
-  const C<F> G2386 = G2381 + G2385;
-  const C<F> G2387 = G435 * G1180;
-  const C<F> G2388 = G442 * G2387;
-  const C<F> G2389 = C1 * G2388;
-  const C<F> G2390 = G399 * G2389;
-  const C<F> G2391 = G462 * G2387;
-  const C<F> G2392 = C1 * G2391;
-  const C<F> G2393 = G453 * G2392;
-  const C<F> G2394 = C1 * G2393;
-  const C<F> G2395 = G2390 + G2394;
-  const C<F> G2396 = G471 * G2389;
-  const C<F> G2397 = G481 * G2387;
-  const C<F> G2398 = C1 * G2397;
-  const C<F> G2399 = G453 * G2398;
-  const C<F> G2400 = C1 * G2399;
-  const C<F> G2401 = G2396 + G2400;
-  const C<F> G2402 = G169 * G2357;
-  const C<F> G2403 = C1 * G2402;
-  const C<F> G2404 = G277 * G2403;
-  const C<F> G2405 = G208 * G2357;
-  const C<F> G2406 = C1 * G2405;
-  const C<F> G2407 = G259 * G2406;
-  const C<F> G2408 = C1 * G2407;
-  const C<F> G2409 = G2404 + G2408;
-  const C<F> G2410 = G138 * G2409;
-  const C<F> G2411 = G217 * G2403;
-  const C<F> G2412 = G189 * G2357;
-  const C<F> G2413 = C1 * G2412;
-  const C<F> G2414 = G259 * G2413;
-  const C<F> G2415 = C1 * G2414;
-  const C<F> G2416 = G2411 + G2415;
-  const C<F> G2417 = G198 * G2416;
-  const C<F> G2418 = C1 * G2417;
-  const C<F> G2419 = G2410 + G2418;
-  const C<F> G2420 = G217 * G2406;
-  const C<F> G2421 = G277 * G2413;
-  const C<F> G2422 = C1 * G2421;
-  const C<F> G2423 = G2420 + G2422;
-  const C<F> G2424 = G180 * G2423;
-  const C<F> G2425 = G2419 + G2424;
-  const C<F> G2426 = G1 * X56;
-  const C<F> G2427 = t * X112;
-  const C<F> G2428 = G2426 + G2427;
-  const C<F> G2429 = G7 * G14;
-  const C<F> G2430 = G1168 * G2429;
-  const C<F> G2431 = G4 * G2430;
-  const C<F> G2432 = G1212 * G2429;
-  const C<F> G2433 = G76 * G2432;
-  const C<F> G2434 = C1 * G2433;
-  const C<F> G2435 = G2431 + G2434;
-  const C<F> G2436 = G107 * G2430;
-  const C<F> G2437 = G1240 * G2429;
-  const C<F> G2438 = G76 * G2437;
-  const C<F> G2439 = C1 * G2438;
-  const C<F> G2440 = G2436 + G2439;
-  const C<F> G2441 = G141 * G14;
-  const C<F> G2442 = G1258 * G2441;
-  const C<F> G2443 = G138 * G2442;
-  const C<F> G2444 = G1279 * G2441;
-  const C<F> G2445 = G180 * G2444;
-  const C<F> G2446 = C1 * G2445;
-  const C<F> G2447 = G2443 + G2446;
-  const C<F> G2448 = G198 * G2442;
-  const C<F> G2449 = G1295 * G2441;
-  const C<F> G2450 = G180 * G2449;
-  const C<F> G2451 = C1 * G2450;
-  const C<F> G2452 = G2448 + G2451;
-  const C<F> G2453 = G220 * G14;
-  const C<F> G2454 = G1310 * G2453;
-  const C<F> G2455 = G217 * G2454;
-  const C<F> G2456 = G1331 * G2453;
-  const C<F> G2457 = G259 * G2456;
-  const C<F> G2458 = C1 * G2457;
-  const C<F> G2459 = G2455 + G2458;
-  const C<F> G2460 = G277 * G2454;
-  const C<F> G2461 = G1347 * G2453;
-  const C<F> G2462 = G259 * G2461;
-  const C<F> G2463 = C1 * G2462;
-  const C<F> G2464 = G2460 + G2463;
-  const C<F> G2465 = G311 * G14;
-  const C<F> G2466 = G1362 * G2465;
-  const C<F> G2467 = G302 * G2466;
-  const C<F> G2468 = G1383 * G2465;
-  const C<F> G2469 = G356 * G2468;
-  const C<F> G2470 = C1 * G2469;
-  const C<F> G2471 = G2467 + G2470;
-  const C<F> G2472 = G374 * G2466;
-  const C<F> G2473 = G1399 * G2465;
-  const C<F> G2474 = G356 * G2473;
-  const C<F> G2475 = C1 * G2474;
-  const C<F> G2476 = G2472 + G2475;
-  const C<F> G2477 = G408 * G14;
-  const C<F> G2478 = G1414 * G2477;
-  const C<F> G2479 = G399 * G2478;
-  const C<F> G2480 = G1435 * G2477;
-  const C<F> G2481 = G453 * G2480;
-  const C<F> G2482 = C1 * G2481;
-  const C<F> G2483 = G2479 + G2482;
-  const C<F> G2484 = G471 * G2478;
-  const C<F> G2485 = G1451 * G2477;
-  const C<F> G2486 = G453 * G2485;
-  const C<F> G2487 = C1 * G2486;
-  const C<F> G2488 = G2484 + G2487;
-  const C<F> G2489 = G1310 * G2441;
-  const C<F> G2490 = G277 * G2489;
-  const C<F> G2491 = G1347 * G2441;
-  const C<F> G2492 = G259 * G2491;
-  const C<F> G2493 = C1 * G2492;
-  const C<F> G2494 = G2490 + G2493;
-  const C<F> G2495 = G138 * G2494;
-  const C<F> G2496 = G217 * G2489;
-  const C<F> G2497 = G1331 * G2441;
-  const C<F> G2498 = G259 * G2497;
-  const C<F> G2499 = C1 * G2498;
-  const C<F> G2500 = G2496 + G2499;
-  const C<F> G2501 = G198 * G2500;
-  const C<F> G2502 = C1 * G2501;
-  const C<F> G2503 = G2495 + G2502;
-  const C<F> G2504 = G217 * G2491;
-  const C<F> G2505 = G277 * G2497;
-  const C<F> G2506 = C1 * G2505;
-  const C<F> G2507 = G2504 + G2506;
-  const C<F> G2508 = G180 * G2507;
-  const C<F> G2509 = G2503 + G2508;
-  const C<F> G2510 = G1 * X57;
-  const C<F> G2511 = t * X113;
-  const C<F> G2512 = G2510 + G2511;
-  const C<F> G2513 = G19 * G14;
-  const C<F> G2514 = G1168 * G2513;
-  const C<F> G2515 = G4 * G2514;
-  const C<F> G2516 = G1212 * G2513;
-  const C<F> G2517 = G76 * G2516;
-  const C<F> G2518 = C1 * G2517;
-  const C<F> G2519 = G2515 + G2518;
-  const C<F> G2520 = G107 * G2514;
-  const C<F> G2521 = G1240 * G2513;
-  const C<F> G2522 = G76 * G2521;
-  const C<F> G2523 = C1 * G2522;
-  const C<F> G2524 = G2520 + G2523;
-  const C<F> G2525 = G145 * G14;
-  const C<F> G2526 = G1258 * G2525;
-  const C<F> G2527 = G138 * G2526;
-  const C<F> G2528 = G1279 * G2525;
-  const C<F> G2529 = G180 * G2528;
-  const C<F> G2530 = C1 * G2529;
-  const C<F> G2531 = G2527 + G2530;
-  const C<F> G2532 = G198 * G2526;
-  const C<F> G2533 = G1295 * G2525;
-  const C<F> G2534 = G180 * G2533;
-  const C<F> G2535 = C1 * G2534;
-  const C<F> G2536 = G2532 + G2535;
-  const C<F> G2537 = G224 * G14;
-  const C<F> G2538 = G1310 * G2537;
-  const C<F> G2539 = G217 * G2538;
-  const C<F> G2540 = G1331 * G2537;
-  const C<F> G2541 = G259 * G2540;
-  const C<F> G2542 = C1 * G2541;
-  const C<F> G2543 = G2539 + G2542;
-  const C<F> G2544 = G277 * G2538;
-  const C<F> G2545 = G1347 * G2537;
-  const C<F> G2546 = G259 * G2545;
-  const C<F> G2547 = C1 * G2546;
-  const C<F> G2548 = G2544 + G2547;
-  const C<F> G2549 = G315 * G14;
-  const C<F> G2550 = G1362 * G2549;
-  const C<F> G2551 = G302 * G2550;
-  const C<F> G2552 = G1383 * G2549;
-  const C<F> G2553 = G356 * G2552;
-  const C<F> G2554 = C1 * G2553;
-  const C<F> G2555 = G2551 + G2554;
-  const C<F> G2556 = G374 * G2550;
-  const C<F> G2557 = G1399 * G2549;
-  const C<F> G2558 = G356 * G2557;
-  const C<F> G2559 = C1 * G2558;
-  const C<F> G2560 = G2556 + G2559;
-  const C<F> G2561 = G412 * G14;
-  const C<F> G2562 = G1414 * G2561;
-  const C<F> G2563 = G399 * G2562;
-  const C<F> G2564 = G1435 * G2561;
-  const C<F> G2565 = G453 * G2564;
-  const C<F> G2566 = C1 * G2565;
-  const C<F> G2567 = G2563 + G2566;
-  const C<F> G2568 = G471 * G2562;
-  const C<F> G2569 = G1451 * G2561;
-  const C<F> G2570 = G453 * G2569;
-  const C<F> G2571 = C1 * G2570;
-  const C<F> G2572 = G2568 + G2571;
-  const C<F> G2573 = G1310 * G2525;
-  const C<F> G2574 = G277 * G2573;
-  const C<F> G2575 = G1347 * G2525;
-  const C<F> G2576 = G259 * G2575;
-  const C<F> G2577 = C1 * G2576;
-  const C<F> G2578 = G2574 + G2577;
-  const C<F> G2579 = G138 * G2578;
-  const C<F> G2580 = G217 * G2573;
-  const C<F> G2581 = G1331 * G2525;
-  const C<F> G2582 = G259 * G2581;
-  const C<F> G2583 = C1 * G2582;
-  const C<F> G2584 = G2580 + G2583;
-  const C<F> G2585 = G198 * G2584;
-  const C<F> G2586 = C1 * G2585;
-  const C<F> G2587 = G2579 + G2586;
-  const C<F> G2588 = G217 * G2575;
-  const C<F> G2589 = G277 * G2581;
-  const C<F> G2590 = C1 * G2589;
-  const C<F> G2591 = G2588 + G2590;
-  const C<F> G2592 = G180 * G2591;
-  const C<F> G2593 = G2587 + G2592;
-  const C<F> G2594 = G1 * X58;
-  const C<F> G2595 = t * X114;
-  const C<F> G2596 = G2594 + G2595;
-  const C<F> G2597 = G24 * G14;
-  const C<F> G2598 = G1168 * G2597;
-  const C<F> G2599 = G4 * G2598;
-  const C<F> G2600 = G1212 * G2597;
-  const C<F> G2601 = G76 * G2600;
-  const C<F> G2602 = C1 * G2601;
-  const C<F> G2603 = G2599 + G2602;
-  const C<F> G2604 = G107 * G2598;
-  const C<F> G2605 = G1240 * G2597;
-  const C<F> G2606 = G76 * G2605;
-  const C<F> G2607 = C1 * G2606;
-  const C<F> G2608 = G2604 + G2607;
-  const C<F> G2609 = G149 * G14;
-  const C<F> G2610 = G1258 * G2609;
-  const C<F> G2611 = G138 * G2610;
-  const C<F> G2612 = G1279 * G2609;
-  const C<F> G2613 = G180 * G2612;
-  const C<F> G2614 = C1 * G2613;
-  const C<F> G2615 = G2611 + G2614;
-  const C<F> G2616 = G198 * G2610;
-  const C<F> G2617 = G1295 * G2609;
-  const C<F> G2618 = G180 * G2617;
-  const C<F> G2619 = C1 * G2618;
-  const C<F> G2620 = G2616 + G2619;
-  const C<F> G2621 = G228 * G14;
-  const C<F> G2622 = G1310 * G2621;
-  const C<F> G2623 = G217 * G2622;
-  const C<F> G2624 = G1331 * G2621;
-  const C<F> G2625 = G259 * G2624;
-  const C<F> G2626 = C1 * G2625;
-  const C<F> G2627 = G2623 + G2626;
-  const C<F> G2628 = G277 * G2622;
-  const C<F> G2629 = G1347 * G2621;
-  const C<F> G2630 = G259 * G2629;
-  const C<F> G2631 = C1 * G2630;
-  const C<F> G2632 = G2628 + G2631;
-  const C<F> G2633 = G319 * G14;
-  const C<F> G2634 = G1362 * G2633;
-  const C<F> G2635 = G302 * G2634;
-  const C<F> G2636 = G1383 * G2633;
-  const C<F> G2637 = G356 * G2636;
-  const C<F> G2638 = C1 * G2637;
-  const C<F> G2639 = G2635 + G2638;
-  const C<F> G2640 = G374 * G2634;
-  const C<F> G2641 = G1399 * G2633;
-  const C<F> G2642 = G356 * G2641;
-  const C<F> G2643 = C1 * G2642;
-  const C<F> G2644 = G2640 + G2643;
-  const C<F> G2645 = G416 * G14;
-  const C<F> G2646 = G1414 * G2645;
-  const C<F> G2647 = G399 * G2646;
-  const C<F> G2648 = G1435 * G2645;
-  const C<F> G2649 = G453 * G2648;
-  const C<F> G2650 = C1 * G2649;
-  const C<F> G2651 = G2647 + G2650;
-  const C<F> G2652 = G471 * G2646;
-  const C<F> G2653 = G1451 * G2645;
-  const C<F> G2654 = G453 * G2653;
-  const C<F> G2655 = C1 * G2654;
-  const C<F> G2656 = G2652 + G2655;
-  const C<F> G2657 = G1310 * G2609;
-  const C<F> G2658 = G277 * G2657;
-  const C<F> G2659 = G1347 * G2609;
-  const C<F> G2660 = G259 * G2659;
-  const C<F> G2661 = C1 * G2660;
-  const C<F> G2662 = G2658 + G2661;
-  const C<F> G2663 = G138 * G2662;
-  const C<F> G2664 = G217 * G2657;
-  const C<F> G2665 = G1331 * G2609;
-  const C<F> G2666 = G259 * G2665;
-  const C<F> G2667 = C1 * G2666;
-  const C<F> G2668 = G2664 + G2667;
-  const C<F> G2669 = G198 * G2668;
-  const C<F> G2670 = C1 * G2669;
-  const C<F> G2671 = G2663 + G2670;
-  const C<F> G2672 = G217 * G2659;
-  const C<F> G2673 = G277 * G2665;
-  const C<F> G2674 = C1 * G2673;
-  const C<F> G2675 = G2672 + G2674;
-  const C<F> G2676 = G180 * G2675;
-  const C<F> G2677 = G2671 + G2676;
-  const C<F> G2678 = G1 * X59;
-  const C<F> G2679 = t * X115;
-  const C<F> G2680 = G2678 + G2679;
-  const C<F> G2681 = G1168 * G27;
-  const C<F> G2682 = G62 * G1187;
-  const C<F> G2683 = C1 * G2682;
-  const C<F> G2684 = G2681 + G2683;
-  const C<F> G2685 = G4 * G2684;
-  const C<F> G2686 = G1212 * G27;
-  const C<F> G2687 = G98 * G1187;
-  const C<F> G2688 = C1 * G2687;
-  const C<F> G2689 = G2686 + G2688;
-  const C<F> G2690 = G76 * G2689;
-  const C<F> G2691 = C1 * G2690;
-  const C<F> G2692 = G2685 + G2691;
-  const C<F> G2693 = G107 * G2684;
-  const C<F> G2694 = G1240 * G27;
-  const C<F> G2695 = G129 * G1187;
-  const C<F> G2696 = C1 * G2695;
-  const C<F> G2697 = G2694 + G2696;
-  const C<F> G2698 = G76 * G2697;
-  const C<F> G2699 = C1 * G2698;
-  const C<F> G2700 = G2693 + G2699;
-  const C<F> G2701 = G1258 * G151;
-  const C<F> G2702 = G169 * G1267;
-  const C<F> G2703 = C1 * G2702;
-  const C<F> G2704 = G2701 + G2703;
-  const C<F> G2705 = G138 * G2704;
-  const C<F> G2706 = G1279 * G151;
-  const C<F> G2707 = G189 * G1267;
-  const C<F> G2708 = C1 * G2707;
-  const C<F> G2709 = G2706 + G2708;
-  const C<F> G2710 = G180 * G2709;
-  const C<F> G2711 = C1 * G2710;
-  const C<F> G2712 = G2705 + G2711;
-  const C<F> G2713 = G198 * G2704;
-  const C<F> G2714 = G1295 * G151;
-  const C<F> G2715 = G208 * G1267;
-  const C<F> G2716 = C1 * G2715;
-  const C<F> G2717 = G2714 + G2716;
-  const C<F> G2718 = G180 * G2717;
-  const C<F> G2719 = C1 * G2718;
-  const C<F> G2720 = G2713 + G2719;
-  const C<F> G2721 = G1310 * G230;
-  const C<F> G2722 = G248 * G1319;
-  const C<F> G2723 = C1 * G2722;
-  const C<F> G2724 = G2721 + G2723;
-  const C<F> G2725 = G217 * G2724;
-  const C<F> G2726 = G1331 * G230;
-  const C<F> G2727 = G268 * G1319;
-  const C<F> G2728 = C1 * G2727;
-  const C<F> G2729 = G2726 + G2728;
-  const C<F> G2730 = G259 * G2729;
-  const C<F> G2731 = C1 * G2730;
-  const C<F> G2732 = G2725 + G2731;
-  const C<F> G2733 = G277 * G2724;
-  const C<F> G2734 = G1347 * G230;
-  const C<F> G2735 = G287 * G1319;
-  const C<F> G2736 = C1 * G2735;
-  const C<F> G2737 = G2734 + G2736;
-  const C<F> G2738 = G259 * G2737;
-  const C<F> G2739 = C1 * G2738;
-  const C<F> G2740 = G2733 + G2739;
-  const C<F> G2741 = G1362 * G321;
-  const C<F> G2742 = G345 * G1371;
-  const C<F> G2743 = C1 * G2742;
-  const C<F> G2744 = G2741 + G2743;
-  const C<F> G2745 = G302 * G2744;
-  const C<F> G2746 = G1383 * G321;
-  const C<F> G2747 = G365 * G1371;
-  const C<F> G2748 = C1 * G2747;
-  const C<F> G2749 = G2746 + G2748;
-  const C<F> G2750 = G356 * G2749;
-  const C<F> G2751 = C1 * G2750;
-  const C<F> G2752 = G2745 + G2751;
-  const C<F> G2753 = G374 * G2744;
-  const C<F> G2754 = G1399 * G321;
-  const C<F> G2755 = G384 * G1371;
-  const C<F> G2756 = C1 * G2755;
-  const C<F> G2757 = G2754 + G2756;
-  const C<F> G2758 = G356 * G2757;
-  const C<F> G2759 = C1 * G2758;
-  const C<F> G2760 = G2753 + G2759;
-  const C<F> G2761 = G1414 * G418;
-  const C<F> G2762 = G442 * G1423;
-  const C<F> G2763 = C1 * G2762;
-  const C<F> G2764 = G2761 + G2763;
-  const C<F> G2765 = G399 * G2764;
-  const C<F> G2766 = G1435 * G418;
-  const C<F> G2767 = G462 * G1423;
-  const C<F> G2768 = C1 * G2767;
-  const C<F> G2769 = G2766 + G2768;
-  const C<F> G2770 = G453 * G2769;
-  const C<F> G2771 = C1 * G2770;
-  const C<F> G2772 = G2765 + G2771;
-  const C<F> G2773 = G471 * G2764;
-  const C<F> G2774 = G1451 * G418;
-  const C<F> G2775 = G481 * G1423;
-  const C<F> G2776 = C1 * G2775;
-  const C<F> G2777 = G2774 + G2776;
-  const C<F> G2778 = G453 * G2777;
-  const C<F> G2779 = C1 * G2778;
-  const C<F> G2780 = G2773 + G2779;
-  const C<F> G2781 = G1310 * G151;
-  const C<F> G2782 = G169 * G1319;
-  const C<F> G2783 = C1 * G2782;
-  const C<F> G2784 = G2781 + G2783;
-  const C<F> G2785 = G277 * G2784;
-  const C<F> G2786 = G1347 * G151;
-  const C<F> G2787 = G208 * G1319;
-  const C<F> G2788 = C1 * G2787;
-  const C<F> G2789 = G2786 + G2788;
-  const C<F> G2790 = G259 * G2789;
-  const C<F> G2791 = C1 * G2790;
-  const C<F> G2792 = G2785 + G2791;
-  const C<F> G2793 = G138 * G2792;
-  const C<F> G2794 = G217 * G2784;
-  const C<F> G2795 = G1331 * G151;
-  const C<F> G2796 = G189 * G1319;
-  const C<F> G2797 = C1 * G2796;
-  const C<F> G2798 = G2795 + G2797;
-  const C<F> G2799 = G259 * G2798;
-  const C<F> G2800 = C1 * G2799;
-  const C<F> G2801 = G2794 + G2800;
-  const C<F> G2802 = G198 * G2801;
-  const C<F> G2803 = C1 * G2802;
-  const C<F> G2804 = G2793 + G2803;
-  const C<F> G2805 = G217 * G2789;
-  const C<F> G2806 = G277 * G2798;
-  const C<F> G2807 = C1 * G2806;
-  const C<F> G2808 = G2805 + G2807;
-  const C<F> G2809 = G180 * G2808;
-  const C<F> G2810 = G2804 + G2809;
-  const C<F> G2811 = G2224 * X8;
-  const C<F> G2812 = G2326 * X9;
-  const C<F> G2813 = G2428 * X10;
-  const C<F> G2814 = G2512 * X11;
-  const C<F> G2815 = G2596 * X12;
-  const C<F> G2816 = G2680 * X13;
-  const C<F> G2817 = G1 * X60;
-  const C<F> G2818 = t * X116;
-  const C<F> G2819 = G2817 + G2818;
-  const C<F> G2820 = G2811 + G2812 + G2813 + G2814 + G2815 + G2816 + G2819;
-  const C<F> G2821 = G520 * X0;
-  const C<F> G2822 = G736 * X1;
-  const C<F> G2823 = G944 * X2;
-  const C<F> G2824 = G1147 * X3;
-  const C<F> G2825 = G1 * X65;
-  const C<F> G2826 = t * X121;
-  const C<F> G2827 = G2825 + G2826;
-  const C<F> G2828 = G2821 + G2822 + G2823 + G2824 + G2827;
-  const C<F> G2829 = G1495 * X4;
-  const C<F> G2830 = G1711 * X5;
-  const C<F> G2831 = G1919 * X6;
-  const C<F> G2832 = G2122 * X7;
-  const C<F> G2833 = G1 * X70;
-  const C<F> G2834 = t * X126;
-  const C<F> G2835 = G2833 + G2834;
-  const C<F> G2836 = G2829 + G2830 + G2831 + G2832 + G2835;
-//  y[0] = G104;
-//  y[1] = G135;
-//  y[2] = G195;
-//  y[3] = G214;
-//  y[4] = G274;
-//  y[5] = G293;
-//  y[6] = G371;
-//  y[7] = G390;
-//  y[8] = G468;
-//  y[9] = G487;
-//  y[10] = G517;
-//  y[12] = G520;
-//  y[14] = G551;
-//  y[15] = G563;
-//  y[16] = G587;
-//  y[17] = G598;
-//  y[18] = G622;
-//  y[19] = G633;
-//  y[20] = G657;
-//  y[21] = G668;
-//  y[22] = G692;
-//  y[23] = G703;
-//  y[24] = G733;
-//  y[26] = G736;
-//  y[28] = G764;
-//  y[29] = G775;
-//  y[30] = G798;
-//  y[31] = G809;
-//  y[32] = G832;
-//  y[33] = G843;
-//  y[34] = G866;
-//  y[35] = G877;
-//  y[36] = G900;
-//  y[37] = G911;
-//  y[38] = G941;
-//  y[40] = G944;
-//  y[42] = G970;
-//  y[43] = G982;
-//  y[44] = G1003;
-//  y[45] = G1015;
-//  y[46] = G1036;
-//  y[47] = G1048;
-//  y[48] = G1069;
-//  y[49] = G1081;
-//  y[50] = G1102;
-//  y[51] = G1114;
-//  y[52] = G1144;
-//  y[54] = G1147;
-//  y[56] = G1226;
-//  y[57] = G1254;
-//  y[58] = G1290;
-//  y[59] = G1306;
-//  y[60] = G1342;
-//  y[61] = G1358;
-//  y[62] = G1394;
-//  y[63] = G1410;
-//  y[64] = G1446;
-//  y[65] = G1462;
-//  y[66] = G1492;
-//  y[69] = G1495;
-//  y[70] = G1526;
-//  y[71] = G1538;
-//  y[72] = G1562;
-//  y[73] = G1573;
-//  y[74] = G1597;
-//  y[75] = G1608;
-//  y[76] = G1632;
-//  y[77] = G1643;
-//  y[78] = G1667;
-//  y[79] = G1678;
-//  y[80] = G1708;
-//  y[83] = G1711;
-//  y[84] = G1739;
-//  y[85] = G1750;
-//  y[86] = G1773;
-//  y[87] = G1784;
-//  y[88] = G1807;
-//  y[89] = G1818;
-//  y[90] = G1841;
-//  y[91] = G1852;
-//  y[92] = G1875;
-//  y[93] = G1886;
-//  y[94] = G1916;
-//  y[97] = G1919;
-//  y[98] = G1945;
-//  y[99] = G1957;
-//  y[100] = G1978;
-//  y[101] = G1990;
-//  y[102] = G2011;
-//  y[103] = G2023;
-//  y[104] = G2044;
-//  y[105] = G2056;
-//  y[106] = G2077;
-//  y[107] = G2089;
-//  y[108] = G2119;
-//  y[111] = G2122;
-//  y[112] = G2131;
-//  y[113] = G2137;
-//  y[114] = G2146;
-//  y[115] = G2152;
-//  y[116] = G2161;
-//  y[117] = G2167;
-//  y[118] = G2176;
-//  y[119] = G2182;
-//  y[120] = G2191;
-//  y[121] = G2197;
-//  y[122] = G2221;
-//  y[123] = G2224;
-//  y[126] = G2233;
-//  y[127] = G2239;
-//  y[128] = G2248;
-//  y[129] = G2254;
-//  y[130] = G2263;
-//  y[131] = G2269;
-//  y[132] = G2278;
-//  y[133] = G2284;
-//  y[134] = G2293;
-//  y[135] = G2299;
-//  y[136] = G2323;
-//  y[137] = G2326;
-//  y[140] = G2335;
-//  y[141] = G2341;
-//  y[142] = G2350;
-//  y[143] = G2356;
-//  y[144] = G2365;
-//  y[145] = G2371;
-//  y[146] = G2380;
-//  y[147] = G2386;
-//  y[148] = G2395;
-//  y[149] = G2401;
-//  y[150] = G2425;
-//  y[151] = G2428;
-//  y[154] = G2435;
-//  y[155] = G2440;
-//  y[156] = G2447;
-//  y[157] = G2452;
-//  y[158] = G2459;
-//  y[159] = G2464;
-//  y[160] = G2471;
-//  y[161] = G2476;
-//  y[162] = G2483;
-//  y[163] = G2488;
-//  y[164] = G2509;
-//  y[165] = G2512;
-//  y[168] = G2519;
-//  y[169] = G2524;
-//  y[170] = G2531;
-//  y[171] = G2536;
-//  y[172] = G2543;
-//  y[173] = G2548;
-//  y[174] = G2555;
-//  y[175] = G2560;
-//  y[176] = G2567;
-//  y[177] = G2572;
-//  y[178] = G2593;
-//  y[179] = G2596;
-//  y[182] = G2603;
-//  y[183] = G2608;
-//  y[184] = G2615;
-//  y[185] = G2620;
-//  y[186] = G2627;
-//  y[187] = G2632;
-//  y[188] = G2639;
-//  y[189] = G2644;
-//  y[190] = G2651;
-//  y[191] = G2656;
-//  y[192] = G2677;
-//  y[193] = G2680;
-//  y[196] = -G2692;
-//  y[197] = -G2700;
-//  y[198] = -G2712;
-//  y[199] = -G2720;
-//  y[200] = -G2732;
-//  y[201] = -G2740;
-//  y[202] = -G2752;
-//  y[203] = -G2760;
-//  y[204] = -G2772;
-//  y[205] = -G2780;
-//  y[206] = -G2810;
-//  y[207] = -G2820;
-//  y[208] = -G2828;
-//  y[209] = -G2836;
-//  ;
-//
-
-//  y[26] = G736;
-//  y[40] = G944;
-//  y[54] = G1147;
-//  y[69] = G1495;
-//  y[83] = G1711;
-//  y[97] = G1919;
-//  y[111] = G2122;
-//  y[123] = G2224;
-//  y[137] = G2326;
-//  y[151] = G2428;
-//  y[165] = G2512;
-//  y[179] = G2596;
-//  y[193] = G2680;
-//  y[207] = -G2820;
-//  y[208] = -G2828;
-//  y[209] = -G2836;
-
-  yc[0 ] =  G736;
-  yc[1 ] =  G944;
-  yc[2 ] =  G1147;
-  yc[3 ] =  G1495;
-  yc[4 ] =  G1711;
-  yc[5 ] =  G1919;
-  yc[6 ] =  G2122;
-  yc[7 ] =  G2224;
-  yc[8 ] =  G2326;
-  yc[9 ] =  G2428;
-//  yc[13] = -G2820;
-//  yc[14] = -G2828;
-//  yc[15] = -G2836;
-#endif
-}
-
-// Evaluates Hx and H at the same time, reusing expressions.
-// 
-// Map from a multivariate poly with x 127-dimensional to y NVExNVEPLUS1 dimensional
-// Where 127 = 14 for x, 1 for t, 2*56 total parameters. Returns where y = [Hx|H]
-// 
-// cCode(PH.GateHomotopy#"Hx"|PH.GateHomotopy#"H",gateMatrix{cameraVars})
-// (Ask Tim for the way to use cCode so that the input orders are like this.
-template <typename F>
-inline __attribute__((always_inline)) void 
-eval<chicago14a, F>::
-HxH_constants_all_sols(const C<F>* __restrict ux /*x and t*/, const C<F> * __restrict uparams, C<F>* __restrict uy /*HxH*/) 
-{
-#if 0
-  const C<F> *params = reinterpret_cast<C<F> *> (__builtin_assume_aligned(uparams,64));
-  const C<F> *x = reinterpret_cast<C<F> *> (__builtin_assume_aligned(ux,64));
-  C<F> *yc = reinterpret_cast<C<F> *> (__builtin_assume_aligned(uy,64));
-
-  const C<F> &X0 = x[0];    // q0
-  const C<F> &X1 = x[1];    // q1
-  const C<F> &X2 = x[2];    // q2
-  const C<F> &X3 = x[3];    // q3
-  const C<F> &X4 = x[4];    // q0
-  const C<F> &X5 = x[5];    // q1
-  const C<F> &X6 = x[6];    // q2
-  const C<F> &X7 = x[7];    // q3
-  const C<F> &X8 = x[8];    // transl
-  const C<F> &X9 = x[9];    // transl
-  const C<F> &X10 = x[10];  // transl
-  const C<F> &X11 = x[11];  // transl
-  const C<F> &X12 = x[12];  // transl
-  const C<F> &X13 = x[13];  // transl
-  const F &t = (F &) ux[14];
-  
-  const C<F> &X15 =  params[0];
-  const C<F> &X16 =  params[1];
-  const C<F> &X17 =  params[2];
-  const C<F> &X18 =  params[3];
-  const C<F> &X19 =  params[4];
-  const C<F> &X20 =  params[5];
-  const C<F> &X21 =  params[6];
-  const C<F> &X22 =  params[7];
-  const C<F> &X23 =  params[8];
-  const C<F> &X24 =  params[9];
-  const C<F> &X25 =  params[10];
-  const C<F> &X26 =  params[11];
-  const C<F> &X27 =  params[12];
-  const C<F> &X28 =  params[13];
-  const C<F> &X29 =  params[14];
-  const C<F> &X30 =  params[15];
-  const C<F> &X31 =  params[16];
-  const C<F> &X32 =  params[17];
-  const C<F> &X33 =  params[18];
-  const C<F> &X34 =  params[19];
-  const C<F> &X35 =  params[20];
-  const C<F> &X36 =  params[21];
-  const C<F> &X37 =  params[22];
-  const C<F> &X38 =  params[23];
-  const C<F> &X39 =  params[24];
-  const C<F> &X40 =  params[25];
-  const C<F> &X41 =  params[26];
-  const C<F> &X42 =  params[27];
-  const C<F> &X43 =  params[28];
-  const C<F> &X44 =  params[29];
-  const C<F> &X45 =  params[30];
-  const C<F> &X46 =  params[31];
-  const C<F> &X47 =  params[32];
-  const C<F> &X48 =  params[33];
-  const C<F> &X49 =  params[34];
-  const C<F> &X50 =  params[35];
-  const C<F> &X51 =  params[36];
-  const C<F> &X52 =  params[37];
-  const C<F> &X53 =  params[38];
-  const C<F> &X54 =  params[39];
-  const C<F> &X55 =  params[40];
-  const C<F> &X56 =  params[41];
-  const C<F> &X57 =  params[42];
-  const C<F> &X58 =  params[43];
-  const C<F> &X59 =  params[44];
-  const C<F> &X60 =  params[45];
-  const C<F> &X61 =  params[46];
-  const C<F> &X62 =  params[47];
-  const C<F> &X63 =  params[48];
-  const C<F> &X64 =  params[49];
-  const C<F> &X65 =  params[50];
-  const C<F> &X66 =  params[51];
-  const C<F> &X67 =  params[52];
-  const C<F> &X68 =  params[53];
-  const C<F> &X69 =  params[54];
-  const C<F> &X70 =  params[55];
-  const C<F> &X71 =  params[56];
-  const C<F> &X72 =  params[57];
-  const C<F> &X73 =  params[58];
-  const C<F> &X74 =  params[59];
-  const C<F> &X75 =  params[60];
-  const C<F> &X76 =  params[61];
-  const C<F> &X77 =  params[62];
-  const C<F> &X78 =  params[63];
-  const C<F> &X79 =  params[64];
-  const C<F> &X80 =  params[65];
-  const C<F> &X81 =  params[66];
-  const C<F> &X82 =  params[67];
-  const C<F> &X83 =  params[68];
-  const C<F> &X84 =  params[69];
-  const C<F> &X85 =  params[70];
-  const C<F> &X86 =  params[71];
-  const C<F> &X87 =  params[72];
-  const C<F> &X88 =  params[73];
-  const C<F> &X89 =  params[74];
-  const C<F> &X90 =  params[75];
-  const C<F> &X91 =  params[76];
-  const C<F> &X92 =  params[77];
-  const C<F> &X93 =  params[78];
-  const C<F> &X94 =  params[79];
-  const C<F> &X95 =  params[80];
-  const C<F> &X96 =  params[81];
-  const C<F> &X97 =  params[82];
-  const C<F> &X98 =  params[83];
-  const C<F> &X99 =  params[84];
-  const C<F> &X100 = params[85];
-  const C<F> &X101 = params[86];
-  const C<F> &X102 = params[87];
-  const C<F> &X103 = params[88];
-  const C<F> &X104 = params[89];
-  const C<F> &X105 = params[90];
-  const C<F> &X106 = params[91];
-  const C<F> &X107 = params[92];
-  const C<F> &X108 = params[93];
-  const C<F> &X109 = params[94];
-  const C<F> &X110 = params[95];
-  const C<F> &X111 = params[96];
-  const C<F> &X112 = params[97];
-  const C<F> &X113 = params[98];
-  const C<F> &X114 = params[99];
-  const C<F> &X115 = params[100];
-  const C<F> &X116 = params[101];
-  const C<F> &X117 = params[102];
-  const C<F> &X118 = params[103];
-  const C<F> &X119 = params[104];
-  const C<F> &X120 = params[105];
-  const C<F> &X121 = params[106];
-  const C<F> &X122 = params[107];
-  const C<F> &X123 = params[108];
-  const C<F> &X124 = params[109];
-  const C<F> &X125 = params[110];
-  const C<F> &X126 = params[111];
-  
-  static constexpr F C0 = 1.;
-  static constexpr F C1 = -1.;
-  static constexpr F C2 = 2.;
-//  static constexpr F C3 = 0.;
-  const C<F> G0  = C1 * t;
-  const C<F> G1  = C0 + G0;
-  const C<F> G2  = G1 * X15;
-  const C<F> G3  = t * X71;
-  const C<F> G4  = G2 + G3;
-  const C<F> G5  = G1 * X21;
-  const C<F> G6  = t * X77;
-  const C<F> G7  = G5 + G6;
-  const C<F> G8  = X4 * X4;
-  const C<F> G9  = X5 * X5;
-  const C<F> G10 = G8 + G9;
-  const C<F> G11 = X6 * X6;
-  const C<F> G12 = G10 + G11;
-  const C<F> G13 = X7 * X7;
-  const C<F> G14 = G12 + G13;
-  const C<F> G15 = G14 * X11;
-  const C<F> G16 = G7 * G15;
-  const C<F> G17 = G1 * X22;
-  const C<F> G18 = t * X78;
-  const C<F> G19 = G17 + G18;
-  const C<F> G20 = G14 * X12;
-  const C<F> G21 = G19 * G20;
-  const C<F> G22 = G1 * X23;
-  const C<F> G23 = t * X79;
-  const C<F> G24 = G22 + G23;
-  const C<F> G25 = G14 * X13;
-  const C<F> G26 = G24 * G25;
-  const C<F> G27 = G16 + G21 + G26;
-  const C<F> G28 = G1 * X18;
-  const C<F> G29 = t * X74;
-  const C<F> G30 = G28 + G29;
-  const C<F> G31 = C2 * X2;
-  const C<F> G32 = G30 * G31;
-  const C<F> G33 = G1 * X19;
-  const C<F> G34 = t * X75;
-  const C<F> G35 = G33 + G34;
-  const C<F> G36 = C1 * X1;
-  const C<F> G37 = C2 * G36;
-  const C<F> G38 = G35 * G37;
-  const C<F> G39 = G1 * X20;
-  const C<F> G40 = t * X76;
-  const C<F> G41 = G39 + G40;
-  const C<F> G42 = X0 + X0;
-  const C<F> G43 = G41 * G42;
-  const C<F> G44 = G32 + G38 + G43;
-  const C<F> G45 = G27 * G44;
-  const C<F> G46 = X5 * X7;
-  const C<F> G47 = X4 * X6;
-  const C<F> G48 = G46 + G47;
-  const C<F> G49 = C2 * G48;
-  const C<F> G50 = G7 * G49;
-  const C<F> G51 = X6 * X7;
-  const C<F> G52 = X4 * X5;
-  const C<F> G53 = C1 * G52;
-  const C<F> G54 = G51 + G53;
-  const C<F> G55 = C2 * G54;
-  const C<F> G56 = G19 * G55;
-  const C<F> G57 = G8 + G13;
-  const C<F> G58 = G9 + G11;
-  const C<F> G59 = C1 * G58;
-  const C<F> G60 = G57 + G59;
-  const C<F> G61 = G24 * G60;
-  const C<F> G62 = G50 + G56 + G61;
-  const C<F> G63 = X8 * G42;
-  const C<F> G64 = G30 * G63;
-  const C<F> G65 = X9 * G42;
-  const C<F> G66 = G35 * G65;
-  const C<F> G67 = X10 * G42;
-  const C<F> G68 = G41 * G67;
-  const C<F> G69 = G64 + G66 + G68;
-  const C<F> G70 = G62 * G69;
-  const C<F> G71 = C1 * G70;
-  const C<F> G72 = G45 + G71;
-  const C<F> G73 = G4 * G72;
-  const C<F> G74 = G1 * X17;
-  const C<F> G75 = t * X73;
-  const C<F> G76 = G74 + G75;
-  const C<F> G77 = G30 * G42;
-  const C<F> G78 = C2 * X3;
-  const C<F> G79 = G35 * G78;
-  const C<F> G80 = C1 * X2;
-  const C<F> G81 = C2 * G80;
-  const C<F> G82 = G41 * G81;
-  const C<F> G83 = G77 + G79 + G82;
-  const C<F> G84 = G27 * G83;
-  const C<F> G85 = G11 + G13;
-  const C<F> G86 = C1 * G85;
-  const C<F> G87 = G10 + G86;
-  const C<F> G88 = G7 * G87;
-  const C<F> G89 = X5 * X6;
-  const C<F> G90 = X4 * X7;
-  const C<F> G91 = G89 + G90;
-  const C<F> G92 = C2 * G91;
-  const C<F> G93 = G19 * G92;
-  const C<F> G94 = C1 * G47;
-  const C<F> G95 = G46 + G94;
-  const C<F> G96 = C2 * G95;
-  const C<F> G97 = G24 * G96;
-  const C<F> G98 = G88 + G93 + G97;
-  const C<F> G99 = G98 * G69;
-  const C<F> G100 = C1 * G99;
-  const C<F> G101 = G84 + G100;
-  const C<F> G102 = G76 * G101;
-  const C<F> G103 = C1 * G102;
-  const C<F> G104 = G73 + G103;
-  const C<F> G105 = G1 * X16;
-  const C<F> G106 = t * X72;
-  const C<F> G107 = G105 + G106;
-  const C<F> G108 = G107 * G72;
-  const C<F> G109 = C1 * X3;
-  const C<F> G110 = C2 * G109;
-  const C<F> G111 = G30 * G110;
-  const C<F> G112 = G35 * G42;
-  const C<F> G113 = C2 * X1;
-  const C<F> G114 = G41 * G113;
-  const C<F> G115 = G111 + G112 + G114;
-  const C<F> G116 = G27 * G115;
-  const C<F> G117 = C1 * G90;
-  const C<F> G118 = G89 + G117;
-  const C<F> G119 = C2 * G118;
-  const C<F> G120 = G7 * G119;
-  const C<F> G121 = G8 + G11;
-  const C<F> G122 = G9 + G13;
-  const C<F> G123 = C1 * G122;
-  const C<F> G124 = G121 + G123;
-  const C<F> G125 = G19 * G124;
-  const C<F> G126 = G51 + G52;
-  const C<F> G127 = C2 * G126;
-  const C<F> G128 = G24 * G127;
-  const C<F> G129 = G120 + G125 + G128;
-  const C<F> G130 = G129 * G69;
-  const C<F> G131 = C1 * G130;
-  const C<F> G132 = G116 + G131;
-  const C<F> G133 = G76 * G132;
-  const C<F> G134 = C1 * G133;
-  const C<F> G135 = G108 + G134;
-  const C<F> G136 = G1 * X24;
-  const C<F> G137 = t * X80;
-  const C<F> G138 = G136 + G137;
-  const C<F> G139 = G1 * X30;
-  const C<F> G140 = t * X86;
-  const C<F> G141 = G139 + G140;
-  const C<F> G142 = G141 * G15;
-  const C<F> G143 = G1 * X31;
-  const C<F> G144 = t * X87;
-  const C<F> G145 = G143 + G144;
-  const C<F> G146 = G145 * G20;
-  const C<F> G147 = G1 * X32;
-  const C<F> G148 = t * X88;
-  const C<F> G149 = G147 + G148;
-  const C<F> G150 = G149 * G25;
-  const C<F> G151 = G142 + G146 + G150;
-  const C<F> G152 = G1 * X27;
-  const C<F> G153 = t * X83;
-  const C<F> G154 = G152 + G153;
-  const C<F> G155 = G154 * G31;
-  const C<F> G156 = G1 * X28;
-  const C<F> G157 = t * X84;
-  const C<F> G158 = G156 + G157;
-  const C<F> G159 = G158 * G37;
-  const C<F> G160 = G1 * X29;
-  const C<F> G161 = t * X85;
-  const C<F> G162 = G160 + G161;
-  const C<F> G163 = G162 * G42;
-  const C<F> G164 = G155 + G159 + G163;
-  const C<F> G165 = G151 * G164;
-  const C<F> G166 = G141 * G49;
-  const C<F> G167 = G145 * G55;
-  const C<F> G168 = G149 * G60;
-  const C<F> G169 = G166 + G167 + G168;
-  const C<F> G170 = G154 * G63;
-  const C<F> G171 = G158 * G65;
-  const C<F> G172 = G162 * G67;
-  const C<F> G173 = G170 + G171 + G172;
-  const C<F> G174 = G169 * G173;
-  const C<F> G175 = C1 * G174;
-  const C<F> G176 = G165 + G175;
-  const C<F> G177 = G138 * G176;
-  const C<F> G178 = G1 * X26;
-  const C<F> G179 = t * X82;
-  const C<F> G180 = G178 + G179;
-  const C<F> G181 = G154 * G42;
-  const C<F> G182 = G158 * G78;
-  const C<F> G183 = G162 * G81;
-  const C<F> G184 = G181 + G182 + G183;
-  const C<F> G185 = G151 * G184;
-  const C<F> G186 = G141 * G87;
-  const C<F> G187 = G145 * G92;
-  const C<F> G188 = G149 * G96;
-  const C<F> G189 = G186 + G187 + G188;
-  const C<F> G190 = G189 * G173;
-  const C<F> G191 = C1 * G190;
-  const C<F> G192 = G185 + G191;
-  const C<F> G193 = G180 * G192;
-  const C<F> G194 = C1 * G193;
-  const C<F> G195 = G177 + G194;
-  const C<F> G196 = G1 * X25;
-  const C<F> G197 = t * X81;
-  const C<F> G198 = G196 + G197;
-  const C<F> G199 = G198 * G176;
-  const C<F> G200 = G154 * G110;
-  const C<F> G201 = G158 * G42;
-  const C<F> G202 = G162 * G113;
-  const C<F> G203 = G200 + G201 + G202;
-  const C<F> G204 = G151 * G203;
-  const C<F> G205 = G141 * G119;
-  const C<F> G206 = G145 * G124;
-  const C<F> G207 = G149 * G127;
-  const C<F> G208 = G205 + G206 + G207;
-  const C<F> G209 = G208 * G173;
-  const C<F> G210 = C1 * G209;
-  const C<F> G211 = G204 + G210;
-  const C<F> G212 = G180 * G211;
-  const C<F> G213 = C1 * G212;
-  const C<F> G214 = G199 + G213;
-  const C<F> G215 = G1 * X33;
-  const C<F> G216 = t * X89;
-  const C<F> G217 = G215 + G216;
-  const C<F> G218 = G1 * X39;
-  const C<F> G219 = t * X95;
-  const C<F> G220 = G218 + G219;
-  const C<F> G221 = G220 * G15;
-  const C<F> G222 = G1 * X40;
-  const C<F> G223 = t * X96;
-  const C<F> G224 = G222 + G223;
-  const C<F> G225 = G224 * G20;
-  const C<F> G226 = G1 * X41;
-  const C<F> G227 = t * X97;
-  const C<F> G228 = G226 + G227;
-  const C<F> G229 = G228 * G25;
-  const C<F> G230 = G221 + G225 + G229;
-  const C<F> G231 = G1 * X36;
-  const C<F> G232 = t * X92;
-  const C<F> G233 = G231 + G232;
-  const C<F> G234 = G233 * G31;
-  const C<F> G235 = G1 * X37;
-  const C<F> G236 = t * X93;
-  const C<F> G237 = G235 + G236;
-  const C<F> G238 = G237 * G37;
-  const C<F> G239 = G1 * X38;
-  const C<F> G240 = t * X94;
-  const C<F> G241 = G239 + G240;
-  const C<F> G242 = G241 * G42;
-  const C<F> G243 = G234 + G238 + G242;
-  const C<F> G244 = G230 * G243;
-  const C<F> G245 = G220 * G49;
-  const C<F> G246 = G224 * G55;
-  const C<F> G247 = G228 * G60;
-  const C<F> G248 = G245 + G246 + G247;
-  const C<F> G249 = G233 * G63;
-  const C<F> G250 = G237 * G65;
-  const C<F> G251 = G241 * G67;
-  const C<F> G252 = G249 + G250 + G251;
-  const C<F> G253 = G248 * G252;
-  const C<F> G254 = C1 * G253;
-  const C<F> G255 = G244 + G254;
-  const C<F> G256 = G217 * G255;
-  const C<F> G257 = G1 * X35;
-  const C<F> G258 = t * X91;
-  const C<F> G259 = G257 + G258;
-  const C<F> G260 = G233 * G42;
-  const C<F> G261 = G237 * G78;
-  const C<F> G262 = G241 * G81;
-  const C<F> G263 = G260 + G261 + G262;
-  const C<F> G264 = G230 * G263;
-  const C<F> G265 = G220 * G87;
-  const C<F> G266 = G224 * G92;
-  const C<F> G267 = G228 * G96;
-  const C<F> G268 = G265 + G266 + G267;
-  const C<F> G269 = G268 * G252;
-  const C<F> G270 = C1 * G269;
-  const C<F> G271 = G264 + G270;
-  const C<F> G272 = G259 * G271;
-  const C<F> G273 = C1 * G272;
-  const C<F> G274 = G256 + G273;
-  const C<F> G275 = G1 * X34;
-  const C<F> G276 = t * X90;
-  const C<F> G277 = G275 + G276;
-  const C<F> G278 = G277 * G255;
-  const C<F> G279 = G233 * G110;
-  const C<F> G280 = G237 * G42;
-  const C<F> G281 = G241 * G113;
-  const C<F> G282 = G279 + G280 + G281;
-  const C<F> G283 = G230 * G282;
-  const C<F> G284 = G220 * G119;
-  const C<F> G285 = G224 * G124;
-  const C<F> G286 = G228 * G127;
-  const C<F> G287 = G284 + G285 + G286;
-  const C<F> G288 = G287 * G252;
-  const C<F> G289 = C1 * G288;
-  const C<F> G290 = G283 + G289;
-  const C<F> G291 = G259 * G290;
-  const C<F> G292 = C1 * G291;
-  const C<F> G293 = G278 + G292;
-  const C<F> G294 = G1 * X42;
-  const C<F> G295 = t * X98;
-  const C<F> G296 = G294 + G295;
-  const C<F> G297 = G296 * G4;
-  const C<F> G298 = G1 * X43;
-  const C<F> G299 = t * X99;
-  const C<F> G300 = G298 + G299;
-  const C<F> G301 = G300 * G138;
-  const C<F> G302 = G297 + G301;
-  const C<F> G303 = G1 * X46;
-  const C<F> G304 = t * X102;
-  const C<F> G305 = G303 + G304;
-  const C<F> G306 = G305 * G7;
-  const C<F> G307 = G1 * X47;
-  const C<F> G308 = t * X103;
-  const C<F> G309 = G307 + G308;
-  const C<F> G310 = G309 * G141;
-  const C<F> G311 = G306 + G310;
-  const C<F> G312 = G311 * G15;
-  const C<F> G313 = G305 * G19;
-  const C<F> G314 = G309 * G145;
-  const C<F> G315 = G313 + G314;
-  const C<F> G316 = G315 * G20;
-  const C<F> G317 = G305 * G24;
-  const C<F> G318 = G309 * G149;
-  const C<F> G319 = G317 + G318;
-  const C<F> G320 = G319 * G25;
-  const C<F> G321 = G312 + G316 + G320;
-  const C<F> G322 = G1 * X44;
-  const C<F> G323 = t * X100;
-  const C<F> G324 = G322 + G323;
-  const C<F> G325 = G324 * G30;
-  const C<F> G326 = G1 * X45;
-  const C<F> G327 = t * X101;
-  const C<F> G328 = G326 + G327;
-  const C<F> G329 = G328 * G154;
-  const C<F> G330 = G325 + G329;
-  const C<F> G331 = G330 * G31;
-  const C<F> G332 = G324 * G35;
-  const C<F> G333 = G328 * G158;
-  const C<F> G334 = G332 + G333;
-  const C<F> G335 = G334 * G37;
-  const C<F> G336 = G324 * G41;
-  const C<F> G337 = G328 * G162;
-  const C<F> G338 = G336 + G337;
-  const C<F> G339 = G338 * G42;
-  const C<F> G340 = G331 + G335 + G339;
-  const C<F> G341 = G321 * G340;
-  const C<F> G342 = G311 * G49;
-  const C<F> G343 = G315 * G55;
-  const C<F> G344 = G319 * G60;
-  const C<F> G345 = G342 + G343 + G344;
-  const C<F> G346 = G330 * G63;
-  const C<F> G347 = G334 * G65;
-  const C<F> G348 = G338 * G67;
-  const C<F> G349 = G346 + G347 + G348;
-  const C<F> G350 = G345 * G349;
-  const C<F> G351 = C1 * G350;
-  const C<F> G352 = G341 + G351;
-  const C<F> G353 = G302 * G352;
-  const C<F> G354 = G296 * G76;
-  const C<F> G355 = G300 * G180;
-  const C<F> G356 = G354 + G355;
-  const C<F> G357 = G330 * G42;
-  const C<F> G358 = G334 * G78;
-  const C<F> G359 = G338 * G81;
-  const C<F> G360 = G357 + G358 + G359;
-  const C<F> G361 = G321 * G360;
-  const C<F> G362 = G311 * G87;
-  const C<F> G363 = G315 * G92;
-  const C<F> G364 = G319 * G96;
-  const C<F> G365 = G362 + G363 + G364;
-  const C<F> G366 = G365 * G349;
-  const C<F> G367 = C1 * G366;
-  const C<F> G368 = G361 + G367;
-  const C<F> G369 = G356 * G368;
-  const C<F> G370 = C1 * G369;
-  const C<F> G371 = G353 + G370;
-  const C<F> G372 = G296 * G107;
-  const C<F> G373 = G300 * G198;
-  const C<F> G374 = G372 + G373;
-  const C<F> G375 = G374 * G352;
-  const C<F> G376 = G330 * G110;
-  const C<F> G377 = G334 * G42;
-  const C<F> G378 = G338 * G113;
-  const C<F> G379 = G376 + G377 + G378;
-  const C<F> G380 = G321 * G379;
-  const C<F> G381 = G311 * G119;
-  const C<F> G382 = G315 * G124;
-  const C<F> G383 = G319 * G127;
-  const C<F> G384 = G381 + G382 + G383;
-  const C<F> G385 = G384 * G349;
-  const C<F> G386 = C1 * G385;
-  const C<F> G387 = G380 + G386;
-  const C<F> G388 = G356 * G387;
-  const C<F> G389 = C1 * G388;
-  const C<F> G390 = G375 + G389;
-  const C<F> G391 = G1 * X48;
-  const C<F> G392 = t * X104;
-  const C<F> G393 = G391 + G392;
-  const C<F> G394 = G393 * G4;
-  const C<F> G395 = G1 * X49;
-  const C<F> G396 = t * X105;
-  const C<F> G397 = G395 + G396;
-  const C<F> G398 = G397 * G217;
-  const C<F> G399 = G394 + G398;
-  const C<F> G400 = G1 * X52;
-  const C<F> G401 = t * X108;
-  const C<F> G402 = G400 + G401;
-  const C<F> G403 = G402 * G7;
-  const C<F> G404 = G1 * X53;
-  const C<F> G405 = t * X109;
-  const C<F> G406 = G404 + G405;
-  const C<F> G407 = G406 * G220;
-  const C<F> G408 = G403 + G407;
-  const C<F> G409 = G408 * G15;
-  const C<F> G410 = G402 * G19;
-  const C<F> G411 = G406 * G224;
-  const C<F> G412 = G410 + G411;
-  const C<F> G413 = G412 * G20;
-  const C<F> G414 = G402 * G24;
-  const C<F> G415 = G406 * G228;
-  const C<F> G416 = G414 + G415;
-  const C<F> G417 = G416 * G25;
-  const C<F> G418 = G409 + G413 + G417;
-  const C<F> G419 = G1 * X50;
-  const C<F> G420 = t * X106;
-  const C<F> G421 = G419 + G420;
-  const C<F> G422 = G421 * G30;
-  const C<F> G423 = G1 * X51;
-  const C<F> G424 = t * X107;
-  const C<F> G425 = G423 + G424;
-  const C<F> G426 = G425 * G233;
-  const C<F> G427 = G422 + G426;
-  const C<F> G428 = G427 * G31;
-  const C<F> G429 = G421 * G35;
-  const C<F> G430 = G425 * G237;
-  const C<F> G431 = G429 + G430;
-  const C<F> G432 = G431 * G37;
-  const C<F> G433 = G421 * G41;
-  const C<F> G434 = G425 * G241;
-  const C<F> G435 = G433 + G434;
-  const C<F> G436 = G435 * G42;
-  const C<F> G437 = G428 + G432 + G436;
-  const C<F> G438 = G418 * G437;
-  const C<F> G439 = G408 * G49;
-  const C<F> G440 = G412 * G55;
-  const C<F> G441 = G416 * G60;
-  const C<F> G442 = G439 + G440 + G441;
-  const C<F> G443 = G427 * G63;
-  const C<F> G444 = G431 * G65;
-  const C<F> G445 = G435 * G67;
-  const C<F> G446 = G443 + G444 + G445;
-  const C<F> G447 = G442 * G446;
-  const C<F> G448 = C1 * G447;
-  const C<F> G449 = G438 + G448;
-  const C<F> G450 = G399 * G449;
-  const C<F> G451 = G393 * G76;
-  const C<F> G452 = G397 * G259;
-  const C<F> G453 = G451 + G452;
-  const C<F> G454 = G427 * G42;
-  const C<F> G455 = G431 * G78;
-  const C<F> G456 = G435 * G81;
-  const C<F> G457 = G454 + G455 + G456;
-  const C<F> G458 = G418 * G457;
-  const C<F> G459 = G408 * G87;
-  const C<F> G460 = G412 * G92;
-  const C<F> G461 = G416 * G96;
-  const C<F> G462 = G459 + G460 + G461;
-  const C<F> G463 = G462 * G446;
-  const C<F> G464 = C1 * G463;
-  const C<F> G465 = G458 + G464;
-  const C<F> G466 = G453 * G465;
-  const C<F> G467 = C1 * G466;
-  const C<F> G468 = G450 + G467;
-  const C<F> G469 = G393 * G107;
-  const C<F> G470 = G397 * G277;
-  const C<F> G471 = G469 + G470;
-  const C<F> G472 = G471 * G449;
-  const C<F> G473 = G427 * G110;
-  const C<F> G474 = G431 * G42;
-  const C<F> G475 = G435 * G113;
-  const C<F> G476 = G473 + G474 + G475;
-  const C<F> G477 = G418 * G476;
-  const C<F> G478 = G408 * G119;
-  const C<F> G479 = G412 * G124;
-  const C<F> G480 = G416 * G127;
-  const C<F> G481 = G478 + G479 + G480;
-  const C<F> G482 = G481 * G446;
-  const C<F> G483 = C1 * G482;
-  const C<F> G484 = G477 + G483;
-  const C<F> G485 = G453 * G484;
-  const C<F> G486 = C1 * G485;
-  const C<F> G487 = G472 + G486;
-  const C<F> G488 = G151 * G243;
-  const C<F> G489 = G169 * G252;
-  const C<F> G490 = C1 * G489;
-  const C<F> G491 = G488 + G490;
-  const C<F> G492 = G277 * G491;
-  const C<F> G493 = G151 * G282;
-  const C<F> G494 = G208 * G252;
-  const C<F> G495 = C1 * G494;
-  const C<F> G496 = G493 + G495;
-  const C<F> G497 = G259 * G496;
-  const C<F> G498 = C1 * G497;
-  const C<F> G499 = G492 + G498;
-  const C<F> G500 = G138 * G499;
-  const C<F> G501 = G217 * G491;
-  const C<F> G502 = G151 * G263;
-  const C<F> G503 = G189 * G252;
-  const C<F> G504 = C1 * G503;
-  const C<F> G505 = G502 + G504;
-  const C<F> G506 = G259 * G505;
-  const C<F> G507 = C1 * G506;
-  const C<F> G508 = G501 + G507;
-  const C<F> G509 = G198 * G508;
-  const C<F> G510 = C1 * G509;
-  const C<F> G511 = G500 + G510;
-  const C<F> G512 = G217 * G496;
-  const C<F> G513 = G277 * G505;
-  const C<F> G514 = C1 * G513;
-  const C<F> G515 = G512 + G514;
-  const C<F> G516 = G180 * G515;
-  const C<F> G517 = G511 + G516;
-  const C<F> G518 = G1 * X61;
-  const C<F> G519 = t * X117;
-  const C<F> G520 = G518 + G519;
-  const C<F> G521 = G30 * G78;
-  const C<F> G522 = C1 * X0;
-  const C<F> G523 = C2 * G522;
-  const C<F> G524 = G35 * G523;
-  const C<F> G525 = X1 + X1;
-  const C<F> G526 = C1 * G525;
-  const C<F> G527 = G41 * G526;
-  const C<F> G528 = G521 + G524 + G527;
-  const C<F> G529 = G27 * G528;
-  const C<F> G530 = X8 * G525;
-  const C<F> G531 = G30 * G530;
-  const C<F> G532 = X9 * G525;
-  const C<F> G533 = G35 * G532;
-  const C<F> G534 = X10 * G525;
-  const C<F> G535 = G41 * G534;
-  const C<F> G536 = G531 + G533 + G535;
-  const C<F> G537 = G62 * G536;
-  const C<F> G538 = C1 * G537;
-  const C<F> G539 = G529 + G538;
-  const C<F> G540 = G4 * G539;
-  const C<F> G541 = G30 * G525;
-  const C<F> G542 = G35 * G31;
-  const C<F> G543 = G41 * G78;
-  const C<F> G544 = G541 + G542 + G543;
-  const C<F> G545 = G27 * G544;
-  const C<F> G546 = G98 * G536;
-  const C<F> G547 = C1 * G546;
-  const C<F> G548 = G545 + G547;
-  const C<F> G549 = G76 * G548;
-  const C<F> G550 = C1 * G549;
-  const C<F> G551 = G540 + G550;
-  const C<F> G552 = G107 * G539;
-  const C<F> G553 = G35 * G526;
-  const C<F> G554 = C2 * X0;
-  const C<F> G555 = G41 * G554;
-  const C<F> G556 = G32 + G553 + G555;
-  const C<F> G557 = G27 * G556;
-  const C<F> G558 = G129 * G536;
-  const C<F> G559 = C1 * G558;
-  const C<F> G560 = G557 + G559;
-  const C<F> G561 = G76 * G560;
-  const C<F> G562 = C1 * G561;
-  const C<F> G563 = G552 + G562;
-  const C<F> G564 = G154 * G78;
-  const C<F> G565 = G158 * G523;
-  const C<F> G566 = G162 * G526;
-  const C<F> G567 = G564 + G565 + G566;
-  const C<F> G568 = G151 * G567;
-  const C<F> G569 = G154 * G530;
-  const C<F> G570 = G158 * G532;
-  const C<F> G571 = G162 * G534;
-  const C<F> G572 = G569 + G570 + G571;
-  const C<F> G573 = G169 * G572;
-  const C<F> G574 = C1 * G573;
-  const C<F> G575 = G568 + G574;
-  const C<F> G576 = G138 * G575;
-  const C<F> G577 = G154 * G525;
-  const C<F> G578 = G158 * G31;
-  const C<F> G579 = G162 * G78;
-  const C<F> G580 = G577 + G578 + G579;
-  const C<F> G581 = G151 * G580;
-  const C<F> G582 = G189 * G572;
-  const C<F> G583 = C1 * G582;
-  const C<F> G584 = G581 + G583;
-  const C<F> G585 = G180 * G584;
-  const C<F> G586 = C1 * G585;
-  const C<F> G587 = G576 + G586;
-  const C<F> G588 = G198 * G575;
-  const C<F> G589 = G158 * G526;
-  const C<F> G590 = G162 * G554;
-  const C<F> G591 = G155 + G589 + G590;
-  const C<F> G592 = G151 * G591;
-  const C<F> G593 = G208 * G572;
-  const C<F> G594 = C1 * G593;
-  const C<F> G595 = G592 + G594;
-  const C<F> G596 = G180 * G595;
-  const C<F> G597 = C1 * G596;
-  const C<F> G598 = G588 + G597;
-  const C<F> G599 = G233 * G78;
-  const C<F> G600 = G237 * G523;
-  const C<F> G601 = G241 * G526;
-  const C<F> G602 = G599 + G600 + G601;
-  const C<F> G603 = G230 * G602;
-  const C<F> G604 = G233 * G530;
-  const C<F> G605 = G237 * G532;
-  const C<F> G606 = G241 * G534;
-  const C<F> G607 = G604 + G605 + G606;
-  const C<F> G608 = G248 * G607;
-  const C<F> G609 = C1 * G608;
-  const C<F> G610 = G603 + G609;
-  const C<F> G611 = G217 * G610;
-  const C<F> G612 = G233 * G525;
-  const C<F> G613 = G237 * G31;
-  const C<F> G614 = G241 * G78;
-  const C<F> G615 = G612 + G613 + G614;
-  const C<F> G616 = G230 * G615;
-  const C<F> G617 = G268 * G607;
-  const C<F> G618 = C1 * G617;
-  const C<F> G619 = G616 + G618;
-  const C<F> G620 = G259 * G619;
-  const C<F> G621 = C1 * G620;
-  const C<F> G622 = G611 + G621;
-  const C<F> G623 = G277 * G610;
-  const C<F> G624 = G237 * G526;
-  const C<F> G625 = G241 * G554;
-  const C<F> G626 = G234 + G624 + G625;
-  const C<F> G627 = G230 * G626;
-  const C<F> G628 = G287 * G607;
-  const C<F> G629 = C1 * G628;
-  const C<F> G630 = G627 + G629;
-  const C<F> G631 = G259 * G630;
-  const C<F> G632 = C1 * G631;
-  const C<F> G633 = G623 + G632;
-  const C<F> G634 = G330 * G78;
-  const C<F> G635 = G334 * G523;
-  const C<F> G636 = G338 * G526;
-  const C<F> G637 = G634 + G635 + G636;
-  const C<F> G638 = G321 * G637;
-  const C<F> G639 = G330 * G530;
-  const C<F> G640 = G334 * G532;
-  const C<F> G641 = G338 * G534;
-  const C<F> G642 = G639 + G640 + G641;
-  const C<F> G643 = G345 * G642;
-  const C<F> G644 = C1 * G643;
-  const C<F> G645 = G638 + G644;
-  const C<F> G646 = G302 * G645;
-  const C<F> G647 = G330 * G525;
-  const C<F> G648 = G334 * G31;
-  const C<F> G649 = G338 * G78;
-  const C<F> G650 = G647 + G648 + G649;
-  const C<F> G651 = G321 * G650;
-  const C<F> G652 = G365 * G642;
-  const C<F> G653 = C1 * G652;
-  const C<F> G654 = G651 + G653;
-  const C<F> G655 = G356 * G654;
-  const C<F> G656 = C1 * G655;
-  const C<F> G657 = G646 + G656;
-  const C<F> G658 = G374 * G645;
-  const C<F> G659 = G334 * G526;
-  const C<F> G660 = G338 * G554;
-  const C<F> G661 = G331 + G659 + G660;
-  const C<F> G662 = G321 * G661;
-  const C<F> G663 = G384 * G642;
-  const C<F> G664 = C1 * G663;
-  const C<F> G665 = G662 + G664;
-  const C<F> G666 = G356 * G665;
-  const C<F> G667 = C1 * G666;
-  const C<F> G668 = G658 + G667;
-  const C<F> G669 = G427 * G78;
-  const C<F> G670 = G431 * G523;
-  const C<F> G671 = G435 * G526;
-  const C<F> G672 = G669 + G670 + G671;
-  const C<F> G673 = G418 * G672;
-  const C<F> G674 = G427 * G530;
-  const C<F> G675 = G431 * G532;
-  const C<F> G676 = G435 * G534;
-  const C<F> G677 = G674 + G675 + G676;
-  const C<F> G678 = G442 * G677;
-  const C<F> G679 = C1 * G678;
-  const C<F> G680 = G673 + G679;
-  const C<F> G681 = G399 * G680;
-  const C<F> G682 = G427 * G525;
-  const C<F> G683 = G431 * G31;
-  const C<F> G684 = G435 * G78;
-  const C<F> G685 = G682 + G683 + G684;
-  const C<F> G686 = G418 * G685;
-  const C<F> G687 = G462 * G677;
-  const C<F> G688 = C1 * G687;
-  const C<F> G689 = G686 + G688;
-  const C<F> G690 = G453 * G689;
-  const C<F> G691 = C1 * G690;
-  const C<F> G692 = G681 + G691;
-  const C<F> G693 = G471 * G680;
-  const C<F> G694 = G431 * G526;
-  const C<F> G695 = G435 * G554;
-  const C<F> G696 = G428 + G694 + G695;
-  const C<F> G697 = G418 * G696;
-  const C<F> G698 = G481 * G677;
-  const C<F> G699 = C1 * G698;
-  const C<F> G700 = G697 + G699;
-  const C<F> G701 = G453 * G700;
-  const C<F> G702 = C1 * G701;
-  const C<F> G703 = G693 + G702;
-  const C<F> G704 = G151 * G602;
-  const C<F> G705 = G169 * G607;
-  const C<F> G706 = C1 * G705;
-  const C<F> G707 = G704 + G706;
-  const C<F> G708 = G277 * G707;
-  const C<F> G709 = G151 * G626;
-  const C<F> G710 = G208 * G607;
-  const C<F> G711 = C1 * G710;
-  const C<F> G712 = G709 + G711;
-  const C<F> G713 = G259 * G712;
-  const C<F> G714 = C1 * G713;
-  const C<F> G715 = G708 + G714;
-  const C<F> G716 = G138 * G715;
-  const C<F> G717 = G217 * G707;
-  const C<F> G718 = G151 * G615;
-  const C<F> G719 = G189 * G607;
-  const C<F> G720 = C1 * G719;
-  const C<F> G721 = G718 + G720;
-  const C<F> G722 = G259 * G721;
-  const C<F> G723 = C1 * G722;
-  const C<F> G724 = G717 + G723;
-  const C<F> G725 = G198 * G724;
-  const C<F> G726 = C1 * G725;
-  const C<F> G727 = G716 + G726;
-  const C<F> G728 = G217 * G712;
-  const C<F> G729 = G277 * G721;
-  const C<F> G730 = C1 * G729;
-  const C<F> G731 = G728 + G730;
-  const C<F> G732 = G180 * G731;
-  const C<F> G733 = G727 + G732;
-  const C<F> G734 = G1 * X62;
-  const C<F> G735 = t * X118;
-  const C<F> G736 = G734 + G735;
-  const C<F> G737 = G30 * G554;
-  const C<F> G738 = X2 + X2;
-  const C<F> G739 = C1 * G738;
-  const C<F> G740 = G41 * G739;
-  const C<F> G741 = G737 + G79 + G740;
-  const C<F> G742 = G27 * G741;
-  const C<F> G743 = X8 * G738;
-  const C<F> G744 = G30 * G743;
-  const C<F> G745 = X9 * G738;
-  const C<F> G746 = G35 * G745;
-  const C<F> G747 = X10 * G738;
-  const C<F> G748 = G41 * G747;
-  const C<F> G749 = G744 + G746 + G748;
-  const C<F> G750 = G62 * G749;
-  const C<F> G751 = C1 * G750;
-  const C<F> G752 = G742 + G751;
-  const C<F> G753 = G4 * G752;
-  const C<F> G754 = G30 * G739;
-  const C<F> G755 = G35 * G113;
-  const C<F> G756 = G41 * G523;
-  const C<F> G757 = G754 + G755 + G756;
-  const C<F> G758 = G27 * G757;
-  const C<F> G759 = G98 * G749;
-  const C<F> G760 = C1 * G759;
-  const C<F> G761 = G758 + G760;
-  const C<F> G762 = G76 * G761;
-  const C<F> G763 = C1 * G762;
-  const C<F> G764 = G753 + G763;
-  const C<F> G765 = G107 * G752;
-  const C<F> G766 = G30 * G113;
-  const C<F> G767 = G35 * G738;
-  const C<F> G768 = G766 + G767 + G543;
-  const C<F> G769 = G27 * G768;
-  const C<F> G770 = G129 * G749;
-  const C<F> G771 = C1 * G770;
-  const C<F> G772 = G769 + G771;
-  const C<F> G773 = G76 * G772;
-  const C<F> G774 = C1 * G773;
-  const C<F> G775 = G765 + G774;
-  const C<F> G776 = G154 * G554;
-  const C<F> G777 = G162 * G739;
-  const C<F> G778 = G776 + G182 + G777;
-  const C<F> G779 = G151 * G778;
-  const C<F> G780 = G154 * G743;
-  const C<F> G781 = G158 * G745;
-  const C<F> G782 = G162 * G747;
-  const C<F> G783 = G780 + G781 + G782;
-  const C<F> G784 = G169 * G783;
-  const C<F> G785 = C1 * G784;
-  const C<F> G786 = G779 + G785;
-  const C<F> G787 = G138 * G786;
-  const C<F> G788 = G154 * G739;
-  const C<F> G789 = G158 * G113;
-  const C<F> G790 = G162 * G523;
-  const C<F> G791 = G788 + G789 + G790;
-  const C<F> G792 = G151 * G791;
-  const C<F> G793 = G189 * G783;
-  const C<F> G794 = C1 * G793;
-  const C<F> G795 = G792 + G794;
-  const C<F> G796 = G180 * G795;
-  const C<F> G797 = C1 * G796;
-  const C<F> G798 = G787 + G797;
-  const C<F> G799 = G198 * G786;
-  const C<F> G800 = G154 * G113;
-  const C<F> G801 = G158 * G738;
-  const C<F> G802 = G800 + G801 + G579;
-  const C<F> G803 = G151 * G802;
-  const C<F> G804 = G208 * G783;
-  const C<F> G805 = C1 * G804;
-  const C<F> G806 = G803 + G805;
-  const C<F> G807 = G180 * G806;
-  const C<F> G808 = C1 * G807;
-  const C<F> G809 = G799 + G808;
-  const C<F> G810 = G233 * G554;
-  const C<F> G811 = G241 * G739;
-  const C<F> G812 = G810 + G261 + G811;
-  const C<F> G813 = G230 * G812;
-  const C<F> G814 = G233 * G743;
-  const C<F> G815 = G237 * G745;
-  const C<F> G816 = G241 * G747;
-  const C<F> G817 = G814 + G815 + G816;
-  const C<F> G818 = G248 * G817;
-  const C<F> G819 = C1 * G818;
-  const C<F> G820 = G813 + G819;
-  const C<F> G821 = G217 * G820;
-  const C<F> G822 = G233 * G739;
-  const C<F> G823 = G237 * G113;
-  const C<F> G824 = G241 * G523;
-  const C<F> G825 = G822 + G823 + G824;
-  const C<F> G826 = G230 * G825;
-  const C<F> G827 = G268 * G817;
-  const C<F> G828 = C1 * G827;
-  const C<F> G829 = G826 + G828;
-  const C<F> G830 = G259 * G829;
-  const C<F> G831 = C1 * G830;
-  const C<F> G832 = G821 + G831;
-  const C<F> G833 = G277 * G820;
-  const C<F> G834 = G233 * G113;
-  const C<F> G835 = G237 * G738;
-  const C<F> G836 = G834 + G835 + G614;
-  const C<F> G837 = G230 * G836;
-  const C<F> G838 = G287 * G817;
-  const C<F> G839 = C1 * G838;
-  const C<F> G840 = G837 + G839;
-  const C<F> G841 = G259 * G840;
-  const C<F> G842 = C1 * G841;
-  const C<F> G843 = G833 + G842;
-  const C<F> G844 = G330 * G554;
-  const C<F> G845 = G338 * G739;
-  const C<F> G846 = G844 + G358 + G845;
-  const C<F> G847 = G321 * G846;
-  const C<F> G848 = G330 * G743;
-  const C<F> G849 = G334 * G745;
-  const C<F> G850 = G338 * G747;
-  const C<F> G851 = G848 + G849 + G850;
-  const C<F> G852 = G345 * G851;
-  const C<F> G853 = C1 * G852;
-  const C<F> G854 = G847 + G853;
-  const C<F> G855 = G302 * G854;
-  const C<F> G856 = G330 * G739;
-  const C<F> G857 = G334 * G113;
-  const C<F> G858 = G338 * G523;
-  const C<F> G859 = G856 + G857 + G858;
-  const C<F> G860 = G321 * G859;
-  const C<F> G861 = G365 * G851;
-  const C<F> G862 = C1 * G861;
-  const C<F> G863 = G860 + G862;
-  const C<F> G864 = G356 * G863;
-  const C<F> G865 = C1 * G864;
-  const C<F> G866 = G855 + G865;
-  const C<F> G867 = G374 * G854;
-  const C<F> G868 = G330 * G113;
-  const C<F> G869 = G334 * G738;
-  const C<F> G870 = G868 + G869 + G649;
-  const C<F> G871 = G321 * G870;
-  const C<F> G872 = G384 * G851;
-  const C<F> G873 = C1 * G872;
-  const C<F> G874 = G871 + G873;
-  const C<F> G875 = G356 * G874;
-  const C<F> G876 = C1 * G875;
-  const C<F> G877 = G867 + G876;
-  const C<F> G878 = G427 * G554;
-  const C<F> G879 = G435 * G739;
-  const C<F> G880 = G878 + G455 + G879;
-  const C<F> G881 = G418 * G880;
-  const C<F> G882 = G427 * G743;
-  const C<F> G883 = G431 * G745;
-  const C<F> G884 = G435 * G747;
-  const C<F> G885 = G882 + G883 + G884;
-  const C<F> G886 = G442 * G885;
-  const C<F> G887 = C1 * G886;
-  const C<F> G888 = G881 + G887;
-  const C<F> G889 = G399 * G888;
-  const C<F> G890 = G427 * G739;
-  const C<F> G891 = G431 * G113;
-  const C<F> G892 = G435 * G523;
-  const C<F> G893 = G890 + G891 + G892;
-  const C<F> G894 = G418 * G893;
-  const C<F> G895 = G462 * G885;
-  const C<F> G896 = C1 * G895;
-  const C<F> G897 = G894 + G896;
-  const C<F> G898 = G453 * G897;
-  const C<F> G899 = C1 * G898;
-  const C<F> G900 = G889 + G899;
-  const C<F> G901 = G471 * G888;
-  const C<F> G902 = G427 * G113;
-  const C<F> G903 = G431 * G738;
-  const C<F> G904 = G902 + G903 + G684;
-  const C<F> G905 = G418 * G904;
-  const C<F> G906 = G481 * G885;
-  const C<F> G907 = C1 * G906;
-  const C<F> G908 = G905 + G907;
-  const C<F> G909 = G453 * G908;
-  const C<F> G910 = C1 * G909;
-  const C<F> G911 = G901 + G910;
-  const C<F> G912 = G151 * G812;
-  const C<F> G913 = G169 * G817;
-  const C<F> G914 = C1 * G913;
-  const C<F> G915 = G912 + G914;
-  const C<F> G916 = G277 * G915;
-  const C<F> G917 = G151 * G836;
-  const C<F> G918 = G208 * G817;
-  const C<F> G919 = C1 * G918;
-  const C<F> G920 = G917 + G919;
-  const C<F> G921 = G259 * G920;
-  const C<F> G922 = C1 * G921;
-  const C<F> G923 = G916 + G922;
-  const C<F> G924 = G138 * G923;
-  const C<F> G925 = G217 * G915;
-  const C<F> G926 = G151 * G825;
-  const C<F> G927 = G189 * G817;
-  const C<F> G928 = C1 * G927;
-  const C<F> G929 = G926 + G928;
-  const C<F> G930 = G259 * G929;
-  const C<F> G931 = C1 * G930;
-  const C<F> G932 = G925 + G931;
-  const C<F> G933 = G198 * G932;
-  const C<F> G934 = C1 * G933;
-  const C<F> G935 = G924 + G934;
-  const C<F> G936 = G217 * G920;
-  const C<F> G937 = G277 * G929;
-  const C<F> G938 = C1 * G937;
-  const C<F> G939 = G936 + G938;
-  const C<F> G940 = G180 * G939;
-  const C<F> G941 = G935 + G940;
-  const C<F> G942 = G1 * X63;
-  const C<F> G943 = t * X119;
-  const C<F> G944 = G942 + G943;
-  const C<F> G945 = X3 + X3;
-  const C<F> G946 = G41 * G945;
-  const C<F> G947 = G766 + G542 + G946;
-  const C<F> G948 = G27 * G947;
-  const C<F> G949 = X8 * G945;
-  const C<F> G950 = G30 * G949;
-  const C<F> G951 = X9 * G945;
-  const C<F> G952 = G35 * G951;
-  const C<F> G953 = X10 * G945;
-  const C<F> G954 = G41 * G953;
-  const C<F> G955 = G950 + G952 + G954;
-  const C<F> G956 = G62 * G955;
-  const C<F> G957 = C1 * G956;
-  const C<F> G958 = G948 + G957;
-  const C<F> G959 = G4 * G958;
-  const C<F> G960 = C1 * G945;
-  const C<F> G961 = G30 * G960;
-  const C<F> G962 = G35 * G554;
-  const C<F> G963 = G961 + G962 + G114;
-  const C<F> G964 = G27 * G963;
-  const C<F> G965 = G98 * G955;
-  const C<F> G966 = C1 * G965;
-  const C<F> G967 = G964 + G966;
-  const C<F> G968 = G76 * G967;
-  const C<F> G969 = C1 * G968;
-  const C<F> G970 = G959 + G969;
-  const C<F> G971 = G107 * G958;
-  const C<F> G972 = G30 * G523;
-  const C<F> G973 = G35 * G960;
-  const C<F> G974 = G41 * G31;
-  const C<F> G975 = G972 + G973 + G974;
-  const C<F> G976 = G27 * G975;
-  const C<F> G977 = G129 * G955;
-  const C<F> G978 = C1 * G977;
-  const C<F> G979 = G976 + G978;
-  const C<F> G980 = G76 * G979;
-  const C<F> G981 = C1 * G980;
-  const C<F> G982 = G971 + G981;
-  const C<F> G983 = G162 * G945;
-  const C<F> G984 = G800 + G578 + G983;
-  const C<F> G985 = G151 * G984;
-  const C<F> G986 = G154 * G949;
-  const C<F> G987 = G158 * G951;
-  const C<F> G988 = G162 * G953;
-  const C<F> G989 = G986 + G987 + G988;
-  const C<F> G990 = G169 * G989;
-  const C<F> G991 = C1 * G990;
-  const C<F> G992 = G985 + G991;
-  const C<F> G993 = G138 * G992;
-  const C<F> G994 = G154 * G960;
-  const C<F> G995 = G158 * G554;
-  const C<F> G996 = G994 + G995 + G202;
-  const C<F> G997 = G151 * G996;
-  const C<F> G998 = G189 * G989;
-  const C<F> G999 = C1 * G998;
-  const C<F> G1000 = G997 + G999;
-  const C<F> G1001 = G180 * G1000;
-  const C<F> G1002 = C1 * G1001;
-  const C<F> G1003 = G993 + G1002;
-  const C<F> G1004 = G198 * G992;
-  const C<F> G1005 = G154 * G523;
-  const C<F> G1006 = G158 * G960;
-  const C<F> G1007 = G162 * G31;
-  const C<F> G1008 = G1005 + G1006 + G1007;
-  const C<F> G1009 = G151 * G1008;
-  const C<F> G1010 = G208 * G989;
-  const C<F> G1011 = C1 * G1010;
-  const C<F> G1012 = G1009 + G1011;
-  const C<F> G1013 = G180 * G1012;
-  const C<F> G1014 = C1 * G1013;
-  const C<F> G1015 = G1004 + G1014;
-  const C<F> G1016 = G241 * G945;
-  const C<F> G1017 = G834 + G613 + G1016;
-  const C<F> G1018 = G230 * G1017;
-  const C<F> G1019 = G233 * G949;
-  const C<F> G1020 = G237 * G951;
-  const C<F> G1021 = G241 * G953;
-  const C<F> G1022 = G1019 + G1020 + G1021;
-  const C<F> G1023 = G248 * G1022;
-  const C<F> G1024 = C1 * G1023;
-  const C<F> G1025 = G1018 + G1024;
-  const C<F> G1026 = G217 * G1025;
-  const C<F> G1027 = G233 * G960;
-  const C<F> G1028 = G237 * G554;
-  const C<F> G1029 = G1027 + G1028 + G281;
-  const C<F> G1030 = G230 * G1029;
-  const C<F> G1031 = G268 * G1022;
-  const C<F> G1032 = C1 * G1031;
-  const C<F> G1033 = G1030 + G1032;
-  const C<F> G1034 = G259 * G1033;
-  const C<F> G1035 = C1 * G1034;
-  const C<F> G1036 = G1026 + G1035;
-  const C<F> G1037 = G277 * G1025;
-  const C<F> G1038 = G233 * G523;
-  const C<F> G1039 = G237 * G960;
-  const C<F> G1040 = G241 * G31;
-  const C<F> G1041 = G1038 + G1039 + G1040;
-  const C<F> G1042 = G230 * G1041;
-  const C<F> G1043 = G287 * G1022;
-  const C<F> G1044 = C1 * G1043;
-  const C<F> G1045 = G1042 + G1044;
-  const C<F> G1046 = G259 * G1045;
-  const C<F> G1047 = C1 * G1046;
-  const C<F> G1048 = G1037 + G1047;
-  const C<F> G1049 = G338 * G945;
-  const C<F> G1050 = G868 + G648 + G1049;
-  const C<F> G1051 = G321 * G1050;
-  const C<F> G1052 = G330 * G949;
-  const C<F> G1053 = G334 * G951;
-  const C<F> G1054 = G338 * G953;
-  const C<F> G1055 = G1052 + G1053 + G1054;
-  const C<F> G1056 = G345 * G1055;
-  const C<F> G1057 = C1 * G1056;
-  const C<F> G1058 = G1051 + G1057;
-  const C<F> G1059 = G302 * G1058;
-  const C<F> G1060 = G330 * G960;
-  const C<F> G1061 = G334 * G554;
-  const C<F> G1062 = G1060 + G1061 + G378;
-  const C<F> G1063 = G321 * G1062;
-  const C<F> G1064 = G365 * G1055;
-  const C<F> G1065 = C1 * G1064;
-  const C<F> G1066 = G1063 + G1065;
-  const C<F> G1067 = G356 * G1066;
-  const C<F> G1068 = C1 * G1067;
-  const C<F> G1069 = G1059 + G1068;
-  const C<F> G1070 = G374 * G1058;
-  const C<F> G1071 = G330 * G523;
-  const C<F> G1072 = G334 * G960;
-  const C<F> G1073 = G338 * G31;
-  const C<F> G1074 = G1071 + G1072 + G1073;
-  const C<F> G1075 = G321 * G1074;
-  const C<F> G1076 = G384 * G1055;
-  const C<F> G1077 = C1 * G1076;
-  const C<F> G1078 = G1075 + G1077;
-  const C<F> G1079 = G356 * G1078;
-  const C<F> G1080 = C1 * G1079;
-  const C<F> G1081 = G1070 + G1080;
-  const C<F> G1082 = G435 * G945;
-  const C<F> G1083 = G902 + G683 + G1082;
-  const C<F> G1084 = G418 * G1083;
-  const C<F> G1085 = G427 * G949;
-  const C<F> G1086 = G431 * G951;
-  const C<F> G1087 = G435 * G953;
-  const C<F> G1088 = G1085 + G1086 + G1087;
-  const C<F> G1089 = G442 * G1088;
-  const C<F> G1090 = C1 * G1089;
-  const C<F> G1091 = G1084 + G1090;
-  const C<F> G1092 = G399 * G1091;
-  const C<F> G1093 = G427 * G960;
-  const C<F> G1094 = G431 * G554;
-  const C<F> G1095 = G1093 + G1094 + G475;
-  const C<F> G1096 = G418 * G1095;
-  const C<F> G1097 = G462 * G1088;
-  const C<F> G1098 = C1 * G1097;
-  const C<F> G1099 = G1096 + G1098;
-  const C<F> G1100 = G453 * G1099;
-  const C<F> G1101 = C1 * G1100;
-  const C<F> G1102 = G1092 + G1101;
-  const C<F> G1103 = G471 * G1091;
-  const C<F> G1104 = G427 * G523;
-  const C<F> G1105 = G431 * G960;
-  const C<F> G1106 = G435 * G31;
-  const C<F> G1107 = G1104 + G1105 + G1106;
-  const C<F> G1108 = G418 * G1107;
-  const C<F> G1109 = G481 * G1088;
-  const C<F> G1110 = C1 * G1109;
-  const C<F> G1111 = G1108 + G1110;
-  const C<F> G1112 = G453 * G1111;
-  const C<F> G1113 = C1 * G1112;
-  const C<F> G1114 = G1103 + G1113;
-  const C<F> G1115 = G151 * G1017;
-  const C<F> G1116 = G169 * G1022;
-  const C<F> G1117 = C1 * G1116;
-  const C<F> G1118 = G1115 + G1117;
-  const C<F> G1119 = G277 * G1118;
-  const C<F> G1120 = G151 * G1041;
-  const C<F> G1121 = G208 * G1022;
-  const C<F> G1122 = C1 * G1121;
-  const C<F> G1123 = G1120 + G1122;
-  const C<F> G1124 = G259 * G1123;
-  const C<F> G1125 = C1 * G1124;
-  const C<F> G1126 = G1119 + G1125;
-  const C<F> G1127 = G138 * G1126;
-  const C<F> G1128 = G217 * G1118;
-  const C<F> G1129 = G151 * G1029;
-  const C<F> G1130 = G189 * G1022;
-  const C<F> G1131 = C1 * G1130;
-  const C<F> G1132 = G1129 + G1131;
-  const C<F> G1133 = G259 * G1132;
-  const C<F> G1134 = C1 * G1133;
-  const C<F> G1135 = G1128 + G1134;
-  const C<F> G1136 = G198 * G1135;
-  const C<F> G1137 = C1 * G1136;
-  const C<F> G1138 = G1127 + G1137;
-  const C<F> G1139 = G217 * G1123;
-  const C<F> G1140 = G277 * G1132;
-  const C<F> G1141 = C1 * G1140;
-  const C<F> G1142 = G1139 + G1141;
-  const C<F> G1143 = G180 * G1142;
-  const C<F> G1144 = G1138 + G1143;
-  const C<F> G1145 = G1 * X64;
-  const C<F> G1146 = t * X120;
-  const C<F> G1147 = G1145 + G1146;
-  const C<F> G1148 = X1 * X3;
-  const C<F> G1149 = X0 * X2;
-  const C<F> G1150 = G1148 + G1149;
-  const C<F> G1151 = C2 * G1150;
-  const C<F> G1152 = G30 * G1151;
-  const C<F> G1153 = X2 * X3;
-  const C<F> G1154 = X0 * X1;
-  const C<F> G1155 = C1 * G1154;
-  const C<F> G1156 = G1153 + G1155;
-  const C<F> G1157 = C2 * G1156;
-  const C<F> G1158 = G35 * G1157;
-  const C<F> G1159 = X0 * X0;
-  const C<F> G1160 = X3 * X3;
-  const C<F> G1161 = G1159 + G1160;
-  const C<F> G1162 = X1 * X1;
-  const C<F> G1163 = X2 * X2;
-  const C<F> G1164 = G1162 + G1163;
-  const C<F> G1165 = C1 * G1164;
-  const C<F> G1166 = G1161 + G1165;
-  const C<F> G1167 = G41 * G1166;
-  const C<F> G1168 = G1152 + G1158 + G1167;
-  const C<F> G1169 = X4 + X4;
-  const C<F> G1170 = X11 * G1169;
-  const C<F> G1171 = G7 * G1170;
-  const C<F> G1172 = X12 * G1169;
-  const C<F> G1173 = G19 * G1172;
-  const C<F> G1174 = X13 * G1169;
-  const C<F> G1175 = G24 * G1174;
-  const C<F> G1176 = G1171 + G1173 + G1175;
-  const C<F> G1177 = G1168 * G1176;
-  const C<F> G1178 = G1159 + G1162;
-  const C<F> G1179 = G1178 + G1163;
-  const C<F> G1180 = G1179 + G1160;
-  const C<F> G1181 = G1180 * X8;
-  const C<F> G1182 = G30 * G1181;
-  const C<F> G1183 = G1180 * X9;
-  const C<F> G1184 = G35 * G1183;
-  const C<F> G1185 = G1180 * X10;
-  const C<F> G1186 = G41 * G1185;
-  const C<F> G1187 = G1182 + G1184 + G1186;
-  const C<F> G1188 = C2 * X6;
-  const C<F> G1189 = G7 * G1188;
-  const C<F> G1190 = C1 * X5;
-  const C<F> G1191 = C2 * G1190;
-  const C<F> G1192 = G19 * G1191;
-  const C<F> G1193 = G24 * G1169;
-  const C<F> G1194 = G1189 + G1192 + G1193;
-  const C<F> G1195 = G1187 * G1194;
-  const C<F> G1196 = C1 * G1195;
-  const C<F> G1197 = G1177 + G1196;
-  const C<F> G1198 = G4 * G1197;
-  const C<F> G1199 = G1163 + G1160;
-  const C<F> G1200 = C1 * G1199;
-  const C<F> G1201 = G1178 + G1200;
-  const C<F> G1202 = G30 * G1201;
-  const C<F> G1203 = X1 * X2;
-  const C<F> G1204 = X0 * X3;
-  const C<F> G1205 = G1203 + G1204;
-  const C<F> G1206 = C2 * G1205;
-  const C<F> G1207 = G35 * G1206;
-  const C<F> G1208 = C1 * G1149;
-  const C<F> G1209 = G1148 + G1208;
-  const C<F> G1210 = C2 * G1209;
-  const C<F> G1211 = G41 * G1210;
-  const C<F> G1212 = G1202 + G1207 + G1211;
-  const C<F> G1213 = G1212 * G1176;
-  const C<F> G1214 = G7 * G1169;
-  const C<F> G1215 = C2 * X7;
-  const C<F> G1216 = G19 * G1215;
-  const C<F> G1217 = C1 * X6;
-  const C<F> G1218 = C2 * G1217;
-  const C<F> G1219 = G24 * G1218;
-  const C<F> G1220 = G1214 + G1216 + G1219;
-  const C<F> G1221 = G1187 * G1220;
-  const C<F> G1222 = C1 * G1221;
-  const C<F> G1223 = G1213 + G1222;
-  const C<F> G1224 = G76 * G1223;
-  const C<F> G1225 = C1 * G1224;
-  const C<F> G1226 = G1198 + G1225;
-  const C<F> G1227 = G107 * G1197;
-  const C<F> G1228 = C1 * G1204;
-  const C<F> G1229 = G1203 + G1228;
-  const C<F> G1230 = C2 * G1229;
-  const C<F> G1231 = G30 * G1230;
-  const C<F> G1232 = G1159 + G1163;
-  const C<F> G1233 = G1162 + G1160;
-  const C<F> G1234 = C1 * G1233;
-  const C<F> G1235 = G1232 + G1234;
-  const C<F> G1236 = G35 * G1235;
-  const C<F> G1237 = G1153 + G1154;
-  const C<F> G1238 = C2 * G1237;
-  const C<F> G1239 = G41 * G1238;
-  const C<F> G1240 = G1231 + G1236 + G1239;
-  const C<F> G1241 = G1240 * G1176;
-  const C<F> G1242 = C1 * X7;
-  const C<F> G1243 = C2 * G1242;
-  const C<F> G1244 = G7 * G1243;
-  const C<F> G1245 = G19 * G1169;
-  const C<F> G1246 = C2 * X5;
-  const C<F> G1247 = G24 * G1246;
-  const C<F> G1248 = G1244 + G1245 + G1247;
-  const C<F> G1249 = G1187 * G1248;
-  const C<F> G1250 = C1 * G1249;
-  const C<F> G1251 = G1241 + G1250;
-  const C<F> G1252 = G76 * G1251;
-  const C<F> G1253 = C1 * G1252;
-  const C<F> G1254 = G1227 + G1253;
-  const C<F> G1255 = G154 * G1151;
-  const C<F> G1256 = G158 * G1157;
-  const C<F> G1257 = G162 * G1166;
-  const C<F> G1258 = G1255 + G1256 + G1257;
-  const C<F> G1259 = G141 * G1170;
-  const C<F> G1260 = G145 * G1172;
-  const C<F> G1261 = G149 * G1174;
-  const C<F> G1262 = G1259 + G1260 + G1261;
-  const C<F> G1263 = G1258 * G1262;
-  const C<F> G1264 = G154 * G1181;
-  const C<F> G1265 = G158 * G1183;
-  const C<F> G1266 = G162 * G1185;
-  const C<F> G1267 = G1264 + G1265 + G1266;
-  const C<F> G1268 = G141 * G1188;
-  const C<F> G1269 = G145 * G1191;
-  const C<F> G1270 = G149 * G1169;
-  const C<F> G1271 = G1268 + G1269 + G1270;
-  const C<F> G1272 = G1267 * G1271;
-  const C<F> G1273 = C1 * G1272;
-  const C<F> G1274 = G1263 + G1273;
-  const C<F> G1275 = G138 * G1274;
-  const C<F> G1276 = G154 * G1201;
-  const C<F> G1277 = G158 * G1206;
-  const C<F> G1278 = G162 * G1210;
-  const C<F> G1279 = G1276 + G1277 + G1278;
-  const C<F> G1280 = G1279 * G1262;
-  const C<F> G1281 = G141 * G1169;
-  const C<F> G1282 = G145 * G1215;
-  const C<F> G1283 = G149 * G1218;
-  const C<F> G1284 = G1281 + G1282 + G1283;
-  const C<F> G1285 = G1267 * G1284;
-  const C<F> G1286 = C1 * G1285;
-  const C<F> G1287 = G1280 + G1286;
-  const C<F> G1288 = G180 * G1287;
-  const C<F> G1289 = C1 * G1288;
-  const C<F> G1290 = G1275 + G1289;
-  const C<F> G1291 = G198 * G1274;
-  const C<F> G1292 = G154 * G1230;
-  const C<F> G1293 = G158 * G1235;
-  const C<F> G1294 = G162 * G1238;
-  const C<F> G1295 = G1292 + G1293 + G1294;
-  const C<F> G1296 = G1295 * G1262;
-  const C<F> G1297 = G141 * G1243;
-  const C<F> G1298 = G145 * G1169;
-  const C<F> G1299 = G149 * G1246;
-  const C<F> G1300 = G1297 + G1298 + G1299;
-  const C<F> G1301 = G1267 * G1300;
-  const C<F> G1302 = C1 * G1301;
-  const C<F> G1303 = G1296 + G1302;
-  const C<F> G1304 = G180 * G1303;
-  const C<F> G1305 = C1 * G1304;
-  const C<F> G1306 = G1291 + G1305;
-  const C<F> G1307 = G233 * G1151;
-  const C<F> G1308 = G237 * G1157;
-  const C<F> G1309 = G241 * G1166;
-  const C<F> G1310 = G1307 + G1308 + G1309;
-  const C<F> G1311 = G220 * G1170;
-  const C<F> G1312 = G224 * G1172;
-  const C<F> G1313 = G228 * G1174;
-  const C<F> G1314 = G1311 + G1312 + G1313;
-  const C<F> G1315 = G1310 * G1314;
-  const C<F> G1316 = G233 * G1181;
-  const C<F> G1317 = G237 * G1183;
-  const C<F> G1318 = G241 * G1185;
-  const C<F> G1319 = G1316 + G1317 + G1318;
-  const C<F> G1320 = G220 * G1188;
-  const C<F> G1321 = G224 * G1191;
-  const C<F> G1322 = G228 * G1169;
-  const C<F> G1323 = G1320 + G1321 + G1322;
-  const C<F> G1324 = G1319 * G1323;
-  const C<F> G1325 = C1 * G1324;
-  const C<F> G1326 = G1315 + G1325;
-  const C<F> G1327 = G217 * G1326;
-  const C<F> G1328 = G233 * G1201;
-  const C<F> G1329 = G237 * G1206;
-  const C<F> G1330 = G241 * G1210;
-  const C<F> G1331 = G1328 + G1329 + G1330;
-  const C<F> G1332 = G1331 * G1314;
-  const C<F> G1333 = G220 * G1169;
-  const C<F> G1334 = G224 * G1215;
-  const C<F> G1335 = G228 * G1218;
-  const C<F> G1336 = G1333 + G1334 + G1335;
-  const C<F> G1337 = G1319 * G1336;
-  const C<F> G1338 = C1 * G1337;
-  const C<F> G1339 = G1332 + G1338;
-  const C<F> G1340 = G259 * G1339;
-  const C<F> G1341 = C1 * G1340;
-  const C<F> G1342 = G1327 + G1341;
-  const C<F> G1343 = G277 * G1326;
-  const C<F> G1344 = G233 * G1230;
-  const C<F> G1345 = G237 * G1235;
-  const C<F> G1346 = G241 * G1238;
-  const C<F> G1347 = G1344 + G1345 + G1346;
-  const C<F> G1348 = G1347 * G1314;
-  const C<F> G1349 = G220 * G1243;
-  const C<F> G1350 = G224 * G1169;
-  const C<F> G1351 = G228 * G1246;
-  const C<F> G1352 = G1349 + G1350 + G1351;
-  const C<F> G1353 = G1319 * G1352;
-  const C<F> G1354 = C1 * G1353;
-  const C<F> G1355 = G1348 + G1354;
-  const C<F> G1356 = G259 * G1355;
-  const C<F> G1357 = C1 * G1356;
-  const C<F> G1358 = G1343 + G1357;
-  const C<F> G1359 = G330 * G1151;
-  const C<F> G1360 = G334 * G1157;
-  const C<F> G1361 = G338 * G1166;
-  const C<F> G1362 = G1359 + G1360 + G1361;
-  const C<F> G1363 = G311 * G1170;
-  const C<F> G1364 = G315 * G1172;
-  const C<F> G1365 = G319 * G1174;
-  const C<F> G1366 = G1363 + G1364 + G1365;
-  const C<F> G1367 = G1362 * G1366;
-  const C<F> G1368 = G330 * G1181;
-  const C<F> G1369 = G334 * G1183;
-  const C<F> G1370 = G338 * G1185;
-  const C<F> G1371 = G1368 + G1369 + G1370;
-  const C<F> G1372 = G311 * G1188;
-  const C<F> G1373 = G315 * G1191;
-  const C<F> G1374 = G319 * G1169;
-  const C<F> G1375 = G1372 + G1373 + G1374;
-  const C<F> G1376 = G1371 * G1375;
-  const C<F> G1377 = C1 * G1376;
-  const C<F> G1378 = G1367 + G1377;
-  const C<F> G1379 = G302 * G1378;
-  const C<F> G1380 = G330 * G1201;
-  const C<F> G1381 = G334 * G1206;
-  const C<F> G1382 = G338 * G1210;
-  const C<F> G1383 = G1380 + G1381 + G1382;
-  const C<F> G1384 = G1383 * G1366;
-  const C<F> G1385 = G311 * G1169;
-  const C<F> G1386 = G315 * G1215;
-  const C<F> G1387 = G319 * G1218;
-  const C<F> G1388 = G1385 + G1386 + G1387;
-  const C<F> G1389 = G1371 * G1388;
-  const C<F> G1390 = C1 * G1389;
-  const C<F> G1391 = G1384 + G1390;
-  const C<F> G1392 = G356 * G1391;
-  const C<F> G1393 = C1 * G1392;
-  const C<F> G1394 = G1379 + G1393;
-  const C<F> G1395 = G374 * G1378;
-  const C<F> G1396 = G330 * G1230;
-  const C<F> G1397 = G334 * G1235;
-  const C<F> G1398 = G338 * G1238;
-  const C<F> G1399 = G1396 + G1397 + G1398;
-  const C<F> G1400 = G1399 * G1366;
-  const C<F> G1401 = G311 * G1243;
-  const C<F> G1402 = G315 * G1169;
-  const C<F> G1403 = G319 * G1246;
-  const C<F> G1404 = G1401 + G1402 + G1403;
-  const C<F> G1405 = G1371 * G1404;
-  const C<F> G1406 = C1 * G1405;
-  const C<F> G1407 = G1400 + G1406;
-  const C<F> G1408 = G356 * G1407;
-  const C<F> G1409 = C1 * G1408;
-  const C<F> G1410 = G1395 + G1409;
-  const C<F> G1411 = G427 * G1151;
-  const C<F> G1412 = G431 * G1157;
-  const C<F> G1413 = G435 * G1166;
-  const C<F> G1414 = G1411 + G1412 + G1413;
-  const C<F> G1415 = G408 * G1170;
-  const C<F> G1416 = G412 * G1172;
-  const C<F> G1417 = G416 * G1174;
-  const C<F> G1418 = G1415 + G1416 + G1417;
-  const C<F> G1419 = G1414 * G1418;
-  const C<F> G1420 = G427 * G1181;
-  const C<F> G1421 = G431 * G1183;
-  const C<F> G1422 = G435 * G1185;
-  const C<F> G1423 = G1420 + G1421 + G1422;
-  const C<F> G1424 = G408 * G1188;
-  const C<F> G1425 = G412 * G1191;
-  const C<F> G1426 = G416 * G1169;
-  const C<F> G1427 = G1424 + G1425 + G1426;
-  const C<F> G1428 = G1423 * G1427;
-  const C<F> G1429 = C1 * G1428;
-  const C<F> G1430 = G1419 + G1429;
-  const C<F> G1431 = G399 * G1430;
-  const C<F> G1432 = G427 * G1201;
-  const C<F> G1433 = G431 * G1206;
-  const C<F> G1434 = G435 * G1210;
-  const C<F> G1435 = G1432 + G1433 + G1434;
-  const C<F> G1436 = G1435 * G1418;
-  const C<F> G1437 = G408 * G1169;
-  const C<F> G1438 = G412 * G1215;
-  const C<F> G1439 = G416 * G1218;
-  const C<F> G1440 = G1437 + G1438 + G1439;
-  const C<F> G1441 = G1423 * G1440;
-  const C<F> G1442 = C1 * G1441;
-  const C<F> G1443 = G1436 + G1442;
-  const C<F> G1444 = G453 * G1443;
-  const C<F> G1445 = C1 * G1444;
-  const C<F> G1446 = G1431 + G1445;
-  const C<F> G1447 = G471 * G1430;
-  const C<F> G1448 = G427 * G1230;
-  const C<F> G1449 = G431 * G1235;
-  const C<F> G1450 = G435 * G1238;
-  const C<F> G1451 = G1448 + G1449 + G1450;
-  const C<F> G1452 = G1451 * G1418;
-  const C<F> G1453 = G408 * G1243;
-  const C<F> G1454 = G412 * G1169;
-  const C<F> G1455 = G416 * G1246;
-  const C<F> G1456 = G1453 + G1454 + G1455;
-  const C<F> G1457 = G1423 * G1456;
-  const C<F> G1458 = C1 * G1457;
-  const C<F> G1459 = G1452 + G1458;
-  const C<F> G1460 = G453 * G1459;
-  const C<F> G1461 = C1 * G1460;
-  const C<F> G1462 = G1447 + G1461;
-  const C<F> G1463 = G1310 * G1262;
-  const C<F> G1464 = G1319 * G1271;
-  const C<F> G1465 = C1 * G1464;
-  const C<F> G1466 = G1463 + G1465;
-  const C<F> G1467 = G277 * G1466;
-  const C<F> G1468 = G1347 * G1262;
-  const C<F> G1469 = G1319 * G1300;
-  const C<F> G1470 = C1 * G1469;
-  const C<F> G1471 = G1468 + G1470;
-  const C<F> G1472 = G259 * G1471;
-  const C<F> G1473 = C1 * G1472;
-  const C<F> G1474 = G1467 + G1473;
-  const C<F> G1475 = G138 * G1474;
-  const C<F> G1476 = G217 * G1466;
-  const C<F> G1477 = G1331 * G1262;
-  const C<F> G1478 = G1319 * G1284;
-  const C<F> G1479 = C1 * G1478;
-  const C<F> G1480 = G1477 + G1479;
-  const C<F> G1481 = G259 * G1480;
-  const C<F> G1482 = C1 * G1481;
-  const C<F> G1483 = G1476 + G1482;
-  const C<F> G1484 = G198 * G1483;
-  const C<F> G1485 = C1 * G1484;
-  const C<F> G1486 = G1475 + G1485;
-  const C<F> G1487 = G217 * G1471;
-  const C<F> G1488 = G277 * G1480;
-  const C<F> G1489 = C1 * G1488;
-  const C<F> G1490 = G1487 + G1489;
-  const C<F> G1491 = G180 * G1490;
-  const C<F> G1492 = G1486 + G1491;
-  const C<F> G1493 = G1 * X66;
-  const C<F> G1494 = t * X122;
-  const C<F> G1495 = G1493 + G1494;
-  const C<F> G1496 = X5 + X5;
-  const C<F> G1497 = X11 * G1496;
-  const C<F> G1498 = G7 * G1497;
-  const C<F> G1499 = X12 * G1496;
-  const C<F> G1500 = G19 * G1499;
-  const C<F> G1501 = X13 * G1496;
-  const C<F> G1502 = G24 * G1501;
-  const C<F> G1503 = G1498 + G1500 + G1502;
-  const C<F> G1504 = G1168 * G1503;
-  const C<F> G1505 = G7 * G1215;
-  const C<F> G1506 = C1 * X4;
-  const C<F> G1507 = C2 * G1506;
-  const C<F> G1508 = G19 * G1507;
-  const C<F> G1509 = C1 * G1496;
-  const C<F> G1510 = G24 * G1509;
-  const C<F> G1511 = G1505 + G1508 + G1510;
-  const C<F> G1512 = G1187 * G1511;
-  const C<F> G1513 = C1 * G1512;
-  const C<F> G1514 = G1504 + G1513;
-  const C<F> G1515 = G4 * G1514;
-  const C<F> G1516 = G1212 * G1503;
-  const C<F> G1517 = G7 * G1496;
-  const C<F> G1518 = G19 * G1188;
-  const C<F> G1519 = G24 * G1215;
-  const C<F> G1520 = G1517 + G1518 + G1519;
-  const C<F> G1521 = G1187 * G1520;
-  const C<F> G1522 = C1 * G1521;
-  const C<F> G1523 = G1516 + G1522;
-  const C<F> G1524 = G76 * G1523;
-  const C<F> G1525 = C1 * G1524;
-  const C<F> G1526 = G1515 + G1525;
-  const C<F> G1527 = G107 * G1514;
-  const C<F> G1528 = G1240 * G1503;
-  const C<F> G1529 = G19 * G1509;
-  const C<F> G1530 = C2 * X4;
-  const C<F> G1531 = G24 * G1530;
-  const C<F> G1532 = G1189 + G1529 + G1531;
-  const C<F> G1533 = G1187 * G1532;
-  const C<F> G1534 = C1 * G1533;
-  const C<F> G1535 = G1528 + G1534;
-  const C<F> G1536 = G76 * G1535;
-  const C<F> G1537 = C1 * G1536;
-  const C<F> G1538 = G1527 + G1537;
-  const C<F> G1539 = G141 * G1497;
-  const C<F> G1540 = G145 * G1499;
-  const C<F> G1541 = G149 * G1501;
-  const C<F> G1542 = G1539 + G1540 + G1541;
-  const C<F> G1543 = G1258 * G1542;
-  const C<F> G1544 = G141 * G1215;
-  const C<F> G1545 = G145 * G1507;
-  const C<F> G1546 = G149 * G1509;
-  const C<F> G1547 = G1544 + G1545 + G1546;
-  const C<F> G1548 = G1267 * G1547;
-  const C<F> G1549 = C1 * G1548;
-  const C<F> G1550 = G1543 + G1549;
-  const C<F> G1551 = G138 * G1550;
-  const C<F> G1552 = G1279 * G1542;
-  const C<F> G1553 = G141 * G1496;
-  const C<F> G1554 = G145 * G1188;
-  const C<F> G1555 = G149 * G1215;
-  const C<F> G1556 = G1553 + G1554 + G1555;
-  const C<F> G1557 = G1267 * G1556;
-  const C<F> G1558 = C1 * G1557;
-  const C<F> G1559 = G1552 + G1558;
-  const C<F> G1560 = G180 * G1559;
-  const C<F> G1561 = C1 * G1560;
-  const C<F> G1562 = G1551 + G1561;
-  const C<F> G1563 = G198 * G1550;
-  const C<F> G1564 = G1295 * G1542;
-  const C<F> G1565 = G145 * G1509;
-  const C<F> G1566 = G149 * G1530;
-  const C<F> G1567 = G1268 + G1565 + G1566;
-  const C<F> G1568 = G1267 * G1567;
-  const C<F> G1569 = C1 * G1568;
-  const C<F> G1570 = G1564 + G1569;
-  const C<F> G1571 = G180 * G1570;
-  const C<F> G1572 = C1 * G1571;
-  const C<F> G1573 = G1563 + G1572;
-  const C<F> G1574 = G220 * G1497;
-  const C<F> G1575 = G224 * G1499;
-  const C<F> G1576 = G228 * G1501;
-  const C<F> G1577 = G1574 + G1575 + G1576;
-  const C<F> G1578 = G1310 * G1577;
-  const C<F> G1579 = G220 * G1215;
-  const C<F> G1580 = G224 * G1507;
-  const C<F> G1581 = G228 * G1509;
-  const C<F> G1582 = G1579 + G1580 + G1581;
-  const C<F> G1583 = G1319 * G1582;
-  const C<F> G1584 = C1 * G1583;
-  const C<F> G1585 = G1578 + G1584;
-  const C<F> G1586 = G217 * G1585;
-  const C<F> G1587 = G1331 * G1577;
-  const C<F> G1588 = G220 * G1496;
-  const C<F> G1589 = G224 * G1188;
-  const C<F> G1590 = G228 * G1215;
-  const C<F> G1591 = G1588 + G1589 + G1590;
-  const C<F> G1592 = G1319 * G1591;
-  const C<F> G1593 = C1 * G1592;
-  const C<F> G1594 = G1587 + G1593;
-  const C<F> G1595 = G259 * G1594;
-  const C<F> G1596 = C1 * G1595;
-  const C<F> G1597 = G1586 + G1596;
-  const C<F> G1598 = G277 * G1585;
-  const C<F> G1599 = G1347 * G1577;
-  const C<F> G1600 = G224 * G1509;
-  const C<F> G1601 = G228 * G1530;
-  const C<F> G1602 = G1320 + G1600 + G1601;
-  const C<F> G1603 = G1319 * G1602;
-  const C<F> G1604 = C1 * G1603;
-  const C<F> G1605 = G1599 + G1604;
-  const C<F> G1606 = G259 * G1605;
-  const C<F> G1607 = C1 * G1606;
-  const C<F> G1608 = G1598 + G1607;
-  const C<F> G1609 = G311 * G1497;
-  const C<F> G1610 = G315 * G1499;
-  const C<F> G1611 = G319 * G1501;
-  const C<F> G1612 = G1609 + G1610 + G1611;
-  const C<F> G1613 = G1362 * G1612;
-  const C<F> G1614 = G311 * G1215;
-  const C<F> G1615 = G315 * G1507;
-  const C<F> G1616 = G319 * G1509;
-  const C<F> G1617 = G1614 + G1615 + G1616;
-  const C<F> G1618 = G1371 * G1617;
-  const C<F> G1619 = C1 * G1618;
-  const C<F> G1620 = G1613 + G1619;
-  const C<F> G1621 = G302 * G1620;
-  const C<F> G1622 = G1383 * G1612;
-  const C<F> G1623 = G311 * G1496;
-  const C<F> G1624 = G315 * G1188;
-  const C<F> G1625 = G319 * G1215;
-  const C<F> G1626 = G1623 + G1624 + G1625;
-  const C<F> G1627 = G1371 * G1626;
-  const C<F> G1628 = C1 * G1627;
-  const C<F> G1629 = G1622 + G1628;
-  const C<F> G1630 = G356 * G1629;
-  const C<F> G1631 = C1 * G1630;
-  const C<F> G1632 = G1621 + G1631;
-  const C<F> G1633 = G374 * G1620;
-  const C<F> G1634 = G1399 * G1612;
-  const C<F> G1635 = G315 * G1509;
-  const C<F> G1636 = G319 * G1530;
-  const C<F> G1637 = G1372 + G1635 + G1636;
-  const C<F> G1638 = G1371 * G1637;
-  const C<F> G1639 = C1 * G1638;
-  const C<F> G1640 = G1634 + G1639;
-  const C<F> G1641 = G356 * G1640;
-  const C<F> G1642 = C1 * G1641;
-  const C<F> G1643 = G1633 + G1642;
-  const C<F> G1644 = G408 * G1497;
-  const C<F> G1645 = G412 * G1499;
-  const C<F> G1646 = G416 * G1501;
-  const C<F> G1647 = G1644 + G1645 + G1646;
-  const C<F> G1648 = G1414 * G1647;
-  const C<F> G1649 = G408 * G1215;
-  const C<F> G1650 = G412 * G1507;
-  const C<F> G1651 = G416 * G1509;
-  const C<F> G1652 = G1649 + G1650 + G1651;
-  const C<F> G1653 = G1423 * G1652;
-  const C<F> G1654 = C1 * G1653;
-  const C<F> G1655 = G1648 + G1654;
-  const C<F> G1656 = G399 * G1655;
-  const C<F> G1657 = G1435 * G1647;
-  const C<F> G1658 = G408 * G1496;
-  const C<F> G1659 = G412 * G1188;
-  const C<F> G1660 = G416 * G1215;
-  const C<F> G1661 = G1658 + G1659 + G1660;
-  const C<F> G1662 = G1423 * G1661;
-  const C<F> G1663 = C1 * G1662;
-  const C<F> G1664 = G1657 + G1663;
-  const C<F> G1665 = G453 * G1664;
-  const C<F> G1666 = C1 * G1665;
-  const C<F> G1667 = G1656 + G1666;
-  const C<F> G1668 = G471 * G1655;
-  const C<F> G1669 = G1451 * G1647;
-  const C<F> G1670 = G412 * G1509;
-  const C<F> G1671 = G416 * G1530;
-  const C<F> G1672 = G1424 + G1670 + G1671;
-  const C<F> G1673 = G1423 * G1672;
-  const C<F> G1674 = C1 * G1673;
-  const C<F> G1675 = G1669 + G1674;
-  const C<F> G1676 = G453 * G1675;
-  const C<F> G1677 = C1 * G1676;
-  const C<F> G1678 = G1668 + G1677;
-  const C<F> G1679 = G1310 * G1542;
-  const C<F> G1680 = G1319 * G1547;
-  const C<F> G1681 = C1 * G1680;
-  const C<F> G1682 = G1679 + G1681;
-  const C<F> G1683 = G277 * G1682;
-  const C<F> G1684 = G1347 * G1542;
-  const C<F> G1685 = G1319 * G1567;
-  const C<F> G1686 = C1 * G1685;
-  const C<F> G1687 = G1684 + G1686;
-  const C<F> G1688 = G259 * G1687;
-  const C<F> G1689 = C1 * G1688;
-  const C<F> G1690 = G1683 + G1689;
-  const C<F> G1691 = G138 * G1690;
-  const C<F> G1692 = G217 * G1682;
-  const C<F> G1693 = G1331 * G1542;
-  const C<F> G1694 = G1319 * G1556;
-  const C<F> G1695 = C1 * G1694;
-  const C<F> G1696 = G1693 + G1695;
-  const C<F> G1697 = G259 * G1696;
-  const C<F> G1698 = C1 * G1697;
-  const C<F> G1699 = G1692 + G1698;
-  const C<F> G1700 = G198 * G1699;
-  const C<F> G1701 = C1 * G1700;
-  const C<F> G1702 = G1691 + G1701;
-  const C<F> G1703 = G217 * G1687;
-  const C<F> G1704 = G277 * G1696;
-  const C<F> G1705 = C1 * G1704;
-  const C<F> G1706 = G1703 + G1705;
-  const C<F> G1707 = G180 * G1706;
-  const C<F> G1708 = G1702 + G1707;
-  const C<F> G1709 = G1 * X67;
-  const C<F> G1710 = t * X123;
-  const C<F> G1711 = G1709 + G1710;
-  const C<F> G1712 = X6 + X6;
-  const C<F> G1713 = X11 * G1712;
-  const C<F> G1714 = G7 * G1713;
-  const C<F> G1715 = X12 * G1712;
-  const C<F> G1716 = G19 * G1715;
-  const C<F> G1717 = X13 * G1712;
-  const C<F> G1718 = G24 * G1717;
-  const C<F> G1719 = G1714 + G1716 + G1718;
-  const C<F> G1720 = G1168 * G1719;
-  const C<F> G1721 = G7 * G1530;
-  const C<F> G1722 = C1 * G1712;
-  const C<F> G1723 = G24 * G1722;
-  const C<F> G1724 = G1721 + G1216 + G1723;
-  const C<F> G1725 = G1187 * G1724;
-  const C<F> G1726 = C1 * G1725;
-  const C<F> G1727 = G1720 + G1726;
-  const C<F> G1728 = G4 * G1727;
-  const C<F> G1729 = G1212 * G1719;
-  const C<F> G1730 = G7 * G1722;
-  const C<F> G1731 = G19 * G1246;
-  const C<F> G1732 = G24 * G1507;
-  const C<F> G1733 = G1730 + G1731 + G1732;
-  const C<F> G1734 = G1187 * G1733;
-  const C<F> G1735 = C1 * G1734;
-  const C<F> G1736 = G1729 + G1735;
-  const C<F> G1737 = G76 * G1736;
-  const C<F> G1738 = C1 * G1737;
-  const C<F> G1739 = G1728 + G1738;
-  const C<F> G1740 = G107 * G1727;
-  const C<F> G1741 = G1240 * G1719;
-  const C<F> G1742 = G7 * G1246;
-  const C<F> G1743 = G19 * G1712;
-  const C<F> G1744 = G1742 + G1743 + G1519;
-  const C<F> G1745 = G1187 * G1744;
-  const C<F> G1746 = C1 * G1745;
-  const C<F> G1747 = G1741 + G1746;
-  const C<F> G1748 = G76 * G1747;
-  const C<F> G1749 = C1 * G1748;
-  const C<F> G1750 = G1740 + G1749;
-  const C<F> G1751 = G141 * G1713;
-  const C<F> G1752 = G145 * G1715;
-  const C<F> G1753 = G149 * G1717;
-  const C<F> G1754 = G1751 + G1752 + G1753;
-  const C<F> G1755 = G1258 * G1754;
-  const C<F> G1756 = G141 * G1530;
-  const C<F> G1757 = G149 * G1722;
-  const C<F> G1758 = G1756 + G1282 + G1757;
-  const C<F> G1759 = G1267 * G1758;
-  const C<F> G1760 = C1 * G1759;
-  const C<F> G1761 = G1755 + G1760;
-  const C<F> G1762 = G138 * G1761;
-  const C<F> G1763 = G1279 * G1754;
-  const C<F> G1764 = G141 * G1722;
-  const C<F> G1765 = G145 * G1246;
-  const C<F> G1766 = G149 * G1507;
-  const C<F> G1767 = G1764 + G1765 + G1766;
-  const C<F> G1768 = G1267 * G1767;
-  const C<F> G1769 = C1 * G1768;
-  const C<F> G1770 = G1763 + G1769;
-  const C<F> G1771 = G180 * G1770;
-  const C<F> G1772 = C1 * G1771;
-  const C<F> G1773 = G1762 + G1772;
-  const C<F> G1774 = G198 * G1761;
-  const C<F> G1775 = G1295 * G1754;
-  const C<F> G1776 = G141 * G1246;
-  const C<F> G1777 = G145 * G1712;
-  const C<F> G1778 = G1776 + G1777 + G1555;
-  const C<F> G1779 = G1267 * G1778;
-  const C<F> G1780 = C1 * G1779;
-  const C<F> G1781 = G1775 + G1780;
-  const C<F> G1782 = G180 * G1781;
-  const C<F> G1783 = C1 * G1782;
-  const C<F> G1784 = G1774 + G1783;
-  const C<F> G1785 = G220 * G1713;
-  const C<F> G1786 = G224 * G1715;
-  const C<F> G1787 = G228 * G1717;
-  const C<F> G1788 = G1785 + G1786 + G1787;
-  const C<F> G1789 = G1310 * G1788;
-  const C<F> G1790 = G220 * G1530;
-  const C<F> G1791 = G228 * G1722;
-  const C<F> G1792 = G1790 + G1334 + G1791;
-  const C<F> G1793 = G1319 * G1792;
-  const C<F> G1794 = C1 * G1793;
-  const C<F> G1795 = G1789 + G1794;
-  const C<F> G1796 = G217 * G1795;
-  const C<F> G1797 = G1331 * G1788;
-  const C<F> G1798 = G220 * G1722;
-  const C<F> G1799 = G224 * G1246;
-  const C<F> G1800 = G228 * G1507;
-  const C<F> G1801 = G1798 + G1799 + G1800;
-  const C<F> G1802 = G1319 * G1801;
-  const C<F> G1803 = C1 * G1802;
-  const C<F> G1804 = G1797 + G1803;
-  const C<F> G1805 = G259 * G1804;
-  const C<F> G1806 = C1 * G1805;
-  const C<F> G1807 = G1796 + G1806;
-  const C<F> G1808 = G277 * G1795;
-  const C<F> G1809 = G1347 * G1788;
-  const C<F> G1810 = G220 * G1246;
-  const C<F> G1811 = G224 * G1712;
-  const C<F> G1812 = G1810 + G1811 + G1590;
-  const C<F> G1813 = G1319 * G1812;
-  const C<F> G1814 = C1 * G1813;
-  const C<F> G1815 = G1809 + G1814;
-  const C<F> G1816 = G259 * G1815;
-  const C<F> G1817 = C1 * G1816;
-  const C<F> G1818 = G1808 + G1817;
-  const C<F> G1819 = G311 * G1713;
-  const C<F> G1820 = G315 * G1715;
-  const C<F> G1821 = G319 * G1717;
-  const C<F> G1822 = G1819 + G1820 + G1821;
-  const C<F> G1823 = G1362 * G1822;
-  const C<F> G1824 = G311 * G1530;
-  const C<F> G1825 = G319 * G1722;
-  const C<F> G1826 = G1824 + G1386 + G1825;
-  const C<F> G1827 = G1371 * G1826;
-  const C<F> G1828 = C1 * G1827;
-  const C<F> G1829 = G1823 + G1828;
-  const C<F> G1830 = G302 * G1829;
-  const C<F> G1831 = G1383 * G1822;
-  const C<F> G1832 = G311 * G1722;
-  const C<F> G1833 = G315 * G1246;
-  const C<F> G1834 = G319 * G1507;
-  const C<F> G1835 = G1832 + G1833 + G1834;
-  const C<F> G1836 = G1371 * G1835;
-  const C<F> G1837 = C1 * G1836;
-  const C<F> G1838 = G1831 + G1837;
-  const C<F> G1839 = G356 * G1838;
-  const C<F> G1840 = C1 * G1839;
-  const C<F> G1841 = G1830 + G1840;
-  const C<F> G1842 = G374 * G1829;
-  const C<F> G1843 = G1399 * G1822;
-  const C<F> G1844 = G311 * G1246;
-  const C<F> G1845 = G315 * G1712;
-  const C<F> G1846 = G1844 + G1845 + G1625;
-  const C<F> G1847 = G1371 * G1846;
-  const C<F> G1848 = C1 * G1847;
-  const C<F> G1849 = G1843 + G1848;
-  const C<F> G1850 = G356 * G1849;
-  const C<F> G1851 = C1 * G1850;
-  const C<F> G1852 = G1842 + G1851;
-  const C<F> G1853 = G408 * G1713;
-  const C<F> G1854 = G412 * G1715;
-  const C<F> G1855 = G416 * G1717;
-  const C<F> G1856 = G1853 + G1854 + G1855;
-  const C<F> G1857 = G1414 * G1856;
-  const C<F> G1858 = G408 * G1530;
-  const C<F> G1859 = G416 * G1722;
-  const C<F> G1860 = G1858 + G1438 + G1859;
-  const C<F> G1861 = G1423 * G1860;
-  const C<F> G1862 = C1 * G1861;
-  const C<F> G1863 = G1857 + G1862;
-  const C<F> G1864 = G399 * G1863;
-  const C<F> G1865 = G1435 * G1856;
-  const C<F> G1866 = G408 * G1722;
-  const C<F> G1867 = G412 * G1246;
-  const C<F> G1868 = G416 * G1507;
-  const C<F> G1869 = G1866 + G1867 + G1868;
-  const C<F> G1870 = G1423 * G1869;
-  const C<F> G1871 = C1 * G1870;
-  const C<F> G1872 = G1865 + G1871;
-  const C<F> G1873 = G453 * G1872;
-  const C<F> G1874 = C1 * G1873;
-  const C<F> G1875 = G1864 + G1874;
-  const C<F> G1876 = G471 * G1863;
-  const C<F> G1877 = G1451 * G1856;
-  const C<F> G1878 = G408 * G1246;
-  const C<F> G1879 = G412 * G1712;
-  const C<F> G1880 = G1878 + G1879 + G1660;
-  const C<F> G1881 = G1423 * G1880;
-  const C<F> G1882 = C1 * G1881;
-  const C<F> G1883 = G1877 + G1882;
-  const C<F> G1884 = G453 * G1883;
-  const C<F> G1885 = C1 * G1884;
-  const C<F> G1886 = G1876 + G1885;
-  const C<F> G1887 = G1310 * G1754;
-  const C<F> G1888 = G1319 * G1758;
-  const C<F> G1889 = C1 * G1888;
-  const C<F> G1890 = G1887 + G1889;
-  const C<F> G1891 = G277 * G1890;
-  const C<F> G1892 = G1347 * G1754;
-  const C<F> G1893 = G1319 * G1778;
-  const C<F> G1894 = C1 * G1893;
-  const C<F> G1895 = G1892 + G1894;
-  const C<F> G1896 = G259 * G1895;
-  const C<F> G1897 = C1 * G1896;
-  const C<F> G1898 = G1891 + G1897;
-  const C<F> G1899 = G138 * G1898;
-  const C<F> G1900 = G217 * G1890;
-  const C<F> G1901 = G1331 * G1754;
-  const C<F> G1902 = G1319 * G1767;
-  const C<F> G1903 = C1 * G1902;
-  const C<F> G1904 = G1901 + G1903;
-  const C<F> G1905 = G259 * G1904;
-  const C<F> G1906 = C1 * G1905;
-  const C<F> G1907 = G1900 + G1906;
-  const C<F> G1908 = G198 * G1907;
-  const C<F> G1909 = C1 * G1908;
-  const C<F> G1910 = G1899 + G1909;
-  const C<F> G1911 = G217 * G1895;
-  const C<F> G1912 = G277 * G1904;
-  const C<F> G1913 = C1 * G1912;
-  const C<F> G1914 = G1911 + G1913;
-  const C<F> G1915 = G180 * G1914;
-  const C<F> G1916 = G1910 + G1915;
-  const C<F> G1917 = G1 * X68;
-  const C<F> G1918 = t * X124;
-  const C<F> G1919 = G1917 + G1918;
-  const C<F> G1920 = X7 + X7;
-  const C<F> G1921 = X11 * G1920;
-  const C<F> G1922 = G7 * G1921;
-  const C<F> G1923 = X12 * G1920;
-  const C<F> G1924 = G19 * G1923;
-  const C<F> G1925 = X13 * G1920;
-  const C<F> G1926 = G24 * G1925;
-  const C<F> G1927 = G1922 + G1924 + G1926;
-  const C<F> G1928 = G1168 * G1927;
-  const C<F> G1929 = G24 * G1920;
-  const C<F> G1930 = G1742 + G1518 + G1929;
-  const C<F> G1931 = G1187 * G1930;
-  const C<F> G1932 = C1 * G1931;
-  const C<F> G1933 = G1928 + G1932;
-  const C<F> G1934 = G4 * G1933;
-  const C<F> G1935 = G1212 * G1927;
-  const C<F> G1936 = C1 * G1920;
-  const C<F> G1937 = G7 * G1936;
-  const C<F> G1938 = G19 * G1530;
-  const C<F> G1939 = G1937 + G1938 + G1247;
-  const C<F> G1940 = G1187 * G1939;
-  const C<F> G1941 = C1 * G1940;
-  const C<F> G1942 = G1935 + G1941;
-  const C<F> G1943 = G76 * G1942;
-  const C<F> G1944 = C1 * G1943;
-  const C<F> G1945 = G1934 + G1944;
-  const C<F> G1946 = G107 * G1933;
-  const C<F> G1947 = G1240 * G1927;
-  const C<F> G1948 = G7 * G1507;
-  const C<F> G1949 = G19 * G1936;
-  const C<F> G1950 = G24 * G1188;
-  const C<F> G1951 = G1948 + G1949 + G1950;
-  const C<F> G1952 = G1187 * G1951;
-  const C<F> G1953 = C1 * G1952;
-  const C<F> G1954 = G1947 + G1953;
-  const C<F> G1955 = G76 * G1954;
-  const C<F> G1956 = C1 * G1955;
-  const C<F> G1957 = G1946 + G1956;
-  const C<F> G1958 = G141 * G1921;
-  const C<F> G1959 = G145 * G1923;
-  const C<F> G1960 = G149 * G1925;
-  const C<F> G1961 = G1958 + G1959 + G1960;
-  const C<F> G1962 = G1258 * G1961;
-  const C<F> G1963 = G149 * G1920;
-  const C<F> G1964 = G1776 + G1554 + G1963;
-  const C<F> G1965 = G1267 * G1964;
-  const C<F> G1966 = C1 * G1965;
-  const C<F> G1967 = G1962 + G1966;
-  const C<F> G1968 = G138 * G1967;
-  const C<F> G1969 = G1279 * G1961;
-  const C<F> G1970 = G141 * G1936;
-  const C<F> G1971 = G145 * G1530;
-  const C<F> G1972 = G1970 + G1971 + G1299;
-  const C<F> G1973 = G1267 * G1972;
-  const C<F> G1974 = C1 * G1973;
-  const C<F> G1975 = G1969 + G1974;
-  const C<F> G1976 = G180 * G1975;
-  const C<F> G1977 = C1 * G1976;
-  const C<F> G1978 = G1968 + G1977;
-  const C<F> G1979 = G198 * G1967;
-  const C<F> G1980 = G1295 * G1961;
-  const C<F> G1981 = G141 * G1507;
-  const C<F> G1982 = G145 * G1936;
-  const C<F> G1983 = G149 * G1188;
-  const C<F> G1984 = G1981 + G1982 + G1983;
-  const C<F> G1985 = G1267 * G1984;
-  const C<F> G1986 = C1 * G1985;
-  const C<F> G1987 = G1980 + G1986;
-  const C<F> G1988 = G180 * G1987;
-  const C<F> G1989 = C1 * G1988;
-  const C<F> G1990 = G1979 + G1989;
-  const C<F> G1991 = G220 * G1921;
-  const C<F> G1992 = G224 * G1923;
-  const C<F> G1993 = G228 * G1925;
-  const C<F> G1994 = G1991 + G1992 + G1993;
-  const C<F> G1995 = G1310 * G1994;
-  const C<F> G1996 = G228 * G1920;
-  const C<F> G1997 = G1810 + G1589 + G1996;
-  const C<F> G1998 = G1319 * G1997;
-  const C<F> G1999 = C1 * G1998;
-  const C<F> G2000 = G1995 + G1999;
-  const C<F> G2001 = G217 * G2000;
-  const C<F> G2002 = G1331 * G1994;
-  const C<F> G2003 = G220 * G1936;
-  const C<F> G2004 = G224 * G1530;
-  const C<F> G2005 = G2003 + G2004 + G1351;
-  const C<F> G2006 = G1319 * G2005;
-  const C<F> G2007 = C1 * G2006;
-  const C<F> G2008 = G2002 + G2007;
-  const C<F> G2009 = G259 * G2008;
-  const C<F> G2010 = C1 * G2009;
-  const C<F> G2011 = G2001 + G2010;
-  const C<F> G2012 = G277 * G2000;
-  const C<F> G2013 = G1347 * G1994;
-  const C<F> G2014 = G220 * G1507;
-  const C<F> G2015 = G224 * G1936;
-  const C<F> G2016 = G228 * G1188;
-  const C<F> G2017 = G2014 + G2015 + G2016;
-  const C<F> G2018 = G1319 * G2017;
-  const C<F> G2019 = C1 * G2018;
-  const C<F> G2020 = G2013 + G2019;
-  const C<F> G2021 = G259 * G2020;
-  const C<F> G2022 = C1 * G2021;
-  const C<F> G2023 = G2012 + G2022;
-  const C<F> G2024 = G311 * G1921;
-  const C<F> G2025 = G315 * G1923;
-  const C<F> G2026 = G319 * G1925;
-  const C<F> G2027 = G2024 + G2025 + G2026;
-  const C<F> G2028 = G1362 * G2027;
-  const C<F> G2029 = G319 * G1920;
-  const C<F> G2030 = G1844 + G1624 + G2029;
-  const C<F> G2031 = G1371 * G2030;
-  const C<F> G2032 = C1 * G2031;
-  const C<F> G2033 = G2028 + G2032;
-  const C<F> G2034 = G302 * G2033;
-  const C<F> G2035 = G1383 * G2027;
-  const C<F> G2036 = G311 * G1936;
-  const C<F> G2037 = G315 * G1530;
-  const C<F> G2038 = G2036 + G2037 + G1403;
-  const C<F> G2039 = G1371 * G2038;
-  const C<F> G2040 = C1 * G2039;
-  const C<F> G2041 = G2035 + G2040;
-  const C<F> G2042 = G356 * G2041;
-  const C<F> G2043 = C1 * G2042;
-  const C<F> G2044 = G2034 + G2043;
-  const C<F> G2045 = G374 * G2033;
-  const C<F> G2046 = G1399 * G2027;
-  const C<F> G2047 = G311 * G1507;
-  const C<F> G2048 = G315 * G1936;
-  const C<F> G2049 = G319 * G1188;
-  const C<F> G2050 = G2047 + G2048 + G2049;
-  const C<F> G2051 = G1371 * G2050;
-  const C<F> G2052 = C1 * G2051;
-  const C<F> G2053 = G2046 + G2052;
-  const C<F> G2054 = G356 * G2053;
-  const C<F> G2055 = C1 * G2054;
-  const C<F> G2056 = G2045 + G2055;
-  const C<F> G2057 = G408 * G1921;
-  const C<F> G2058 = G412 * G1923;
-  const C<F> G2059 = G416 * G1925;
-  const C<F> G2060 = G2057 + G2058 + G2059;
-  const C<F> G2061 = G1414 * G2060;
-  const C<F> G2062 = G416 * G1920;
-  const C<F> G2063 = G1878 + G1659 + G2062;
-  const C<F> G2064 = G1423 * G2063;
-  const C<F> G2065 = C1 * G2064;
-  const C<F> G2066 = G2061 + G2065;
-  const C<F> G2067 = G399 * G2066;
-  const C<F> G2068 = G1435 * G2060;
-  const C<F> G2069 = G408 * G1936;
-  const C<F> G2070 = G412 * G1530;
-  const C<F> G2071 = G2069 + G2070 + G1455;
-  const C<F> G2072 = G1423 * G2071;
-  const C<F> G2073 = C1 * G2072;
-  const C<F> G2074 = G2068 + G2073;
-  const C<F> G2075 = G453 * G2074;
-  const C<F> G2076 = C1 * G2075;
-  const C<F> G2077 = G2067 + G2076;
-  const C<F> G2078 = G471 * G2066;
-  const C<F> G2079 = G1451 * G2060;
-  const C<F> G2080 = G408 * G1507;
-  const C<F> G2081 = G412 * G1936;
-  const C<F> G2082 = G416 * G1188;
-  const C<F> G2083 = G2080 + G2081 + G2082;
-  const C<F> G2084 = G1423 * G2083;
-  const C<F> G2085 = C1 * G2084;
-  const C<F> G2086 = G2079 + G2085;
-  const C<F> G2087 = G453 * G2086;
-  const C<F> G2088 = C1 * G2087;
-  const C<F> G2089 = G2078 + G2088;
-  const C<F> G2090 = G1310 * G1961;
-  const C<F> G2091 = G1319 * G1964;
-  const C<F> G2092 = C1 * G2091;
-  const C<F> G2093 = G2090 + G2092;
-  const C<F> G2094 = G277 * G2093;
-  const C<F> G2095 = G1347 * G1961;
-  const C<F> G2096 = G1319 * G1984;
-  const C<F> G2097 = C1 * G2096;
-  const C<F> G2098 = G2095 + G2097;
-  const C<F> G2099 = G259 * G2098;
-  const C<F> G2100 = C1 * G2099;
-  const C<F> G2101 = G2094 + G2100;
-  const C<F> G2102 = G138 * G2101;
-  const C<F> G2103 = G217 * G2093;
-  const C<F> G2104 = G1331 * G1961;
-  const C<F> G2105 = G1319 * G1972;
-  const C<F> G2106 = C1 * G2105;
-  const C<F> G2107 = G2104 + G2106;
-  const C<F> G2108 = G259 * G2107;
-  const C<F> G2109 = C1 * G2108;
-  const C<F> G2110 = G2103 + G2109;
-  const C<F> G2111 = G198 * G2110;
-  const C<F> G2112 = C1 * G2111;
-  const C<F> G2113 = G2102 + G2112;
-  const C<F> G2114 = G217 * G2098;
-  const C<F> G2115 = G277 * G2107;
-  const C<F> G2116 = C1 * G2115;
-  const C<F> G2117 = G2114 + G2116;
-  const C<F> G2118 = G180 * G2117;
-  const C<F> G2119 = G2113 + G2118;
-  const C<F> G2120 = G1 * X69;
-  const C<F> G2121 = t * X125;
-  const C<F> G2122 = G2120 + G2121;
-  const C<F> G2123 = G30 * G1180;
-  const C<F> G2124 = G62 * G2123;
-  const C<F> G2125 = C1 * G2124;
-  const C<F> G2126 = G4 * G2125;
-  const C<F> G2127 = G98 * G2123;
-  const C<F> G2128 = C1 * G2127;
-  const C<F> G2129 = G76 * G2128;
-  const C<F> G2130 = C1 * G2129;
-  const C<F> G2131 = G2126 + G2130;
-  const C<F> G2132 = G107 * G2125;
-  const C<F> G2133 = G129 * G2123;
-  const C<F> G2134 = C1 * G2133;
-  const C<F> G2135 = G76 * G2134;
-  const C<F> G2136 = C1 * G2135;
-  const C<F> G2137 = G2132 + G2136;
-  const C<F> G2138 = G154 * G1180;
-  const C<F> G2139 = G169 * G2138;
-  const C<F> G2140 = C1 * G2139;
-  const C<F> G2141 = G138 * G2140;
-  const C<F> G2142 = G189 * G2138;
-  const C<F> G2143 = C1 * G2142;
-  const C<F> G2144 = G180 * G2143;
-  const C<F> G2145 = C1 * G2144;
-  const C<F> G2146 = G2141 + G2145;
-  const C<F> G2147 = G198 * G2140;
-  const C<F> G2148 = G208 * G2138;
-  const C<F> G2149 = C1 * G2148;
-  const C<F> G2150 = G180 * G2149;
-  const C<F> G2151 = C1 * G2150;
-  const C<F> G2152 = G2147 + G2151;
-  const C<F> G2153 = G233 * G1180;
-  const C<F> G2154 = G248 * G2153;
-  const C<F> G2155 = C1 * G2154;
-  const C<F> G2156 = G217 * G2155;
-  const C<F> G2157 = G268 * G2153;
-  const C<F> G2158 = C1 * G2157;
-  const C<F> G2159 = G259 * G2158;
-  const C<F> G2160 = C1 * G2159;
-  const C<F> G2161 = G2156 + G2160;
-  const C<F> G2162 = G277 * G2155;
-  const C<F> G2163 = G287 * G2153;
-  const C<F> G2164 = C1 * G2163;
-  const C<F> G2165 = G259 * G2164;
-  const C<F> G2166 = C1 * G2165;
-  const C<F> G2167 = G2162 + G2166;
-  const C<F> G2168 = G330 * G1180;
-  const C<F> G2169 = G345 * G2168;
-  const C<F> G2170 = C1 * G2169;
-  const C<F> G2171 = G302 * G2170;
-  const C<F> G2172 = G365 * G2168;
-  const C<F> G2173 = C1 * G2172;
-  const C<F> G2174 = G356 * G2173;
-  const C<F> G2175 = C1 * G2174;
-  const C<F> G2176 = G2171 + G2175;
-  const C<F> G2177 = G374 * G2170;
-  const C<F> G2178 = G384 * G2168;
-  const C<F> G2179 = C1 * G2178;
-  const C<F> G2180 = G356 * G2179;
-  const C<F> G2181 = C1 * G2180;
-  const C<F> G2182 = G2177 + G2181;
-  const C<F> G2183 = G427 * G1180;
-  const C<F> G2184 = G442 * G2183;
-  const C<F> G2185 = C1 * G2184;
-  const C<F> G2186 = G399 * G2185;
-  const C<F> G2187 = G462 * G2183;
-  const C<F> G2188 = C1 * G2187;
-  const C<F> G2189 = G453 * G2188;
-  const C<F> G2190 = C1 * G2189;
-  const C<F> G2191 = G2186 + G2190;
-  const C<F> G2192 = G471 * G2185;
-  const C<F> G2193 = G481 * G2183;
-  const C<F> G2194 = C1 * G2193;
-  const C<F> G2195 = G453 * G2194;
-  const C<F> G2196 = C1 * G2195;
-  const C<F> G2197 = G2192 + G2196;
-  const C<F> G2198 = G169 * G2153;
-  const C<F> G2199 = C1 * G2198;
-  const C<F> G2200 = G277 * G2199;
-  const C<F> G2201 = G208 * G2153;
-  const C<F> G2202 = C1 * G2201;
-  const C<F> G2203 = G259 * G2202;
-  const C<F> G2204 = C1 * G2203;
-  const C<F> G2205 = G2200 + G2204;
-  const C<F> G2206 = G138 * G2205;
-  const C<F> G2207 = G217 * G2199;
-  const C<F> G2208 = G189 * G2153;
-  const C<F> G2209 = C1 * G2208;
-  const C<F> G2210 = G259 * G2209;
-  const C<F> G2211 = C1 * G2210;
-  const C<F> G2212 = G2207 + G2211;
-  const C<F> G2213 = G198 * G2212;
-  const C<F> G2214 = C1 * G2213;
-  const C<F> G2215 = G2206 + G2214;
-  const C<F> G2216 = G217 * G2202;
-  const C<F> G2217 = G277 * G2209;
-  const C<F> G2218 = C1 * G2217;
-  const C<F> G2219 = G2216 + G2218;
-  const C<F> G2220 = G180 * G2219;
-  const C<F> G2221 = G2215 + G2220;
-  const C<F> G2222 = G1 * X54;
-  const C<F> G2223 = t * X110;
-  const C<F> G2224 = G2222 + G2223;
-  const C<F> G2225 = G35 * G1180;
-  const C<F> G2226 = G62 * G2225;
-  const C<F> G2227 = C1 * G2226;
-  const C<F> G2228 = G4 * G2227;
-  const C<F> G2229 = G98 * G2225;
-  const C<F> G2230 = C1 * G2229;
-  const C<F> G2231 = G76 * G2230;
-  const C<F> G2232 = C1 * G2231;
-  const C<F> G2233 = G2228 + G2232;
-  const C<F> G2234 = G107 * G2227;
-  const C<F> G2235 = G129 * G2225;
-  const C<F> G2236 = C1 * G2235;
-  const C<F> G2237 = G76 * G2236;
-  const C<F> G2238 = C1 * G2237;
-  const C<F> G2239 = G2234 + G2238;
-  const C<F> G2240 = G158 * G1180;
-  const C<F> G2241 = G169 * G2240;
-  const C<F> G2242 = C1 * G2241;
-  const C<F> G2243 = G138 * G2242;
-  const C<F> G2244 = G189 * G2240;
-  const C<F> G2245 = C1 * G2244;
-  const C<F> G2246 = G180 * G2245;
-  const C<F> G2247 = C1 * G2246;
-  const C<F> G2248 = G2243 + G2247;
-  const C<F> G2249 = G198 * G2242;
-  const C<F> G2250 = G208 * G2240;
-  const C<F> G2251 = C1 * G2250;
-  const C<F> G2252 = G180 * G2251;
-  const C<F> G2253 = C1 * G2252;
-  const C<F> G2254 = G2249 + G2253;
-  const C<F> G2255 = G237 * G1180;
-  const C<F> G2256 = G248 * G2255;
-  const C<F> G2257 = C1 * G2256;
-  const C<F> G2258 = G217 * G2257;
-  const C<F> G2259 = G268 * G2255;
-  const C<F> G2260 = C1 * G2259;
-  const C<F> G2261 = G259 * G2260;
-  const C<F> G2262 = C1 * G2261;
-  const C<F> G2263 = G2258 + G2262;
-  const C<F> G2264 = G277 * G2257;
-  const C<F> G2265 = G287 * G2255;
-  const C<F> G2266 = C1 * G2265;
-  const C<F> G2267 = G259 * G2266;
-  const C<F> G2268 = C1 * G2267;
-  const C<F> G2269 = G2264 + G2268;
-  const C<F> G2270 = G334 * G1180;
-  const C<F> G2271 = G345 * G2270;
-  const C<F> G2272 = C1 * G2271;
-  const C<F> G2273 = G302 * G2272;
-  const C<F> G2274 = G365 * G2270;
-  const C<F> G2275 = C1 * G2274;
-  const C<F> G2276 = G356 * G2275;
-  const C<F> G2277 = C1 * G2276;
-  const C<F> G2278 = G2273 + G2277;
-  const C<F> G2279 = G374 * G2272;
-  const C<F> G2280 = G384 * G2270;
-  const C<F> G2281 = C1 * G2280;
-  const C<F> G2282 = G356 * G2281;
-  const C<F> G2283 = C1 * G2282;
-  const C<F> G2284 = G2279 + G2283;
-  const C<F> G2285 = G431 * G1180;
-  const C<F> G2286 = G442 * G2285;
-  const C<F> G2287 = C1 * G2286;
-  const C<F> G2288 = G399 * G2287;
-  const C<F> G2289 = G462 * G2285;
-  const C<F> G2290 = C1 * G2289;
-  const C<F> G2291 = G453 * G2290;
-  const C<F> G2292 = C1 * G2291;
-  const C<F> G2293 = G2288 + G2292;
-  const C<F> G2294 = G471 * G2287;
-  const C<F> G2295 = G481 * G2285;
-  const C<F> G2296 = C1 * G2295;
-  const C<F> G2297 = G453 * G2296;
-  const C<F> G2298 = C1 * G2297;
-  const C<F> G2299 = G2294 + G2298;
-  const C<F> G2300 = G169 * G2255;
-  const C<F> G2301 = C1 * G2300;
-  const C<F> G2302 = G277 * G2301;
-  const C<F> G2303 = G208 * G2255;
-  const C<F> G2304 = C1 * G2303;
-  const C<F> G2305 = G259 * G2304;
-  const C<F> G2306 = C1 * G2305;
-  const C<F> G2307 = G2302 + G2306;
-  const C<F> G2308 = G138 * G2307;
-  const C<F> G2309 = G217 * G2301;
-  const C<F> G2310 = G189 * G2255;
-  const C<F> G2311 = C1 * G2310;
-  const C<F> G2312 = G259 * G2311;
-  const C<F> G2313 = C1 * G2312;
-  const C<F> G2314 = G2309 + G2313;
-  const C<F> G2315 = G198 * G2314;
-  const C<F> G2316 = C1 * G2315;
-  const C<F> G2317 = G2308 + G2316;
-  const C<F> G2318 = G217 * G2304;
-  const C<F> G2319 = G277 * G2311;
-  const C<F> G2320 = C1 * G2319;
-  const C<F> G2321 = G2318 + G2320;
-  const C<F> G2322 = G180 * G2321;
-  const C<F> G2323 = G2317 + G2322;
-  const C<F> G2324 = G1 * X55;
-  const C<F> G2325 = t * X111;
-  const C<F> G2326 = G2324 + G2325;
-  const C<F> G2327 = G41 * G1180;
-  const C<F> G2328 = G62 * G2327;
-  const C<F> G2329 = C1 * G2328;
-  const C<F> G2330 = G4 * G2329;
-  const C<F> G2331 = G98 * G2327;
-  const C<F> G2332 = C1 * G2331;
-  const C<F> G2333 = G76 * G2332;
-  const C<F> G2334 = C1 * G2333;
-  const C<F> G2335 = G2330 + G2334;
-  const C<F> G2336 = G107 * G2329;
-  const C<F> G2337 = G129 * G2327;
-  const C<F> G2338 = C1 * G2337;
-  const C<F> G2339 = G76 * G2338;
-  const C<F> G2340 = C1 * G2339;
-  const C<F> G2341 = G2336 + G2340;
-  const C<F> G2342 = G162 * G1180;
-  const C<F> G2343 = G169 * G2342;
-  const C<F> G2344 = C1 * G2343;
-  const C<F> G2345 = G138 * G2344;
-  const C<F> G2346 = G189 * G2342;
-  const C<F> G2347 = C1 * G2346;
-  const C<F> G2348 = G180 * G2347;
-  const C<F> G2349 = C1 * G2348;
-  const C<F> G2350 = G2345 + G2349;
-  const C<F> G2351 = G198 * G2344;
-  const C<F> G2352 = G208 * G2342;
-  const C<F> G2353 = C1 * G2352;
-  const C<F> G2354 = G180 * G2353;
-  const C<F> G2355 = C1 * G2354;
-  const C<F> G2356 = G2351 + G2355;
-  const C<F> G2357 = G241 * G1180;
-  const C<F> G2358 = G248 * G2357;
-  const C<F> G2359 = C1 * G2358;
-  const C<F> G2360 = G217 * G2359;
-  const C<F> G2361 = G268 * G2357;
-  const C<F> G2362 = C1 * G2361;
-  const C<F> G2363 = G259 * G2362;
-  const C<F> G2364 = C1 * G2363;
-  const C<F> G2365 = G2360 + G2364;
-  const C<F> G2366 = G277 * G2359;
-  const C<F> G2367 = G287 * G2357;
-  const C<F> G2368 = C1 * G2367;
-  const C<F> G2369 = G259 * G2368;
-  const C<F> G2370 = C1 * G2369;
-  const C<F> G2371 = G2366 + G2370;
-  const C<F> G2372 = G338 * G1180;
-  const C<F> G2373 = G345 * G2372;
-  const C<F> G2374 = C1 * G2373;
-  const C<F> G2375 = G302 * G2374;
-  const C<F> G2376 = G365 * G2372;
-  const C<F> G2377 = C1 * G2376;
-  const C<F> G2378 = G356 * G2377;
-  const C<F> G2379 = C1 * G2378;
-  const C<F> G2380 = G2375 + G2379;
-  const C<F> G2381 = G374 * G2374;
-  const C<F> G2382 = G384 * G2372;
-  const C<F> G2383 = C1 * G2382;
-  const C<F> G2384 = G356 * G2383;
-  const C<F> G2385 = C1 * G2384;
-  const C<F> G2386 = G2381 + G2385;
-  const C<F> G2387 = G435 * G1180;
-  const C<F> G2388 = G442 * G2387;
-  const C<F> G2389 = C1 * G2388;
-  const C<F> G2390 = G399 * G2389;
-  const C<F> G2391 = G462 * G2387;
-  const C<F> G2392 = C1 * G2391;
-  const C<F> G2393 = G453 * G2392;
-  const C<F> G2394 = C1 * G2393;
-  const C<F> G2395 = G2390 + G2394;
-  const C<F> G2396 = G471 * G2389;
-  const C<F> G2397 = G481 * G2387;
-  const C<F> G2398 = C1 * G2397;
-  const C<F> G2399 = G453 * G2398;
-  const C<F> G2400 = C1 * G2399;
-  const C<F> G2401 = G2396 + G2400;
-  const C<F> G2402 = G169 * G2357;
-  const C<F> G2403 = C1 * G2402;
-  const C<F> G2404 = G277 * G2403;
-  const C<F> G2405 = G208 * G2357;
-  const C<F> G2406 = C1 * G2405;
-  const C<F> G2407 = G259 * G2406;
-  const C<F> G2408 = C1 * G2407;
-  const C<F> G2409 = G2404 + G2408;
-  const C<F> G2410 = G138 * G2409;
-  const C<F> G2411 = G217 * G2403;
-  const C<F> G2412 = G189 * G2357;
-  const C<F> G2413 = C1 * G2412;
-  const C<F> G2414 = G259 * G2413;
-  const C<F> G2415 = C1 * G2414;
-  const C<F> G2416 = G2411 + G2415;
-  const C<F> G2417 = G198 * G2416;
-  const C<F> G2418 = C1 * G2417;
-  const C<F> G2419 = G2410 + G2418;
-  const C<F> G2420 = G217 * G2406;
-  const C<F> G2421 = G277 * G2413;
-  const C<F> G2422 = C1 * G2421;
-  const C<F> G2423 = G2420 + G2422;
-  const C<F> G2424 = G180 * G2423;
-  const C<F> G2425 = G2419 + G2424;
-  const C<F> G2426 = G1 * X56;
-  const C<F> G2427 = t * X112;
-  const C<F> G2428 = G2426 + G2427;
-  const C<F> G2429 = G7 * G14;
-  const C<F> G2430 = G1168 * G2429;
-  const C<F> G2431 = G4 * G2430;
-  const C<F> G2432 = G1212 * G2429;
-  const C<F> G2433 = G76 * G2432;
-  const C<F> G2434 = C1 * G2433;
-  const C<F> G2435 = G2431 + G2434;
-  const C<F> G2436 = G107 * G2430;
-  const C<F> G2437 = G1240 * G2429;
-  const C<F> G2438 = G76 * G2437;
-  const C<F> G2439 = C1 * G2438;
-  const C<F> G2440 = G2436 + G2439;
-  const C<F> G2441 = G141 * G14;
-  const C<F> G2442 = G1258 * G2441;
-  const C<F> G2443 = G138 * G2442;
-  const C<F> G2444 = G1279 * G2441;
-  const C<F> G2445 = G180 * G2444;
-  const C<F> G2446 = C1 * G2445;
-  const C<F> G2447 = G2443 + G2446;
-  const C<F> G2448 = G198 * G2442;
-  const C<F> G2449 = G1295 * G2441;
-  const C<F> G2450 = G180 * G2449;
-  const C<F> G2451 = C1 * G2450;
-  const C<F> G2452 = G2448 + G2451;
-  const C<F> G2453 = G220 * G14;
-  const C<F> G2454 = G1310 * G2453;
-  const C<F> G2455 = G217 * G2454;
-  const C<F> G2456 = G1331 * G2453;
-  const C<F> G2457 = G259 * G2456;
-  const C<F> G2458 = C1 * G2457;
-  const C<F> G2459 = G2455 + G2458;
-  const C<F> G2460 = G277 * G2454;
-  const C<F> G2461 = G1347 * G2453;
-  const C<F> G2462 = G259 * G2461;
-  const C<F> G2463 = C1 * G2462;
-  const C<F> G2464 = G2460 + G2463;
-  const C<F> G2465 = G311 * G14;
-  const C<F> G2466 = G1362 * G2465;
-  const C<F> G2467 = G302 * G2466;
-  const C<F> G2468 = G1383 * G2465;
-  const C<F> G2469 = G356 * G2468;
-  const C<F> G2470 = C1 * G2469;
-  const C<F> G2471 = G2467 + G2470;
-  const C<F> G2472 = G374 * G2466;
-  const C<F> G2473 = G1399 * G2465;
-  const C<F> G2474 = G356 * G2473;
-  const C<F> G2475 = C1 * G2474;
-  const C<F> G2476 = G2472 + G2475;
-  const C<F> G2477 = G408 * G14;
-  const C<F> G2478 = G1414 * G2477;
-  const C<F> G2479 = G399 * G2478;
-  const C<F> G2480 = G1435 * G2477;
-  const C<F> G2481 = G453 * G2480;
-  const C<F> G2482 = C1 * G2481;
-  const C<F> G2483 = G2479 + G2482;
-  const C<F> G2484 = G471 * G2478;
-  const C<F> G2485 = G1451 * G2477;
-  const C<F> G2486 = G453 * G2485;
-  const C<F> G2487 = C1 * G2486;
-  const C<F> G2488 = G2484 + G2487;
-  const C<F> G2489 = G1310 * G2441;
-  const C<F> G2490 = G277 * G2489;
-  const C<F> G2491 = G1347 * G2441;
-  const C<F> G2492 = G259 * G2491;
-  const C<F> G2493 = C1 * G2492;
-  const C<F> G2494 = G2490 + G2493;
-  const C<F> G2495 = G138 * G2494;
-  const C<F> G2496 = G217 * G2489;
-  const C<F> G2497 = G1331 * G2441;
-  const C<F> G2498 = G259 * G2497;
-  const C<F> G2499 = C1 * G2498;
-  const C<F> G2500 = G2496 + G2499;
-  const C<F> G2501 = G198 * G2500;
-  const C<F> G2502 = C1 * G2501;
-  const C<F> G2503 = G2495 + G2502;
-  const C<F> G2504 = G217 * G2491;
-  const C<F> G2505 = G277 * G2497;
-  const C<F> G2506 = C1 * G2505;
-  const C<F> G2507 = G2504 + G2506;
-  const C<F> G2508 = G180 * G2507;
-  const C<F> G2509 = G2503 + G2508;
-  const C<F> G2510 = G1 * X57;
-  const C<F> G2511 = t * X113;
-  const C<F> G2512 = G2510 + G2511;
-  const C<F> G2513 = G19 * G14;
-  const C<F> G2514 = G1168 * G2513;
-  const C<F> G2515 = G4 * G2514;
-  const C<F> G2516 = G1212 * G2513;
-  const C<F> G2517 = G76 * G2516;
-  const C<F> G2518 = C1 * G2517;
-  const C<F> G2519 = G2515 + G2518;
-  const C<F> G2520 = G107 * G2514;
-  const C<F> G2521 = G1240 * G2513;
-  const C<F> G2522 = G76 * G2521;
-  const C<F> G2523 = C1 * G2522;
-  const C<F> G2524 = G2520 + G2523;
-  const C<F> G2525 = G145 * G14;
-  const C<F> G2526 = G1258 * G2525;
-  const C<F> G2527 = G138 * G2526;
-  const C<F> G2528 = G1279 * G2525;
-  const C<F> G2529 = G180 * G2528;
-  const C<F> G2530 = C1 * G2529;
-  const C<F> G2531 = G2527 + G2530;
-  const C<F> G2532 = G198 * G2526;
-  const C<F> G2533 = G1295 * G2525;
-  const C<F> G2534 = G180 * G2533;
-  const C<F> G2535 = C1 * G2534;
-  const C<F> G2536 = G2532 + G2535;
-  const C<F> G2537 = G224 * G14;
-  const C<F> G2538 = G1310 * G2537;
-  const C<F> G2539 = G217 * G2538;
-  const C<F> G2540 = G1331 * G2537;
-  const C<F> G2541 = G259 * G2540;
-  const C<F> G2542 = C1 * G2541;
-  const C<F> G2543 = G2539 + G2542;
-  const C<F> G2544 = G277 * G2538;
-  const C<F> G2545 = G1347 * G2537;
-  const C<F> G2546 = G259 * G2545;
-  const C<F> G2547 = C1 * G2546;
-  const C<F> G2548 = G2544 + G2547;
-  const C<F> G2549 = G315 * G14;
-  const C<F> G2550 = G1362 * G2549;
-  const C<F> G2551 = G302 * G2550;
-  const C<F> G2552 = G1383 * G2549;
-  const C<F> G2553 = G356 * G2552;
-  const C<F> G2554 = C1 * G2553;
-  const C<F> G2555 = G2551 + G2554;
-  const C<F> G2556 = G374 * G2550;
-  const C<F> G2557 = G1399 * G2549;
-  const C<F> G2558 = G356 * G2557;
-  const C<F> G2559 = C1 * G2558;
-  const C<F> G2560 = G2556 + G2559;
-  const C<F> G2561 = G412 * G14;
-  const C<F> G2562 = G1414 * G2561;
-  const C<F> G2563 = G399 * G2562;
-  const C<F> G2564 = G1435 * G2561;
-  const C<F> G2565 = G453 * G2564;
-  const C<F> G2566 = C1 * G2565;
-  const C<F> G2567 = G2563 + G2566;
-  const C<F> G2568 = G471 * G2562;
-  const C<F> G2569 = G1451 * G2561;
-  const C<F> G2570 = G453 * G2569;
-  const C<F> G2571 = C1 * G2570;
-  const C<F> G2572 = G2568 + G2571;
-  const C<F> G2573 = G1310 * G2525;
-  const C<F> G2574 = G277 * G2573;
-  const C<F> G2575 = G1347 * G2525;
-  const C<F> G2576 = G259 * G2575;
-  const C<F> G2577 = C1 * G2576;
-  const C<F> G2578 = G2574 + G2577;
-  const C<F> G2579 = G138 * G2578;
-  const C<F> G2580 = G217 * G2573;
-  const C<F> G2581 = G1331 * G2525;
-  const C<F> G2582 = G259 * G2581;
-  const C<F> G2583 = C1 * G2582;
-  const C<F> G2584 = G2580 + G2583;
-  const C<F> G2585 = G198 * G2584;
-  const C<F> G2586 = C1 * G2585;
-  const C<F> G2587 = G2579 + G2586;
-  const C<F> G2588 = G217 * G2575;
-  const C<F> G2589 = G277 * G2581;
-  const C<F> G2590 = C1 * G2589;
-  const C<F> G2591 = G2588 + G2590;
-  const C<F> G2592 = G180 * G2591;
-  const C<F> G2593 = G2587 + G2592;
-  const C<F> G2594 = G1 * X58;
-  const C<F> G2595 = t * X114;
-  const C<F> G2596 = G2594 + G2595;
-  const C<F> G2597 = G24 * G14;
-  const C<F> G2598 = G1168 * G2597;
-  const C<F> G2599 = G4 * G2598;
-  const C<F> G2600 = G1212 * G2597;
-  const C<F> G2601 = G76 * G2600;
-  const C<F> G2602 = C1 * G2601;
-  const C<F> G2603 = G2599 + G2602;
-  const C<F> G2604 = G107 * G2598;
-  const C<F> G2605 = G1240 * G2597;
-  const C<F> G2606 = G76 * G2605;
-  const C<F> G2607 = C1 * G2606;
-  const C<F> G2608 = G2604 + G2607;
-  const C<F> G2609 = G149 * G14;
-  const C<F> G2610 = G1258 * G2609;
-  const C<F> G2611 = G138 * G2610;
-  const C<F> G2612 = G1279 * G2609;
-  const C<F> G2613 = G180 * G2612;
-  const C<F> G2614 = C1 * G2613;
-  const C<F> G2615 = G2611 + G2614;
-  const C<F> G2616 = G198 * G2610;
-  const C<F> G2617 = G1295 * G2609;
-  const C<F> G2618 = G180 * G2617;
-  const C<F> G2619 = C1 * G2618;
-  const C<F> G2620 = G2616 + G2619;
-  const C<F> G2621 = G228 * G14;
-  const C<F> G2622 = G1310 * G2621;
-  const C<F> G2623 = G217 * G2622;
-  const C<F> G2624 = G1331 * G2621;
-  const C<F> G2625 = G259 * G2624;
-  const C<F> G2626 = C1 * G2625;
-  const C<F> G2627 = G2623 + G2626;
-  const C<F> G2628 = G277 * G2622;
-  const C<F> G2629 = G1347 * G2621;
-  const C<F> G2630 = G259 * G2629;
-  const C<F> G2631 = C1 * G2630;
-  const C<F> G2632 = G2628 + G2631;
-  const C<F> G2633 = G319 * G14;
-  const C<F> G2634 = G1362 * G2633;
-  const C<F> G2635 = G302 * G2634;
-  const C<F> G2636 = G1383 * G2633;
-  const C<F> G2637 = G356 * G2636;
-  const C<F> G2638 = C1 * G2637;
-  const C<F> G2639 = G2635 + G2638;
-  const C<F> G2640 = G374 * G2634;
-  const C<F> G2641 = G1399 * G2633;
-  const C<F> G2642 = G356 * G2641;
-  const C<F> G2643 = C1 * G2642;
-  const C<F> G2644 = G2640 + G2643;
-  const C<F> G2645 = G416 * G14;
-  const C<F> G2646 = G1414 * G2645;
-  const C<F> G2647 = G399 * G2646;
-  const C<F> G2648 = G1435 * G2645;
-  const C<F> G2649 = G453 * G2648;
-  const C<F> G2650 = C1 * G2649;
-  const C<F> G2651 = G2647 + G2650;
-  const C<F> G2652 = G471 * G2646;
-  const C<F> G2653 = G1451 * G2645;
-  const C<F> G2654 = G453 * G2653;
-  const C<F> G2655 = C1 * G2654;
-  const C<F> G2656 = G2652 + G2655;
-  const C<F> G2657 = G1310 * G2609;
-  const C<F> G2658 = G277 * G2657;
-  const C<F> G2659 = G1347 * G2609;
-  const C<F> G2660 = G259 * G2659;
-  const C<F> G2661 = C1 * G2660;
-  const C<F> G2662 = G2658 + G2661;
-  const C<F> G2663 = G138 * G2662;
-  const C<F> G2664 = G217 * G2657;
-  const C<F> G2665 = G1331 * G2609;
-  const C<F> G2666 = G259 * G2665;
-  const C<F> G2667 = C1 * G2666;
-  const C<F> G2668 = G2664 + G2667;
-  const C<F> G2669 = G198 * G2668;
-  const C<F> G2670 = C1 * G2669;
-  const C<F> G2671 = G2663 + G2670;
-  const C<F> G2672 = G217 * G2659;
-  const C<F> G2673 = G277 * G2665;
-  const C<F> G2674 = C1 * G2673;
-  const C<F> G2675 = G2672 + G2674;
-  const C<F> G2676 = G180 * G2675;
-  const C<F> G2677 = G2671 + G2676;
-  const C<F> G2678 = G1 * X59;
-  const C<F> G2679 = t * X115;
-  const C<F> G2680 = G2678 + G2679;
-  const C<F> G2681 = G1168 * G27;
-  const C<F> G2682 = G62 * G1187;
-  const C<F> G2683 = C1 * G2682;
-  const C<F> G2684 = G2681 + G2683;
-  const C<F> G2685 = G4 * G2684;
-  const C<F> G2686 = G1212 * G27;
-  const C<F> G2687 = G98 * G1187;
-  const C<F> G2688 = C1 * G2687;
-  const C<F> G2689 = G2686 + G2688;
-  const C<F> G2690 = G76 * G2689;
-  const C<F> G2691 = C1 * G2690;
-  const C<F> G2692 = G2685 + G2691;
-  const C<F> G2693 = G107 * G2684;
-  const C<F> G2694 = G1240 * G27;
-  const C<F> G2695 = G129 * G1187;
-  const C<F> G2696 = C1 * G2695;
-  const C<F> G2697 = G2694 + G2696;
-  const C<F> G2698 = G76 * G2697;
-  const C<F> G2699 = C1 * G2698;
-  const C<F> G2700 = G2693 + G2699;
-  const C<F> G2701 = G1258 * G151;
-  const C<F> G2702 = G169 * G1267;
-  const C<F> G2703 = C1 * G2702;
-  const C<F> G2704 = G2701 + G2703;
-  const C<F> G2705 = G138 * G2704;
-  const C<F> G2706 = G1279 * G151;
-  const C<F> G2707 = G189 * G1267;
-  const C<F> G2708 = C1 * G2707;
-  const C<F> G2709 = G2706 + G2708;
-  const C<F> G2710 = G180 * G2709;
-  const C<F> G2711 = C1 * G2710;
-  const C<F> G2712 = G2705 + G2711;
-  const C<F> G2713 = G198 * G2704;
-  const C<F> G2714 = G1295 * G151;
-  const C<F> G2715 = G208 * G1267;
-  const C<F> G2716 = C1 * G2715;
-  const C<F> G2717 = G2714 + G2716;
-  const C<F> G2718 = G180 * G2717;
-  const C<F> G2719 = C1 * G2718;
-  const C<F> G2720 = G2713 + G2719;
-  const C<F> G2721 = G1310 * G230;
-  const C<F> G2722 = G248 * G1319;
-  const C<F> G2723 = C1 * G2722;
-  const C<F> G2724 = G2721 + G2723;
-  const C<F> G2725 = G217 * G2724;
-  const C<F> G2726 = G1331 * G230;
-  const C<F> G2727 = G268 * G1319;
-  const C<F> G2728 = C1 * G2727;
-  const C<F> G2729 = G2726 + G2728;
-  const C<F> G2730 = G259 * G2729;
-  const C<F> G2731 = C1 * G2730;
-  const C<F> G2732 = G2725 + G2731;
-  const C<F> G2733 = G277 * G2724;
-  const C<F> G2734 = G1347 * G230;
-  const C<F> G2735 = G287 * G1319;
-  const C<F> G2736 = C1 * G2735;
-  const C<F> G2737 = G2734 + G2736;
-  const C<F> G2738 = G259 * G2737;
-  const C<F> G2739 = C1 * G2738;
-  const C<F> G2740 = G2733 + G2739;
-  const C<F> G2741 = G1362 * G321;
-  const C<F> G2742 = G345 * G1371;
-  const C<F> G2743 = C1 * G2742;
-  const C<F> G2744 = G2741 + G2743;
-  const C<F> G2745 = G302 * G2744;
-  const C<F> G2746 = G1383 * G321;
-  const C<F> G2747 = G365 * G1371;
-  const C<F> G2748 = C1 * G2747;
-  const C<F> G2749 = G2746 + G2748;
-  const C<F> G2750 = G356 * G2749;
-  const C<F> G2751 = C1 * G2750;
-  const C<F> G2752 = G2745 + G2751;
-  const C<F> G2753 = G374 * G2744;
-  const C<F> G2754 = G1399 * G321;
-  const C<F> G2755 = G384 * G1371;
-  const C<F> G2756 = C1 * G2755;
-  const C<F> G2757 = G2754 + G2756;
-  const C<F> G2758 = G356 * G2757;
-  const C<F> G2759 = C1 * G2758;
-  const C<F> G2760 = G2753 + G2759;
-  const C<F> G2761 = G1414 * G418;
-  const C<F> G2762 = G442 * G1423;
-  const C<F> G2763 = C1 * G2762;
-  const C<F> G2764 = G2761 + G2763;
-  const C<F> G2765 = G399 * G2764;
-  const C<F> G2766 = G1435 * G418;
-  const C<F> G2767 = G462 * G1423;
-  const C<F> G2768 = C1 * G2767;
-  const C<F> G2769 = G2766 + G2768;
-  const C<F> G2770 = G453 * G2769;
-  const C<F> G2771 = C1 * G2770;
-  const C<F> G2772 = G2765 + G2771;
-  const C<F> G2773 = G471 * G2764;
-  const C<F> G2774 = G1451 * G418;
-  const C<F> G2775 = G481 * G1423;
-  const C<F> G2776 = C1 * G2775;
-  const C<F> G2777 = G2774 + G2776;
-  const C<F> G2778 = G453 * G2777;
-  const C<F> G2779 = C1 * G2778;
-  const C<F> G2780 = G2773 + G2779;
-  const C<F> G2781 = G1310 * G151;
-  const C<F> G2782 = G169 * G1319;
-  const C<F> G2783 = C1 * G2782;
-  const C<F> G2784 = G2781 + G2783;
-  const C<F> G2785 = G277 * G2784;
-  const C<F> G2786 = G1347 * G151;
-  const C<F> G2787 = G208 * G1319;
-  const C<F> G2788 = C1 * G2787;
-  const C<F> G2789 = G2786 + G2788;
-  const C<F> G2790 = G259 * G2789;
-  const C<F> G2791 = C1 * G2790;
-  const C<F> G2792 = G2785 + G2791;
-  const C<F> G2793 = G138 * G2792;
-  const C<F> G2794 = G217 * G2784;
-  const C<F> G2795 = G1331 * G151;
-  const C<F> G2796 = G189 * G1319;
-  const C<F> G2797 = C1 * G2796;
-  const C<F> G2798 = G2795 + G2797;
-  const C<F> G2799 = G259 * G2798;
-  const C<F> G2800 = C1 * G2799;
-  const C<F> G2801 = G2794 + G2800;
-  const C<F> G2802 = G198 * G2801;
-  const C<F> G2803 = C1 * G2802;
-  const C<F> G2804 = G2793 + G2803;
-  const C<F> G2805 = G217 * G2789;
-  const C<F> G2806 = G277 * G2798;
-  const C<F> G2807 = C1 * G2806;
-  const C<F> G2808 = G2805 + G2807;
-  const C<F> G2809 = G180 * G2808;
-  const C<F> G2810 = G2804 + G2809;
-  const C<F> G2811 = G2224 * X8;
-  const C<F> G2812 = G2326 * X9;
-  const C<F> G2813 = G2428 * X10;
-  const C<F> G2814 = G2512 * X11;
-  const C<F> G2815 = G2596 * X12;
-  const C<F> G2816 = G2680 * X13;
-  const C<F> G2817 = G1 * X60;
-  const C<F> G2818 = t * X116;
-  const C<F> G2819 = G2817 + G2818;
-  const C<F> G2820 = G2811 + G2812 + G2813 + G2814 + G2815 + G2816 + G2819;
-  const C<F> G2821 = G520 * X0;
-  const C<F> G2822 = G736 * X1;
-  const C<F> G2823 = G944 * X2;
-  const C<F> G2824 = G1147 * X3;
-  const C<F> G2825 = G1 * X65;
-  const C<F> G2826 = t * X121;
-  const C<F> G2827 = G2825 + G2826;
-  const C<F> G2828 = G2821 + G2822 + G2823 + G2824 + G2827;
-  const C<F> G2829 = G1495 * X4;
-  const C<F> G2830 = G1711 * X5;
-  const C<F> G2831 = G1919 * X6;
-  const C<F> G2832 = G2122 * X7;
-  const C<F> G2833 = G1 * X70;
-  const C<F> G2834 = t * X126;
-  const C<F> G2835 = G2833 + G2834;
-  const C<F> G2836 = G2829 + G2830 + G2831 + G2832 + G2835;
-//  y[0] = G104;
-//  y[1] = G135;
-//  y[2] = G195;
-//  y[3] = G214;
-//  y[4] = G274;
-//  y[5] = G293;
-//  y[6] = G371;
-//  y[7] = G390;
-//  y[8] = G468;
-//  y[9] = G487;
-//  y[10] = G517;
-//  y[12] = G520;
-//  y[14] = G551;
-//  y[15] = G563;
-//  y[16] = G587;
-//  y[17] = G598;
-//  y[18] = G622;
-//  y[19] = G633;
-//  y[20] = G657;
-//  y[21] = G668;
-//  y[22] = G692;
-//  y[23] = G703;
-//  y[24] = G733;
-//  y[26] = G736;
-//  y[28] = G764;
-//  y[29] = G775;
-//  y[30] = G798;
-//  y[31] = G809;
-//  y[32] = G832;
-//  y[33] = G843;
-//  y[34] = G866;
-//  y[35] = G877;
-//  y[36] = G900;
-//  y[37] = G911;
-//  y[38] = G941;
-//  y[40] = G944;
-//  y[42] = G970;
-//  y[43] = G982;
-//  y[44] = G1003;
-//  y[45] = G1015;
-//  y[46] = G1036;
-//  y[47] = G1048;
-//  y[48] = G1069;
-//  y[49] = G1081;
-//  y[50] = G1102;
-//  y[51] = G1114;
-//  y[52] = G1144;
-//  y[54] = G1147;
-//  y[56] = G1226;
-//  y[57] = G1254;
-//  y[58] = G1290;
-//  y[59] = G1306;
-//  y[60] = G1342;
-//  y[61] = G1358;
-//  y[62] = G1394;
-//  y[63] = G1410;
-//  y[64] = G1446;
-//  y[65] = G1462;
-//  y[66] = G1492;
-//  y[69] = G1495;
-//  y[70] = G1526;
-//  y[71] = G1538;
-//  y[72] = G1562;
-//  y[73] = G1573;
-//  y[74] = G1597;
-//  y[75] = G1608;
-//  y[76] = G1632;
-//  y[77] = G1643;
-//  y[78] = G1667;
-//  y[79] = G1678;
-//  y[80] = G1708;
-//  y[83] = G1711;
-//  y[84] = G1739;
-//  y[85] = G1750;
-//  y[86] = G1773;
-//  y[87] = G1784;
-//  y[88] = G1807;
-//  y[89] = G1818;
-//  y[90] = G1841;
-//  y[91] = G1852;
-//  y[92] = G1875;
-//  y[93] = G1886;
-//  y[94] = G1916;
-//  y[97] = G1919;
-//  y[98] = G1945;
-//  y[99] = G1957;
-//  y[100] = G1978;
-//  y[101] = G1990;
-//  y[102] = G2011;
-//  y[103] = G2023;
-//  y[104] = G2044;
-//  y[105] = G2056;
-//  y[106] = G2077;
-//  y[107] = G2089;
-//  y[108] = G2119;
-//  y[111] = G2122;
-//  y[112] = G2131;
-//  y[113] = G2137;
-//  y[114] = G2146;
-//  y[115] = G2152;
-//  y[116] = G2161;
-//  y[117] = G2167;
-//  y[118] = G2176;
-//  y[119] = G2182;
-//  y[120] = G2191;
-//  y[121] = G2197;
-//  y[122] = G2221;
-//  y[123] = G2224;
-//  y[126] = G2233;
-//  y[127] = G2239;
-//  y[128] = G2248;
-//  y[129] = G2254;
-//  y[130] = G2263;
-//  y[131] = G2269;
-//  y[132] = G2278;
-//  y[133] = G2284;
-//  y[134] = G2293;
-//  y[135] = G2299;
-//  y[136] = G2323;
-//  y[137] = G2326;
-//  y[140] = G2335;
-//  y[141] = G2341;
-//  y[142] = G2350;
-//  y[143] = G2356;
-//  y[144] = G2365;
-//  y[145] = G2371;
-//  y[146] = G2380;
-//  y[147] = G2386;
-//  y[148] = G2395;
-//  y[149] = G2401;
-//  y[150] = G2425;
-//  y[151] = G2428;
-//  y[154] = G2435;
-//  y[155] = G2440;
-//  y[156] = G2447;
-//  y[157] = G2452;
-//  y[158] = G2459;
-//  y[159] = G2464;
-//  y[160] = G2471;
-//  y[161] = G2476;
-//  y[162] = G2483;
-//  y[163] = G2488;
-//  y[164] = G2509;
-//  y[165] = G2512;
-//  y[168] = G2519;
-//  y[169] = G2524;
-//  y[170] = G2531;
-//  y[171] = G2536;
-//  y[172] = G2543;
-//  y[173] = G2548;
-//  y[174] = G2555;
-//  y[175] = G2560;
-//  y[176] = G2567;
-//  y[177] = G2572;
-//  y[178] = G2593;
-//  y[179] = G2596;
-//  y[182] = G2603;
-//  y[183] = G2608;
-//  y[184] = G2615;
-//  y[185] = G2620;
-//  y[186] = G2627;
-//  y[187] = G2632;
-//  y[188] = G2639;
-//  y[189] = G2644;
-//  y[190] = G2651;
-//  y[191] = G2656;
-//  y[192] = G2677;
-//  y[193] = G2680;
-//  y[196] = -G2692;
-//  y[197] = -G2700;
-//  y[198] = -G2712;
-//  y[199] = -G2720;
-//  y[200] = -G2732;
-//  y[201] = -G2740;
-//  y[202] = -G2752;
-//  y[203] = -G2760;
-//  y[204] = -G2772;
-//  y[205] = -G2780;
-//  y[206] = -G2810;
-//  y[207] = -G2820;
-//  y[208] = -G2828;
-//  y[209] = -G2836;
-//  ;
-//
-
-//  y[26] = G736;
-//  y[40] = G944;
-//  y[54] = G1147;
-//  y[69] = G1495;
-//  y[83] = G1711;
-//  y[97] = G1919;
-//  y[111] = G2122;
-//  y[123] = G2224;
-//  y[137] = G2326;
-//  y[151] = G2428;
-//  y[165] = G2512;
-//  y[179] = G2596;
-//  y[193] = G2680;
-//  y[207] = -G2820;
-//  y[208] = -G2828;
-//  y[209] = -G2836;
-
-
-
-//  yc[10] =  G2512;
-//  yc[11] =  G2596;
-//  yc[12] =  G2680;
-//  yc[13] = -G2820;
-//  yc[14] = -G2828;
-//  yc[15] = -G2836;
-#endif
-}
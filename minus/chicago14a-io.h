@@ -20,7 +20,7 @@ struct minus_io<chicago14a, F> : public minus_io_14a<chicago14a, F> {
   static bool point_tangents2params_img(const F p[pp::nviews][pp::npoints][io::ncoords2d], const F tgt[pp::nviews][pp::npoints][io::ncoords2d], unsigned id_tgt0, unsigned id_tgt1, const F K[/*3 or 2*/][io::ncoords2d_h], C<F> * __restrict params/*[static 2*M::nparams]*/, bool gammify_start_params=true);
   // this function is the same for all problems
   static void get_params_start_target(F plines[/*15 for chicago*/][io::ncoords2d_h], C<F> * __restrict params/*[static 2*M::nparams]*/, bool gammify_start_params=true);
-  static bool point_tangents2lines(const F p[pp::nviews][pp::npoints][io::ncoords2d], const F tgt[pp::nviews][pp::npoints][io::ncoords2d], unsigned id_tgt0, unsigned id_tgt1, F plines[pp::nvislines][io::ncoords2d_h]);
+  static bool point_tangents2lines(const F p[pp::nviews][pp::npoints][io::ncoords2d], const F tgt[pp::nviews][pp::npoints][io::ncoords2d], unsigned id_tgt0, unsigned id_tgt1, F plines[pp::nvislines][io::ncoords2d_h], F *score=nullptr);
   static void lines2params(const F plines[pp::nvislines][io::ncoords2d_h], C<F> * __restrict params/*[static M::n//params]*/);
   // Output --------------------------------------------------------------------
   static bool has_valid_solutions(const typename M::solution solutions[M::nsols]);
@@ -1,4 +1,7 @@
 // Specific to Chicago
+// Dense solve, kept for reference. The tracker uses the structured solve
+// below.
+//
 // Solves Ax = b
 //
 // That is:
@@ -64,3 +67,176 @@ lsolve(
   x[1]  -= (m(1,2)*x[2]+m(1,3)*x[3]+m(1,4)*x[4]+m(1,5)*x[5]+m(1,6)*x[6]+m(1,7)*x[7]+m(1,8)*x[8]+m(1,9)*x[9]+m(1,10)*x[10]+m(1,11)*x[11]+m(1,12)*x[12]+m(1,13)*x[13]); x[1] /= m(1,1);
   x[0]  -= (m(0,1)*x[1]+m(0,2)*x[2]+m(0,3)*x[3]+m(0,4)*x[4]+m(0,5)*x[5]+m(0,6)*x[6]+m(0,7)*x[7]+m(0,8)*x[8]+m(0,9)*x[9]+m(0,10)*x[10]+m(0,11)*x[11]+m(0,12)*x[12]+m(0,13)*x[13]); x[0] /= m(0,0);
 }
+
+// Sizes of the structured solve below, and what it keeps for resolve()
+struct chart_factors_base {
+  static constexpr unsigned n = 14, b = 14*14; // b: column of b
+  static constexpr unsigned nchart = 3, nfree = n - nchart;
+};
+
+template <typename F>
+struct chart_factors : chart_factors_base {
+  alignas(64) F s[2*nfree*(nfree+1)];  // 11x12 block of T, column-major
+  unsigned char piv[nfree];    // pivots of its LU
+  unsigned char chart_piv[nchart]; // unknown each chart row is solved for
+  unsigned char col[nfree + 1]; // the remaining unknowns, then b
+};
+
+// Structured solve of the Chicago [Hx | Ht] block, used by the tracker.
+//
+// Solves Ax = b given m = [A | b] (column-major 14x15, m[col*14 + row]), making
+// use of its fixed sparsity. Rows 0-10 are dense, but the last three are the
+// linear chart equations, each involving a disjoint group of unknowns:
+//
+//   row 12: q01 chart, columns 0-3
+//   row 13: q02 chart, columns 4-7
+//   row 11: translation chart, columns 8-13
+//
+// All other entries of rows 11-13 are zero and are never read, so they need
+// not be written by the evaluators either. Each chart row is solved for its
+// biggest coefficient, x_a = (b_r - sum_{j != a} m(r,j) x_j) / m(r,a), which
+// is substituted into rows 0-10 (the Schur complement of the chart rows, with a
+// fixed fill pattern inside each group). That leaves a dense 11x11 system,
+// solved by the unrolled LU of lsolve.hxx, after which the three chart
+// unknowns are back-substituted. About half the flops of the dense 14x14 LU.
+//
+// Generic on the scalar type T, with m and x only needing operator[]. m is
+// overwritten.
+//
+// solve(m, lu, x) keeps what resolve(m, lu, x) needs to solve for another b:
+// the chart rows of m, which were scaled in place, the untouched chart
+// columns a, and the LU of the 11x11 system, gathered into lu.
+template <typename T, typename MV, typename XV>
+struct lsolve_chart : chart_factors_base {
+  typedef typename complex_traits<T>::real F;
+  typedef lsolve_unrolled<nfree, T, T *, T *> lu11;
+  static constexpr unsigned char chart_row[nchart] = {12, 13, 11};
+  static constexpr unsigned char chart_begin[nchart] = {0, 4, 8};
+  static constexpr unsigned char chart_end[nchart] = {4, 8, 14};
+
+  // Eliminates the chart unknowns from rows 0-10 of [A | b] and gathers the
+  // resulting 11x12 system into s
+  static __attribute__((always_inline)) inline void
+  reduce(MV m, unsigned char piv[nchart], unsigned char col[nfree + 1], T *s)
+  {
+    for (unsigned c = 0, nc = 0; c < nchart; ++c) {
+      const unsigned r = chart_row[c];
+      unsigned a = chart_begin[c];
+      F biggest = norm(T(m[a*n+r]));
+      for (unsigned j = a+1; j < chart_end[c]; ++j) {
+        const F tmp = norm(T(m[j*n+r]));
+        if (tmp > biggest) { biggest = tmp; a = j; }
+      }
+      piv[c] = a;
+      // row r := row r / m(r,a), so that x_a = m(r,b) - sum_{j != a} m(r,j) x_j
+      const T inv = T(1) / T(m[a*n+r]);
+      for (unsigned j = chart_begin[c]; j < chart_end[c]; ++j)
+        if (j != a) { m[j*n+r] = T(m[j*n+r]) * inv; col[nc++] = j; }
+      m[b+r] = T(m[b+r]) * inv;
+      // substitute x_a in the dense rows
+      for (unsigned i = 0; i < nfree; ++i) {
+        const T f = m[a*n+i];
+        for (unsigned j = chart_begin[c]; j < chart_end[c]; ++j)
+          if (j != a) m[j*n+i] = T(m[j*n+i]) - f * T(m[j*n+r]);
+        m[b+i] = T(m[b+i]) - f * T(m[b+r]);
+      }
+    }
+    col[nfree] = n;
+    for (unsigned jj = 0; jj <= nfree; ++jj)
+      for (unsigned i = 0; i < nfree; ++i)
+        s[jj*nfree+i] = T(m[col[jj]*n+i]);
+  }
+
+  // Scatters the solution y of the 11x11 system into x, then recovers the
+  // chart unknowns from the scaled chart rows, whose b entries are br
+  static __attribute__((always_inline)) inline void
+  expand(MV m, const unsigned char piv[nchart], const unsigned char col[nfree + 1],
+      const T *y, const T br[nchart], XV x)
+  {
+    for (unsigned k = 0; k < nfree; ++k)
+      x[col[k]] = y[k];
+    for (unsigned c = 0; c < nchart; ++c) {
+      const unsigned r = chart_row[c], a = piv[c];
+      T v = br[c];
+      for (unsigned j = chart_begin[c]; j < chart_end[c]; ++j)
+        if (j != a) v = v - T(m[j*n+r]) * T(x[j]);
+      x[a] = v;
+    }
+  }
+
+  static __attribute__((always_inline)) inline void
+  solve(MV m, XV x)
+  {
+    unsigned char piv[nchart], col[nfree + 1];
+    alignas(64) T s[nfree*(nfree+1)], y[nfree], br[nchart];
+    reduce(m, piv, col, s);
+    lu11::solve(s, y);
+    for (unsigned c = 0; c < nchart; ++c)
+      br[c] = m[b+chart_row[c]];
+    expand(m, piv, col, y, br, x);
+  }
+
+  static __attribute__((always_inline)) inline void
+  solve(MV m, chart_factors<F> *lu, XV x)
+  {
+    T * const s = reinterpret_cast<T *>(lu->s);
+    alignas(64) T y[nfree], br[nchart];
+    reduce(m, lu->chart_piv, lu->col, s);
+    lu11::solve(s, lu->piv, y);
+    for (unsigned c = 0; c < nchart; ++c)
+      br[c] = m[b+chart_row[c]];
+    expand(m, lu->chart_piv, lu->col, y, br, x);
+  }
+
+  // x holds b on input
+  static __attribute__((always_inline)) inline void
+  resolve(MV m, const chart_factors<F> &lu, XV x)
+  {
+    T * const s = const_cast<T *>(reinterpret_cast<const T *>(lu.s));
+    alignas(64) T y[nfree], br[nchart];
+    for (unsigned i = 0; i < nfree; ++i)
+      y[i] = x[i];
+    for (unsigned c = 0; c < nchart; ++c) {
+      const unsigned r = chart_row[c], a = lu.chart_piv[c];
+      br[c] = T(x[r]) / T(m[a*n+r]);
+      for (unsigned i = 0; i < nfree; ++i)
+        y[i] = y[i] - T(m[a*n+i]) * br[c];
+    }
+    lu11::resolve(s, lu.piv, y);
+    expand(m, lu.chart_piv, lu.col, y, br, x);
+  }
+};
+
+template <typename T, typename MV, typename XV>
+constexpr unsigned char lsolve_chart<T, MV, XV>::chart_row[];
+template <typename T, typename MV, typename XV>
+constexpr unsigned char lsolve_chart<T, MV, XV>::chart_begin[];
+template <typename T, typename MV, typename XV>
+constexpr unsigned char lsolve_chart<T, MV, XV>::chart_end[];
+
+// The tracker uses the structured solve for Chicago
+template <typename F>
+struct lsolver<chicago14a, F> {
+  static constexpr unsigned n = formulation_parameters<chicago14a>::nve;
+  typedef chart_factors<F> factors;
+  typedef lsolve_chart<C<F>, C<F> *, C<F> *> chart;
+
+  static __attribute__((always_inline)) inline void solve(C<F> * __restrict um, C<F> * __restrict ux)
+  {
+    C<F> * const m = reinterpret_cast<C<F> *> (__builtin_assume_aligned(um,64));
+    C<F> * const x = reinterpret_cast<C<F> *> (__builtin_assume_aligned(ux,64));
+    chart::solve(m, x);
+  }
+  static __attribute__((always_inline)) inline void solve(C<F> * __restrict um, factors *lu, C<F> * __restrict ux)
+  {
+    C<F> * const m = reinterpret_cast<C<F> *> (__builtin_assume_aligned(um,64));
+    C<F> * const x = reinterpret_cast<C<F> *> (__builtin_assume_aligned(ux,64));
+    chart::solve(m, lu, x);
+  }
+  static __attribute__((always_inline)) inline void resolve(C<F> * __restrict um, const factors &lu, C<F> * __restrict ux)
+  {
+    C<F> * const m = reinterpret_cast<C<F> *> (__builtin_assume_aligned(um,64));
+    C<F> * const x = reinterpret_cast<C<F> *> (__builtin_assume_aligned(ux,64));
+    chart::resolve(m, lu, x);
+  }
+};
@@ -15,6 +15,12 @@ struct formulation_parameters<chicago14a> {
   //    pChart: 2xquaternions + 2translations + 1 homg coord per quat + 1 homg
   //    coord per [t01 t02] pair = 2*4+2*3+2+1 = 17
   //    internal note: see inGates in chicago.m2
+  //    The charts are affine: each picks one point of the line {lambda q} of
+  //    a quaternion, -q included, and of [t01 t02]. So no two of the nsols
+  //    solutions are sign flips of one another, and there is no orbit of the
+  //    quaternion sign ambiguity left to track only once.
+  static constexpr unsigned nconstants = 56;  // parameter-only values memoized per solve,
+                                              // see eval<chicago14a,F>::constants
 };
 
 template <>
@@ -8,11 +8,39 @@ template <typename F>
 struct eval<chicago14a, F> {
   static void inline  __attribute__((always_inline)) Hxt(const C<F> * __restrict x /*x, t*/,    const C<F> * __restrict params, C<F> * __restrict y /*Hxt*/);
   static void inline  __attribute__((always_inline)) HxH(const C<F> * __restrict x /*x and t*/, const C<F> * __restrict params, C<F> * __restrict y /*HxH*/);
-  static void inline  __attribute__((always_inline)) Hxt_constants(const C<F> * __restrict x /*x, t*/,    const C<F> * __restrict params, C<F> * __restrict y /*Hxt*/);
-  static void inline  __attribute__((always_inline)) HxH_constants(const C<F> * __restrict x /*x, t*/,    const C<F> * __restrict params, C<F> * __restrict y /*HxH*/);
-  static void inline  __attribute__((always_inline)) HxH_constants_all_sols(const C<F> * __restrict x /*x, t*/,    const C<F> * __restrict params, C<F> * __restrict y /*HxH*/);
+  // memoization of the parameter-only values, once per solve:
+  static void inline  __attribute__((always_inline)) constants(const C<F> * __restrict params, C<F> * __restrict memo);
+  static void inline  __attribute__((always_inline)) Hxt(const C<F> * __restrict x /*x, t*/,    const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict y /*Hxt*/);
+  static void inline  __attribute__((always_inline)) HxH(const C<F> * __restrict x /*x and t*/, const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict y /*HxH*/);
+  // -H alone, the last column of HxH
+  static void inline  __attribute__((always_inline)) H(const C<F> * __restrict x /*x and t*/, const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict y /*-H*/);
+  // -H on jets, for the Taylor predictor
+  template <unsigned K>
+  static void inline  __attribute__((always_inline)) H(const jet<C<F>,K> * __restrict x, F t, const C<F> * __restrict params, const C<F> * __restrict memo, jet<C<F>,K> * __restrict y /*-H*/);
+  // generic straight-line programs behind the above
+  template <typename T, typename XV, typename TV, typename PV, typename MV, typename YV>
+  static void inline  __attribute__((always_inline)) Hxt_slp(XV x, TV t, PV params, MV memo, YV y);
+  template <typename T, typename XV, typename TV, typename PV, typename MV, typename YV>
+  static void inline  __attribute__((always_inline)) HxH_slp(XV x, TV t, PV params, MV memo, YV y);
 };
 
+// Parameter-only values of the evaluators, computed once per solve and
+// only read afterwards, so all tracking threads can share one memo.
+//
+// The homotopy parameters are (1-t)*p0 + t*p1 for start p0 = params[0:56] and
+// target p1 = params[56:112]. Every gate of Hxt and HxH that depends on params
+// alone is one of the differences p1 - p0, which also are the d/dt of the
+// homotopy parameters. So the memo is memo[i] = p1[i] - p0[i].
+template <typename F>
+inline __attribute__((always_inline)) void 
+eval<chicago14a, F>::
+constants(const C<F> * __restrict params, C<F> * __restrict memo)
+{
+  static constexpr unsigned n = formulation_parameters<chicago14a>::nparams;
+  for (unsigned i = 0; i < n; ++i)
+    memo[i] = params[n+i] - params[i];
+}
+
 #include "chicago14a-Hxt.hxx"
 #include "chicago14a-HxH.hxx"
 
@@ -196,11 +224,16 @@ gammify(C<F> * __restrict params /*[ chicago: M::nparams]*/)
 // if you intend to reuse it 
 //
 // Input points and tangents in normalized image coordinates.
+//
+// score, if given, receives the smallest angle between a tangent line and a
+// line through its point and another one, a cheap conditioning score of the
+// tangent pair i0, i1 (larger is better, 0 if the points are degenerate).
+// Returns false below 1e-4.
 
 template <typename F>
 bool 
 minus_io<chicago14a, F>::
-point_tangents2lines(const F p[pp::nviews][pp::npoints][io::ncoords2d], const F t[pp::nviews][pp::npoints][io::ncoords2d], unsigned i0, unsigned i1, F plines[pp::nvislines][io::ncoords2d_h])
+point_tangents2lines(const F p[pp::nviews][pp::npoints][io::ncoords2d], const F t[pp::nviews][pp::npoints][io::ncoords2d], unsigned i0, unsigned i1, F plines[pp::nvislines][io::ncoords2d_h], F *score)
 {
   typedef minus_3d<F> vec;
   typedef minus_array<M::nve,F> v;
@@ -211,6 +244,7 @@ point_tangents2lines(const F p[pp::nviews][pp::npoints][io::ncoords2d], const F
   static constexpr double eps = 1e-4; // very important to tune this as it will
                                       // save a lot of time if trash is
                                       // early-detected
+  if (score) *score = 0;
   if (v::area2(p[0][i0],p[0][i1],p[0][i2])  < eps ||  // retinal area.  Could be spherical area 
       v::area2(p[1][i0],p[1][i1],p[1][i2])  < eps || 
       v::area2(p[2][i0],p[2][i1],p[2][i2])  < eps) {
@@ -247,42 +281,28 @@ point_tangents2lines(const F p[pp::nviews][pp::npoints][io::ncoords2d], const F
 
   io::normalize_lines(plines, pp::nvislines);
 
-  if (v::abs_angle_between_lines(plines[0], plines[9])  < eps || 
-      v::abs_angle_between_lines(plines[1], plines[10]) < eps ||
-      v::abs_angle_between_lines(plines[2], plines[11]) < eps ||
-
-      v::abs_angle_between_lines(plines[3], plines[9])  < eps ||
-      v::abs_angle_between_lines(plines[4], plines[10]) < eps ||
-      v::abs_angle_between_lines(plines[5], plines[11]) < eps ||
-      
-      v::abs_angle_between_lines(plines[6], plines[12]) < eps ||
-      v::abs_angle_between_lines(plines[7], plines[13]) < eps ||
-      v::abs_angle_between_lines(plines[8], plines[14]) < eps ||
-      
-      v::abs_angle_between_lines(plines[0], plines[12]) < eps ||
-      v::abs_angle_between_lines(plines[1], plines[13]) < eps ||
-      v::abs_angle_between_lines(plines[2], plines[14]) < eps) {
-//    std::cerr << "MINUS: angle error ------------------------\n";
-//    std::cerr << "Angles: " << 
-//          v::abs_angle_between_lines(plines[0], plines[9])  << " " << 
-//          v::abs_angle_between_lines(plines[1], plines[10]) << " " <<
-//          v::abs_angle_between_lines(plines[2], plines[11]) << " " <<
-
-//          v::abs_angle_between_lines(plines[3], plines[9]) << " " <<
-//          v::abs_angle_between_lines(plines[4], plines[10]) << " " <<
-//          v::abs_angle_between_lines(plines[5], plines[11]) << " " <<
-//          
-//          v::abs_angle_between_lines(plines[6], plines[12]) << " " <<
-//          v::abs_angle_between_lines(plines[7], plines[13]) << " " <<
-//          v::abs_angle_between_lines(plines[8], plines[14]) << " " <<
-//          
-//          v::abs_angle_between_lines(plines[0], plines[12]) << " " <<
-//          v::abs_angle_between_lines(plines[1], plines[13]) << " " <<
-//          v::abs_angle_between_lines(plines[2], plines[14]);
-   return false;
-  }
-  
-  return true;
+  // the angles between each tangent line and the lines through its point and
+  // the other two; the pair is degenerate as any of them goes to 0
+  const F angles[] = {
+    v::abs_angle_between_lines(plines[0], plines[9]), 
+    v::abs_angle_between_lines(plines[1], plines[10]),
+    v::abs_angle_between_lines(plines[2], plines[11]),
+
+    v::abs_angle_between_lines(plines[3], plines[9]), 
+    v::abs_angle_between_lines(plines[4], plines[10]),
+    v::abs_angle_between_lines(plines[5], plines[11]),
+    
+    v::abs_angle_between_lines(plines[6], plines[12]),
+    v::abs_angle_between_lines(plines[7], plines[13]),
+    v::abs_angle_between_lines(plines[8], plines[14]),
+    
+    v::abs_angle_between_lines(plines[0], plines[12]),
+    v::abs_angle_between_lines(plines[1], plines[13]),
+    v::abs_angle_between_lines(plines[2], plines[14])
+  };
+  const F min_angle = *std::min_element(angles, angles + sizeof(angles)/sizeof(F));
+  if (score) *score = min_angle;
+  return min_angle >= eps;
 }
 
 // gammify_start_params: set to false if your start parameters are already
@@ -361,6 +381,7 @@ point_tangents2params_img(
 // Highlevel solver interface - Class minus ------------------------------------
 
 #include <thread>
+#include <mutex>
 #include "chicago14a-default-data.h"
 
 namespace MiNuS {
@@ -404,6 +425,72 @@ minus<chicago14a, F>::solve(
     unsigned *nsols_final,
     unsigned nthreads
     )
+{
+  return solve(p, tgt, solutions_cams, id_sols, nsols_final, nthreads, nullptr, nullptr);
+}
+
+// 
+// same as solve() but runs on the parked workers of pool, see thread-pool.h
+// 
+template <typename F>
+inline bool
+minus<chicago14a, F>::solve(
+    const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+    const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+    F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]
+    unsigned id_sols[M::nsols],
+    unsigned *nsols_final,
+    minus_thread_pool &pool
+    )
+{
+  return solve(p, tgt, solutions_cams, id_sols, nsols_final, pool.nthreads(), &pool, nullptr);
+}
+
+// 
+// same as solve() but within budget, see problem-defs.h
+// 
+template <typename F>
+inline bool
+minus<chicago14a, F>::solve(
+    const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+    const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+    F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]
+    unsigned id_sols[M::nsols],
+    unsigned *nsols_final,
+    typename M::track_budget &budget,
+    unsigned nthreads
+    )
+{
+  return solve(p, tgt, solutions_cams, id_sols, nsols_final, nthreads, nullptr, &budget);
+}
+
+template <typename F>
+inline bool
+minus<chicago14a, F>::solve(
+    const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+    const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+    F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]
+    unsigned id_sols[M::nsols],
+    unsigned *nsols_final,
+    typename M::track_budget &budget,
+    minus_thread_pool &pool
+    )
+{
+  return solve(p, tgt, solutions_cams, id_sols, nsols_final, pool.nthreads(), &pool, &budget);
+}
+
+template <typename F>
+inline bool
+minus<chicago14a, F>::solve(
+    const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+    const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+    F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]
+    unsigned id_sols[M::nsols],
+    unsigned *nsols_final,
+    unsigned nthreads,
+    minus_thread_pool *pool,
+    typename M::track_budget *budget
+    )
 {
   typedef minus_data<chicago14a,F> data;
   alignas(64) C<F> params[2*M::f::nparams];
@@ -414,31 +501,302 @@ minus<chicago14a, F>::solve(
     return false;
 
   alignas(64) typename M::solution solutions[M::nsols];
-  alignas(64) typename M::track_settings settings = M::DEFAULT;
+  if (!solve_params(params, solutions, nthreads, pool, budget))
+    return false;
+ 
+  // decode solutions into 3x4 cams (actually 4x3 in mem)
+  io::all_solutions2cams(solutions, solutions_cams, id_sols, nsols_final);
 
-  unsigned npaths_per_thread = M::nsols/nthreads;
-  assert(M::nsols % nthreads == 0);
-  
+  // filter solutions that have no positive >1 depth for all three views
+  return *nsols_final > 0;
+}
 
-  // TODO: improve https://stackoverflow.com/questions/55908791/creating-100-threads-in-c
-  std::vector<std::thread> t; 
-  t.reserve(nthreads);
-  { // TODO: smarter way to select start solutions
-    for (unsigned i = 0; i < nthreads; ++i)
-      t.emplace_back(M::track, settings, data::start_sols_, params, solutions, 
-          npaths_per_thread*i, npaths_per_thread*(i+1));
+// 
+// tracks all paths from the start system to params, see problem-defs.h
+// 
+template <typename F>
+inline bool
+minus<chicago14a, F>::solve_params(
+    const C<F> params[2*M::f::nparams],
+    typename M::solution solutions[M::nsols],
+    unsigned nthreads,
+    minus_thread_pool *pool,
+    typename M::track_budget *budget
+    )
+{
+  typedef minus_data<chicago14a,F> data;
+  alignas(64) typename M::track_settings settings = M::DEFAULT;
+  settings.budget_ = budget;
+  alignas(64) C<F> memo[M::f::nconstants]; // shared read-only by all threads
+  M::evaluate_constants(params, memo);
+
+  // Paths are claimed dynamically in small chunks, so any number of threads
+  // works and the slowest thread is not stuck with a fixed range of long paths.
+  // The calling thread tracks too.
+  typename M::path_scheduler sched(0, M::nsols);
+  if (!nthreads) nthreads = 1;
+
+  if (pool)
+    pool->run([&] { M::track_scheduled(settings, data::start_sols_, params, memo, solutions, &sched); });
+  else { // TODO: smarter way to select start solutions
+    std::vector<std::thread> t; 
+    t.reserve(nthreads-1);
+    for (unsigned i = 0; i + 1 < nthreads; ++i)
+      t.emplace_back(M::track_scheduled, settings, data::start_sols_, params, memo, solutions, &sched);
+    M::track_scheduled(settings, data::start_sols_, params, memo, solutions, &sched);
 
      for (auto &thr : t)
           thr.join();
   }
-  if (!io::has_valid_solutions(solutions))
+  // out of budget: whatever was found, see track_budget
+  const auto out_of_budget = [budget] { return budget && budget->charge(0); };
+  if (out_of_budget())
+    return true;
+  { // rare: paths that jumped onto another one, retracked with a finer step
+    typename M::track_settings finer = settings;
+    finer.epsilon2_ *= 1e-2;
+    finer.init_dt_ *= .25;
+    finer.max_num_steps_ *= 4;
+    M::retrack_collisions(settings, finer, data::start_sols_, params, memo, solutions, 0, M::nsols);
+  }
+  M::retrack_detour(settings, data::start_sols_, params, solutions, 0, M::nsols); // opt-in, see detour_budget_
+  if (!io::has_valid_solutions(solutions)) { // rare: retrack only the failed paths
+    // Most failures run out of steps rather than precision (see
+    // cmd/minus-bench.cxx), so first allow more steps, then go to double_double
+    // for a few paths, see wide_retrack_max_paths_
+    typename M::track_settings longer = settings;
+    longer.max_num_steps_ *= 4;
+    M::template retrack_failed<F>(longer, data::start_sols_, params, solutions, 0, M::nsols);
+    if (!io::has_valid_solutions(solutions)) {
+      if (out_of_budget())
+        return false;
+      typename minus_core<chicago14a, double_double>::track_settings wider;
+      wider.max_num_steps_ *= 4;
+      M::template retrack_failed<double_double>(wider, data::start_sols_, params, solutions, 0, M::nsols,
+          settings.wide_retrack_max_paths_, budget);
+      if (!io::has_valid_solutions(solutions))
+        return false;
+    }
+  }
+  return true;
+}
+
+// 
+// solve() with the best conditioned tangent pair, see problem-defs.h
+// 
+template <typename F>
+inline bool
+minus<chicago14a, F>::solve_best_tangents(
+    const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+    const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+    F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]
+    unsigned id_sols[M::nsols],
+    unsigned *nsols_final,
+    unsigned nthreads,
+    unsigned *id_tgt
+    )
+{
+  return solve_best_tangents(p, tgt, solutions_cams, id_sols, nsols_final, nthreads, nullptr, id_tgt);
+}
+
+template <typename F>
+inline bool
+minus<chicago14a, F>::solve_best_tangents(
+    const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+    const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+    F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]
+    unsigned id_sols[M::nsols],
+    unsigned *nsols_final,
+    minus_thread_pool &pool,
+    unsigned *id_tgt
+    )
+{
+  return solve_best_tangents(p, tgt, solutions_cams, id_sols, nsols_final, pool.nthreads(), &pool, id_tgt);
+}
+
+// Each pair already tracks on all threads, so the pairs are solved one after
+// the other rather than concurrently: the first one usually succeeds.
+template <typename F>
+inline bool
+minus<chicago14a, F>::solve_best_tangents(
+    const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+    const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+    F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]
+    unsigned id_sols[M::nsols],
+    unsigned *nsols_final,
+    unsigned nthreads,
+    minus_thread_pool *pool,
+    unsigned *id_tgt
+    )
+{
+  typedef minus_data<chicago14a,F> data;
+  static constexpr unsigned pairs[3][2] = {{1,2}, {0,2}, {0,1}}; // by the tangent left out
+  F plines[3][pp::nvislines][io::ncoords2d_h], score[3];
+  unsigned rank[3] = {2, 1, 0}; // ties keep solve()'s pair first
+  for (unsigned i = 0; i < 3; ++i)
+    if (!io::point_tangents2lines(p, tgt, pairs[i][0], pairs[i][1], plines[i], score + i))
+      score[i] = -1;
+  std::stable_sort(rank, rank + 3, [&score](unsigned a, unsigned b) { return score[a] > score[b]; });
+
+  alignas(64) C<F> params[2*M::f::nparams];
+  alignas(64) typename M::solution solutions[M::nsols];
+  for (unsigned r = 0; r < 3 && score[rank[r]] >= 0; ++r) {
+    memcpy(params, data::params_start_target_, M::f::nparams*sizeof(C<F>));
+    io::get_params_start_target(plines[rank[r]], params);
+    for (auto &s : solutions) s = typename M::solution();
+    if (!solve_params(params, solutions, nthreads, pool, nullptr))
+      continue;
+    io::all_solutions2cams(solutions, solutions_cams, id_sols, nsols_final);
+    if (id_tgt) *id_tgt = rank[r];
+    return true;
+  }
+  return false;
+}
+
+// 
+// early exit solve, see problem-defs.h
+// 
+template <typename F>
+inline bool
+minus<chicago14a, F>::solve_first(
+    unsigned k, const acceptor &accept,
+    const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+    const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+    F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]
+    unsigned id_sols[M::nsols],
+    unsigned *nsols_final,
+    unsigned nthreads,
+    const unsigned short *order
+    )
+{
+  return solve_first(k, accept, p, tgt, solutions_cams, id_sols, nsols_final, nthreads, nullptr, order);
+}
+
+template <typename F>
+inline bool
+minus<chicago14a, F>::solve_first(
+    unsigned k, const acceptor &accept,
+    const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+    const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+    F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]
+    unsigned id_sols[M::nsols],
+    unsigned *nsols_final,
+    minus_thread_pool &pool,
+    const unsigned short *order
+    )
+{
+  return solve_first(k, accept, p, tgt, solutions_cams, id_sols, nsols_final, pool.nthreads(), &pool, order);
+}
+
+template <typename F>
+inline bool
+minus<chicago14a, F>::solve_first(
+    unsigned k, const acceptor &accept,
+    const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+    const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+    F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]
+    unsigned id_sols[M::nsols],
+    unsigned *nsols_final,
+    unsigned nthreads,
+    minus_thread_pool *pool,
+    const unsigned short *order
+    )
+{
+  typedef minus_data<chicago14a,F> data;
+  typedef minus_array<M::nve,F> v;
+  alignas(64) C<F> params[2*M::f::nparams];
+  memcpy(params, data::params_start_target_, M::f::nparams*sizeof(C<F>));
+  
+  *nsols_final = 0;
+  constexpr int id_tgt0 = 0; constexpr int id_tgt1 = 1;
+  if (!k || !io::point_tangents2params(p, tgt, id_tgt0, id_tgt1, params))
     return false;
- 
-  // decode solutions into 3x4 cams (actually 4x3 in mem)
-  io::all_solutions2cams(solutions, solutions_cams, id_sols, nsols_final);
 
-  // filter solutions that have no positive >1 depth for all three views
-  return true;
+  alignas(64) typename M::solution solutions[M::nsols];
+  alignas(64) C<F> memo[M::f::nconstants];
+  M::evaluate_constants(params, memo);
+
+  // One path per claim, so that a cancel takes effect after the path each
+  // thread is on. The retracking passes of solve() are not run.
+  typename M::path_scheduler sched(0, M::nsols, 1, order);
+  std::mutex m;
+  auto work = [&] {
+    unsigned b, e;
+    while (sched.claim(&b, &e)) {
+      const unsigned sol = sched.path(b);
+      M::track_memoized(M::DEFAULT, data::start_sols_, params, memo, solutions, sol, sol + 1);
+      F rs[M::nve], cams[pp::nviews-1][4][3];
+      if (solutions[sol].status != M::REGULAR || !v::get_real(solutions[sol].x, rs))
+        continue;
+      io::solution2cams(rs, cams);
+      if (!accept(cams))
+        continue;
+      std::lock_guard<std::mutex> lock(m);
+      if (*nsols_final == k) // others got there first
+        break;
+      memcpy(solutions_cams[sol], cams, sizeof(cams));
+      id_sols[(*nsols_final)++] = sol;
+      if (*nsols_final == k)
+        sched.cancel();
+    }
+  };
+  if (!nthreads) nthreads = 1;
+  if (pool)
+    pool->run(work);
+  else {
+    std::vector<std::thread> t; 
+    t.reserve(nthreads-1);
+    for (unsigned i = 0; i + 1 < nthreads; ++i)
+      t.emplace_back(work);
+    work();
+    for (auto &thr : t)
+      thr.join();
+  }
+  return *nsols_final > 0;
+}
+
+// 
+// video mode, see problem-defs.h
+// 
+template <typename F>
+inline unsigned
+minus<chicago14a, F>::continue_from(
+    const C<F> prev_params[M::f::nparams],
+    const typename M::solution prev_solutions[],
+    unsigned k,
+    const C<F> new_params[M::f::nparams],
+    typename M::solution solutions[M::nsols],
+    unsigned nthreads
+    )
+{
+  typedef minus_data<chicago14a,F> data;
+  typedef minus_array<M::nve,F> v;
+  assert(k <= M::nsols);
+  alignas(64) C<F> params[2*M::f::nparams];
+
+  if (k) { // a path or two is not worth more threads
+    alignas(64) C<F> s_sols[M::nsols*M::nve];
+    alignas(64) C<F> memo[M::f::nconstants];
+    alignas(64) typename M::solution continued[M::nsols];
+    memcpy(params, prev_params, M::f::nparams*sizeof(C<F>));
+    memcpy(params + M::f::nparams, new_params, M::f::nparams*sizeof(C<F>));
+    for (unsigned i = 0; i < k; ++i)
+      v::copy(prev_solutions[i].x, s_sols + i*M::nve);
+    M::evaluate_constants(params, memo);
+    M::track_memoized(M::DEFAULT, s_sols, params, memo, continued, 0, k);
+    F real_solution[M::nve];
+    for (unsigned i = 0; i < k; ++i)
+      if (continued[i].status == M::REGULAR && v::get_real(continued[i].x, real_solution)) {
+        std::copy(continued, continued + k, solutions);
+        return k;
+      }
+  }
+  // lost track: solve the new frame from scratch
+  memcpy(params, data::params_start_target_, M::f::nparams*sizeof(C<F>));
+  memcpy(params + M::f::nparams, new_params, M::f::nparams*sizeof(C<F>));
+  io::gammify(params);
+  io::gammify(params + M::f::nparams);
+  return solve_params(params, solutions, nthreads, nullptr, nullptr) ? M::nsols : 0;
 }
 
 // 
@@ -471,6 +829,35 @@ minus<chicago14a, F>::solve_img(
   return solve(pn, tn, solutions_cams, id_sols, nsols_final, nthreads);
 }
 
+// 
+// same as solve_img() but runs on the parked workers of pool, see thread-pool.h
+// 
+template <typename F>
+inline bool
+minus<chicago14a, F>::solve_img(
+    const F K[/*3 or 2 ignoring last line*/][io::ncoords2d_h],
+    const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+    const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+    F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]
+    unsigned id_sols[M::nsols],
+    unsigned *nsols_final,
+    minus_thread_pool &pool)
+{
+  F pn[pp::nviews][pp::npoints][io::ncoords2d];
+  F tn[pp::nviews][pp::npoints][io::ncoords2d];
+  
+  // see if uno minus  default_gammas_m2 is less than 1
+  io::invert_intrinsics(K, p[0], pn[0], pp::npoints);
+  io::invert_intrinsics(K, p[1], pn[1], pp::npoints);
+  io::invert_intrinsics(K, p[2], pn[2], pp::npoints);
+  // don't use all three, but just invert all anyways.
+  io::invert_intrinsics_tgt(K, tgt[0], tn[0], pp::npoints);
+  io::invert_intrinsics_tgt(K, tgt[1], tn[1], pp::npoints);
+  io::invert_intrinsics_tgt(K, tgt[2], tn[2], pp::npoints);
+
+  return solve(pn, tn, solutions_cams, id_sols, nsols_final, pool);
+}
+
 //
 // Performs tests to see if there are potentially valid solutions,
 // without making use of ground truth. 
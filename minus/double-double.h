@@ -0,0 +1,130 @@
+#ifndef double_double_h_
+#define double_double_h_
+//
+// \brief Double-double floating point, to retrack in extended precision the
+// few paths that fail in double, see minus_core::retrack_failed()
+//
+// A value is the unevaluated sum hi + lo of two doubles with |lo| <= ulp(hi)/2,
+// for about 32 significant digits. The algorithms are those of the QD library
+// (Hida, Li, Bailey), built on the error-free transforms two_sum and
+// two_prod. Everything minus_core<P, F> needs of F is provided, so that eval,
+// lsolve and the tracker instantiate on F = double_double unchanged.
+//
+// The error-free transforms need each double operation rounded exactly as
+// written. -ffast-math lets the compiler reassociate them, eg fold
+// (a + b) - a into b, which silently degrades double_double to double. Each
+// intermediate that must be kept as rounded is passed through opaque(),
+// which the optimizer cannot see through.
+//
+// \author Ricardo Fabbri
+//
+#include <cmath>
+#include <limits>
+
+namespace MiNuS {
+
+struct double_double {
+  double hi, lo;
+  constexpr double_double(double h = 0, double l = 0) : hi(h), lo(l) { }
+  constexpr explicit operator double() const { return hi; }
+
+  // error-free transforms ------------------------------------------------------
+  static inline __attribute__((always_inline)) double opaque(double x)
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    __asm__ ("" : "+x" (x));
+#elif defined(__aarch64__)
+    __asm__ ("" : "+w" (x));
+#else
+    __asm__ ("" : "+m" (x));
+#endif
+    return x;
+  }
+  // a + b = s + e exactly, assuming |a| >= |b|
+  static inline __attribute__((always_inline)) double quick_two_sum(double a, double b, double *e)
+  { const double s = opaque(a + b); *e = b - opaque(s - a); return s; }
+  // a + b = s + e exactly
+  static inline __attribute__((always_inline)) double two_sum(double a, double b, double *e)
+  {
+    const double s = opaque(a + b), bb = opaque(s - a);
+    *e = opaque(a - opaque(s - bb)) + opaque(b - bb);
+    return s;
+  }
+  // a * b = p + e exactly
+  static inline __attribute__((always_inline)) double two_prod(double a, double b, double *e)
+  { const double p = opaque(a * b); *e = std::fma(a, b, -p); return p; }
+
+  // arithmetic -----------------------------------------------------------------
+  friend inline double_double operator+(double_double a, double_double b)
+  {
+    double e1, e2;
+    double s = two_sum(a.hi, b.hi, &e1);
+    const double t = two_sum(a.lo, b.lo, &e2);
+    e1 += t;
+    s = quick_two_sum(s, e1, &e1);
+    e1 += e2;
+    s = quick_two_sum(s, e1, &e1);
+    return double_double(s, e1);
+  }
+  friend inline double_double operator-(double_double a) { return double_double(-a.hi, -a.lo); }
+  friend inline double_double operator-(double_double a, double_double b) { return a + (-b); }
+  friend inline double_double operator*(double_double a, double_double b)
+  {
+    double e;
+    const double p = two_prod(a.hi, b.hi, &e);
+    e += a.hi * b.lo + a.lo * b.hi;
+    const double s = quick_two_sum(p, e, &e);
+    return double_double(s, e);
+  }
+  friend inline double_double operator/(double_double a, double_double b)
+  {
+    const double q1 = a.hi / b.hi;
+    double_double r = a - q1 * b;
+    const double q2 = r.hi / b.hi;
+    r = r - q2 * b;
+    const double q3 = r.hi / b.hi;
+    double e;
+    const double s = quick_two_sum(q1, q2, &e);
+    return double_double(s, e) + q3;
+  }
+  double_double &operator+=(double_double b) { return *this = *this + b; }
+  double_double &operator-=(double_double b) { return *this = *this - b; }
+  double_double &operator*=(double_double b) { return *this = *this * b; }
+  double_double &operator/=(double_double b) { return *this = *this / b; }
+
+  // comparison -----------------------------------------------------------------
+  friend constexpr bool operator<(double_double a, double_double b)
+  { return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo); }
+  friend constexpr bool operator>(double_double a, double_double b) { return b < a; }
+  friend constexpr bool operator<=(double_double a, double_double b) { return !(b < a); }
+  friend constexpr bool operator>=(double_double a, double_double b) { return !(a < b); }
+  friend constexpr bool operator==(double_double a, double_double b) { return a.hi == b.hi && a.lo == b.lo; }
+  friend constexpr bool operator!=(double_double a, double_double b) { return !(a == b); }
+
+  // functions, found by argument-dependent lookup only (eg within
+  // std::abs(std::complex)), so they do not hide ::sqrt etc in MiNuS
+  friend inline double_double abs(double_double a) { return a.hi < 0 ? -a : a; }
+  friend inline double_double fabs(double_double a) { return abs(a); }
+  friend inline double_double sqrt(double_double a)
+  {
+    if (a.hi <= 0) return 0;
+    const double x = 1. / std::sqrt(a.hi), ax = a.hi * x;
+    return double_double(ax) + (a - double_double(ax) * ax).hi * (x * .5);
+  }
+};
+
+} // namespace MiNuS
+
+namespace std {
+template <>
+struct numeric_limits<MiNuS::double_double> : numeric_limits<double> {
+  static constexpr int digits = 2*numeric_limits<double>::digits;
+  static constexpr int digits10 = 31;
+  static constexpr MiNuS::double_double epsilon() { return 4.93038065763132e-32; } // 2^-104
+  static constexpr MiNuS::double_double min() { return numeric_limits<double>::min(); }
+  static constexpr MiNuS::double_double max() { return numeric_limits<double>::max(); }
+  static constexpr MiNuS::double_double lowest() { return -numeric_limits<double>::max(); }
+};
+} // namespace std
+
+#endif  // double_double_h_
@@ -1,6 +1,7 @@
 #ifndef internal_util_h_
 #define internal_util_h_
 
+#include <algorithm>
 #include <cmath>
 #include <random>
 
@@ -19,6 +20,84 @@ namespace MiNuS {
 template <typename F>
 using C = typename std::complex<F>;
 
+// the real type underlying a complex type T
+template <typename T>
+struct complex_traits;
+
+template <typename F>
+struct complex_traits<std::complex<F>> { typedef F real; };
+
+// Write-only view keeping y[i-B] for i >= B and discarding writes below B.
+// Passed as the output of an inlined evaluator, the discarded entries and
+// the gates only they depend on are dead code, so that eg the last column of
+// HxH is computed alone.
+template <unsigned B, typename YV>
+struct tail_array {
+  YV y;
+  explicit tail_array(YV y) : y(y) { }
+  struct reference {
+    const YV &y; const unsigned i;
+    template <typename T>
+    inline __attribute__((always_inline)) reference &
+    operator=(const T &v) { if (i >= B) y[i-B] = v; return *this; }
+  };
+  inline __attribute__((always_inline)) reference
+  operator[](unsigned i) const { return reference{y, i}; }
+};
+
+// Truncated power series (jet) c[0] + c[1] s + ... + c[K] s^K, with
+// coefficients of scalar type T. Running a straight-line program on jets
+// gives the Taylor coefficients of its result to order K, as for the Taylor
+// predictor of minus_core. A T converts to a constant jet, so that
+// parameters and constants of the program mix in unchanged. The operators are
+// not force-inlined: over a whole evaluator this was measured slower, and
+// much slower to compile.
+template <typename T, unsigned K>
+struct jet {
+  T c[K+1];
+  jet() { }
+  jet(const T &v) : c{v} { }
+};
+
+template <typename T, unsigned K>
+inline jet<T,K>
+operator+(const jet<T,K> &a, const jet<T,K> &b)
+{ jet<T,K> r; for (unsigned k = 0; k <= K; ++k) r.c[k] = a.c[k] + b.c[k]; return r; }
+
+template <typename T, unsigned K>
+inline jet<T,K>
+operator-(const jet<T,K> &a, const jet<T,K> &b)
+{ jet<T,K> r; for (unsigned k = 0; k <= K; ++k) r.c[k] = a.c[k] - b.c[k]; return r; }
+
+template <typename T, unsigned K>
+inline jet<T,K>
+operator-(const jet<T,K> &a)
+{ jet<T,K> r; for (unsigned k = 0; k <= K; ++k) r.c[k] = -a.c[k]; return r; }
+
+// Cauchy product, truncated at s^K
+template <typename T, unsigned K>
+inline jet<T,K>
+operator*(const jet<T,K> &a, const jet<T,K> &b)
+{
+  jet<T,K> r;
+  for (unsigned k = 0; k <= K; ++k) {
+    r.c[k] = a.c[0] * b.c[k];
+    for (unsigned i = 1; i <= k; ++i) r.c[k] += a.c[i] * b.c[k-i];
+  }
+  return r;
+}
+
+// mixed scalar/jet, as the generated evaluators use for constants and memo
+template <typename T, unsigned K>
+inline jet<T,K>
+operator*(const jet<T,K> &a, const T &b)
+{ jet<T,K> r; for (unsigned k = 0; k <= K; ++k) r.c[k] = a.c[k] * b; return r; }
+
+template <typename T, unsigned K>
+inline jet<T,K>
+operator*(const typename complex_traits<T>::real &a, const jet<T,K> &b)
+{ jet<T,K> r; for (unsigned k = 0; k <= K; ++k) r.c[k] = a * b.c[k]; return r; }
+
 template <unsigned N, typename F>
 struct minus_array { // Speed critical -----------------------------------------
   static inline __attribute__((always_inline)) void 
@@ -66,7 +145,8 @@ struct minus_array { // Speed critical -----------------------------------------
   static inline __attribute__((always_inline)) void 
   fcopy(const C<F> * __restrict a, C<F> * __restrict b)
   {
-    memcpy(b, a, N*sizeof(C<F>)+sizeof(F));
+    const F *fa = reinterpret_cast<const F *>(a);
+    std::copy(fa, fa + 2*N+1, reinterpret_cast<F *>(b));
   }
 
   static inline __attribute__((always_inline)) F
@@ -17,6 +17,9 @@ std::normal_distribution<F> minus_util<F>::gauss{0.0,1000.0};
 template <problem P, typename F> const typename 
 minus_core<P, F>::track_settings minus_core<P, F>::DEFAULT;
 
+template <problem P, typename F> constexpr F
+minus_core<P, F>::the_smallest_number;
+
 } // namespace minus
 
 #endif // internal_util_hxx_
@@ -0,0 +1,162 @@
+#ifndef lsolve_hxx_
+#define lsolve_hxx_
+// to be included in minus.hxx
+//
+// Unrolled dense LU solve for N unknowns, for any formulation.
+//
+// Solves Ax = b given m = [A | b], column-major N x (N+1), m[col*N + row].
+// The N pivot steps are unrolled by template recursion, so that within each
+// step all offsets and trip counts are compile-time constants.
+// Pivoting is as in chicago14a-lsolve.hxx: a row is swapped in only if it
+// beats the diagonal by a factor of 1e3 in norm, scanning from the bottom. b
+// is carried along as the last column of the elimination, then
+// back-substitution gives x.
+//
+// Generic on the scalar type T, with m and x only needing operator[]. m is
+// overwritten.
+
+// Calls f.template apply<I>() for I = B, ..., E-1
+template <unsigned B, unsigned E>
+struct static_for {
+  template <typename Fn>
+  static __attribute__((always_inline)) inline void run(Fn &f)
+  { f.template apply<B>(); static_for<B+1, E>::run(f); }
+};
+
+template <unsigned E>
+struct static_for<E, E> {
+  template <typename Fn>
+  static __attribute__((always_inline)) inline void run(Fn &) { }
+};
+
+template <unsigned N, typename T, typename MV, typename XV>
+struct lsolve_unrolled {
+  typedef typename complex_traits<T>::real F;
+
+  // Pivot step K. The inner loops have compile-time trip counts, which GCC
+  // unrolls and vectorizes as it sees fit: unrolling them by hand as well
+  // bloats the code and was measured slower (see cmd/minus-bench.cxx).
+  //
+  // With piv, the row swapped into row K is recorded in piv[K] and whole rows
+  // are swapped, so that m keeps the LU factors of PA for resolve(). Otherwise
+  // the L part is stale after a swap, as only b needs to be eliminated.
+  template <bool keep>
+  struct eliminate {
+    MV m; unsigned char *piv;
+    template <unsigned K>
+    __attribute__((always_inline)) inline void apply()
+    {
+      unsigned row_of_biggest_in_col = K;
+      const F biggest_in_corner = norm(T(m[K*N+K]))*1e3;
+      for (unsigned j = N-1; j != K; --j)
+        if (unlikely(norm(T(m[K*N+j])) > biggest_in_corner)) {
+          row_of_biggest_in_col = j;
+          break;
+        }
+      if (keep) piv[K] = row_of_biggest_in_col;
+      if (likely(K != row_of_biggest_in_col))
+        for (unsigned j = keep ? 0 : K; j <= N; ++j) {
+          const T tmp = m[j*N+K];
+          m[j*N+K] = T(m[j*N+row_of_biggest_in_col]);
+          m[j*N+row_of_biggest_in_col] = tmp;
+        }
+      const T inv = T(1) / T(m[K*N+K]);
+      for (unsigned i = K+1; i < N; ++i)
+        m[K*N+i] = T(m[K*N+i]) * inv;
+      for (unsigned j = K+1; j <= N; ++j) { // rank-1 update of the trailing block and of b
+        const T u = m[j*N+K];
+        for (unsigned i = K+1; i < N; ++i)
+          m[j*N+i] = T(m[j*N+i]) - T(m[K*N+i]) * u;
+      }
+    }
+  };
+
+  // x := U^-1 x
+  static __attribute__((always_inline)) inline void back_substitute(MV m, XV x)
+  {
+    for (unsigned k = N-1; k != (unsigned)-1; --k) {
+      T v = x[k];
+      for (unsigned j = k+1; j < N; ++j)
+        v = v - T(m[j*N+k]) * T(x[j]);
+      x[k] = v / T(m[k*N+k]);
+    }
+  }
+
+  static __attribute__((always_inline)) inline void solve(MV m, XV x)
+  {
+    eliminate<false> e{m, nullptr};
+    static_for<0, N>::run(e);
+    for (unsigned k = 0; k < N; ++k)
+      x[k] = T(m[N*N+k]);
+    back_substitute(m, x);
+  }
+
+  // Same as solve(), leaving the LU factors of A in m and piv
+  static __attribute__((always_inline)) inline void solve(MV m, unsigned char piv[N], XV x)
+  {
+    eliminate<true> e{m, piv};
+    static_for<0, N>::run(e);
+    for (unsigned k = 0; k < N; ++k)
+      x[k] = T(m[N*N+k]);
+    back_substitute(m, x);
+  }
+
+  // Solves Ax = b for another b, reusing m and piv from solve(m, piv, x).
+  // x holds b on input.
+  static __attribute__((always_inline)) inline void resolve(MV m, const unsigned char piv[N], XV x)
+  {
+    for (unsigned k = 0; k < N; ++k) // x := Pb, then L^-1 x
+      if (unlikely(piv[k] != k)) {
+        const T tmp = x[k];
+        x[k] = T(x[piv[k]]);
+        x[piv[k]] = tmp;
+      }
+    for (unsigned k = 0; k < N; ++k) {
+      const T xk = x[k];
+      for (unsigned i = k+1; i < N; ++i)
+        x[i] = T(x[i]) - T(m[k*N+i]) * xk;
+    }
+    back_substitute(m, x);
+  }
+};
+
+// Dense unrolled solve
+template <unsigned N, typename F>
+__attribute__((always_inline)) inline void
+lsolve_n(C<F> * __restrict um, C<F> * __restrict ux)
+{
+  C<F> * const m = reinterpret_cast<C<F> *> (__builtin_assume_aligned(um,64));
+  C<F> * const x = reinterpret_cast<C<F> *> (__builtin_assume_aligned(ux,64));
+  lsolve_unrolled<N, C<F>, C<F> *, C<F> *>::solve(m, x);
+}
+
+// The linear solver of the tracker, for the [Hx|Ht] block of problem P.
+// Defaults to the unrolled dense LU above for f::nve unknowns; a problem can
+// specialize this to exploit the structure of its system, see
+// chicago14a-lsolve.hxx.
+//
+// solve(m, lu, x) also keeps the factorization of A in m and lu, so that
+// resolve(m, lu, x) solves for another right-hand side in x at the cost of
+// the triangular solves (used by the chord corrector of track()).
+template <problem P, typename F>
+struct lsolver {
+  static constexpr unsigned n = formulation_parameters<P>::nve;
+  struct factors { unsigned char piv[n]; };
+  typedef lsolve_unrolled<n, C<F>, C<F> *, C<F> *> dense_lu;
+
+  static __attribute__((always_inline)) inline void solve(C<F> * __restrict m, C<F> * __restrict x)
+  { lsolve_n<n, F>(m, x); }
+  static __attribute__((always_inline)) inline void solve(C<F> * __restrict m, factors *lu, C<F> * __restrict x)
+  { dense_lu::solve(m, lu->piv, x); }
+  static __attribute__((always_inline)) inline void resolve(C<F> * __restrict m, const factors &lu, C<F> * __restrict x)
+  { dense_lu::resolve(m, lu.piv, x); }
+};
+
+template <problem P, typename F>
+__attribute__((always_inline)) inline void
+lsolve(C<F> * __restrict m, C<F> * __restrict x)
+{
+  lsolver<P,F>::solve(m, x);
+}
+
+#endif  // lsolve_hxx_
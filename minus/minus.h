@@ -17,8 +17,14 @@
 //  - see CMakeLists.txt and README.md
 
 #include <complex>
+#include <atomic>
+#include <algorithm>
+#include <limits>
+#include <chrono>
 
 #include "internal-util.h"
+#include "double-double.h"
+#include "thread-pool.h"
 
 namespace MiNuS {
   
@@ -64,6 +70,7 @@ class minus_core { // fully static, not to be instantiated - just used for templ
     static constexpr unsigned nve = NVE;          // the size of the system (Number of Variables or Equations)
     static constexpr unsigned nsols = NSOLS;      // the number of solutions
     static constexpr unsigned nparams = NPARAMS;  // the number of parameters
+    static constexpr unsigned nconstants = NCONSTANTS;  // size of the per-solve memo of eval<P,F>::constants
   }
   */
   // shortcuts to the formulation parameters useful to most users
@@ -74,13 +81,23 @@ class minus_core { // fully static, not to be instantiated - just used for templ
     UNDETERMINED,       // 0
     PROCESSING,         // 1
     REGULAR,            // 2 OK. rest is error.
-    SINGULAR,           // 3 unused
+    SINGULAR,           // 3 endgame converged to a singular endpoint (cycle_number > 1 or Hx singular)
     INFINITY_FAILED,    // 4
     MIN_STEP_FAILED,    // 5
     ORIGIN_FAILED,      // 6 unused
-    INCREASE_PRECISION, // 7 unused
+    INCREASE_PRECISION, // 7 failed in F, queued for retrack_failed()
     DECREASE_PRECISION, // 8 unused
     MAX_NUM_STEPS_FAIL, // 9 failed to converge in less than solution::num_steps 
+    NONREAL_PRUNED,     // 10 abandoned in the end zone as headed to a non-real endpoint, see track_settings::prune_nonreal_
+    STOPPED,            // 11 not finished when the solve ran out of time or steps, see track_budget
+  };
+
+  // predictor of track(), see track_settings::predictor_
+  enum predictor : unsigned char {
+    RK4,                // classic Runge-Kutta 4, heuristic step control
+    CASH_KARP,          // embedded Runge-Kutta 5(4), PI control of dt on its error estimate
+    HERMITE,            // cubic Hermite on the last two points and tangents, one solve per step
+    TAYLOR,             // Taylor series of the path to order taylor_order, by jets through H
   };
   
   struct solution
@@ -89,10 +106,96 @@ class minus_core { // fully static, not to be instantiated - just used for templ
     F t;               // last value of parameter t used
     unsigned num_steps;  // number of steps taken along the path
     solution_status status;
-    solution() : num_steps(0), status(UNDETERMINED) { }
+    unsigned char cycle_number; // estimated by the endgame at t = 1, 0 if not run
+    solution() : t(0), num_steps(0), status(UNDETERMINED), cycle_number(0) { }
   };
 
   static const track_settings DEFAULT;
+
+  // Hands out the paths in [begin, end) to tracking threads in small chunks,
+  // first come first served. Path lengths are very skewed (a few paths take
+  // tens of times the mean number of steps), so a thread that draws short
+  // paths comes back for more instead of idling while another one finishes a
+  // long path. Shared by all threads of one solve.
+  //
+  // With an order, positions [begin, end) are handed out instead, position k
+  // standing for path order[k]: paths are tracked in that order, and
+  // path_scheduler(0, n, chunk, order) tracks only the first n of them. See
+  // cmd/minus-train-order.cxx for training one.
+  struct path_scheduler {
+    path_scheduler(unsigned begin, unsigned end, unsigned chunk=2, const unsigned short *order=nullptr)
+      : next_(begin), end_(end), chunk_(chunk), order_(order) { }
+    // claims the next chunk of positions [*b, *e). false when none are left.
+    bool claim(unsigned *b, unsigned *e) {
+      const unsigned n = next_.fetch_add(chunk_, std::memory_order_relaxed);
+      if (n >= end_) return false;
+      *b = n; *e = std::min(n + chunk_, end_);
+      return true;
+    }
+    // no more claims succeed; paths already claimed are still tracked
+    void cancel() { next_.store(end_, std::memory_order_relaxed); }
+    // the path at position k
+    unsigned path(unsigned k) const { return order_ ? order_[k] : k; }
+    std::atomic<unsigned> next_;
+    const unsigned end_;
+    const unsigned chunk_;
+    const unsigned short *const order_;
+  };
+
+  // Time and step budget of one solve, shared by all its threads through
+  // track_settings::budget_. Once stop_ is set, the paths being tracked end
+  // with status STOPPED at their next step, and paths started later at their
+  // first. Each path charges the steps it took and checks the deadline once
+  // every check_period steps, and when it ends or pauses, setting stop_ when
+  // either is exhausted, so that every step only does a relaxed load of stop_.
+  struct track_budget {
+    static constexpr unsigned check_period = 32;
+    typedef std::chrono::steady_clock clock;
+    explicit track_budget(long steps=std::numeric_limits<long>::max(), clock::time_point deadline=clock::time_point::max())
+      : stop_(false), steps_(steps), deadline_(deadline) { }
+    bool stopped() const { return stop_.load(std::memory_order_relaxed); }
+    // charges n steps, checks the deadline. true if out of budget.
+    bool charge(long n) {
+      if (steps_.fetch_sub(n, std::memory_order_relaxed) <= n || clock::now() >= deadline_)
+        stop_.store(true, std::memory_order_relaxed);
+      return stopped();
+    }
+    std::atomic<bool> stop_;
+    std::atomic<long> steps_;
+    const clock::time_point deadline_;
+  };
+
+  // One path being tracked, paused between steps: step(n) takes at most n
+  // more steps, so that a caller can interleave paths of many solves,
+  // preempt long paths, or drive a path from a coroutine. Tracking a path
+  // with path_tracker(...) then step() until it returns false is
+  // track_path(). s, params, memo and *t_s must outlive the tracker. *t_s
+  // holds the last point reached after every step(); its status is final
+  // once step() returned false. The endgame, with s.endgame_, runs to
+  // completion within a single step(). Needs 64-byte alignment, which new
+  // only provides from C++17 on: keep it on the stack or in aligned storage.
+  struct path_tracker {
+    // starts the path from (t_s->x, t_s->t), to t_end
+    path_tracker(const track_settings &s, const C<F> *params, const C<F> *memo, solution *t_s, F t_end = 1);
+    // takes at most n steps. false once the path is done.
+    bool step(unsigned n = std::numeric_limits<unsigned>::max());
+
+    alignas(64) F x0t0f_[f::nve*2+1]; // last accepted point
+    alignas(64) F dxdtf_[f::nve*2+1]; // last increment, dt in the t slot
+    alignas(64) C<F> dp_[f::nve], xp_[f::nve]; // Hermite history: previous x and tangent
+    F tp_;
+    const track_settings &s_;
+    const C<F> *const params_, *const memo_;
+    solution *const t_s_;
+    const F t_end_;
+    unsigned charged_;  // t_s_->num_steps already charged to s.budget_
+    double err_prev_;   // of the Cash-Karp predictor
+    double y0p_, sp_;   // s.early_infinity_: y0 and 1-t at the previous accepted step
+    char predictor_successes_;
+    char diverging_;
+    bool end_zone_;
+    bool have_prev_;
+  };
   
   public: // ----------- Functions --------------------------------------------
   
@@ -105,16 +208,143 @@ class minus_core { // fully static, not to be instantiated - just used for templ
       const C<F> params[2*f::nparams], solution raw_solutions[f::nsols])
   { track(s, s_sols, params, raw_solutions, 0, f::nsols); }
 
+  // Same as track(), with the parameter-only values of the evaluators
+  // precomputed by evaluate_constants(params, memo). memo is only read, so
+  // all threads tracking the same params can share one.
+  static void track_memoized(const track_settings &s, const C<F> s_sols[f::nve*f::nsols], 
+      const C<F> params[2*f::nparams], const C<F> memo[f::nconstants], solution raw_solutions[f::nsols], 
+      unsigned sol_min, unsigned sol_max);
+
+  // helper function: tracks chunks of paths claimed from sch until none are
+  // left. Run it from any number of threads sharing the same scheduler.
+  static void track_scheduled(const track_settings &s, const C<F> s_sols[f::nve*f::nsols], 
+      const C<F> params[2*f::nparams], const C<F> memo[f::nconstants], solution raw_solutions[f::nsols], 
+      path_scheduler *sch)
+  {
+    unsigned b, e;
+    while (sch->claim(&b, &e))
+      if (!sch->order_)
+        track_memoized(s, s_sols, params, memo, raw_solutions, b, e);
+      else for (unsigned k = b; k < e; ++k)
+        track_memoized(s, s_sols, params, memo, raw_solutions, sch->path(k), sch->path(k) + 1);
+  }
+
+  // Mixed precision: tracks the paths in the cheaper FL (eg float) with the
+  // settings sl, then polishes each endpoint with refine() in F, and retracks
+  // in F with the settings s the paths whose endpoint does not converge or
+  // whose FL tracking failed short of infinity. Output is as with track().
+  // Call as track_mixed<float>(...).
+  template <typename FL>
+  static void track_mixed(const typename minus_core<P, FL>::track_settings &sl, const track_settings &s,
+      const C<F> s_sols[f::nve*f::nsols], const C<F> params[2*f::nparams], const C<F> memo[f::nconstants], 
+      solution raw_solutions[f::nsols], unsigned sol_min, unsigned sol_max);
+
+  template <typename FL>
+  static void track_mixed_scheduled(const typename minus_core<P, FL>::track_settings &sl, const track_settings &s,
+      const C<F> s_sols[f::nve*f::nsols], const C<F> params[2*f::nparams], const C<F> memo[f::nconstants], 
+      solution raw_solutions[f::nsols], path_scheduler *sch)
+  {
+    alignas(64) C<FL> params_l[2*f::nparams];
+    alignas(64) C<FL> memo_l[f::nconstants];
+    for (unsigned i = 0; i < 2*f::nparams; ++i) params_l[i] = C<FL>(params[i]);
+    for (unsigned i = 0; i < f::nconstants; ++i) memo_l[i] = C<FL>(memo[i]);
+    unsigned b, e;
+    while (sch->claim(&b, &e))
+      if (!sch->order_)
+        track_mixed<FL>(sl, s, s_sols, params, memo, params_l, memo_l, raw_solutions, b, e);
+      else for (unsigned k = b; k < e; ++k)
+        track_mixed<FL>(sl, s, s_sols, params, memo, params_l, memo_l, raw_solutions, sch->path(k), sch->path(k) + 1);
+  }
+
+  // Newton's method on the target system H(x,1) = 0 from sol->x, at most
+  // s.max_corr_steps_ steps. Returns true once |dx| < epsilon |x|.
+  static bool refine(const track_settings &s, const C<F> params[2*f::nparams], const C<F> memo[f::nconstants],
+      solution *sol);
+
+  // Second pass of track(): retracks in the wider FH (eg double_double) the
+  // paths in [sol_min, sol_max) that failed with MIN_STEP_FAILED or
+  // MAX_NUM_STEPS_FAIL, with the settings sh. They are marked
+  // INCREASE_PRECISION, then get the status of their FH tracking. Paths that
+  // succeeded are left untouched, and nothing is computed in FH if none failed.
+  // At most max_paths paths are retracked, the first ones to fail. Once
+  // budget, if given, runs out, the paths not yet retracked get STOPPED.
+  // Returns the number of paths retracked. Call as retrack_failed<double_double>(...), see double-double.h.
+  template <typename FH>
+  static unsigned retrack_failed(const typename minus_core<P, FH>::track_settings &sh,
+      const C<F> s_sols[f::nve*f::nsols], const C<F> params[2*f::nparams], 
+      solution raw_solutions[f::nsols], unsigned sol_min, unsigned sol_max,
+      unsigned max_paths=std::numeric_limits<unsigned>::max(), track_budget *budget=nullptr);
+
+  // Gamma trick: retracks the paths in [sol_min, sol_max) that failed with
+  // MIN_STEP_FAILED, INFINITY_FAILED or MAX_NUM_STEPS_FAIL along a detour
+  // through a random complex parameter point, with the settings s. Paths
+  // that fail again are retried on a fresh detour, for at most
+  // s.detour_budget_ path retracks in all. Returns the number of paths
+  // recovered, i.e. that end REGULAR at a solution no other path reached.
+  // Does nothing with s.detour_budget_ = 0. A path only keeps the num_steps
+  // of its last attempt: the steps of the attempts it replaced, the first
+  // tracking included, are added to *discarded_steps if given.
+  static unsigned retrack_detour(const track_settings &s,
+      const C<F> s_sols[f::nve*f::nsols], const C<F> params[2*f::nparams],
+      solution raw_solutions[f::nsols], unsigned sol_min, unsigned sol_max,
+      unsigned *discarded_steps=nullptr);
+
+  // Path jumping: two paths that reach the same endpoint mean that at least
+  // one of them jumped onto the other, losing a solution. Finds the REGULAR
+  // paths in [sol_min, sol_max) whose endpoints coincide, up to a relative
+  // squared distance of 100*s.epsilon2_ for the settings s they were tracked
+  // with, and retracks each of them from t = 0 with the tighter settings st.
+  // Returns the number of paths retracked.
+  static unsigned retrack_collisions(const track_settings &s, const track_settings &st,
+      const C<F> s_sols[f::nve*f::nsols], const C<F> params[2*f::nparams], const C<F> memo[f::nconstants],
+      solution raw_solutions[f::nsols], unsigned sol_min, unsigned sol_max);
+
+  // Computes the memo of parameter-only values used by the evaluators, once
+  // per params (i.e. per solve)
+  static void evaluate_constants(const C<F> params[2*f::nparams], C<F> memo[f::nconstants]);
+
   private: // -----------------------------------------------------------------
   static constexpr unsigned NVEPLUS1 = f::nve+1;
   static constexpr unsigned NVEPLUS2 = f::nve+2;
   static constexpr unsigned NVE2 = f::nve*f::nve;
+  // tolerance of the tracker on t, eg to tell when t reached 1 or the end
+  // zone. 1e-13 (XXX BENCHMARK THIS), or a few ulps of t where F is coarser
+  static constexpr F the_smallest_number = F(4*double(std::numeric_limits<F>::epsilon()) > 1e-13 ? 
+      4*double(std::numeric_limits<F>::epsilon()) : 1e-13);
+  // track_mixed() body, with params and memo already converted to FL in
+  // params_l and memo_l
+  template <typename FL>
+  static void track_mixed(const typename minus_core<P, FL>::track_settings &sl, const track_settings &s,
+      const C<F> s_sols[f::nve*f::nsols], const C<F> params[2*f::nparams], const C<F> memo[f::nconstants], 
+      const C<FL> params_l[2*f::nparams], const C<FL> memo_l[f::nconstants],
+      solution raw_solutions[f::nsols], unsigned sol_min, unsigned sol_max);
+  // track() body for one path, continuing from the point in *t_s
+  static void track_path(const track_settings &s, const C<F> * __restrict params, const C<F> * __restrict memo, 
+      solution * __restrict t_s, F t_end = 1);
+  // Cash-Karp prediction x1t1 from x0t0 over dt, returns its error estimate
+  // relative to s.predictor_tolerance_ (accept if <= 1)
+  static double predict_cash_karp(const track_settings &s, const C<F> * __restrict x0t0, F dt, 
+      const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict Hxt, C<F> * __restrict x1t1);
+  // order of the TAYLOR predictor. Orders 3 and 4 take a few % fewer steps
+  // on chicago14a, but cost more per step than they save (cmd/minus-bench.cxx)
+  static constexpr unsigned taylor_order = 2;
+  // a row of Taylor coefficients, padded to keep each row 64-byte aligned for lsolver
+  static constexpr unsigned taylor_row = (f::nve*sizeof(C<F>) + 63)/64*64/sizeof(C<F>);
+  struct taylor_coefficient;
+  // Taylor prediction x1t1 from x0t0 over dt
+  static void predict_taylor(const C<F> * __restrict x0t0, F dt, 
+      const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict Hxt, C<F> * __restrict x1t1);
+  static bool coincides(const track_settings &s, const solution raw_solutions[f::nsols], 
+      unsigned sol_min, unsigned sol_max, unsigned i);
+  // end zone of track_path() with s.endgame_
+  static void endgame(const track_settings &s, const C<F> * __restrict params, const C<F> * __restrict memo, 
+      solution * __restrict t_s);
   // force-inlining this makes it slower
-  static void evaluate_Hxt(const C<F> * __restrict x /*x, t*/,    const C<F> * __restrict params, C<F> * __restrict y /*HxH*/);
-  static void evaluate_HxH(const C<F> * __restrict x /*x and t*/, const C<F> * __restrict params, C<F> * __restrict y /*HxH*/);
-  static void evaluate_Hxt_constants(const C<F> * __restrict x /*x and t*/, const C<F> * __restrict params, C<F> * __restrict y /*HxH*/);
-  static void evaluate_HxH_constants(const C<F> * __restrict x /*x and t*/, const C<F> * __restrict params, C<F> * __restrict y /*HxH*/);
-  static void evaluate_HxH_constants_all_sols(const C<F> * __restrict x /*x and t*/, const C<F> * __restrict params, C<F> * __restrict y /*HxH*/);
+  static void evaluate_Hxt(const C<F> * __restrict x /*x, t*/,    const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict y /*HxH*/);
+  static void evaluate_HxH(const C<F> * __restrict x /*x and t*/, const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict y /*HxH*/);
+  static void evaluate_H(const C<F> * __restrict x /*x and t*/, const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict y /*-H*/);
+  template <unsigned K>
+  static void evaluate_H(const jet<C<F>,K> * __restrict x, F t, const C<F> * __restrict params, const C<F> * __restrict memo, jet<C<F>,K> * __restrict y /*-H*/);
 };
 
 // TODO: make these static
@@ -130,8 +360,24 @@ struct minus_core<P, F>::track_settings {
     infinity_threshold2_(1e7 * 1e7), // m2 InfinityThreshold^2
     max_num_steps_(500),
     num_successes_before_increase_(20), // m2 numberSuccessesBeforeIncrease
-    max_corr_steps_(4)  // m2 maxCorrSteps (track.m2 param of rawSetParametersPT corresp to max_corr_steps in NAG.cpp)
-  { }
+    max_corr_steps_(4),  // m2 maxCorrSteps (track.m2 param of rawSetParametersPT corresp to max_corr_steps in NAG.cpp)
+    chord_corrector_(false),
+    endgame_(false),
+    endgame_max_samples_(12),
+    predictor_(RK4),
+    predictor_tolerance_(1e-3),
+    detour_budget_(0),
+    early_infinity_(false),
+    prune_nonreal_(0),
+    budget_(nullptr),
+    wide_retrack_max_paths_(4)
+  { 
+    // Hx is often conditioned badly enough that a float corrector stalls
+    // well above 1e-6 relative; the endpoints are refined in double anyway,
+    // see track_mixed(). A float path that needs steps below 1e-4 rarely
+    // recovers, and is better handed to double early.
+    if (std::numeric_limits<F>::digits < 32) { epsilon2_ = 1e-3*1e-3; min_dt_ = 1e-4; }
+  }
   F init_dt_;   // m2 tStep, t_step, raw interface code initDt
   F min_dt_;        // m2 tStepMin, raw interface code minDt
   F end_zone_factor_;
@@ -142,6 +388,62 @@ struct minus_core<P, F>::track_settings {
   unsigned max_num_steps_; // maximum number of steps per track.  Each step takes roughly 1 microseconds (tops)
   char num_successes_before_increase_; // m2 numberSuccessesBeforeIncrease
   char max_corr_steps_;  // m2 maxCorrSteps (track.m2 param of rawSetParametersPT corresp to max_corr_steps in NAG.cpp)
+  // Corrector iterations after the first reuse its factorization of Hx and
+  // only evaluate H (chord/simplified Newton). A full Newton step is taken
+  // again whenever |dx| fails to at least halve. Up to max_corr_steps_ of
+  // each kind are taken.
+  bool chord_corrector_;
+  // In the end zone, estimate the endpoint and its cycle number with the
+  // power-series endgame (see endgame() in minus.hxx) from at most
+  // endgame_max_samples_ samples at t = 1 - s, s halving each time, instead
+  // of stepping up to t = 1.
+  bool endgame_;
+  char endgame_max_samples_;
+  // With CASH_KARP, dt is set by a PI controller from the local error
+  // estimate of each step, relative to |x| and predictor_tolerance_, instead
+  // of by dt_increase_factor_ and num_successes_before_increase_. A failed
+  // corrector still multiplies dt by dt_decrease_factor_.
+  // With HERMITE, the prediction is the cubic Hermite extrapolation through
+  // the last two points of the path and the tangents dx/dt there, so a step
+  // costs a single [Hx|Ht] solve, for the tangent at the current point. The
+  // step after a failed corrector, the first one and those in the end zone
+  // are taken with RK4. Step control is that of RK4.
+  // With TAYLOR, the prediction is the Taylor polynomial of x(t) at t0 to
+  // order taylor_order. Its coefficients are found one order at a time, by
+  // evaluating H on jets (truncated power series) of the path and solving
+  // with the one factorization of Hx at x0. Step control is that of RK4.
+  predictor predictor_;
+  F predictor_tolerance_;
+  // Opt-in recovery of failed paths by retrack_detour(): the most paths it
+  // may retrack per solve, 0 to disable it.
+  unsigned detour_budget_;
+  // In the end zone, tell a path at infinity by the homogenizing coordinate
+  // y0 = 1/(1 + |x|^2) of [1 : x], which goes to 0 as (1-t)^w, w > 0, only
+  // for such paths: the path is INFINITY_FAILED once two accepted steps in a
+  // row estimate w > 1/2 with y0 below 1/sqrt(infinity_threshold2_), instead
+  // of stepping on until |x|^2 > infinity_threshold2_. Endpoints with |x|^2
+  // past sqrt(infinity_threshold2_) that are still being approached this
+  // fast are lost. See scripts/synthdata/synthdata-bench-early-infinity.
+  bool early_infinity_;
+  // In the end zone, abandon a path as NONREAL_PRUNED once some coordinate
+  // has |imag| > prune_nonreal_ both at the current point and at t = 1,
+  // extrapolated linearly from the last two points, as its endpoint would
+  // likely fail minus_array::get_real() (|imag| < 1e-2). 0 disables it.
+  // On chicago14a, many paths to real endpoints are still far from real a
+  // few steps before t = 1, so this loses real solutions at any threshold
+  // that saves steps, possibly the true one: eg minus-chicago -g
+  // --prune_nonreal 1 prunes the path to the ground truth. See
+  // bench_prune_nonreal() in cmd/minus-bench.cxx.
+  F prune_nonreal_;
+  // Shared time and step budget of the solve, see track_budget. nullptr for
+  // none. Only track_path() checks it.
+  track_budget *budget_;
+  // Last resort of minus<P,F>::solve() when no real solution was found: the
+  // most failed paths it retracks in double_double with retrack_failed(), 0
+  // to disable it. Each such path is single-threaded and takes about 0.7s, and
+  // budget_ is only checked between paths (see bench_retrack_failed() in
+  // cmd/minus-bench.cxx), hence the small cap.
+  unsigned wide_retrack_max_paths_;
 };
 // Original settings from Tim: Fri Feb 22 12:00:06 -03 2019 Git 0ec3340
 // o9 = MutableHashTable{AffinePatches => DynamicPatch     }
@@ -182,40 +484,41 @@ template <problem P, typename F>
 struct eval {
   static void Hxt(const C<F> * __restrict x /*x, t*/,    const C<F> * __restrict params, C<F> * __restrict y);
   static void HxH(const C<F> * __restrict x /*x and t*/, const C<F> * __restrict params, C<F> * __restrict y);
-  // optional memoization of constants and intermediate values:
-  static void Hxt_constants(const C<F> * __restrict x /*x, t*/,    const C<F> * __restrict params, C<F> * __restrict y);
-  static void HxH_constants(const C<F> * __restrict x /*x, t*/,    const C<F> * __restrict params, C<F> * __restrict y);
-  static void HxH_constants_all_sols(const C<F> * __restrict x /*x, t*/,    const C<F> * __restrict params, C<F> * __restrict y);
+  // memoization of the values that only depend on params, computed once per
+  // solve into memo[f::nconstants], and the evaluators reading it:
+  static void constants(const C<F> * __restrict params, C<F> * __restrict memo);
+  static void Hxt(const C<F> * __restrict x /*x, t*/,    const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict y);
+  static void HxH(const C<F> * __restrict x /*x and t*/, const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict y);
+  // -H(x,t) alone, ie the last column of HxH, for the chord corrector:
+  static void H(const C<F> * __restrict x /*x and t*/, const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict y);
+  // -H(x(s), t + s) for x(s) given as jets, ie its Taylor coefficients in s to
+  // order K, for the TAYLOR predictor:
+  template <unsigned K>
+  static void H(const jet<C<F>,K> * __restrict x, F t, const C<F> * __restrict params, const C<F> * __restrict memo, jet<C<F>,K> * __restrict y);
 };
 
 template <problem P, typename F>
-void minus_core<P, F>::evaluate_Hxt(const C<F> * __restrict x /*x, t*/, const C<F> * __restrict params, C<F> * __restrict y)
+void minus_core<P, F>::evaluate_Hxt(const C<F> * __restrict x /*x, t*/, const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict y)
 {
-  eval<P,F>::Hxt(x, params, y);
+  eval<P,F>::Hxt(x, params, memo, y);
 }
 
 template <problem P, typename F>
-void minus_core<P, F>::evaluate_HxH(const C<F> * __restrict x /*x, t*/, const C<F> * __restrict params, C<F> * __restrict y)
+void minus_core<P, F>::evaluate_HxH(const C<F> * __restrict x /*x, t*/, const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict y)
 {
-  eval<P,F>::HxH(x, params, y);
+  eval<P,F>::HxH(x, params, memo, y);
 }
 
 template <problem P, typename F>
-void minus_core<P, F>::evaluate_Hxt_constants(const C<F> * __restrict x /*x, t*/, const C<F> * __restrict params, C<F> * __restrict y)
+void minus_core<P, F>::evaluate_H(const C<F> * __restrict x /*x, t*/, const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict y)
 {
-  eval<P,F>::Hxt_constants(x, params, y);
+  eval<P,F>::H(x, params, memo, y);
 }
 
-template <problem P, typename F>
-void minus_core<P, F>::evaluate_HxH_constants(const C<F> * __restrict x /*x, t*/, const C<F> * __restrict params, C<F> * __restrict y)
-{
-  eval<P,F>::HxH_constants(x, params, y);
-}
-
-template <problem P, typename F>
-void minus_core<P, F>::evaluate_HxH_constants_all_sols(const C<F> * __restrict x /*x, t*/, const C<F> * __restrict params, C<F> * __restrict y)
+template <problem P, typename F> template <unsigned K>
+void minus_core<P, F>::evaluate_H(const jet<C<F>,K> * __restrict x, F t, const C<F> * __restrict params, const C<F> * __restrict memo, jet<C<F>,K> * __restrict y)
 {
-  eval<P,F>::HxH_constants_all_sols(x, params, y);
+  eval<P,F>::H(x, t, params, memo, y);
 }
 
 // Internal data ---------------------------------------------------------------
@@ -26,64 +26,14 @@ namespace MiNuS {
 
 using namespace Eigen; // only used for linear solve
 
+#include "lsolve.hxx"
 #include "chicago14a-lsolve.hxx"
 
-template <problem P, typename F>
-__attribute__((always_inline)) inline void
-memoize_Hxt(C<F> __restrict *block/*, C<F> * __restrict memo*/ /* constants */)
-{
-  C<F> *const y = reinterpret_cast<C<F> *> (__builtin_assume_aligned(block,64));
-//  C<F> *const yc = reinterpret_cast<C<F> *> (__builtin_assume_aligned(memo,64));
-
-  y[11]=y[13]=y[25]=y[27]=y[39]=y[41]=y[53]=y[55]=y[67]=
-        y[68]=y[81]=y[82]=y[95]=y[96]=y[109]=y[110]=y[124]=
-        y[125]=y[138]=y[139]=y[152]=y[153]=y[166]=y[167]=
-        y[180]=y[181]=y[194]=y[195]=0;
-//  y[26]  = yc[0];
-//  y[40]  = yc[1];
-//  y[54]  = yc[2];
-//  y[69]  = yc[3];
-//  y[83]  = yc[4];
-//  y[97]  = yc[5];
-//  y[111] = yc[6];
-//  y[123] = yc[7];
-//  y[137] = yc[8];
-//  y[151] = yc[9];
-//  y[165] = yc[10];
-//  y[179] = yc[11];
-//  y[193] = yc[12];
-//  y[207] = yc[13];
-//  y[208] = yc[14];
-//  y[209] = yc[15];
-}
-
-template <problem P, typename F>
-__attribute__((always_inline)) inline void
-memoize_HxH(C<F> __restrict *block/*, C<F> * __restrict memo*/ /* constants */)
+template <problem P, typename F> void
+minus_core<P, F>::
+evaluate_constants(const C<F> params[2*f::nparams], C<F> memo[f::nconstants])
 {
-  C<F> *const y = reinterpret_cast<C<F> *> (__builtin_assume_aligned(block,64));
-//  C<F> *const yc = reinterpret_cast<C<F> *> (__builtin_assume_aligned(memo,64));
-
-  y[11]=y[13]=y[25]=y[27]=y[39]=y[41]=y[53]=y[55]=y[67]=
-        y[68]=y[81]=y[82]=y[95]=y[96]=y[109]=y[110]=y[124]=
-        y[125]=y[138]=y[139]=y[152]=y[153]=y[166]=y[167]=
-        y[180]=y[181]=y[194]=y[195]=0;
-//  y[26]  = yc[0];
-//  y[40]  = yc[1];
-//  y[54]  = yc[2];
-//  y[69]  = yc[3];
-//  y[83]  = yc[4];
-//  y[97]  = yc[5];
-//  y[111] = yc[6];
-//  y[123] = yc[7];
-//  y[137] = yc[8];
-//  y[151] = yc[9];
-//  y[165] = yc[10];
-//  y[179] = yc[11];
-//  y[193] = yc[12];
-//  y[207] = yc[13];
-//  y[208] = yc[14];
-//  y[209] = yc[15];
+  eval<P,F>::constants(params, memo);
 }
 
 // THE MEAT //////////////////////////////////////////////////////////////////////
@@ -94,20 +44,76 @@ memoize_HxH(C<F> __restrict *block/*, C<F> * __restrict memo*/ /* constants */)
 // 
 template <problem P, typename F> void 
 minus_core<P, F>::
-track(const track_settings &s, const C<F> s_sols_u[f::nve*f::nsols], const C<F> params_u[2*f::nparams], solution raw_solutions_u[f::nsols], unsigned sol_min, unsigned sol_max)
+track(const track_settings &s, const C<F> s_sols[f::nve*f::nsols], const C<F> params[2*f::nparams], solution raw_solutions[f::nsols], unsigned sol_min, unsigned sol_max)
+{
+  alignas(64) C<F> memo[f::nconstants];
+  evaluate_constants(params, memo);
+  track_memoized(s, s_sols, params, memo, raw_solutions, sol_min, sol_max);
+}
+
+// memo: parameter-only values from evaluate_constants(params, memo)
+template <problem P, typename F> void 
+minus_core<P, F>::
+track_memoized(const track_settings &s, const C<F> s_sols_u[f::nve*f::nsols], const C<F> params_u[2*f::nparams], const C<F> memo_u[f::nconstants], solution raw_solutions_u[f::nsols], unsigned sol_min, unsigned sol_max)
 {
   const C<F> *s_sols = reinterpret_cast<C<F> *> (__builtin_assume_aligned(s_sols_u,64));
   const C<F> *params = reinterpret_cast<C<F> *> (__builtin_assume_aligned(params_u,64));
+  const C<F> *memo = reinterpret_cast<C<F> *> (__builtin_assume_aligned(memo_u,64));
   solution *raw_solutions = reinterpret_cast<solution *> (__builtin_assume_aligned(raw_solutions_u,64));
   assert(sol_min <= sol_max && sol_max <= f::nsols);
+
+  solution *t_s = raw_solutions + sol_min;  // current target solution
+  const C<F>* __restrict s_s = s_sols + sol_min*f::nve;    // current start solution
+  for (unsigned sol_n = sol_min; sol_n < sol_max; ++sol_n) { // solution loop
+    memcpy(t_s->x, s_s, f::nve*sizeof(C<F>));
+    t_s->t = 0;
+    track_path(s, params, memo, t_s);
+    ++t_s; s_s += f::nve;
+  } // outer solution loop
+}
+
+// Tracks one path from (t_s->x, t_s->t) to t_end, or until it fails. Steps
+// add to t_s->num_steps, and the last point reached and the status are
+// written to *t_s. t_end < 1 must lie within the end zone. With
+// s.endgame_, a path tracked to 1 is handed over to endgame() on entry to
+// the end zone.
+template <problem P, typename F> inline void 
+minus_core<P, F>::
+track_path(const track_settings &s, const C<F> * __restrict params, const C<F> * __restrict memo, solution * __restrict t_s, F t_end)
+{
+  path_tracker p(s, params, memo, t_s, t_end);
+  p.step();
+}
+
+template <problem P, typename F>
+minus_core<P, F>::path_tracker::
+path_tracker(const track_settings &s, const C<F> *params, const C<F> *memo, solution *t_s, F t_end)
+  : tp_(0), s_(s), params_(params), memo_(memo), t_s_(t_s), t_end_(t_end), charged_(t_s->num_steps),
+    err_prev_(1), y0p_(0), sp_(0),
+    predictor_successes_(0), diverging_(0), end_zone_(false), have_prev_(false)
+{
+  t_s->status = PROCESSING;
+  minus_array<f::nve,F>::copy(t_s->x, (C<F> *) x0t0f_);
+  x0t0f_[f::nve*2] = t_s->t;
+  dxdtf_[f::nve*2] = s.init_dt_;
+}
+
+// The body of track_path(), with the state that lasts across steps loaded
+// from and stored back to the tracker.
+template <problem P, typename F> inline bool
+minus_core<P, F>::path_tracker::
+step(unsigned n)
+{
+  const track_settings &s = s_;
+  const C<F> * __restrict const params = params_, * __restrict const memo = memo_;
+  solution * __restrict const t_s = t_s_;
+  const F t_end = t_end_;
   alignas(64) C<F> Hxt[NVEPLUS1 * f::nve]; 
-  alignas(64) F x0t0f[f::nve*2+1];
   alignas(64) F xtf[f::nve*2+1];
-  alignas(64) F dxdtf[f::nve*2+1];
   alignas(64) C<F> dxi[f::nve];
-  C<F> *const x0t0 = (C<F> *) x0t0f;
+  C<F> *const x0t0 = (C<F> *) x0t0f_;
   C<F> *const xt = (C<F> *) xtf;
-  C<F> *const dxdt = (C<F> *) dxdtf;
+  C<F> *const dxdt = (C<F> *) dxdtf_;
   C<F> *const x0 = x0t0;
   F    *const t0 = (F *) (x0t0 + f::nve);
   F    *const t  = (F *) (xt + f::nve);
@@ -116,152 +122,626 @@ track(const track_settings &s, const C<F> s_sols_u[f::nve*f::nsols], const C<F>
   C<F> *const dx4 = dx;
   F    *const dt = (F *)(dxdt + f::nve);
   C<F> *const HxH=Hxt;
-  Map<Matrix<C<F>, f::nve, NVEPLUS1>,Aligned> AA((C<F> *)Hxt,f::nve,NVEPLUS1);
-  static constexpr F the_smallest_number = 1e-13; // XXX BENCHMARK THIS
+  typename lsolver<P,F>::factors lu; // of Hx, for s.chord_corrector_
   typedef minus_array<f::nve,F> v;
 
-  //  alignas(64) C<F> ycHxt[16]; 
-  //  alignas(64) C<F> ycHxH[13];
-  // memoization_init() : 
+  bool end_zone = end_zone_, to_endgame = false;
+  char predictor_successes = predictor_successes_;
+  double err, err_prev = err_prev_; // of the Cash-Karp predictor
+  alignas(64) C<F> d0[f::nve]; // Hermite: tangent at x0
+  C<F> *const dp = dp_, *const xp = xp_; // Hermite history: previous x and tangent
+  F tp = tp_;
+  bool have_prev = have_prev_;
+  double y0p = y0p_, sp = sp_; // s.early_infinity_: y0 and 1-t at the previous accepted step
+  char diverging = diverging_;
 
-  // C<F> previous[13];
-  const F &t_step = s.init_dt_;  // initial step
-  solution *t_s = raw_solutions + sol_min;  // current target solution
-  const C<F>* __restrict s_s = s_sols + sol_min*f::nve;    // current start solution
-  for (unsigned sol_n = sol_min; sol_n < sol_max; ++sol_n) { // solution loop
-    t_s->status = PROCESSING;
-    bool end_zone = false;
-    v::copy(s_s, x0);
-    *t0 = 0; *dt = t_step;
-    char predictor_successes = 0;
-
-    // track H(x,t) for t in [0,1]
-    while (likely(t_s->status == PROCESSING && 1. - *t0 > the_smallest_number)) {
-      if (unlikely(t_s->num_steps == s.max_num_steps_)) {
-        t_s->status = MAX_NUM_STEPS_FAIL; // failed to reach solution in the available step budget
+  // track H(x,t) for t in [0,t_end]
+  for (; likely(t_s->status == PROCESSING && t_end - *t0 > the_smallest_number); --n) {
+    if (unlikely(!n))
+      break;
+    if (unlikely(t_s->num_steps >= s.max_num_steps_)) {
+      t_s->status = MAX_NUM_STEPS_FAIL; // failed to reach solution in the available step budget
+      break;
+    }
+    if (unlikely(s.budget_ != nullptr)) {
+      if (t_s->num_steps - charged_ >= track_budget::check_period) {
+        s.budget_->charge(t_s->num_steps - charged_);
+        charged_ = t_s->num_steps;
+      }
+      if (s.budget_->stopped()) {
+        t_s->status = STOPPED;
+        break;
+      }
+    }
+    
+    if (unlikely(!end_zone && 1. - *t0 <= s.end_zone_factor_ + the_smallest_number)) {
+      end_zone = true; // paths that coincide are found at the endpoints, see retrack_collisions()
+      if (unlikely(s.endgame_ && t_end == 1)) {
+        to_endgame = true;
         break;
       }
-      
-      if (unlikely(!end_zone && 1. - *t0 <= s.end_zone_factor_ + the_smallest_number))
-        end_zone = true; // TODO: see if this path coincides with any other path on entry to the end zone
-      if (unlikely(end_zone)) {
-          if (unlikely(*dt > 1. - *t0)) *dt = 1 - *t0;
-      } else if (unlikely(*dt > 1. - s.end_zone_factor_ - *t0)) *dt = 1. - s.end_zone_factor_ - *t0;
-      /// PREDICTOR /// in: x0t0,dt out: dx
-      /*  top-level code for Runge-Kutta-4
-          dx1 := solveHxTimesDXequalsminusHt(x0,t0);
-          dx2 := solveHxTimesDXequalsminusHt(x0+(1/2)*dx1*dt,t0+(1/2)*dt);
-          dx3 := solveHxTimesDXequalsminusHt(x0+(1/2)*dx2*dt,t0+(1/2)*dt);
-          dx4 := solveHxTimesDXequalsminusHt(x0+dx3*dt,t0+dt);
-          (1/6)*dt*(dx1+2*dx2+2*dx3+dx4) */
-      v::fcopy(x0t0, xt);
-
-      // dx1
-      // evaluate_Hxt_constants(xt, params, ycHxt);
-      memoize_Hxt<P,F>(Hxt);/*, ycHxt);*/
-      evaluate_Hxt(xt, params, Hxt); // Outputs Hxt
-      // dx4_eigen = lu.compute(AA).solve(bb);
-      lsolve<P,F>(AA, dx4);
-      
-      // dx2
-      const F one_half_dt = *dt*0.5;
-
-      v::multiply_scalar_to_self(dx4, one_half_dt);
-
-      v::add_to_self(xt, dx4);
-      v::multiply_scalar_to_self(dx4, 2.);
-      *t += one_half_dt;  // t0+.5dt
-      evaluate_Hxt(xt, params, Hxt);
-      memoize_Hxt<P,F>(Hxt);/*, ycHxt);*/
-      lsolve<P,F>(AA, dxi);
-
-      // dx3
-      v::multiply_scalar_to_self(dxi, one_half_dt);
-      v::copy(x0t0, xt);
-      v::add_to_self(xt, dxi);
-      v::multiply_scalar_to_self(dxi, 4.);
-      v::add_to_self(dx4, dxi);
-      evaluate_Hxt(xt, params, Hxt);
-      memoize_Hxt<P,F>(Hxt);/*, ycHxt);*/
-      lsolve<P,F>(AA, dxi);
-
-      // dx4
-      v::multiply_scalar_to_self(dxi, *dt);
-      v::fcopy(x0t0, xt);
-      v::add_to_self(xt, dxi);
-      v::multiply_scalar_to_self(dxi, 2.);
-      v::add_to_self(dx4, dxi);
-      *t = *t0 + *dt;               // t0+dt
-      evaluate_Hxt(xt, params, Hxt);
-      memoize_Hxt<P,F>(Hxt);/*, ycHxt);*/
-      lsolve<P,F>(AA, dxi);
-      v::multiply_scalar_to_self(dxi, *dt);
-      v::add_to_self(dx4, dxi);
-      v::multiply_scalar_to_self(dx4, 1./6.);
-
-      // "dx1" = .5*dx1*dt, "dx2" = .5*dx2*dt, "dx3" = dx3*dt. Eigen vectorizes this:
-      // dx4_eigen = (dx4_eigen* *dt + dx1_eigen*2 + dx2_eigen*4 + dx3_eigen*2)*(1./6.);
-      
-      // make prediction
-      v::fcopy(x0t0, x1t1);
-      v::fadd_to_self((double *)x1t1, (double *)dxdt);
-
-      
-      /// CORRECTOR ///
-      char n_corr_steps = 0;
-      bool is_successful;
-      //if (t_s->num_steps ==0)
-      //evaluate_HxH_constants_all_sols(x1t1, params, ycHxH);
-      //evaluate_HxH_constants(x1t1, params, ycHxH);
-      /*
-      {
-        static std::mutex lock;
-        const std::lock_guard<std::mutex> guard(lock);
-         
-        if ( t_s->num_steps > 1)
-          for (unsigned i=0; i < 13; ++i) {
-            F err = std::norm(ycHxH[i]-previous[i]);
-            if (err > 1e-15) {
-              std::cerr << "Different " << i << " -------------------------------------------- " << err << std::endl;
-              std::cerr << "\tnow: " << ycHxH[i] << " previous: " << previous[i] << std::endl;
-            }
-          }
-        for (unsigned i=0; i < 13; ++i)
-          previous[i] = ycHxH[i];
+    }
+    if (unlikely(end_zone)) {
+        if (unlikely(*dt > t_end - *t0)) *dt = t_end - *t0;
+    } else if (unlikely(*dt > 1. - s.end_zone_factor_ - *t0)) *dt = 1. - s.end_zone_factor_ - *t0;
+    /// PREDICTOR /// in: x0t0,dt out: dx
+    if (unlikely(s.predictor_ == CASH_KARP)) {
+      err = predict_cash_karp(s, x0t0, *dt, params, memo, Hxt, x1t1);
+      if (unlikely(err > 1)) { // rejected without correcting
+        predictor_successes = 0;
+        *dt *= std::max(.2, .9*std::pow(err, -.2));
+        if (unlikely(*dt < s.min_dt_)) t_s->status = MIN_STEP_FAILED;
+        ++t_s->num_steps;
+        continue;
       }
-      */
+    } else if (unlikely(s.predictor_ == HERMITE && have_prev && !end_zone)) {
+      evaluate_Hxt(x0t0, params, memo, Hxt);
+      lsolve<P,F>(Hxt, d0);
+      // cubic Hermite on [tp, t0] through (xp, dp) and (x0, d0), at t0 + dt
+      const F h = *t0 - tp, u = 1 + *dt / h;
+      const F h00 = (2*u - 3)*u*u + 1, h10 = ((u - 2)*u + 1)*u*h, h01 = (3 - 2*u)*u*u, h11 = (u - 1)*u*u*h;
+      for (unsigned i = 0; i < f::nve; ++i)
+        x1t1[i] = h00*xp[i] + h10*dp[i] + h01*x0[i] + h11*d0[i];
+      *t = *t0 + *dt;
+    } else if (unlikely(s.predictor_ == TAYLOR)) {
+      predict_taylor(x0t0, *dt, params, memo, Hxt, x1t1);
+    } else {
+    /*  top-level code for Runge-Kutta-4
+        dx1 := solveHxTimesDXequalsminusHt(x0,t0);
+        dx2 := solveHxTimesDXequalsminusHt(x0+(1/2)*dx1*dt,t0+(1/2)*dt);
+        dx3 := solveHxTimesDXequalsminusHt(x0+(1/2)*dx2*dt,t0+(1/2)*dt);
+        dx4 := solveHxTimesDXequalsminusHt(x0+dx3*dt,t0+dt);
+        (1/6)*dt*(dx1+2*dx2+2*dx3+dx4) */
+    v::fcopy(x0t0, xt);
+
+    // dx1
+    evaluate_Hxt(xt, params, memo, Hxt); // Outputs Hxt
+    lsolve<P,F>(Hxt, dx4);
+    if (unlikely(s.predictor_ == HERMITE)) v::copy(dx4, d0);
+    
+    // dx2
+    const F one_half_dt = *dt*0.5;
+
+    v::multiply_scalar_to_self(dx4, one_half_dt);
+
+    v::add_to_self(xt, dx4);
+    v::multiply_scalar_to_self(dx4, F(2.));
+    *t += one_half_dt;  // t0+.5dt
+    evaluate_Hxt(xt, params, memo, Hxt);
+    lsolve<P,F>(Hxt, dxi);
 
-      do {
+    // dx3
+    v::multiply_scalar_to_self(dxi, one_half_dt);
+    v::copy(x0t0, xt);
+    v::add_to_self(xt, dxi);
+    v::multiply_scalar_to_self(dxi, F(4.));
+    v::add_to_self(dx4, dxi);
+    evaluate_Hxt(xt, params, memo, Hxt);
+    lsolve<P,F>(Hxt, dxi);
+
+    // dx4
+    v::multiply_scalar_to_self(dxi, *dt);
+    v::fcopy(x0t0, xt);
+    v::add_to_self(xt, dxi);
+    v::multiply_scalar_to_self(dxi, F(2.));
+    v::add_to_self(dx4, dxi);
+    *t = *t0 + *dt;               // t0+dt
+    evaluate_Hxt(xt, params, memo, Hxt);
+    lsolve<P,F>(Hxt, dxi);
+    v::multiply_scalar_to_self(dxi, *dt);
+    v::add_to_self(dx4, dxi);
+    v::multiply_scalar_to_self(dx4, F(1./6.));
+
+    // "dx1" = .5*dx1*dt, "dx2" = .5*dx2*dt, "dx3" = dx3*dt. Eigen vectorizes this:
+    // dx4_eigen = (dx4_eigen* *dt + dx1_eigen*2 + dx2_eigen*4 + dx3_eigen*2)*(1./6.);
+    
+    // make prediction
+    v::fcopy(x0t0, x1t1);
+    v::fadd_to_self((F *)x1t1, (F *)dxdt);
+    } // RK4
+
+    
+    /// CORRECTOR ///
+    char n_corr_steps = 0, n_chord_steps = 0;
+    bool is_successful, newton = true;
+    F dx2_prev;
+    do {
+      if (likely(newton)) {
         ++n_corr_steps;
-        evaluate_HxH(x1t1, params, HxH);
-        memoize_HxH<P,F>(HxH);//, ycHxH);
-        lsolve<P,F>(AA, dx);
-        v::add_to_self(x1t1, dx);
-        is_successful = v::norm2(dx) < s.epsilon2_ * v::norm2(x1t1); // |dx|^2/|x1|^2 < eps2
-      } while (likely(!is_successful && n_corr_steps < s.max_corr_steps_));
-      
-      if (unlikely(!is_successful)) { // predictor failure
-        predictor_successes = 0;
-        *dt *= s.dt_decrease_factor_;
-        if (unlikely(*dt < s.min_dt_)) t_s->status = MIN_STEP_FAILED; // slight difference to SLP-imp.hpp:612
-      } else { // predictor success
-        ++predictor_successes;
-        // std::swap(x1t1,x0t0);
-        // x0 = x0t0; t0 = (F *) (x0t0 + f::nve); xt = x1t1;
-        v::fcopy(x1t1, x0t0);
-        if (unlikely(predictor_successes >= s.num_successes_before_increase_)) {
-          predictor_successes = 0;
-          *dt *= s.dt_increase_factor_;
+        evaluate_HxH(x1t1, params, memo, HxH);
+        if (likely(!s.chord_corrector_)) lsolve<P,F>(Hxt, dx);
+        else lsolver<P,F>::solve(Hxt, &lu, dx);
+      } else { // chord step, reusing the factors of Hx
+        ++n_chord_steps;
+        evaluate_H(x1t1, params, memo, dx);
+        lsolver<P,F>::resolve(Hxt, lu, dx);
+      }
+      v::add_to_self(x1t1, dx);
+      const F dx2 = v::norm2(dx);
+      is_successful = dx2 < s.epsilon2_ * v::norm2(x1t1); // |dx|^2/|x1|^2 < eps2
+      newton = !s.chord_corrector_ || (!newton && dx2 > .25*dx2_prev); // |dx| did not halve
+      dx2_prev = dx2;
+    } while (likely(!is_successful && (newton ? n_corr_steps < s.max_corr_steps_ : n_chord_steps < s.max_corr_steps_)));
+    
+    if (unlikely(!is_successful)) { // predictor failure
+      predictor_successes = 0;
+      *dt *= s.dt_decrease_factor_;
+      if (unlikely(*dt < s.min_dt_)) t_s->status = MIN_STEP_FAILED; // slight difference to SLP-imp.hpp:612
+      have_prev = false;
+    } else { // predictor success
+      ++predictor_successes;
+      if (unlikely(s.predictor_ == HERMITE)) {
+        v::copy(x0, xp); v::copy(d0, dp); tp = *t0;
+        have_prev = true;
+      }
+      if (unlikely(s.prune_nonreal_ > 0 && end_zone)) { // endpoint extrapolated linearly from x0 and x1
+        const double r = double((1 - *t) / (*t - *t0)), thr = double(s.prune_nonreal_);
+        for (unsigned i = 0; i < f::nve; ++i) {
+          const double im = double(x1t1[i].imag()), im1 = im + r*(im - double(x0[i].imag()));
+          if (std::abs(im) > thr && std::abs(im1) > thr) { t_s->status = NONREAL_PRUNED; break; }
         }
       }
-      if (unlikely(v::norm2(x0) > s.infinity_threshold2_))
-        t_s->status = INFINITY_FAILED;
-      ++t_s->num_steps;
-    } // while (t loop)
-    memcpy(t_s, x0t0, (f::nve*2+1)*sizeof(F));
-    if (t_s->status == PROCESSING) t_s->status = REGULAR;
-    ++t_s; s_s += f::nve;
-  } // outer solution loop
+      // std::swap(x1t1,x0t0);
+      // x0 = x0t0; t0 = (F *) (x0t0 + f::nve); xt = x1t1;
+      v::fcopy(x1t1, x0t0);
+      if (unlikely(s.predictor_ == CASH_KARP)) { // PI controller, Hairer-Wanner II.4 with k = 5
+        *dt *= std::min(5., std::max(.2, .9*std::pow(err, -.7/5)*std::pow(err_prev, .4/5)));
+        err_prev = std::max(err, 1e-4);
+      } else if (unlikely(predictor_successes >= s.num_successes_before_increase_)) {
+        predictor_successes = 0;
+        *dt *= s.dt_increase_factor_;
+      }
+      if (unlikely(s.early_infinity_ && end_zone && 1 - *t0 > the_smallest_number)) {
+        // y0 ~ (1-t)^w, w need not be more accurate than double for any F
+        const double y0 = 1 / (1 + double(v::norm2(x0))), s1 = double(1 - *t0);
+        diverging = (y0p && y0*y0 * double(s.infinity_threshold2_) < 1 && std::log(y0/y0p) < .5*std::log(s1/sp)) ? 
+          diverging + 1 : 0;
+        if (unlikely(diverging >= 2)) t_s->status = INFINITY_FAILED;
+        y0p = y0; sp = s1;
+      }
+    }
+    if (unlikely(v::norm2(x0) > s.infinity_threshold2_))
+      t_s->status = INFINITY_FAILED;
+    ++t_s->num_steps;
+  } // while (t loop)
+  if (unlikely(s.budget_ != nullptr) && t_s->num_steps != charged_) {
+    s.budget_->charge(t_s->num_steps - charged_);
+    charged_ = t_s->num_steps;
+  }
+  v::copy(x0, t_s->x);
+  t_s->t = *t0;
+  if (t_s->status != PROCESSING)
+    return false;
+  if (unlikely(!to_endgame && t_end - *t0 > the_smallest_number)) { // paused
+    end_zone_ = end_zone; predictor_successes_ = predictor_successes; err_prev_ = err_prev;
+    tp_ = tp; have_prev_ = have_prev; y0p_ = y0p; sp_ = sp; diverging_ = diverging;
+    return true;
+  }
+  if (unlikely(to_endgame))
+    endgame(s, params, memo, t_s);
+  else
+    t_s->status = REGULAR;
+  return false;
+}
+
+// Cash-Karp embedded Runge-Kutta 5(4) (Cash, Karp 1990). The same six
+// stages of [Hx|Ht] solves give a 5th order prediction, which is returned in
+// x1t1, and a 4th order one, whose difference estimates the local error.
+template <problem P, typename F> double
+minus_core<P, F>::
+predict_cash_karp(const track_settings &s, const C<F> * __restrict x0t0, F dt, 
+    const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict Hxt, C<F> * __restrict x1t1)
+{
+  static constexpr double c[6] = {0, 1./5, 3./10, 3./5, 1, 7./8};
+  static constexpr double a[6][5] = {
+    {},
+    {1./5},
+    {3./40, 9./40},
+    {3./10, -9./10, 6./5},
+    {-11./54, 5./2, -70./27, 35./27},
+    {1631./55296, 175./512, 575./13824, 44275./110592, 253./4096}};
+  static constexpr double b5[6] = {37./378, 0, 250./621, 125./594, 0, 512./1771};
+  static constexpr double b4[6] = {2825./27648, 0, 18575./48384, 13525./55296, 277./14336, 1./4};
+  alignas(64) C<F> k[6][f::nve];
+  const F t0 = *(const F *) (x0t0 + f::nve);
+  F *const t1 = (F *) (x1t1 + f::nve);
+  typedef minus_array<f::nve,F> v;
+
+  for (unsigned i = 0; i < 6; ++i) {
+    v::copy(x0t0, x1t1);
+    for (unsigned j = 0; j < i; ++j) {
+      const F aij = F(a[i][j]) * dt;
+      for (unsigned n = 0; n < f::nve; ++n) x1t1[n] += aij * k[j][n];
+    }
+    *t1 = t0 + F(c[i]) * dt;
+    evaluate_Hxt(x1t1, params, memo, Hxt);
+    lsolve<P,F>(Hxt, k[i]);
+  }
+  F e2 = 0;
+  v::copy(x0t0, x1t1);
+  for (unsigned n = 0; n < f::nve; ++n) {
+    C<F> e = C<F>();
+    for (unsigned i = 0; i < 6; ++i) {
+      x1t1[n] += F(b5[i]) * dt * k[i][n];
+      e += F(b5[i] - b4[i]) * dt * k[i][n];
+    }
+    e2 += std::norm(e);
+  }
+  *t1 = t0 + dt;
+  return std::sqrt(double(e2 / (s.predictor_tolerance_ * s.predictor_tolerance_ * v::norm2(x0t0))));
+}
+
+// Order K coefficient of the Taylor series x(t0 + s) = sum_k x[k] s^k, given
+// x[0:K]. With x_K(s) the series truncated to order K-1, the coefficient of
+// s^K in H(x_K(s) + x[K] s^K, t0 + s) = 0 is [H(x_K(s), t0 + s)]_K + Hx x[K],
+// so x[K] solves Hx x[K] = [-H(x_K(s), t0 + s)]_K, reusing the factors of Hx
+// in Hxt, lu. H is evaluated on jets of order K.
+template <problem P, typename F>
+struct minus_core<P, F>::taylor_coefficient {
+  static constexpr unsigned nve = f::nve;
+  C<F> (*x)[taylor_row]; F t0;
+  const C<F> *params, *memo; C<F> *Hxt; const typename lsolver<P,F>::factors &lu;
+  template <unsigned K>
+  inline void apply()
+  {
+    jet<C<F>,K> xs[nve], y[nve];
+    for (unsigned i = 0; i < nve; ++i) {
+      for (unsigned k = 0; k < K; ++k) xs[i].c[k] = x[k][i];
+      xs[i].c[K] = C<F>();
+    }
+    evaluate_H(xs, t0, params, memo, y);
+    for (unsigned i = 0; i < nve; ++i) x[K][i] = y[i].c[K];
+    lsolver<P,F>::resolve(Hxt, lu, x[K]);
+  }
+};
+
+// Taylor series predictor (see eg Jorba, Zou 2005 for jets). x[1] = dx/dt
+// is the [Hx|Ht] solve of RK4, keeping the factors of Hx, and the higher
+// coefficients follow by taylor_coefficient. x1t1 is the Taylor polynomial
+// at dt, by Horner.
+template <problem P, typename F> void
+minus_core<P, F>::
+predict_taylor(const C<F> * __restrict x0t0, F dt, 
+    const C<F> * __restrict params, const C<F> * __restrict memo, C<F> * __restrict Hxt, C<F> * __restrict x1t1)
+{
+  alignas(64) C<F> x[taylor_order+1][taylor_row];
+  typename lsolver<P,F>::factors lu;
+  const F t0 = *(const F *) (x0t0 + f::nve);
+  typedef minus_array<f::nve,F> v;
+
+  v::copy(x0t0, x[0]);
+  evaluate_Hxt(x0t0, params, memo, Hxt);
+  lsolver<P,F>::solve(Hxt, &lu, x[1]);
+  taylor_coefficient c{x, t0, params, memo, Hxt, lu};
+  static_for<2, taylor_order+1>::run(c);
+
+  v::copy(x[taylor_order], x1t1);
+  for (unsigned k = taylor_order; k-- != 0; ) {
+    v::multiply_scalar_to_self(x1t1, dt);
+    v::add_to_self(x1t1, x[k]);
+  }
+  *(F *) (x1t1 + f::nve) = t0 + dt;
+}
+
+// Power-series endgame (Morgan, Sommese, Wampler 1992). Near t = 1 a path is
+// x(s) = x* + sum_k a_k s^(k/c), s = 1-t, for a cycle number c that is 1 at
+// a regular endpoint. The path is sampled at s_0, s_0/2, s_0/4, ..., with
+// dx/dt at each sample from the same [Hx|Ht] solve as the predictor. c is
+// estimated from the ratio of successive differences |x_k - x_k+1|, which
+// tends to 2^(-1/c). x is analytic in w = s^(1/c), so the cubic Hermite
+// interpolant in w through the last two samples extrapolates to x* at w = 0.
+// Sampling stops once two successive estimates of x* agree to the corrector
+// tolerance, after at most s.endgame_max_samples_ samples. Paths where it
+// does not converge are tracked on to t = 1 as without the endgame.
+template <problem P, typename F> void 
+minus_core<P, F>::
+endgame(const track_settings &s, const C<F> * __restrict params, const C<F> * __restrict memo, solution * __restrict t_s)
+{
+  static constexpr unsigned max_cycle_number = 8;
+  alignas(64) C<F> Hxt[NVEPLUS1 * f::nve]; 
+  alignas(64) F xtf[f::nve*2+1];
+  alignas(64) C<F> x[2][f::nve], dxdt[2][f::nve]; // last two samples
+  alignas(64) C<F> est[f::nve];
+  C<F> *const xt = (C<F> *) xtf;
+  typedef minus_array<f::nve,F> v;
+
+  track_settings segment = s; // the path between samples is tracked as usual
+  segment.endgame_ = false;
+  F s_k = 1 - t_s->t, dx2_prev = 0;
+  unsigned c = 1;
+  bool estimated = false;
+  for (unsigned k = 0; k < unsigned(s.endgame_max_samples_); ++k, s_k *= .5) {
+    if (k) {
+      track_path(segment, params, memo, t_s, 1 - s_k);
+      if (t_s->status != REGULAR) return;
+      t_s->status = PROCESSING;
+    }
+    C<F> *const xk = x[k&1], *const dk = dxdt[k&1];
+    const C<F> *const xp = x[(k+1)&1], *const dp = dxdt[(k+1)&1];
+    v::copy(t_s->x, xk);
+    v::copy(t_s->x, xt);
+    xtf[f::nve*2] = t_s->t;
+    evaluate_Hxt(xt, params, memo, Hxt);
+    lsolve<P,F>(Hxt, dk);
+    if (!k) continue;
+
+    F dx2 = 0;
+    for (unsigned i = 0; i < f::nve; ++i) dx2 += std::norm(xp[i] - xk[i]);
+    if (k >= 2) { // |x_k-1 - x_k| / |x_k-2 - x_k-1| ~ 2^(-1/c)
+      // c and the nodes need not be more accurate than double for any F
+      const double ratio = std::sqrt(double(dx2) / double(dx2_prev));
+      c = (ratio > 0 && ratio < 1) ? unsigned(std::log(.5) / std::log(ratio) + .5) : max_cycle_number;
+      c = std::max(1u, std::min(c, max_cycle_number));
+
+      // Hermite in w between w_a = (2 s_k)^(1/c) and w_b = s_k^(1/c), at w = 0
+      const double wa = std::pow(2*double(s_k), 1./c), wb = std::pow(double(s_k), 1./c);
+      const F h = wb - wa, u = wa / (wa - wb);
+      const F h00 = (2*u - 3)*u*u + 1, h10 = ((u - 2)*u + 1)*u, h01 = (3 - 2*u)*u*u, h11 = (u - 1)*u*u;
+      // dx/dw = -dx/dt c w^(c-1)
+      const F ma = -h10 * h * F(c * std::pow(wa, c - 1.)), mb = -h11 * h * F(c * std::pow(wb, c - 1.));
+      F d2 = 0, est2 = 0;
+      for (unsigned i = 0; i < f::nve; ++i) {
+        const C<F> e = h00*xp[i] + ma*dp[i] + h01*xk[i] + mb*dk[i];
+        d2 += std::norm(e - est[i]); est2 += std::norm(e);
+        est[i] = e;
+      }
+      if (estimated && d2 < s.epsilon2_ * est2) { // converged
+        v::copy(est, t_s->x);
+        t_s->t = 1;
+        t_s->cycle_number = c;
+        t_s->status = (c == 1 && refine(s, params, memo, t_s)) ? REGULAR : SINGULAR;
+        return;
+      }
+      estimated = true;
+    }
+    dx2_prev = dx2;
+  }
+  t_s->status = PROCESSING;
+  track_path(segment, params, memo, t_s);
+}
+
+// Newton's method at t = 1, the same iteration as the corrector of track()
+template <problem P, typename F> bool
+minus_core<P, F>::
+refine(const track_settings &s, const C<F> params[2*f::nparams], const C<F> memo[f::nconstants], solution *sol)
+{
+  alignas(64) C<F> HxH[NVEPLUS1 * f::nve]; 
+  alignas(64) F xtf[f::nve*2+1];
+  alignas(64) C<F> dx[f::nve];
+  C<F> *const xt = (C<F> *) xtf;
+  typedef minus_array<f::nve,F> v;
+
+  v::copy(sol->x, xt);
+  xtf[2*f::nve] = 1;
+  for (char n_corr_steps = 0; n_corr_steps < s.max_corr_steps_; ++n_corr_steps) {
+    evaluate_HxH(xt, params, memo, HxH);
+    lsolve<P,F>(HxH, dx);
+    v::add_to_self(xt, dx);
+    if (v::norm2(dx) < s.epsilon2_ * v::norm2(xt)) {
+      v::copy(xt, sol->x);
+      return true;
+    }
+  }
+  return false;
+}
+
+template <problem P, typename F> template <typename FL> void
+minus_core<P, F>::
+track_mixed(const typename minus_core<P, FL>::track_settings &sl, const track_settings &s, 
+    const C<F> s_sols[f::nve*f::nsols], const C<F> params[2*f::nparams], const C<F> memo[f::nconstants], 
+    solution raw_solutions[f::nsols], unsigned sol_min, unsigned sol_max)
+{
+  alignas(64) C<FL> params_l[2*f::nparams];
+  alignas(64) C<FL> memo_l[f::nconstants];
+  for (unsigned i = 0; i < 2*f::nparams; ++i) params_l[i] = C<FL>(params[i]);
+  for (unsigned i = 0; i < f::nconstants; ++i) memo_l[i] = C<FL>(memo[i]);
+  track_mixed<FL>(sl, s, s_sols, params, memo, params_l, memo_l, raw_solutions, sol_min, sol_max);
+}
+
+// The FL pass converts the start solution of each path as it gets to it. A
+// path FL could not finish is retracked in F from t = 0: continuing from the
+// last point FL reached was tried, and loses paths that FL had already
+// jumped or drifted off of.
+template <problem P, typename F> template <typename FL> void
+minus_core<P, F>::
+track_mixed(const typename minus_core<P, FL>::track_settings &sl, const track_settings &s, 
+    const C<F> s_sols[f::nve*f::nsols], const C<F> params[2*f::nparams], const C<F> memo[f::nconstants], 
+    const C<FL> params_l[2*f::nparams], const C<FL> memo_l[f::nconstants],
+    solution raw_solutions[f::nsols], unsigned sol_min, unsigned sol_max)
+{
+  typedef minus_core<P, FL> ML;
+  assert(sol_min <= sol_max && sol_max <= f::nsols);
+  alignas(64) C<FL> s_sol_l[f::nve];
+  alignas(64) typename ML::solution l;
+
+  for (unsigned i = sol_min; i < sol_max; ++i) {
+    for (unsigned k = 0; k < f::nve; ++k) s_sol_l[k] = C<FL>(s_sols[i*f::nve + k]);
+    l = typename ML::solution();
+    ML::track_memoized(sl, s_sol_l, params_l, memo_l, &l, 0, 1);
+
+    solution *t_s = raw_solutions + i;
+    for (unsigned k = 0; k < f::nve; ++k) t_s->x[k] = C<F>(l.x[k]);
+    t_s->t = l.t;
+    t_s->num_steps = l.num_steps;
+    t_s->status = (solution_status) l.status;
+    t_s->cycle_number = l.cycle_number;
+    if (likely(l.status == ML::REGULAR && refine(s, params, memo, t_s))
+        || l.status == ML::INFINITY_FAILED)
+      continue;
+    *t_s = solution();  // retrack in F from the start
+    memcpy(t_s->x, s_sols + i*f::nve, f::nve*sizeof(C<F>));
+    track_path(s, params, memo, t_s);
+  }
+}
+
+template <problem P, typename F> template <typename FH> unsigned
+minus_core<P, F>::
+retrack_failed(const typename minus_core<P, FH>::track_settings &sh,
+    const C<F> s_sols[f::nve*f::nsols], const C<F> params[2*f::nparams], 
+    solution raw_solutions[f::nsols], unsigned sol_min, unsigned sol_max, unsigned max_paths, track_budget *budget)
+{
+  typedef minus_core<P, FH> MH;
+  assert(sol_min <= sol_max && sol_max <= f::nsols);
+  unsigned n = 0;
+  for (unsigned i = sol_min; i < sol_max && n < max_paths; ++i)
+    if (raw_solutions[i].status == MIN_STEP_FAILED || raw_solutions[i].status == MAX_NUM_STEPS_FAIL) {
+      raw_solutions[i].status = INCREASE_PRECISION;
+      ++n;
+    }
+  if (likely(!n))
+    return 0;
+
+  alignas(64) C<FH> params_h[2*f::nparams];
+  alignas(64) C<FH> memo_h[f::nconstants];
+  alignas(64) C<FH> s_sol_h[f::nve];
+  alignas(64) typename MH::solution sol_h;
+  for (unsigned i = 0; i < 2*f::nparams; ++i) params_h[i] = C<FH>(params[i].real(), params[i].imag());
+  MH::evaluate_constants(params_h, memo_h);
+
+  for (unsigned i = sol_min; i < sol_max; ++i) {
+    solution *t_s = raw_solutions + i;
+    if (t_s->status != INCREASE_PRECISION) continue;
+    if (budget && budget->charge(0)) { t_s->status = STOPPED; continue; }
+    for (unsigned k = 0; k < f::nve; ++k) s_sol_h[k] = C<FH>(s_sols[i*f::nve + k].real(), s_sols[i*f::nve + k].imag());
+    sol_h = typename MH::solution();
+    MH::track_memoized(sh, s_sol_h, params_h, memo_h, &sol_h, 0, 1);
+    for (unsigned k = 0; k < f::nve; ++k) t_s->x[k] = C<F>(F(sol_h.x[k].real()), F(sol_h.x[k].imag()));
+    t_s->t = F(sol_h.t);
+    t_s->num_steps = sol_h.num_steps;
+    t_s->status = (solution_status) sol_h.status;
+    t_s->cycle_number = sol_h.cycle_number;
+  }
+  return n;
+}
+
+// Whether the REGULAR endpoint of path i coincides with that of any other
+// REGULAR path in [sol_min, sol_max), as in retrack_collisions()
+template <problem P, typename F> bool
+minus_core<P, F>::
+coincides(const track_settings &s, const solution raw_solutions[f::nsols], unsigned sol_min, unsigned sol_max, unsigned i)
+{
+  typedef minus_array<f::nve,F> v;
+  const F tol2 = 100*s.epsilon2_*v::norm2(raw_solutions[i].x);
+  for (unsigned j = sol_min; j < sol_max; ++j) {
+    if (j == i || raw_solutions[j].status != REGULAR) continue;
+    F d2 = 0;
+    for (unsigned k = 0; k < f::nve; ++k) d2 += std::norm(raw_solutions[i].x[k] - raw_solutions[j].x[k]);
+    if (d2 < tol2) return true;
+  }
+  return false;
+}
+
+// Gamma trick (Morgan, Sommese 1987): for generic complex params, the
+// homotopy is singular at only finitely many points of the complex t plane.
+// A path that fails near one of them, or on its way to infinity, usually
+// gets through along another route to the same target. The route here is
+// p0 -> pm -> p1, pm = p0 + c (p1 - p0), for c random on the circle through
+// 0 and 1 centered at 1/2, ie the segment p0 -> p1 bent off into the
+// complex plane. Each round draws a new c and retracks every path still
+// failing, from its start solution, until the budget is spent. A detour
+// that ends on a solution some other path already reached jumped paths
+// along the way, and counts as failed.
+template <problem P, typename F> unsigned
+minus_core<P, F>::
+retrack_detour(const track_settings &s,
+    const C<F> s_sols[f::nve*f::nsols], const C<F> params[2*f::nparams],
+    solution raw_solutions[f::nsols], unsigned sol_min, unsigned sol_max, unsigned *discarded_steps)
+{
+  assert(sol_min <= sol_max && sol_max <= f::nsols);
+  auto failed = [](const solution &sol) { return sol.status == MIN_STEP_FAILED || 
+    sol.status == INFINITY_FAILED || sol.status == MAX_NUM_STEPS_FAIL; };
+  alignas(64) C<F> params_a[2*f::nparams], params_b[2*f::nparams]; // p0 -> pm, pm -> p1
+  alignas(64) C<F> memo_a[f::nconstants], memo_b[f::nconstants];
+  unsigned budget = s.detour_budget_, recovered = 0;
+
+  while (budget && std::any_of(raw_solutions + sol_min, raw_solutions + sol_max, failed)) {
+    C<F> c;
+    minus_util<F>::randc(&c);
+    c = F(.5)*(F(1) + c);
+    for (unsigned i = 0; i < f::nparams; ++i) {
+      params_a[i] = params[i];
+      params_a[f::nparams + i] = params_b[i] = params[i] + c*(params[f::nparams + i] - params[i]);
+      params_b[f::nparams + i] = params[f::nparams + i];
+    }
+    evaluate_constants(params_a, memo_a);
+    evaluate_constants(params_b, memo_b);
+    for (unsigned i = sol_min; i < sol_max && budget; ++i) {
+      solution *t_s = raw_solutions + i;
+      if (!failed(*t_s)) continue;
+      --budget;
+      const solution_status status = t_s->status;
+      if (discarded_steps) *discarded_steps += t_s->num_steps;
+      *t_s = solution();
+      memcpy(t_s->x, s_sols + i*f::nve, f::nve*sizeof(C<F>));
+      track_path(s, params_a, memo_a, t_s);
+      if (t_s->status != REGULAR) continue;
+      t_s->t = 0;
+      track_path(s, params_b, memo_b, t_s);
+      if (t_s->status != REGULAR) continue;
+      if (unlikely(coincides(s, raw_solutions, sol_min, sol_max, i)))
+        t_s->status = status; // jumped onto a solution already found: still failing
+      else
+        ++recovered;
+    }
+  }
+  return recovered;
+}
+
+// The REGULAR endpoints are sorted on Re x[0], so that coinciding ones are
+// found among neighbours whose Re x[0] are within the tolerance, in
+// O(n log n) rather than comparing all pairs. Every path of a group of
+// coinciding endpoints is retracked, as there is no telling which one stayed
+// on its own path.
+template <problem P, typename F> unsigned
+minus_core<P, F>::
+retrack_collisions(const track_settings &s, const track_settings &st,
+    const C<F> s_sols[f::nve*f::nsols], const C<F> params[2*f::nparams], const C<F> memo[f::nconstants],
+    solution raw_solutions[f::nsols], unsigned sol_min, unsigned sol_max)
+{
+  typedef minus_array<f::nve,F> v;
+  assert(sol_min <= sol_max && sol_max <= f::nsols);
+  unsigned idx[f::nsols], n = 0;
+  uint64_t key[f::nsols];
+  bool collides[f::nsols] = { };
+  F max_norm2 = 0;
+  for (unsigned i = sol_min; i < sol_max; ++i)
+    if (raw_solutions[i].status == REGULAR) {
+      idx[n++] = i;
+      max_norm2 = std::max(max_norm2, v::norm2(raw_solutions[i].x));
+      // the bits of Re x[0] as an integer in the same order. Unlike
+      // comparing Fs, this is a total order even with a NaN endpoint, which
+      // -ffast-math lets through, and would send std::sort out of bounds
+      const double k = double(raw_solutions[i].x[0].real());
+      uint64_t b; memcpy(&b, &k, sizeof(b));
+      key[i - sol_min] = b >> 63 ? ~b : b | uint64_t(1) << 63;
+    }
+  std::sort(idx, idx + n, [&key, sol_min](unsigned a, unsigned b) { return key[a - sol_min] < key[b - sol_min]; });
+
+  const F tol2 = 100*s.epsilon2_, window = std::sqrt(tol2*max_norm2);
+  unsigned nc = 0;
+  for (unsigned a = 0; a < n; ++a) {
+    const solution &sa = raw_solutions[idx[a]];
+    for (unsigned b = a + 1; b < n && raw_solutions[idx[b]].x[0].real() - sa.x[0].real() <= window; ++b) {
+      const solution &sb = raw_solutions[idx[b]];
+      F d2 = 0;
+      for (unsigned k = 0; k < f::nve; ++k) d2 += std::norm(sa.x[k] - sb.x[k]);
+      if (d2 < tol2 * v::norm2(sa.x)) {
+        nc += !collides[idx[a] - sol_min] + !collides[idx[b] - sol_min];
+        collides[idx[a] - sol_min] = collides[idx[b] - sol_min] = true;
+      }
+    }
+  }
+  if (likely(!nc))
+    return 0;
+
+  for (unsigned i = sol_min; i < sol_max; ++i) {
+    if (!collides[i - sol_min]) continue;
+    solution *t_s = raw_solutions + i;
+    *t_s = solution();
+    memcpy(t_s->x, s_sols + i*f::nve, f::nve*sizeof(C<F>));
+    track_path(st, params, memo, t_s);
+  }
+  return nc;
 }
 
 // I/O Base functions ----------------------------------------------------------
@@ -325,7 +805,8 @@ all_solutions2cams(solution raw_solutions[M::nsols], F cameras[M::nsols][2][4][3
     F real_solution[M::nve];
     if (raw_solutions[sol].status == M::REGULAR && v::get_real(raw_solutions[sol].x, real_solution)) {
       id_sols[(*nsols_final)++] = sol;
-      // build cams by using quat2rotm
+      // build cams by using quat2rotm, which only rescales the quaternion
+      // each chart picked (see pChart in chicago14a.h)
       solution2cams(real_solution, (F (*)[4][3] ) (cameras + sol));
     }
   }
@@ -29,6 +29,164 @@ struct minus <P, F> {
       unsigned id_sols[M::nsols],
       unsigned *nsols_final,
       unsigned nthreads=4);
+
+  // Same as the above, but tracking on the parked workers of pool instead of
+  // spawning threads at each call. Use one pool for many solves.
+  static bool solve(
+      const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+      const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+      F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]^t
+      unsigned id_sols[M::nsols],
+      unsigned *nsols_final,
+      minus_thread_pool &pool);
+
+  static bool solve_img(
+      const F K[/*3 or 2 ignoring last line*/][io::ncoords2d_h],
+      const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+      const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+      F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]^t
+      unsigned id_sols[M::nsols],
+      unsigned *nsols_final,
+      minus_thread_pool &pool);
+
+  // Same as solve(), within a budget of steps and/or a deadline shared by all
+  // threads, eg M::track_budget(5000) or M::track_budget(LONG_MAX,
+  // M::track_budget::clock::now() + std::chrono::milliseconds(2)). Paths not
+  // finished in time end with status M::STOPPED, and the real solutions found
+  // by then are returned. Once out of budget, the retracking passes are
+  // skipped. Returns false if there is none.
+  static bool solve(
+      const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+      const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+      F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]^t
+      unsigned id_sols[M::nsols],
+      unsigned *nsols_final,
+      typename M::track_budget &budget,
+      unsigned nthreads=4);
+
+  static bool solve(
+      const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+      const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+      F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]^t
+      unsigned id_sols[M::nsols],
+      unsigned *nsols_final,
+      typename M::track_budget &budget,
+      minus_thread_pool &pool);
+
+  // Same as solve(), but with the best conditioned two of the three
+  // tangents instead of always the first two: the three pairs are ranked by
+  // the score of io::point_tangents2lines, and solved in that order until one
+  // yields real solutions. *id_tgt, if given, receives the index 0..2 of the
+  // tangent left out.
+  static bool solve_best_tangents(
+      const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+      const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+      F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]^t
+      unsigned id_sols[M::nsols],
+      unsigned *nsols_final,
+      unsigned nthreads=4,
+      unsigned *id_tgt=nullptr);
+
+  static bool solve_best_tangents(
+      const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+      const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+      F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]^t
+      unsigned id_sols[M::nsols],
+      unsigned *nsols_final,
+      minus_thread_pool &pool,
+      unsigned *id_tgt=nullptr);
+
+  // Early exit: publishes each real REGULAR endpoint as soon as its path is
+  // tracked, and stops once k of them satisfied accept (eg, reprojection on a
+  // few held-out correspondences). Paths already being tracked finish, the
+  // others are not tracked. order, if given, is the order in which to track
+  // the paths, as in M::path_scheduler. Output is as with solve(), with only
+  // the accepted solutions. accept may be called concurrently from all
+  // tracking threads. Returns false if none was accepted.
+  typedef std::function<bool(const F cams[pp::nviews-1][4][3])> acceptor;
+  static bool solve_first(
+      unsigned k, const acceptor &accept,
+      const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+      const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+      F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]^t
+      unsigned id_sols[M::nsols],
+      unsigned *nsols_final,
+      unsigned nthreads=4,
+      const unsigned short *order=nullptr);
+
+  static bool solve_first(
+      unsigned k, const acceptor &accept,
+      const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+      const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+      F solutions_cams[M::nsols][pp::nviews-1][4][3],  // first camera is always [I | 0]^t
+      unsigned id_sols[M::nsols],
+      unsigned *nsols_final,
+      minus_thread_pool &pool,
+      const unsigned short *order=nullptr);
+
+  // Video: tracks only the chosen solutions prev_solutions[0..k) of the
+  // previous frame, from its problem prev_params to the problem new_params of
+  // the next frame, into solutions[0..k): k paths instead of M::nsols. The
+  // params are as lines2params writes them from the output of
+  // point_tangents2lines, not gammified, and are tracked as they are: the same
+  // gammas at both ends would only rescale the equations, and different ones
+  // would lengthen the path, which is short when the frames are close. When
+  // none of the k paths ends at a real REGULAR solution, falls back to
+  // tracking all paths to new_params from the start system, gammified as
+  // solve() does, into solutions; k = 0 always does, eg for the first frame.
+  // Returns the number of solutions written: k, or M::nsols after a
+  // fallback, 0 if that failed too.
+  static unsigned continue_from(
+      const C<F> prev_params[M::f::nparams],
+      const typename M::solution prev_solutions[],
+      unsigned k,
+      const C<F> new_params[M::f::nparams],
+      typename M::solution solutions[M::nsols],
+      unsigned nthreads=4);
+
+  private:
+  // tracks all paths from the start system to params[M::f::nparams..) into
+  // solutions, with the retracking passes of solve(). false if no real
+  // solution was found, unless out of budget.
+  static bool solve_params(
+      const C<F> params[2*M::f::nparams],
+      typename M::solution solutions[M::nsols],
+      unsigned nthreads,
+      minus_thread_pool *pool,
+      typename M::track_budget *budget);
+
+  static bool solve_first(
+      unsigned k, const acceptor &accept,
+      const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+      const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+      F solutions_cams[M::nsols][pp::nviews-1][4][3],
+      unsigned id_sols[M::nsols],
+      unsigned *nsols_final,
+      unsigned nthreads,
+      minus_thread_pool *pool,
+      const unsigned short *order);
+
+  static bool solve_best_tangents(
+      const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+      const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+      F solutions_cams[M::nsols][pp::nviews-1][4][3],
+      unsigned id_sols[M::nsols],
+      unsigned *nsols_final,
+      unsigned nthreads,
+      minus_thread_pool *pool,
+      unsigned *id_tgt);
+
+  // common body of the solve() overloads: tracks on pool if given, otherwise
+  // on nthreads freshly spawned threads, within budget if given
+  static bool solve(
+      const F p[pp::nviews][pp::npoints][io::ncoords2d], 
+      const F tgt[pp::nviews][pp::npoints][io::ncoords2d], 
+      F solutions_cams[M::nsols][pp::nviews-1][4][3],
+      unsigned id_sols[M::nsols],
+      unsigned *nsols_final,
+      unsigned nthreads,
+      minus_thread_pool *pool,
+      typename M::track_budget *budget);
 };
 #undef P
 #define P cleveland14a
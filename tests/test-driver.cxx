@@ -4,6 +4,7 @@ DECLARE( test_minus );
 DECLARE( test_minus_cleveland );
 DECLARE( test_internals );
 DECLARE( test_internals_cleveland );
+DECLARE( test_tracker );
 
 void
 register_tests()
@@ -12,6 +13,7 @@ register_tests()
   REGISTER( test_minus_cleveland );
   REGISTER( test_internals );
   REGISTER( test_internals_cleveland );
+  REGISTER( test_tracker );
 }
 
 DEFINE_MAIN;
@@ -0,0 +1,210 @@
+//
+// \author Ricardo Fabbri
+// \date October 2026
+//
+// Regression tests of the path tracker and its scheduling: resumable
+// path_tracker, path_scheduler, track_budget, solve_first(), continue_from()
+// and the cap of retrack_failed()
+//
+// This tests using minus.hxx directly, for the member templates
+//
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <testlib/testlib_test.h>
+#include <minus/minus.hxx>
+#include <minus/chicago14a.hxx>
+#include <minus/debug-common.h>
+#include <minus/chicago14a-io.h>
+#include <minus/chicago-default.h>
+#include "test-common.h"
+
+using namespace MiNuS;
+typedef minus<chicago14a, Float> S;
+
+// step(n) in pieces must end every path exactly as one uninterrupted run
+static void
+test_path_tracker_resume()
+{
+  static M::solution whole[M::nsols], pieces[M::nsols];
+  alignas(64) complex memo[M::f::nconstants];
+  M::evaluate_constants(data::params_, memo);
+  M::track_memoized(M::DEFAULT, data::start_sols_, data::params_, memo, whole, 0, M::nsols);
+
+  unsigned mismatches = 0, max_rounds = 0;
+  for (unsigned i = 0; i < M::nsols; ++i) {
+    memcpy(pieces[i].x, data::start_sols_ + i*M::nve, sizeof(pieces[i].x));
+    M::path_tracker tr(M::DEFAULT, data::params_, memo, pieces + i);
+    unsigned rounds = 1;
+    while (tr.step(5))
+      ++rounds;
+    if (rounds > max_rounds) max_rounds = rounds;
+    if (whole[i].status != pieces[i].status || whole[i].num_steps != pieces[i].num_steps
+        || whole[i].t != pieces[i].t || memcmp(whole[i].x, pieces[i].x, sizeof(whole[i].x)))
+      ++mismatches;
+  }
+  TEST("Paths were actually paused", max_rounds > 1, true);
+  TEST("step(5) until done matches track_memoized()", mismatches, 0);
+}
+
+// every path is handed out exactly once, with or without an order
+static void
+test_path_scheduler()
+{
+  unsigned short order[M::nsols];
+  for (unsigned i = 0; i < M::nsols; ++i) order[i] = M::nsols - 1 - i;
+
+  for (unsigned chunk : {1u, 2u, 7u}) {
+    for (const unsigned short *o : {(const unsigned short *) nullptr, (const unsigned short *) order}) {
+      M::path_scheduler sch(0, M::nsols, chunk, o);
+      std::vector<unsigned> claimed(M::nsols, 0);
+      unsigned b, e, first = M::nsols;
+      bool in_range = true;
+      while (sch.claim(&b, &e)) {
+        in_range = in_range && b < e && e <= M::nsols && e - b <= chunk;
+        for (unsigned k = b; k < e; ++k) {
+          if (first == M::nsols) first = sch.path(k);
+          ++claimed[sch.path(k)];
+        }
+      }
+      unsigned once = 0;
+      for (unsigned c : claimed) once += c == 1;
+      TEST("Claims are chunks within range", in_range, true);
+      TEST("Each path claimed exactly once", once, M::nsols);
+      TEST("Order is followed", first, o ? M::nsols - 1u : 0u);
+    }
+  }
+  M::path_scheduler sch(0, M::nsols, 2);
+  unsigned b, e;
+  sch.claim(&b, &e);
+  sch.cancel();
+  TEST("No claim after cancel()", sch.claim(&b, &e), false);
+}
+
+// a small step budget stops the solve, and is charged the steps taken
+static void
+test_track_budget()
+{
+  static Float cams[M::nsols][2][4][3];
+  unsigned ids[M::nsols], nsols_final = 0;
+
+  M::track_budget budget(500);
+  S::solve(data::p_, data::tgt_, cams, ids, &nsols_final, budget, 1);
+  TEST("Budget of 500 steps runs out", budget.stopped(), true);
+  TEST("Steps left", budget.steps_.load() <= 0, true);
+
+  M::track_budget unlimited;
+  bool ok = S::solve(data::p_, data::tgt_, cams, ids, &nsols_final, unlimited, 1);
+  TEST("Unlimited budget solves", ok && nsols_final > 0, true);
+  TEST("Unlimited budget does not stop", unlimited.stopped(), false);
+}
+
+// rotation part of a camera [R | T]^t is orthonormal
+static bool
+is_rotation(const Float cam[4][3])
+{
+  for (unsigned i = 0; i < 3; ++i)
+    for (unsigned j = 0; j < 3; ++j) {
+      Float d = 0;
+      for (unsigned k = 0; k < 3; ++k) d += cam[i][k]*cam[j][k];
+      if (std::abs(d - (i == j)) > eps_) return false;
+    }
+  return true;
+}
+
+// solve_first(k) returns k distinct, real solutions, all accepted
+static void
+test_solve_first()
+{
+  static Float cams[M::nsols][2][4][3];
+  unsigned ids[M::nsols], nsols_final = 0;
+  for (unsigned k : {1u, 2u, 3u}) {
+    unsigned calls = 0;
+    bool ok = S::solve_first(k, [&](const Float [2][4][3]) { ++calls; return true; },
+        data::p_, data::tgt_, cams, ids, &nsols_final, 1);
+    TEST("solve_first() succeeds", ok, true);
+    TEST("solve_first(k) returns k solutions", nsols_final, k);
+    TEST("Every solution was accepted", calls, k);
+    bool valid = true;
+    for (unsigned i = 0; i < nsols_final; ++i) {
+      valid = valid && ids[i] < M::nsols && is_rotation(cams[ids[i]][0]) && is_rotation(cams[ids[i]][1]);
+      for (unsigned j = 0; j < i; ++j) valid = valid && ids[i] != ids[j];
+    }
+    TEST("Solutions are distinct cameras", valid, true);
+  }
+  // with an order, the first paths to track are those of the order
+  unsigned short order[M::nsols];
+  for (unsigned i = 0; i < M::nsols; ++i) order[i] = M::nsols - 1 - i;
+  unsigned calls = 0;
+  S::solve_first(1, [&](const Float [2][4][3]) { return ++calls > 1; },
+      data::p_, data::tgt_, cams, ids, &nsols_final, 1, order);
+  TEST("Rejected solutions are not returned", nsols_final, 1);
+  TEST("Rejections are counted", calls, 2);
+}
+
+// continue_from() the ground truth solution to the same params stays there
+static void
+test_continue_from()
+{
+  static M::solution sols[M::nsols], next[M::nsols];
+  alignas(64) complex params[M::f::nparams];
+  Float pn[io::pp::nviews][io::pp::npoints][io::ncoords2d];
+  Float tn[io::pp::nviews][io::pp::npoints][io::ncoords2d];
+  Float lines[io::pp::nvislines][io::ncoords2d_h];
+  for (unsigned v = 0; v < io::pp::nviews; ++v) {
+    io::invert_intrinsics(data::K_, data::p_[v], pn[v], io::pp::npoints);
+    io::invert_intrinsics_tgt(data::K_, data::tgt_[v], tn[v], io::pp::npoints);
+  }
+  io::point_tangents2lines(pn, tn, 0, 1, lines);
+  io::lines2params(lines, params);
+
+  unsigned n = S::continue_from(nullptr, nullptr, 0, params, sols, 1);
+  TEST("continue_from() with k = 0 tracks all paths", n, M::nsols);
+  Float gt[M::nve];
+  unsigned id = 0;
+  io14::RC_to_QT_format(data::cameras_gt_, gt);
+  bool found = io::probe_all_solutions(sols, gt, &id);
+  TEST("Ground truth found", found, true);
+  if (!found) return;
+
+  n = S::continue_from(params, sols + id, 1, params, next, 1);
+  TEST("continue_from() one path", n, 1);
+  TEST("Continued path is REGULAR", next[0].status, M::REGULAR);
+  Float d2 = 0;
+  for (unsigned k = 0; k < M::nve; ++k) d2 += std::norm(next[0].x[k] - sols[id].x[k]);
+  TEST_NEAR("Continued path stays at the solution", d2, 0, eps_*eps_);
+}
+
+// retrack_failed() retracks at most max_paths, and none once out of budget
+static void
+test_retrack_failed_cap()
+{
+  static M::solution sols[M::nsols];
+  alignas(64) complex memo[M::f::nconstants];
+  M::evaluate_constants(data::params_, memo);
+  M::track_memoized(M::DEFAULT, data::start_sols_, data::params_, memo, sols, 0, 8);
+  for (unsigned i = 0; i < 3; ++i) sols[i].status = M::MIN_STEP_FAILED;
+
+  unsigned n = M::retrack_failed<Float>(M::DEFAULT, data::start_sols_, data::params_, sols, 0, 8, 2);
+  TEST("Retracks at most max_paths", n, 2);
+  TEST("Path beyond the cap is left failed", sols[2].status, M::MIN_STEP_FAILED);
+  TEST("Retracked paths end", sols[0].status != M::INCREASE_PRECISION && sols[1].status != M::INCREASE_PRECISION, true);
+
+  M::track_budget spent(0);
+  spent.charge(0);
+  M::retrack_failed<Float>(M::DEFAULT, data::start_sols_, data::params_, sols, 2, 3, 1, &spent);
+  TEST("Out of budget, the path is STOPPED", sols[2].status, M::STOPPED);
+}
+
+void
+test_tracker()
+{
+  test_path_tracker_resume();
+  test_path_scheduler();
+  test_track_budget();
+  test_solve_first();
+  test_continue_from();
+  test_retrack_failed_cap();
+}
+
+TESTMAIN(test_tracker);